@@ -14,6 +14,8 @@
 #if !defined(ALGORITHM_HPP)
 #define ALGORITHM_HPP
 
+#include "iterator.hpp"
+
 namespace ft {
 /**
  * @brief Test whether the elements in two ranges are equal
@@ -133,6 +135,401 @@ bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
   return (first2 != last2);
 };
 
+/**
+ * @brief Return iterator to lower bound
+ * Returns an iterator pointing to the first element in the range [first,last)
+ * which does not compare less than val.
+ *
+ * @param first Forward iterators to the initial and final positions of a
+ * sorted (or properly partitioned) sequence.
+ * @param last Forward iterators to the initial and final positions of a
+ * sorted (or properly partitioned) sequence.
+ * @param val Value of the lower bound to search for in the range.
+ */
+template < class ForwardIterator, class T >
+ForwardIterator lower_bound(ForwardIterator first, ForwardIterator last,
+                            const T& val) {
+  typename iterator_traits< ForwardIterator >::difference_type count, step;
+  count = ft::distance(first, last);
+  while (count > 0) {
+    ForwardIterator it = first;
+    step = count / 2;
+    ft::advance(it, step);
+    if (*it < val) {
+      first = ++it;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return first;
+};
+
+/**
+ * @brief Return iterator to lower bound
+ * Returns an iterator pointing to the first element in the range [first,last)
+ * which does not compare less than val.
+ *
+ * @param comp Binary function that accepts two arguments (the first of the
+ * type pointed by ForwardIterator, and the second, always val), and returns a
+ * value convertible to bool.
+ */
+template < class ForwardIterator, class T, class Compare >
+ForwardIterator lower_bound(ForwardIterator first, ForwardIterator last,
+                            const T& val, Compare comp) {
+  typename iterator_traits< ForwardIterator >::difference_type count, step;
+  count = ft::distance(first, last);
+  while (count > 0) {
+    ForwardIterator it = first;
+    step = count / 2;
+    ft::advance(it, step);
+    if (comp(*it, val)) {
+      first = ++it;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return first;
+};
+
+/**
+ * @brief Return iterator to upper bound
+ * Returns an iterator pointing to the first element in the range [first,last)
+ * which compares greater than val.
+ *
+ * @param first Forward iterators to the initial and final positions of a
+ * sorted (or properly partitioned) sequence.
+ * @param last Forward iterators to the initial and final positions of a
+ * sorted (or properly partitioned) sequence.
+ * @param val Value of the upper bound to search for in the range.
+ */
+template < class ForwardIterator, class T >
+ForwardIterator upper_bound(ForwardIterator first, ForwardIterator last,
+                            const T& val) {
+  typename iterator_traits< ForwardIterator >::difference_type count, step;
+  count = ft::distance(first, last);
+  while (count > 0) {
+    ForwardIterator it = first;
+    step = count / 2;
+    ft::advance(it, step);
+    if (!(val < *it)) {
+      first = ++it;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return first;
+};
+
+/**
+ * @brief Return iterator to upper bound
+ * Returns an iterator pointing to the first element in the range [first,last)
+ * which compares greater than val.
+ *
+ * @param comp Binary function that accepts two arguments (the first is always
+ * val, and the second of the type pointed by ForwardIterator), and returns a
+ * value convertible to bool.
+ */
+template < class ForwardIterator, class T, class Compare >
+ForwardIterator upper_bound(ForwardIterator first, ForwardIterator last,
+                            const T& val, Compare comp) {
+  typename iterator_traits< ForwardIterator >::difference_type count, step;
+  count = ft::distance(first, last);
+  while (count > 0) {
+    ForwardIterator it = first;
+    step = count / 2;
+    ft::advance(it, step);
+    if (!comp(val, *it)) {
+      first = ++it;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return first;
+};
+
+/**
+ * @brief Check whether range is sorted
+ * Returns true if the range [first,last) is sorted into ascending order.
+ */
+template < class ForwardIterator >
+bool is_sorted(ForwardIterator first, ForwardIterator last) {
+  if (first == last) return true;
+  ForwardIterator next = first;
+  while (++next != last) {
+    if (*next < *first) return false;
+    ++first;
+  }
+  return true;
+};
+
+/**
+ * @brief Check whether range is sorted
+ * Returns true if the range [first,last) is sorted according to comp.
+ */
+template < class ForwardIterator, class Compare >
+bool is_sorted(ForwardIterator first, ForwardIterator last, Compare comp) {
+  if (first == last) return true;
+  ForwardIterator next = first;
+  while (++next != last) {
+    if (comp(*next, *first)) return false;
+    ++first;
+  }
+  return true;
+};
+
+/**
+ * @brief Default ordering of the heap functions taking no comp.
+ */
+struct _operator_less {
+  template < class T >
+  bool operator()(const T& a, const T& b) const {
+    return a < b;
+  };
+};
+
+/**
+ * @brief Move value up from hole in the Arity-ary heap at first until its
+ * parent does not compare less. Parents are shifted down into the hole
+ * instead of swapped, so each level costs one move.
+ */
+template < std::size_t Arity, class RandomAccessIterator, class Distance,
+           class T, class Compare >
+void _heap_sift_up(RandomAccessIterator first, Distance hole, T value,
+                   Compare comp) {
+  while (hole > 0) {
+    Distance parent = (hole - 1) / static_cast< Distance >(Arity);
+    if (!comp(*(first + parent), value)) break;
+    *(first + hole) = *(first + parent);
+    hole = parent;
+  }
+  *(first + hole) = value;
+};
+
+/**
+ * @brief Move value down from hole in the Arity-ary heap [first, first+len)
+ * until no child compares greater. The Arity children of a node are
+ * adjacent, so a wider heap trades more compares per level for fewer levels
+ * and fewer cache lines touched.
+ */
+template < std::size_t Arity, class RandomAccessIterator, class Distance,
+           class T, class Compare >
+void _heap_sift_down(RandomAccessIterator first, Distance hole, Distance len,
+                     T value, Compare comp) {
+  const Distance arity = static_cast< Distance >(Arity);
+  for (;;) {
+    Distance child = hole * arity + 1;
+    if (child >= len) break;
+    Distance best = child;
+    if (len - child >= arity) {
+      // a full group: a constant trip count the compiler can unroll
+      for (std::size_t k = 1; k < Arity; ++k) {
+        Distance next = child + Distance(k);
+        best = comp(*(first + best), *(first + next)) ? next : best;
+      }
+    } else {
+      for (++child; child < len; ++child) {
+        if (comp(*(first + best), *(first + child))) best = child;
+      }
+    }
+    if (!comp(value, *(first + best))) break;
+    *(first + hole) = *(first + best);
+    hole = best;
+  }
+  *(first + hole) = value;
+};
+
+/**
+ * @brief Floyd's bottom-up build of an Arity-ary heap, O(n).
+ */
+template < std::size_t Arity, class RandomAccessIterator, class Compare >
+void _heap_make(RandomAccessIterator first, RandomAccessIterator last,
+                Compare comp) {
+  typedef typename iterator_traits< RandomAccessIterator >::difference_type
+      distance_type;
+  typedef typename iterator_traits< RandomAccessIterator >::value_type
+      value_type;
+  distance_type len = last - first;
+  if (len < 2) return;
+  for (distance_type parent = (len - 2) / static_cast< distance_type >(Arity);
+       parent >= 0; --parent) {
+    value_type value = *(first + parent);
+    ft::_heap_sift_down< Arity >(first, parent, len, value, comp);
+  }
+};
+
+template < std::size_t Arity, class RandomAccessIterator, class Compare >
+void _heap_push(RandomAccessIterator first, RandomAccessIterator last,
+                Compare comp) {
+  typedef typename iterator_traits< RandomAccessIterator >::difference_type
+      distance_type;
+  typedef typename iterator_traits< RandomAccessIterator >::value_type
+      value_type;
+  distance_type len = last - first;
+  if (len < 2) return;
+  value_type value = *(last - 1);
+  ft::_heap_sift_up< Arity >(first, len - 1, value, comp);
+};
+
+template < std::size_t Arity, class RandomAccessIterator, class Compare >
+void _heap_pop(RandomAccessIterator first, RandomAccessIterator last,
+               Compare comp) {
+  typedef typename iterator_traits< RandomAccessIterator >::difference_type
+      distance_type;
+  typedef typename iterator_traits< RandomAccessIterator >::value_type
+      value_type;
+  distance_type len = last - first;
+  if (len < 2) return;
+  value_type value = *(last - 1);
+  *(last - 1) = *first;
+  ft::_heap_sift_down< Arity >(first, distance_type(0), len - 1, value, comp);
+};
+
+template < std::size_t Arity, class RandomAccessIterator, class Compare >
+bool _heap_is_heap(RandomAccessIterator first, RandomAccessIterator last,
+                   Compare comp) {
+  typedef typename iterator_traits< RandomAccessIterator >::difference_type
+      distance_type;
+  distance_type len = last - first;
+  for (distance_type child = 1; child < len; ++child) {
+    distance_type parent = (child - 1) / static_cast< distance_type >(Arity);
+    if (comp(*(first + parent), *(first + child))) return false;
+  }
+  return true;
+};
+
+/**
+ * @brief Push element into heap range
+ * Given a heap in the range [first,last-1), this function extends the range
+ * considered a heap to [first,last) by placing the value in (last-1) into its
+ * corresponding location within it.
+ *
+ * @param first Random-access iterators to the initial and final positions of
+ * the new heap range, including the pushed element.
+ * @param last Random-access iterators to the initial and final positions of
+ * the new heap range, including the pushed element.
+ */
+template < class RandomAccessIterator >
+void push_heap(RandomAccessIterator first, RandomAccessIterator last) {
+  ft::_heap_push< 2 >(first, last, _operator_less());
+};
+
+/**
+ * @brief Push element into heap range
+ *
+ * @param comp Binary function that accepts two elements in the range as
+ * arguments, and returns a value convertible to bool. The value returned
+ * indicates whether the element passed as first argument is considered to be
+ * less than the second in the specific strict weak ordering it defines.
+ */
+template < class RandomAccessIterator, class Compare >
+void push_heap(RandomAccessIterator first, RandomAccessIterator last,
+               Compare comp) {
+  ft::_heap_push< 2 >(first, last, comp);
+};
+
+/**
+ * @brief Pop element from heap range
+ * Rearranges the elements in the heap range [first,last) in such a way that
+ * the part considered a heap is shortened by one: The element with the
+ * highest value is moved to (last-1).
+ *
+ * @param first Random-access iterators to the initial and final positions of
+ * the heap to be shrank by one.
+ * @param last Random-access iterators to the initial and final positions of
+ * the heap to be shrank by one.
+ */
+template < class RandomAccessIterator >
+void pop_heap(RandomAccessIterator first, RandomAccessIterator last) {
+  ft::_heap_pop< 2 >(first, last, _operator_less());
+};
+
+/**
+ * @brief Pop element from heap range
+ *
+ * @param comp Binary function that accepts two elements in the range as
+ * arguments, and returns a value convertible to bool. The value returned
+ * indicates whether the element passed as first argument is considered to be
+ * less than the second in the specific strict weak ordering it defines.
+ */
+template < class RandomAccessIterator, class Compare >
+void pop_heap(RandomAccessIterator first, RandomAccessIterator last,
+              Compare comp) {
+  ft::_heap_pop< 2 >(first, last, comp);
+};
+
+/**
+ * @brief Make heap from range
+ * Rearranges the elements in the range [first,last) in such a way that they
+ * form a heap, in linear time (Floyd's construction).
+ *
+ * @param first Random-access iterators to the initial and final positions of
+ * the sequence to be transformed into a heap.
+ * @param last Random-access iterators to the initial and final positions of
+ * the sequence to be transformed into a heap.
+ */
+template < class RandomAccessIterator >
+void make_heap(RandomAccessIterator first, RandomAccessIterator last) {
+  ft::_heap_make< 2 >(first, last, _operator_less());
+};
+
+/**
+ * @brief Make heap from range
+ *
+ * @param comp Binary function that accepts two elements in the range as
+ * arguments, and returns a value convertible to bool. The value returned
+ * indicates whether the element passed as first argument is considered to be
+ * less than the second in the specific strict weak ordering it defines.
+ */
+template < class RandomAccessIterator, class Compare >
+void make_heap(RandomAccessIterator first, RandomAccessIterator last,
+               Compare comp) {
+  ft::_heap_make< 2 >(first, last, comp);
+};
+
+/**
+ * @brief Sort elements of heap
+ * Sorts the elements in the heap range [first,last) into ascending order.
+ */
+template < class RandomAccessIterator >
+void sort_heap(RandomAccessIterator first, RandomAccessIterator last) {
+  for (; last - first > 1; --last) ft::pop_heap(first, last);
+};
+
+/**
+ * @brief Sort elements of heap
+ * Sorts the elements in the heap range [first,last) into ascending order
+ * according to comp.
+ */
+template < class RandomAccessIterator, class Compare >
+void sort_heap(RandomAccessIterator first, RandomAccessIterator last,
+               Compare comp) {
+  for (; last - first > 1; --last) ft::pop_heap(first, last, comp);
+};
+
+/**
+ * @brief Test if range is heap
+ * Returns true if the range [first,last) forms a heap, as if constructed with
+ * make_heap.
+ */
+template < class RandomAccessIterator >
+bool is_heap(RandomAccessIterator first, RandomAccessIterator last) {
+  return ft::_heap_is_heap< 2 >(first, last, _operator_less());
+};
+
+/**
+ * @brief Test if range is heap
+ * Returns true if the range [first,last) forms a heap according to comp.
+ */
+template < class RandomAccessIterator, class Compare >
+bool is_heap(RandomAccessIterator first, RandomAccessIterator last,
+             Compare comp) {
+  return ft::_heap_is_heap< 2 >(first, last, comp);
+};
+
 }  // namespace ft
 
 #endif  // ALGORITHM_HPP
@@ -0,0 +1,184 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/08
+ * @file src/atomic.hpp
+ */
+
+#if !defined(FT__ATOMIC_HPP)
+#define FT__ATOMIC_HPP
+
+#include <sched.h>
+
+#include <cstddef>
+
+namespace ft {
+
+/**
+ * @brief Memory orderings, mapped onto the GCC / Clang __atomic builtins
+ * (C++98 has no <atomic>).
+ */
+enum memory_order {
+  memory_order_relaxed = __ATOMIC_RELAXED,
+  memory_order_consume = __ATOMIC_CONSUME,
+  memory_order_acquire = __ATOMIC_ACQUIRE,
+  memory_order_release = __ATOMIC_RELEASE,
+  memory_order_acq_rel = __ATOMIC_ACQ_REL,
+  memory_order_seq_cst = __ATOMIC_SEQ_CST
+};
+
+/* assumed size of a cache line, used to keep hot fields apart */
+static const std::size_t cache_line_size = 64;
+
+/**
+ * @brief Strongest order allowed on the failure path of a compare exchange
+ * whose success path uses order.
+ */
+inline memory_order _failure_order(memory_order order) {
+  if (order == memory_order_acq_rel) return memory_order_acquire;
+  if (order == memory_order_release) return memory_order_relaxed;
+  return order;
+}
+
+/**
+ * @brief Minimal std::atomic for integral and pointer types.
+ *
+ * @tparam T integral or pointer type no wider than a machine word
+ */
+template < class T >
+class atomic {
+ private:
+  T _value;
+
+  atomic(const atomic&);
+  atomic& operator=(const atomic&);
+
+ public:
+  atomic() : _value(){};
+  explicit atomic(T value) : _value(value){};
+
+  T load(memory_order order = memory_order_seq_cst) const {
+    return __atomic_load_n(&this->_value, order);
+  };
+
+  void store(T value, memory_order order = memory_order_seq_cst) {
+    __atomic_store_n(&this->_value, value, order);
+  };
+
+  T exchange(T value, memory_order order = memory_order_seq_cst) {
+    return __atomic_exchange_n(&this->_value, value, order);
+  };
+
+  /**
+   * @brief On failure, expected receives the current value.
+   */
+  bool compare_exchange_weak(T& expected, T desired,
+                             memory_order order = memory_order_seq_cst) {
+    return __atomic_compare_exchange_n(&this->_value, &expected, desired,
+                                       true, order, _failure_order(order));
+  };
+
+  bool compare_exchange_strong(T& expected, T desired,
+                               memory_order order = memory_order_seq_cst) {
+    return __atomic_compare_exchange_n(&this->_value, &expected, desired,
+                                       false, order, _failure_order(order));
+  };
+
+  T fetch_add(std::ptrdiff_t n, memory_order order = memory_order_seq_cst) {
+    return __atomic_fetch_add(&this->_value, n, order);
+  };
+
+  T fetch_sub(std::ptrdiff_t n, memory_order order = memory_order_seq_cst) {
+    return __atomic_fetch_sub(&this->_value, n, order);
+  };
+};
+
+/**
+ * @brief Scale pointer arithmetic like std::atomic< T* > does: the builtins
+ * add raw bytes.
+ */
+template < class T >
+class atomic< T* > {
+ private:
+  T* _value;
+
+  atomic(const atomic&);
+  atomic& operator=(const atomic&);
+
+ public:
+  atomic() : _value(0){};
+  explicit atomic(T* value) : _value(value){};
+
+  T* load(memory_order order = memory_order_seq_cst) const {
+    return __atomic_load_n(&this->_value, order);
+  };
+
+  void store(T* value, memory_order order = memory_order_seq_cst) {
+    __atomic_store_n(&this->_value, value, order);
+  };
+
+  T* exchange(T* value, memory_order order = memory_order_seq_cst) {
+    return __atomic_exchange_n(&this->_value, value, order);
+  };
+
+  bool compare_exchange_weak(T*& expected, T* desired,
+                             memory_order order = memory_order_seq_cst) {
+    return __atomic_compare_exchange_n(&this->_value, &expected, desired,
+                                       true, order, _failure_order(order));
+  };
+
+  bool compare_exchange_strong(T*& expected, T* desired,
+                               memory_order order = memory_order_seq_cst) {
+    return __atomic_compare_exchange_n(&this->_value, &expected, desired,
+                                       false, order, _failure_order(order));
+  };
+
+  T* fetch_add(std::ptrdiff_t n, memory_order order = memory_order_seq_cst) {
+    return __atomic_fetch_add(&this->_value, n * sizeof(T), order);
+  };
+
+  T* fetch_sub(std::ptrdiff_t n, memory_order order = memory_order_seq_cst) {
+    return __atomic_fetch_sub(&this->_value, n * sizeof(T), order);
+  };
+};
+
+inline void atomic_thread_fence(memory_order order) {
+  __atomic_thread_fence(order);
+}
+
+/**
+ * @brief Spin-wait helper: pause the core for the first rounds, then give
+ * the time slice away so a waiter never starves the thread it waits on.
+ */
+class backoff {
+ private:
+  unsigned _round;
+
+ public:
+  backoff() : _round(0){};
+
+  void pause() {
+    if (this->_round < 16) {
+      for (unsigned i = 0; i < (1u << (this->_round / 4)); ++i) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+      }
+      ++this->_round;
+    } else {
+      sched_yield();
+    }
+  };
+
+  void reset() { this->_round = 0; };
+};
+
+}  // namespace ft
+
+#endif  // FT__ATOMIC_HPP
@@ -0,0 +1,75 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/04
+ * @file src/bench.cpp
+ */
+
+#include "bench.hpp"
+
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <iomanip>
+#include <iostream>
+
+static volatile std::size_t g_bench_sink;
+
+double bench_now(void) {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+void bench_report(const char* label, double seconds, std::size_t ops) {
+  std::cout << "\t " << std::left << std::setw(40) << label << std::right
+            << std::fixed << std::setprecision(3) << std::setw(10)
+            << seconds * 1e3 << " ms" << std::setw(10)
+            << (ops ? seconds * 1e9 / ops : 0.0) << " ns/op" << std::endl;
+}
+
+void bench_sink(std::size_t value) { g_bench_sink += value; }
+
+int bench_cores(void) {
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  if (cores < 1) return 1;
+  return cores > 64 ? 64 : static_cast< int >(cores);
+}
+
+int main(void) {
+  std::cout << "Bench: ft_containers" << std::endl;
+
+  bench_flat_map();
+  bench_btree_map();
+  bench_unordered_map();
+  bench_order_statistic_map();
+  bench_spsc_ring();
+  bench_mpmc_queue();
+  bench_concurrent_vector();
+  bench_rcu_vector();
+  bench_reclamation();
+  bench_thread_cache_allocator();
+  bench_thread_pool();
+  bench_soa_vector();
+  bench_compact_vector();
+  bench_vector_bool();
+  bench_packed_int_vector();
+  bench_cow_vector();
+  bench_persistent_vector();
+  bench_views();
+  bench_span();
+  bench_mdarray();
+  bench_priority_queue();
+  bench_ring_deque();
+  bench_gap_buffer();
+  bench_pma();
+  bench_slot_map();
+
+  return 0;
+}
@@ -0,0 +1,65 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/04
+ * @file src/bench.hpp
+ */
+
+#if !defined(BENCH_HPP)
+#define BENCH_HPP
+
+#include <cstddef>
+
+/**
+ * @brief Wall clock time in seconds.
+ */
+double bench_now(void);
+
+/**
+ * @brief Print one result line: label, total time and nanoseconds per op.
+ */
+void bench_report(const char* label, double seconds, std::size_t ops);
+
+/**
+ * @brief Keep a computed value alive so the optimizer cannot drop the loop.
+ */
+void bench_sink(std::size_t value);
+
+/**
+ * @brief Number of online cores, clamped to [1, 64], for scaling runs.
+ */
+int bench_cores(void);
+
+void bench_flat_map(void);
+void bench_btree_map(void);
+void bench_unordered_map(void);
+void bench_order_statistic_map(void);
+void bench_spsc_ring(void);
+void bench_mpmc_queue(void);
+void bench_concurrent_vector(void);
+void bench_rcu_vector(void);
+void bench_reclamation(void);
+void bench_thread_cache_allocator(void);
+void bench_thread_pool(void);
+void bench_soa_vector(void);
+void bench_compact_vector(void);
+void bench_vector_bool(void);
+void bench_packed_int_vector(void);
+void bench_cow_vector(void);
+void bench_persistent_vector(void);
+void bench_views(void);
+void bench_span(void);
+void bench_mdarray(void);
+void bench_priority_queue(void);
+void bench_ring_deque(void);
+void bench_gap_buffer(void);
+void bench_pma(void);
+void bench_slot_map(void);
+
+#endif  // BENCH_HPP
@@ -0,0 +1,155 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/05
+ * @file src/btree_map.bench.cpp
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+
+#include "bench.hpp"
+#include "btree_map.hpp"
+#include "vector.hpp"
+
+static std::size_t g_btree_bench_bytes = 0;
+
+/**
+ * @brief std::allocator that tracks live bytes, to measure memory per entry.
+ */
+template < class T >
+class btree_counting_allocator : public std::allocator< T > {
+ public:
+  typedef typename std::allocator< T >::pointer pointer;
+  typedef typename std::allocator< T >::size_type size_type;
+
+  template < class U >
+  struct rebind {
+    typedef btree_counting_allocator< U > other;
+  };
+
+  btree_counting_allocator() {}
+  btree_counting_allocator(const btree_counting_allocator& other)
+      : std::allocator< T >(other) {}
+  template < class U >
+  btree_counting_allocator(const btree_counting_allocator< U >& other)
+      : std::allocator< T >(other) {}
+
+  pointer allocate(size_type n, const void* hint = 0) {
+    g_btree_bench_bytes += n * sizeof(T);
+    return std::allocator< T >::allocate(n, hint);
+  }
+
+  void deallocate(pointer p, size_type n) {
+    g_btree_bench_bytes -= n * sizeof(T);
+    std::allocator< T >::deallocate(p, n);
+  }
+};
+
+typedef ft::btree_map<
+    unsigned int, unsigned int, std::less< unsigned int >,
+    btree_counting_allocator< ft::pair< const unsigned int, unsigned int > > >
+    bench_btree;
+typedef std::map<
+    unsigned int, unsigned int, std::less< unsigned int >,
+    btree_counting_allocator< std::pair< const unsigned int, unsigned int > > >
+    bench_tree;
+
+void bench_btree_map(void) {
+  std::cout << "Bench: btree_map" << std::endl;
+
+  const std::size_t n = 1 << 20;
+  const std::size_t lookups = 1 << 22;
+
+  ft::vector< unsigned int > keys;
+  keys.reserve(n);
+  std::srand(42);
+  for (std::size_t i = 0; i < n; ++i) {
+    keys.push_back(static_cast< unsigned int >(std::rand()));
+  }
+  ft::vector< unsigned int > probes;
+  probes.reserve(lookups);
+  for (std::size_t i = 0; i < lookups; ++i) {
+    probes.push_back(keys[std::rand() % n]);
+  }
+
+  std::size_t sum = 0;
+  {
+    g_btree_bench_bytes = 0;
+    bench_btree btree;
+    double start = bench_now();
+    for (std::size_t i = 0; i < n; ++i) btree[keys[i]] = keys[i];
+    bench_report("btree_map insert", bench_now() - start, n);
+    std::cout << "\t btree_map bytes per entry: "
+              << static_cast< double >(g_btree_bench_bytes) / btree.size()
+              << " (height " << btree.height() << ")" << std::endl;
+
+    start = bench_now();
+    for (std::size_t i = 0; i < lookups; ++i) {
+      sum += btree.find(probes[i])->second;
+    }
+    bench_report("btree_map find (hit)", bench_now() - start, lookups);
+
+    start = bench_now();
+    for (bench_btree::const_iterator it = btree.begin(); it != btree.end();
+         ++it) {
+      sum += it->second;
+    }
+    bench_report("btree_map full scan", bench_now() - start, btree.size());
+
+    start = bench_now();
+    std::size_t scanned = 0;
+    for (std::size_t i = 0; i < 1024; ++i) {
+      bench_btree::const_iterator it = btree.lower_bound(probes[i]);
+      for (std::size_t j = 0; j < 256 && it != btree.end(); ++j, ++it) {
+        sum += it->second;
+        ++scanned;
+      }
+    }
+    bench_report("btree_map range scan (256)", bench_now() - start, scanned);
+  }
+  {
+    g_btree_bench_bytes = 0;
+    bench_tree tree;
+    double start = bench_now();
+    for (std::size_t i = 0; i < n; ++i) tree[keys[i]] = keys[i];
+    bench_report("std::map insert", bench_now() - start, n);
+    std::cout << "\t std::map bytes per entry: "
+              << static_cast< double >(g_btree_bench_bytes) / tree.size()
+              << std::endl;
+
+    start = bench_now();
+    for (std::size_t i = 0; i < lookups; ++i) {
+      sum += tree.find(probes[i])->second;
+    }
+    bench_report("std::map find (hit)", bench_now() - start, lookups);
+
+    start = bench_now();
+    for (bench_tree::const_iterator it = tree.begin(); it != tree.end();
+         ++it) {
+      sum += it->second;
+    }
+    bench_report("std::map full scan", bench_now() - start, tree.size());
+
+    start = bench_now();
+    std::size_t scanned = 0;
+    for (std::size_t i = 0; i < 1024; ++i) {
+      bench_tree::const_iterator it = tree.lower_bound(probes[i]);
+      for (std::size_t j = 0; j < 256 && it != tree.end(); ++j, ++it) {
+        sum += it->second;
+        ++scanned;
+      }
+    }
+    bench_report("std::map range scan (256)", bench_now() - start, scanned);
+  }
+
+  bench_sink(sum);
+}
@@ -0,0 +1,1057 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/05
+ * @file src/btree_map.hpp
+ */
+
+#if !defined(FT__BTREE_MAP_HPP)
+#define FT__BTREE_MAP_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+#include "algorithm.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+/**
+ * @brief Common header of every B+tree node.
+ */
+struct btree_node_base {
+  /* true for leaves, false for inner nodes */
+  bool leaf;
+  /* number of keys stored in the node */
+  std::size_t count;
+};
+
+/**
+ * @brief B+tree leaf: keys and mapped values in two contiguous arrays, so the
+ * in-node search only touches keys. Leaves are doubly linked in key order.
+ *
+ * @tparam Key key type
+ * @tparam T mapped type
+ * @tparam N number of slots
+ */
+template < class Key, class T, std::size_t N >
+struct btree_leaf : public btree_node_base {
+  Key keys[N];
+  T values[N];
+  btree_leaf* prev;
+  btree_leaf* next;
+};
+
+/**
+ * @brief B+tree inner node: N separator keys and N + 1 children. Every key
+ * of children[i + 1] compares greater or equal to keys[i], every key of
+ * children[i] compares less.
+ *
+ * @tparam Key key type
+ * @tparam N number of separator slots
+ */
+template < class Key, std::size_t N >
+struct btree_inner : public btree_node_base {
+  Key keys[N];
+  btree_node_base* children[N + 1];
+};
+
+/**
+ * @brief Bidirectional iterator walking the linked leaves of a btree_map.
+ * A position is a (leaf, slot) pair; the end position is one past the last
+ * slot of the last leaf.
+ *
+ * @tparam Leaf leaf node type
+ * @tparam Key key type (always const qualified)
+ * @tparam T mapped type (const qualified for const_iterator)
+ */
+template < class Leaf, class Key, class T >
+class btree_iterator
+    : public ft::iterator<
+          ft::bidirectional_iterator_tag,
+          ft::pair< Key, typename ft::remove_const< T >::type >, std::ptrdiff_t,
+          ft::arrow_proxy< ft::pair_reference< Key, T > >,
+          ft::pair_reference< Key, T > > {
+ public:
+  /* Preserves Iterator's category */
+  typedef ft::bidirectional_iterator_tag iterator_category;
+  /* pair< const key_type, mapped_type > */
+  typedef ft::pair< Key, typename ft::remove_const< T >::type > value_type;
+  /* a signed integral type */
+  typedef std::ptrdiff_t difference_type;
+  /* pair of references into the leaf arrays */
+  typedef ft::pair_reference< Key, T > reference;
+  /* proxy keeping the reference alive for operator-> */
+  typedef ft::arrow_proxy< reference > pointer;
+
+ protected:
+  Leaf* _leaf;
+  std::size_t _pos;
+
+ public:
+  /**
+   * @brief default constructor
+   */
+  btree_iterator() : _leaf(ft::u_nullptr), _pos(0){};
+
+  /**
+   * @brief initalization constructor
+   */
+  btree_iterator(Leaf* leaf, std::size_t pos) : _leaf(leaf), _pos(pos){};
+
+  /**
+   * @brief copy Construct
+   */
+  btree_iterator(const btree_iterator& other)
+      : _leaf(other._leaf), _pos(other._pos){};
+
+  /**
+   * @brief btree_iterator< Leaf, Key, const T > casting operator
+   */
+  operator btree_iterator< Leaf, Key, const T >() const {
+    return btree_iterator< Leaf, Key, const T >(this->_leaf, this->_pos);
+  }
+
+  btree_iterator& operator=(const btree_iterator& other) {
+    this->_leaf = other._leaf;
+    this->_pos = other._pos;
+    return *this;
+  };
+
+  reference operator*() const {
+    return reference(_leaf->keys[_pos], _leaf->values[_pos]);
+  };
+
+  pointer operator->() const { return pointer(operator*()); };
+
+  /**
+   * @brief Advances to the next slot, hopping to the next leaf at the end of
+   * the current one.
+   */
+  btree_iterator& operator++() {
+    if (++_pos == _leaf->count && _leaf->next) {
+      _leaf = _leaf->next;
+      _pos = 0;
+    }
+    return *this;
+  };
+
+  btree_iterator operator++(int) {
+    btree_iterator tmp = *this;
+    ++(*this);
+    return tmp;
+  };
+
+  btree_iterator& operator--() {
+    if (_pos == 0 && _leaf->prev) {
+      _leaf = _leaf->prev;
+      _pos = _leaf->count;
+    }
+    --_pos;
+    return *this;
+  };
+
+  btree_iterator operator--(int) {
+    btree_iterator tmp = *this;
+    --(*this);
+    return tmp;
+  };
+
+  Leaf* const& leaf() const { return this->_leaf; }
+
+  std::size_t const& position() const { return this->_pos; }
+};
+
+template < class Leaf, class K1, class T1, class K2, class T2 >
+bool operator==(const btree_iterator< Leaf, K1, T1 >& lhs,
+                const btree_iterator< Leaf, K2, T2 >& rhs) {
+  return lhs.leaf() == rhs.leaf() && lhs.position() == rhs.position();
+};
+
+template < class Leaf, class K1, class T1, class K2, class T2 >
+bool operator!=(const btree_iterator< Leaf, K1, T1 >& lhs,
+                const btree_iterator< Leaf, K2, T2 >& rhs) {
+  return !(lhs == rhs);
+};
+
+/**
+ * @brief An ordered associative container of unique keys implemented as a
+ * B+tree with wide nodes.
+ *
+ * Each node is sized to _NodeSize bytes (a few cache lines), so a lookup
+ * pays one cache miss per level of a tree that is several times shallower
+ * than a binary tree. Inside a node keys are contiguous and searched with a
+ * branch free linear scan the compiler can vectorize. Elements live only in
+ * the leaves, which are linked so range scans stream through memory.
+ *
+ * Key and T must be default constructible: node arrays are constructed with
+ * the node. Any insert or erase invalidates iterators.
+ *
+ * @tparam Key Type of the keys.
+ * @tparam T Type of the mapped value.
+ * @tparam Compare strict weak ordering on keys, defaults to `less<Key>`.
+ * @tparam _Alloc allocator, rebound for the node types.
+ * @tparam _NodeSize target node size in bytes, defaults to 256.
+ */
+template < class Key, class T, class Compare = std::less< Key >,
+           class _Alloc = std::allocator< ft::pair< const Key, T > >,
+           std::size_t _NodeSize = 256 >
+class btree_map {
+ private:
+  static const std::size_t _leaf_fit =
+      (_NodeSize - sizeof(btree_node_base) - 2 * sizeof(void*)) /
+      (sizeof(Key) + sizeof(T));
+  static const std::size_t _inner_fit =
+      (_NodeSize - sizeof(btree_node_base) - sizeof(void*)) /
+      (sizeof(Key) + sizeof(void*));
+
+ public:
+  /* number of elements a leaf can hold */
+  static const std::size_t leaf_slots = _leaf_fit < 4 ? 4 : _leaf_fit;
+  /* number of separator keys an inner node can hold */
+  static const std::size_t inner_slots = _inner_fit < 4 ? 4 : _inner_fit;
+
+  /* The first template parameter (Key) */
+  typedef Key key_type;
+  /* The second template parameter (T) */
+  typedef T mapped_type;
+  /* pair< const key_type, mapped_type > */
+  typedef ft::pair< const Key, T > value_type;
+  /* The third template parameter (Compare) */
+  typedef Compare key_compare;
+  /* The fourth template parameter (_Alloc) */
+  typedef _Alloc allocator_type;
+  /* pair of references to an element */
+  typedef ft::pair_reference< const Key, T > reference;
+  /* pair of const references to an element */
+  typedef ft::pair_reference< const Key, const T > const_reference;
+  /* an unsigned integral type */
+  typedef std::size_t size_type;
+  /* a signed integral type */
+  typedef std::ptrdiff_t difference_type;
+
+ private:
+  typedef btree_leaf< Key, T, leaf_slots > _leaf;
+  typedef btree_inner< Key, inner_slots > _inner;
+  typedef btree_node_base _node;
+  typedef typename _Alloc::template rebind< _leaf >::other _leaf_allocator;
+  typedef typename _Alloc::template rebind< _inner >::other _inner_allocator;
+
+  /* minimum fill of a non-root node */
+  static const size_type _leaf_min = leaf_slots / 2;
+  static const size_type _inner_min = inner_slots / 2;
+  /* nodes with more keys than this are searched by bisection */
+  static const size_type _linear_search_limit = 64;
+
+ public:
+  /* a bidirectional iterator to value_type */
+  typedef ft::btree_iterator< _leaf, const Key, T > iterator;
+  /* a bidirectional iterator to const value_type */
+  typedef ft::btree_iterator< _leaf, const Key, const T > const_iterator;
+  /* reverse_iterator<iterator> */
+  typedef ft::reverse_iterator< iterator > reverse_iterator;
+  /* reverse_iterator<const_iterator> */
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+
+  /**
+   * @brief Function object that compares two elements by their keys.
+   */
+  class value_compare {
+    friend class btree_map;
+
+   protected:
+    Compare comp;
+    value_compare(Compare c) : comp(c){};
+
+   public:
+    typedef bool result_type;
+    typedef value_type first_argument_type;
+    typedef value_type second_argument_type;
+    bool operator()(const value_type& x, const value_type& y) const {
+      return comp(x.first, y.first);
+    };
+  };
+
+ private:
+  key_compare _comp;
+  _leaf_allocator _leaf_alloc;
+  _inner_allocator _inner_alloc;
+  _node* _root;
+  _leaf* _head;
+  _leaf* _tail;
+  size_type _size;
+  size_type _height;
+
+ public:
+  /**
+   * @brief empty container constructor (default constructor)
+   */
+  explicit btree_map(const key_compare& comp = key_compare(),
+                     const allocator_type& alloc = allocator_type())
+      : _comp(comp), _leaf_alloc(alloc), _inner_alloc(alloc) {
+    this->_init();
+  };
+
+  /**
+   * @brief range constructor
+   */
+  template < class InputIterator >
+  btree_map(InputIterator first, InputIterator last,
+            const key_compare& comp = key_compare(),
+            const allocator_type& alloc = allocator_type(),
+            typename ft::enable_if<
+                !ft::is_integral< InputIterator >::value >::type* = u_nullptr)
+      : _comp(comp), _leaf_alloc(alloc), _inner_alloc(alloc) {
+    this->_init();
+    this->insert(first, last);
+  };
+
+  /**
+   * @brief copy constructor
+   * x is already sorted, so the tree is built bottom up with every node
+   * packed, instead of by inserts that leave each leaf split half full.
+   */
+  btree_map(const btree_map& x)
+      : _comp(x._comp),
+        _leaf_alloc(x._leaf_alloc),
+        _inner_alloc(x._inner_alloc) {
+    this->_bulk_load(x.begin(), x.size());
+  };
+
+  btree_map& operator=(const btree_map& x) {
+    if (this != &x) {
+      btree_map tmp(x);
+      this->swap(tmp);
+    }
+    return *this;
+  };
+
+  ~btree_map() { this->_destroy(this->_root); };
+
+  iterator begin() { return iterator(this->_head, 0); };
+  const_iterator begin() const { return const_iterator(this->_head, 0); };
+  iterator end() { return iterator(this->_tail, this->_tail->count); };
+  const_iterator end() const {
+    return const_iterator(this->_tail, this->_tail->count);
+  };
+  reverse_iterator rbegin() { return reverse_iterator(this->end()); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(this->end());
+  };
+  reverse_iterator rend() { return reverse_iterator(this->begin()); };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(this->begin());
+  };
+
+  bool empty() const { return this->_size == 0; };
+  size_type size() const { return this->_size; };
+  size_type max_size() const {
+    return this->_leaf_alloc.max_size() * leaf_slots;
+  };
+
+  /**
+   * @brief Number of levels, 1 when the root is a leaf.
+   */
+  size_type height() const { return this->_height; };
+
+  /**
+   * @brief Access element, inserting a value-initialized one if k is absent.
+   */
+  mapped_type& operator[](const key_type& k) {
+    iterator it = this->_insert_unique(k, mapped_type()).first;
+    return it.leaf()->values[it.position()];
+  };
+
+  mapped_type& at(const key_type& k) {
+    iterator it = this->find(k);
+    if (it == this->end()) throw std::out_of_range("ft::btree_map");
+    return it.leaf()->values[it.position()];
+  };
+
+  const mapped_type& at(const key_type& k) const {
+    const_iterator it = this->find(k);
+    if (it == this->end()) throw std::out_of_range("ft::btree_map");
+    return it.leaf()->values[it.position()];
+  };
+
+  /**
+   * @brief Insert element
+   */
+  ft::pair< iterator, bool > insert(const value_type& val) {
+    return this->_insert_unique(val.first, val.second);
+  };
+
+  /**
+   * @brief Insert element with hint. The hint is not used: a descent is
+   * already one cache miss per level.
+   */
+  iterator insert(iterator position, const value_type& val) {
+    (void)position;
+    return this->_insert_unique(val.first, val.second).first;
+  };
+
+  /**
+   * @brief range Insert elements
+   */
+  template < class InputIterator >
+  void insert(
+      InputIterator first, InputIterator last,
+      typename ft::enable_if<
+          !ft::is_integral< InputIterator >::value >::type* = u_nullptr) {
+    for (; first != last; ++first) {
+      this->_insert_unique(first->first, first->second);
+    }
+  };
+
+  /**
+   * @brief Erase element at position
+   */
+  void erase(iterator position) {
+    Key k = position->first;
+    this->erase(k);
+  };
+
+  /**
+   * @brief Erase element by key
+   *
+   * @return the number of elements erased (0 or 1)
+   */
+  size_type erase(const key_type& k) {
+    if (!this->_erase(this->_root, k)) return 0;
+    --this->_size;
+    if (!this->_root->leaf && this->_root->count == 0) {
+      _inner* old = static_cast< _inner* >(this->_root);
+      this->_root = old->children[0];
+      this->_free_inner(old);
+      --this->_height;
+    }
+    return 1;
+  };
+
+  /**
+   * @brief range Erase elements
+   * Erasing rebalances nodes, so the range is tracked by key, not by
+   * iterator.
+   */
+  void erase(iterator first, iterator last) {
+    if (last == this->end()) {
+      while (first != this->end()) {
+        Key k = first->first;
+        this->erase(k);
+        first = this->lower_bound(k);
+      }
+      return;
+    }
+    Key stop = last->first;
+    while (this->_comp(first->first, stop)) {
+      Key k = first->first;
+      this->erase(k);
+      first = this->lower_bound(k);
+    }
+  };
+
+  void swap(btree_map& x) {
+    ft::swap(this->_comp, x._comp);
+    ft::swap(this->_root, x._root);
+    ft::swap(this->_head, x._head);
+    ft::swap(this->_tail, x._tail);
+    ft::swap(this->_size, x._size);
+    ft::swap(this->_height, x._height);
+  };
+
+  void clear() {
+    this->_destroy(this->_root);
+    this->_init();
+  };
+
+  key_compare key_comp() const { return this->_comp; };
+
+  value_compare value_comp() const { return value_compare(this->_comp); };
+
+  iterator find(const key_type& k) {
+    _leaf* leaf = this->_find_leaf(k);
+    size_type i = this->_lower_in(leaf->keys, leaf->count, k);
+    if (i == leaf->count || this->_comp(k, leaf->keys[i])) return this->end();
+    return iterator(leaf, i);
+  };
+
+  const_iterator find(const key_type& k) const {
+    _leaf* leaf = this->_find_leaf(k);
+    size_type i = this->_lower_in(leaf->keys, leaf->count, k);
+    if (i == leaf->count || this->_comp(k, leaf->keys[i])) return this->end();
+    return const_iterator(leaf, i);
+  };
+
+  size_type count(const key_type& k) const {
+    return this->find(k) != this->end();
+  };
+
+  iterator lower_bound(const key_type& k) {
+    _leaf* leaf = this->_find_leaf(k);
+    return this->_normalize(
+        iterator(leaf, this->_lower_in(leaf->keys, leaf->count, k)));
+  };
+
+  const_iterator lower_bound(const key_type& k) const {
+    _leaf* leaf = this->_find_leaf(k);
+    return this->_normalize(
+        iterator(leaf, this->_lower_in(leaf->keys, leaf->count, k)));
+  };
+
+  iterator upper_bound(const key_type& k) {
+    _leaf* leaf = this->_find_leaf(k);
+    return this->_normalize(
+        iterator(leaf, this->_upper_in(leaf->keys, leaf->count, k)));
+  };
+
+  const_iterator upper_bound(const key_type& k) const {
+    _leaf* leaf = this->_find_leaf(k);
+    return this->_normalize(
+        iterator(leaf, this->_upper_in(leaf->keys, leaf->count, k)));
+  };
+
+  ft::pair< iterator, iterator > equal_range(const key_type& k) {
+    return ft::make_pair(this->lower_bound(k), this->upper_bound(k));
+  };
+
+  ft::pair< const_iterator, const_iterator > equal_range(
+      const key_type& k) const {
+    return ft::make_pair(this->lower_bound(k), this->upper_bound(k));
+  };
+
+  allocator_type get_allocator() const {
+    return allocator_type(this->_leaf_alloc);
+  };
+
+ private:
+  void _init() {
+    this->_head = this->_new_leaf();
+    this->_tail = this->_head;
+    this->_root = this->_head;
+    this->_size = 0;
+    this->_height = 1;
+  };
+
+  _leaf* _new_leaf() {
+    _leaf* leaf = this->_leaf_alloc.allocate(1);
+    this->_leaf_alloc.construct(leaf, _leaf());
+    leaf->leaf = true;
+    leaf->count = 0;
+    leaf->prev = ft::u_nullptr;
+    leaf->next = ft::u_nullptr;
+    return leaf;
+  };
+
+  _inner* _new_inner() {
+    _inner* inner = this->_inner_alloc.allocate(1);
+    this->_inner_alloc.construct(inner, _inner());
+    inner->leaf = false;
+    inner->count = 0;
+    return inner;
+  };
+
+  void _free_leaf(_leaf* leaf) {
+    this->_leaf_alloc.destroy(leaf);
+    this->_leaf_alloc.deallocate(leaf, 1);
+  };
+
+  void _free_inner(_inner* inner) {
+    this->_inner_alloc.destroy(inner);
+    this->_inner_alloc.deallocate(inner, 1);
+  };
+
+  void _destroy(_node* node) {
+    if (node->leaf) {
+      this->_free_leaf(static_cast< _leaf* >(node));
+      return;
+    }
+    _inner* inner = static_cast< _inner* >(node);
+    for (size_type i = 0; i <= inner->count; ++i) {
+      this->_destroy(inner->children[i]);
+    }
+    this->_free_inner(inner);
+  };
+
+  /**
+   * @brief Build the tree from n sorted, unique elements. Each level holds
+   * as few nodes as fit its entries, which are spread evenly over them, so
+   * every non-root node is at least half full.
+   */
+  void _bulk_load(const_iterator first, size_type n) {
+    if (n == 0) {
+      this->_init();
+      return;
+    }
+    size_type leaves = (n + leaf_slots - 1) / leaf_slots;
+    ft::vector< _node* > level;
+    ft::vector< Key > lows;
+    level.reserve(leaves);
+    lows.reserve(leaves);
+    _leaf* prev = ft::u_nullptr;
+    for (size_type l = 0; l < leaves; ++l) {
+      _leaf* leaf = this->_new_leaf();
+      size_type count = n / leaves + (l < n % leaves ? 1 : 0);
+      for (size_type j = 0; j < count; ++j, ++first) {
+        leaf->keys[j] = first->first;
+        leaf->values[j] = first->second;
+      }
+      leaf->count = count;
+      leaf->prev = prev;
+      if (prev) {
+        prev->next = leaf;
+      } else {
+        this->_head = leaf;
+      }
+      prev = leaf;
+      level.push_back(leaf);
+      lows.push_back(leaf->keys[0]);
+    }
+    this->_tail = prev;
+    this->_size = n;
+    this->_height = 1;
+
+    while (level.size() > 1) {
+      size_type children = level.size();
+      size_type nodes = (children + inner_slots) / (inner_slots + 1);
+      ft::vector< _node* > parents;
+      ft::vector< Key > parent_lows;
+      parents.reserve(nodes);
+      parent_lows.reserve(nodes);
+      size_type c = 0;
+      for (size_type p = 0; p < nodes; ++p) {
+        _inner* inner = this->_new_inner();
+        size_type count = children / nodes + (p < children % nodes ? 1 : 0);
+        parent_lows.push_back(lows[c]);
+        inner->children[0] = level[c++];
+        for (size_type j = 1; j < count; ++j, ++c) {
+          inner->keys[j - 1] = lows[c];
+          inner->children[j] = level[c];
+        }
+        inner->count = count - 1;
+        parents.push_back(inner);
+      }
+      level.swap(parents);
+      lows.swap(parent_lows);
+      ++this->_height;
+    }
+    this->_root = level[0];
+  };
+
+  /**
+   * @brief Reset the vacated slots [first, last) of a leaf, so that the
+   * resources of erased or moved out elements are released right away.
+   */
+  void _leaf_reset(_leaf* leaf, size_type first, size_type last) {
+    for (; first < last; ++first) {
+      leaf->keys[first] = Key();
+      leaf->values[first] = T();
+    }
+  };
+
+  void _inner_reset(_inner* inner, size_type first, size_type last) {
+    for (; first < last; ++first) inner->keys[first] = Key();
+  };
+
+  /**
+   * @brief Number of keys less than k in keys[0,n).
+   * Small nodes are scanned without branches (one compare per key summed),
+   * which keeps the pipeline full and vectorizes for arithmetic keys.
+   */
+  size_type _lower_in(const Key* keys, size_type n, const Key& k) const {
+    if (n > _linear_search_limit) {
+      return ft::lower_bound(keys, keys + n, k, this->_comp) - keys;
+    }
+    size_type i = 0;
+    for (size_type j = 0; j < n; ++j) i += this->_comp(keys[j], k);
+    return i;
+  };
+
+  /**
+   * @brief Number of keys less or equal to k in keys[0,n).
+   */
+  size_type _upper_in(const Key* keys, size_type n, const Key& k) const {
+    if (n > _linear_search_limit) {
+      return ft::upper_bound(keys, keys + n, k, this->_comp) - keys;
+    }
+    size_type i = 0;
+    for (size_type j = 0; j < n; ++j) i += !this->_comp(k, keys[j]);
+    return i;
+  };
+
+  _leaf* _find_leaf(const Key& k) const {
+    _node* node = this->_root;
+    while (!node->leaf) {
+      _inner* inner = static_cast< _inner* >(node);
+      node = inner->children[this->_upper_in(inner->keys, inner->count, k)];
+    }
+    return static_cast< _leaf* >(node);
+  };
+
+  /**
+   * @brief A search may stop one past the last slot of a leaf that is not
+   * the tail; move such a position to the start of the next leaf.
+   */
+  iterator _normalize(iterator it) const {
+    if (it.position() == it.leaf()->count && it.leaf()->next) {
+      return iterator(it.leaf()->next, 0);
+    }
+    return it;
+  };
+
+  ft::pair< iterator, bool > _insert_unique(const Key& k, const T& v) {
+    _leaf* leaf = this->_find_leaf(k);
+    size_type i = this->_lower_in(leaf->keys, leaf->count, k);
+    if (i != leaf->count && !this->_comp(k, leaf->keys[i])) {
+      return ft::make_pair(iterator(leaf, i), false);
+    }
+
+    Key split_key;
+    _node* split_node = ft::u_nullptr;
+    iterator result;
+    this->_insert(this->_root, k, v, split_key, split_node, result);
+    if (split_node) {
+      _inner* root = this->_new_inner();
+      root->keys[0] = split_key;
+      root->children[0] = this->_root;
+      root->children[1] = split_node;
+      root->count = 1;
+      this->_root = root;
+      ++this->_height;
+    }
+    ++this->_size;
+    return ft::make_pair(result, true);
+  };
+
+  /**
+   * @brief Insert a key known to be absent under node. When node splits, the
+   * new right sibling and its separator are returned through split_node and
+   * split_key.
+   */
+  void _insert(_node* node, const Key& k, const T& v, Key& split_key,
+               _node*& split_node, iterator& result) {
+    if (node->leaf) {
+      this->_insert_leaf(static_cast< _leaf* >(node), k, v, split_key,
+                         split_node, result);
+      return;
+    }
+    _inner* inner = static_cast< _inner* >(node);
+    size_type i = this->_upper_in(inner->keys, inner->count, k);
+    Key child_key;
+    _node* child_split = ft::u_nullptr;
+    this->_insert(inner->children[i], k, v, child_key, child_split, result);
+    if (!child_split) return;
+
+    if (inner->count < inner_slots) {
+      this->_inner_insert_at(inner, i, child_key, child_split);
+      return;
+    }
+    // the inner_slots + 1 keys, counting child_key at i, split around
+    // their median: (inner_slots + 1) / 2 keys stay, the rest move right
+    size_type median = (inner_slots + 1) / 2;
+    _inner* right = this->_new_inner();
+    if (i == median) {
+      // child_key itself moves up
+      for (size_type j = median; j < inner->count; ++j) {
+        right->keys[j - median] = inner->keys[j];
+        right->children[j - median + 1] = inner->children[j + 1];
+      }
+      right->children[0] = child_split;
+      right->count = inner->count - median;
+      split_key = child_key;
+      this->_inner_reset(inner, median, inner->count);
+      inner->count = median;
+    } else {
+      // the key moving up stays in the array: split one later when
+      // child_key goes left, so that both halves end up the same size
+      size_type mid = i < median ? median - 1 : median;
+      for (size_type j = mid + 1; j < inner->count; ++j) {
+        right->keys[j - mid - 1] = inner->keys[j];
+      }
+      for (size_type j = mid + 1; j <= inner->count; ++j) {
+        right->children[j - mid - 1] = inner->children[j];
+      }
+      right->count = inner->count - mid - 1;
+      split_key = inner->keys[mid];
+      this->_inner_reset(inner, mid, inner->count);
+      inner->count = mid;
+      if (i < median) {
+        this->_inner_insert_at(inner, i, child_key, child_split);
+      } else {
+        this->_inner_insert_at(right, i - mid - 1, child_key, child_split);
+      }
+    }
+    split_node = right;
+  };
+
+  /**
+   * @brief Insert separator k at i and child at i + 1, node must have room.
+   */
+  void _inner_insert_at(_inner* node, size_type i, const Key& k,
+                        _node* child) {
+    for (size_type j = node->count; j > i; --j) {
+      node->keys[j] = node->keys[j - 1];
+      node->children[j + 1] = node->children[j];
+    }
+    node->keys[i] = k;
+    node->children[i + 1] = child;
+    ++node->count;
+  };
+
+  void _insert_leaf(_leaf* leaf, const Key& k, const T& v, Key& split_key,
+                    _node*& split_node, iterator& result) {
+    size_type i = this->_lower_in(leaf->keys, leaf->count, k);
+    if (leaf->count < leaf_slots) {
+      this->_leaf_insert_at(leaf, i, k, v);
+      result = iterator(leaf, i);
+      return;
+    }
+    size_type mid = leaf_slots / 2;
+    _leaf* right = this->_new_leaf();
+    for (size_type j = mid; j < leaf->count; ++j) {
+      right->keys[j - mid] = leaf->keys[j];
+      right->values[j - mid] = leaf->values[j];
+    }
+    right->count = leaf->count - mid;
+    this->_leaf_reset(leaf, mid, leaf->count);
+    leaf->count = mid;
+    right->next = leaf->next;
+    right->prev = leaf;
+    if (leaf->next) {
+      leaf->next->prev = right;
+    } else {
+      this->_tail = right;
+    }
+    leaf->next = right;
+    if (i < mid) {
+      this->_leaf_insert_at(leaf, i, k, v);
+      result = iterator(leaf, i);
+    } else {
+      this->_leaf_insert_at(right, i - mid, k, v);
+      result = iterator(right, i - mid);
+    }
+    split_key = right->keys[0];
+    split_node = right;
+  };
+
+  void _leaf_insert_at(_leaf* leaf, size_type i, const Key& k, const T& v) {
+    for (size_type j = leaf->count; j > i; --j) {
+      leaf->keys[j] = leaf->keys[j - 1];
+      leaf->values[j] = leaf->values[j - 1];
+    }
+    leaf->keys[i] = k;
+    leaf->values[i] = v;
+    ++leaf->count;
+  };
+
+  /**
+   * @brief Erase k under node, then repair the child that was descended into
+   * if it fell below the minimum fill.
+   */
+  bool _erase(_node* node, const Key& k) {
+    if (node->leaf) {
+      _leaf* leaf = static_cast< _leaf* >(node);
+      size_type i = this->_lower_in(leaf->keys, leaf->count, k);
+      if (i == leaf->count || this->_comp(k, leaf->keys[i])) return false;
+      for (size_type j = i + 1; j < leaf->count; ++j) {
+        leaf->keys[j - 1] = leaf->keys[j];
+        leaf->values[j - 1] = leaf->values[j];
+      }
+      --leaf->count;
+      this->_leaf_reset(leaf, leaf->count, leaf->count + 1);
+      return true;
+    }
+    _inner* inner = static_cast< _inner* >(node);
+    size_type i = this->_upper_in(inner->keys, inner->count, k);
+    if (!this->_erase(inner->children[i], k)) return false;
+    _node* child = inner->children[i];
+    if (child->leaf ? child->count < _leaf_min : child->count < _inner_min) {
+      if (child->leaf) {
+        this->_rebalance_leaf(inner, i);
+      } else {
+        this->_rebalance_inner(inner, i);
+      }
+    }
+    return true;
+  };
+
+  void _rebalance_leaf(_inner* parent, size_type i) {
+    _leaf* child = static_cast< _leaf* >(parent->children[i]);
+    _leaf* left =
+        i > 0 ? static_cast< _leaf* >(parent->children[i - 1]) : ft::u_nullptr;
+    _leaf* right = i < parent->count
+                       ? static_cast< _leaf* >(parent->children[i + 1])
+                       : ft::u_nullptr;
+
+    if (left && left->count > _leaf_min) {
+      this->_leaf_insert_at(child, 0, left->keys[left->count - 1],
+                            left->values[left->count - 1]);
+      --left->count;
+      this->_leaf_reset(left, left->count, left->count + 1);
+      parent->keys[i - 1] = child->keys[0];
+    } else if (right && right->count > _leaf_min) {
+      this->_leaf_insert_at(child, child->count, right->keys[0],
+                            right->values[0]);
+      for (size_type j = 1; j < right->count; ++j) {
+        right->keys[j - 1] = right->keys[j];
+        right->values[j - 1] = right->values[j];
+      }
+      --right->count;
+      this->_leaf_reset(right, right->count, right->count + 1);
+      parent->keys[i] = right->keys[0];
+    } else if (left) {
+      this->_merge_leaves(left, child);
+      this->_inner_remove_at(parent, i - 1);
+    } else if (right) {
+      this->_merge_leaves(child, right);
+      this->_inner_remove_at(parent, i);
+    }
+  };
+
+  /**
+   * @brief Append right to left, unlink and free right.
+   */
+  void _merge_leaves(_leaf* left, _leaf* right) {
+    for (size_type j = 0; j < right->count; ++j) {
+      left->keys[left->count + j] = right->keys[j];
+      left->values[left->count + j] = right->values[j];
+    }
+    left->count += right->count;
+    left->next = right->next;
+    if (right->next) {
+      right->next->prev = left;
+    } else {
+      this->_tail = left;
+    }
+    this->_free_leaf(right);
+  };
+
+  void _rebalance_inner(_inner* parent, size_type i) {
+    _inner* child = static_cast< _inner* >(parent->children[i]);
+    _inner* left = i > 0 ? static_cast< _inner* >(parent->children[i - 1])
+                         : ft::u_nullptr;
+    _inner* right = i < parent->count
+                        ? static_cast< _inner* >(parent->children[i + 1])
+                        : ft::u_nullptr;
+
+    if (left && left->count > _inner_min) {
+      for (size_type j = child->count; j > 0; --j) {
+        child->keys[j] = child->keys[j - 1];
+      }
+      for (size_type j = child->count + 1; j > 0; --j) {
+        child->children[j] = child->children[j - 1];
+      }
+      child->keys[0] = parent->keys[i - 1];
+      child->children[0] = left->children[left->count];
+      ++child->count;
+      parent->keys[i - 1] = left->keys[left->count - 1];
+      --left->count;
+      this->_inner_reset(left, left->count, left->count + 1);
+    } else if (right && right->count > _inner_min) {
+      child->keys[child->count] = parent->keys[i];
+      child->children[child->count + 1] = right->children[0];
+      ++child->count;
+      parent->keys[i] = right->keys[0];
+      for (size_type j = 1; j < right->count; ++j) {
+        right->keys[j - 1] = right->keys[j];
+      }
+      for (size_type j = 1; j <= right->count; ++j) {
+        right->children[j - 1] = right->children[j];
+      }
+      --right->count;
+      this->_inner_reset(right, right->count, right->count + 1);
+    } else if (left) {
+      this->_merge_inners(left, parent->keys[i - 1], child);
+      this->_inner_remove_at(parent, i - 1);
+    } else if (right) {
+      this->_merge_inners(child, parent->keys[i], right);
+      this->_inner_remove_at(parent, i);
+    }
+  };
+
+  /**
+   * @brief Append separator and right to left, free right.
+   */
+  void _merge_inners(_inner* left, const Key& separator, _inner* right) {
+    left->keys[left->count] = separator;
+    for (size_type j = 0; j < right->count; ++j) {
+      left->keys[left->count + 1 + j] = right->keys[j];
+    }
+    for (size_type j = 0; j <= right->count; ++j) {
+      left->children[left->count + 1 + j] = right->children[j];
+    }
+    left->count += right->count + 1;
+    this->_free_inner(right);
+  };
+
+  /**
+   * @brief Remove separator i and child i + 1.
+   */
+  void _inner_remove_at(_inner* node, size_type i) {
+    for (size_type j = i + 1; j < node->count; ++j) {
+      node->keys[j - 1] = node->keys[j];
+      node->children[j] = node->children[j + 1];
+    }
+    --node->count;
+    this->_inner_reset(node, node->count, node->count + 1);
+  };
+};
+
+template < class Key, class T, class Compare, class Alloc, std::size_t N >
+bool operator==(const btree_map< Key, T, Compare, Alloc, N >& lhs,
+                const btree_map< Key, T, Compare, Alloc, N >& rhs) {
+  return lhs.size() == rhs.size() &&
+         ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+};
+
+template < class Key, class T, class Compare, class Alloc, std::size_t N >
+bool operator!=(const btree_map< Key, T, Compare, Alloc, N >& lhs,
+                const btree_map< Key, T, Compare, Alloc, N >& rhs) {
+  return !(lhs == rhs);
+};
+
+template < class Key, class T, class Compare, class Alloc, std::size_t N >
+bool operator<(const btree_map< Key, T, Compare, Alloc, N >& lhs,
+               const btree_map< Key, T, Compare, Alloc, N >& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+};
+
+template < class Key, class T, class Compare, class Alloc, std::size_t N >
+bool operator<=(const btree_map< Key, T, Compare, Alloc, N >& lhs,
+                const btree_map< Key, T, Compare, Alloc, N >& rhs) {
+  return !(rhs < lhs);
+};
+
+template < class Key, class T, class Compare, class Alloc, std::size_t N >
+bool operator>(const btree_map< Key, T, Compare, Alloc, N >& lhs,
+               const btree_map< Key, T, Compare, Alloc, N >& rhs) {
+  return rhs < lhs;
+};
+
+template < class Key, class T, class Compare, class Alloc, std::size_t N >
+bool operator>=(const btree_map< Key, T, Compare, Alloc, N >& lhs,
+                const btree_map< Key, T, Compare, Alloc, N >& rhs) {
+  return !(lhs < rhs);
+};
+
+template < class Key, class T, class Compare, class Alloc, std::size_t N >
+void swap(btree_map< Key, T, Compare, Alloc, N >& x,
+          btree_map< Key, T, Compare, Alloc, N >& y) {
+  x.swap(y);
+};
+
+}  // namespace ft
+
+#endif  // FT__BTREE_MAP_HPP
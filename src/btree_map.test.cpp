@@ -0,0 +1,221 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/05
+ * @file src/btree_map.test.cpp
+ */
+
+#include "btree_map.hpp"
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+
+/* 64 byte nodes: 4 slots per node, so a few hundred keys build a deep tree */
+typedef ft::btree_map< int, int, std::less< int >,
+                       std::allocator< ft::pair< const int, int > >, 64 >
+    ft_small_btree;
+typedef std::map< int, int > std_btree;
+
+/* number of bt_test_resource values holding their resource */
+static int g_bt_test_live = 0;
+
+/**
+ * @brief Mapped value owning a counted resource, to see how long the tree
+ * keeps erased values alive.
+ */
+struct bt_test_resource {
+  bool owns;
+
+  bt_test_resource() : owns(false){};
+  explicit bt_test_resource(bool owns) : owns(owns) {
+    if (owns) ++g_bt_test_live;
+  };
+  bt_test_resource(const bt_test_resource& x) : owns(x.owns) {
+    if (owns) ++g_bt_test_live;
+  };
+  bt_test_resource& operator=(const bt_test_resource& x) {
+    if (owns) --g_bt_test_live;
+    owns = x.owns;
+    if (owns) ++g_bt_test_live;
+    return *this;
+  };
+  ~bt_test_resource() {
+    if (owns) --g_bt_test_live;
+  };
+};
+
+static bool same_content(const ft_small_btree& ft_m, const std_btree& std_m) {
+  if (ft_m.size() != std_m.size()) return false;
+  ft_small_btree::const_iterator ft_it = ft_m.begin();
+  std_btree::const_iterator std_it = std_m.begin();
+  for (; std_it != std_m.end(); ++ft_it, ++std_it) {
+    if (ft_it->first != std_it->first || ft_it->second != std_it->second)
+      return false;
+  }
+  if (ft_it != ft_m.end()) return false;
+
+  ft_small_btree::const_reverse_iterator ft_rit = ft_m.rbegin();
+  std_btree::const_reverse_iterator std_rit = std_m.rbegin();
+  for (; std_rit != std_m.rend(); ++ft_rit, ++std_rit) {
+    if ((*ft_rit).first != std_rit->first) return false;
+  }
+  return ft_rit == ft_m.rend();
+}
+
+void test_btree_map_modifiers(void) {
+  std::cout << "\t modifiers" << std::endl;
+
+  ft_small_btree ft_m;
+  std_btree std_m;
+
+  std::srand(1);
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 3000; ++i) {
+      int k = std::rand() % 1000;
+      ft_m[k] = i;
+      std_m[k] = i;
+    }
+    assert(same_content(ft_m, std_m));
+    assert(ft_m.height() > 2);
+    for (int i = 0; i < 3000; ++i) {
+      int k = std::rand() % 1000;
+      assert(ft_m.erase(k) == std_m.erase(k));
+    }
+    assert(same_content(ft_m, std_m));
+  }
+
+  for (int i = 0; i < 1000; ++i) {
+    assert(ft_m.insert(ft::make_pair(i, -i)).second ==
+           std_m.insert(std::make_pair(i, -i)).second);
+  }
+  assert(same_content(ft_m, std_m));
+  for (int i = 0; i < 1000; ++i) {
+    ft_m.erase(ft_m.find(i));
+    std_m.erase(std_m.find(i));
+  }
+  assert(ft_m.empty() && ft_m.height() == 1);
+  assert(ft_m.begin() == ft_m.end());
+
+  for (int i = 0; i < 500; ++i) {
+    ft_m[i] = i;
+    std_m[i] = i;
+  }
+  ft_m.erase(ft_m.lower_bound(100), ft_m.lower_bound(400));
+  std_m.erase(std_m.lower_bound(100), std_m.lower_bound(400));
+  assert(same_content(ft_m, std_m));
+  ft_m.erase(ft_m.lower_bound(450), ft_m.end());
+  std_m.erase(std_m.lower_bound(450), std_m.end());
+  assert(same_content(ft_m, std_m));
+
+  ft_small_btree ft_copy(ft_m);
+  assert(ft_copy == ft_m);
+  ft_copy[1000] = 0;
+  assert(ft_copy != ft_m && ft_m < ft_copy);
+  ft_copy = ft_m;
+  assert(ft_copy == ft_m);
+  ft_copy.clear();
+  assert(ft_copy.empty() && ft_copy.begin() == ft_copy.end());
+  ft_copy.swap(ft_m);
+  assert(ft_m.empty() && same_content(ft_copy, std_m));
+}
+
+void test_btree_map_lookup(void) {
+  std::cout << "\t lookup" << std::endl;
+
+  ft_small_btree ft_m;
+  std_btree std_m;
+  for (int i = 0; i < 300; i += 3) {
+    ft_m[i] = i;
+    std_m[i] = i;
+  }
+  for (int i = -2; i < 305; ++i) {
+    assert(ft_m.count(i) == std_m.count(i));
+    assert((ft_m.lower_bound(i) == ft_m.end()) ==
+           (std_m.lower_bound(i) == std_m.end()));
+    if (std_m.lower_bound(i) != std_m.end()) {
+      assert(ft_m.lower_bound(i)->first == std_m.lower_bound(i)->first);
+    }
+    assert((ft_m.upper_bound(i) == ft_m.end()) ==
+           (std_m.upper_bound(i) == std_m.end()));
+    if (std_m.upper_bound(i) != std_m.end()) {
+      assert(ft_m.upper_bound(i)->first == std_m.upper_bound(i)->first);
+    }
+  }
+  assert(ft_m.at(3) == 3);
+  try {
+    ft_m.at(4);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+
+  ft_small_btree::iterator it = ft_m.end();
+  --it;
+  assert(it->first == 297);
+  ft::pair< int, int > copied = *ft_m.begin();
+  assert(copied.first == 0);
+
+  ft::btree_map< std::string, std::string > words;
+  words["b"] = "two";
+  words["a"] = "one";
+  assert(words.begin()->second == "one" && words.size() == 2);
+}
+
+void test_btree_map_storage(void) {
+  std::cout << "\t storage" << std::endl;
+
+  // erased values release their resource at once, through every split,
+  // borrow and merge on the way
+  {
+    ft::btree_map< int, bt_test_resource, std::less< int >,
+                   std::allocator< ft::pair< const int, bt_test_resource > >,
+                   64 >
+        owners;
+    std::srand(3);
+    for (int i = 0; i < 2000; ++i) {
+      owners.insert(ft::make_pair(std::rand() % 1000, bt_test_resource(true)));
+      assert(g_bt_test_live == static_cast< int >(owners.size()));
+    }
+    for (int i = 0; i < 3000; ++i) {
+      owners.erase(std::rand() % 1000);
+      assert(g_bt_test_live == static_cast< int >(owners.size()));
+    }
+    owners.erase(owners.begin(), owners.end());
+    assert(owners.empty() && g_bt_test_live == 0);
+  }
+  assert(g_bt_test_live == 0);
+
+  // ascending inserts leave every leaf half full; a copy is packed
+  ft_small_btree sparse;
+  for (int i = 0; i < 1000; ++i) sparse[i] = i;
+  ft_small_btree packed(sparse);
+  assert(packed == sparse && packed.height() < sparse.height());
+  for (int i = 0; i < 1000; i += 2) packed.erase(i);
+  for (int i = 0; i < 1000; i += 2) assert(packed.count(i) == 0);
+  for (int i = 1; i < 1000; i += 2) assert(packed.at(i) == i);
+  // descending inserts split inner nodes on their left side; with an even
+  // inner_slots both halves must still get the same number of keys
+  ft_small_btree descending;
+  for (int i = 1000; i > 0; --i) descending[i] = i;
+  assert(descending.height() <= sparse.height());
+
+  ft_small_btree empty_copy((ft_small_btree()));
+  assert(empty_copy.empty() && empty_copy.begin() == empty_copy.end());
+  empty_copy[1] = 1;
+  assert(empty_copy.size() == 1);
+}
+
+void test_btree_map(void) {
+  std::cout << "Test: btree_map" << std::endl;
+  test_btree_map_modifiers();
+  test_btree_map_lookup();
+  test_btree_map_storage();
+}
@@ -0,0 +1,107 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/13
+ * @file src/compact_vector.bench.cpp
+ */
+
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "bench.hpp"
+#include "compact_vector.hpp"
+#include "vector.hpp"
+
+static std::size_t g_compact_bench_bytes = 0;
+
+/**
+ * @brief Stateless std::allocator that tracks live bytes, to measure the
+ * element storage behind each small vector.
+ */
+template < class T >
+class compact_counting_allocator : public std::allocator< T > {
+ public:
+  typedef typename std::allocator< T >::pointer pointer;
+  typedef typename std::allocator< T >::size_type size_type;
+
+  template < class U >
+  struct rebind {
+    typedef compact_counting_allocator< U > other;
+  };
+
+  compact_counting_allocator() {}
+  compact_counting_allocator(const compact_counting_allocator& other)
+      : std::allocator< T >(other) {}
+  template < class U >
+  compact_counting_allocator(const compact_counting_allocator< U >& other)
+      : std::allocator< T >(other) {}
+
+  pointer allocate(size_type n, const void* hint = 0) {
+    g_compact_bench_bytes += n * sizeof(T);
+    return std::allocator< T >::allocate(n, hint);
+  }
+
+  void deallocate(pointer p, size_type n) {
+    g_compact_bench_bytes -= n * sizeof(T);
+    std::allocator< T >::deallocate(p, n);
+  }
+};
+
+namespace {
+
+/* many tiny vectors, 0 to 3 ints each, like adjacency lists */
+const std::size_t g_objects = 1 << 20;
+
+template < class Small >
+std::size_t compact_bench_run(const char* name) {
+  char label[64];
+  std::size_t sum = 0;
+  g_compact_bench_bytes = 0;
+  ft::vector< Small > lists(g_objects);
+
+  double start = bench_now();
+  for (std::size_t i = 0; i < g_objects; ++i) {
+    for (std::size_t j = 0; j < i % 4; ++j) {
+      lists[i].push_back(static_cast< int >(i + j));
+    }
+  }
+  std::snprintf(label, sizeof(label), "%s fill", name);
+  bench_report(label, bench_now() - start, g_objects);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < g_objects; ++i) {
+    for (std::size_t j = 0; j < lists[i].size(); ++j) sum += lists[i][j];
+  }
+  std::snprintf(label, sizeof(label), "%s scan", name);
+  bench_report(label, bench_now() - start, g_objects);
+
+  std::cout << "\t " << name << " bytes per object: " << sizeof(Small)
+            << " header + "
+            << static_cast< double >(g_compact_bench_bytes) / g_objects
+            << " elements" << std::endl;
+  return sum;
+}
+
+}  // namespace
+
+void bench_compact_vector(void) {
+  std::cout << "Bench: compact_vector" << std::endl;
+
+  std::size_t sum = 0;
+  sum += compact_bench_run<
+      std::vector< int, compact_counting_allocator< int > > >("std::vector");
+  sum += compact_bench_run<
+      ft::vector< int, compact_counting_allocator< int > > >("ft::vector");
+  sum += compact_bench_run<
+      ft::compact_vector< int, compact_counting_allocator< int > > >(
+      "ft::compact_vector");
+  bench_sink(sum);
+}
@@ -0,0 +1,360 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/13
+ * @file src/compact_vector.hpp
+ */
+
+#if !defined(FT__COMPACT_VECTOR_HPP)
+#define FT__COMPACT_VECTOR_HPP
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+#include "algorithm.hpp"
+#include "iterator.hpp"
+#include "random_access_iterator.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+
+namespace ft {
+
+/**
+ * @brief A vector whose header is one pointer plus a 32-bit size and a 32-bit
+ * capacity (16 bytes on LP64, against 24 for ft::vector), meant for holding
+ * very many small sequences.
+ *
+ * A stateless allocator is kept as an empty base and takes no space. The price
+ * is a maximum of 2^32 - 1 elements, and end() costs an add.
+ *
+ * @tparam _T Type of the elements.
+ * @tparam _Alloc Type of the allocator object, defaults to `allocator<_T>`.
+ */
+template < class _T, class _Alloc = std::allocator< _T > >
+class compact_vector : private ft::allocator_holder< _Alloc > {
+  typedef ft::allocator_holder< _Alloc > _allocator_base;
+
+ public:
+  typedef _T value_type;
+  typedef _T const const_value_type;
+  typedef _Alloc allocator_type;
+  /* allocator_type::reference, defaults to `value_type&` */
+  typedef typename allocator_type::reference reference;
+  /* allocator_type::const_reference, defaults to `const value_type&` */
+  typedef typename allocator_type::const_reference const_reference;
+  /* allocator_type::pointer, defaults to `value_type*` */
+  typedef typename allocator_type::pointer pointer;
+  /* allocator_type::const_pointer, defaults to `const value_type*` */
+  typedef typename allocator_type::const_pointer const_pointer;
+  typedef typename ft::random_access_iterator< value_type > iterator;
+  typedef typename ft::random_access_iterator< const_value_type >
+      const_iterator;
+  typedef typename ft::reverse_iterator< iterator > reverse_iterator;
+  typedef typename ft::reverse_iterator< const_iterator >
+      const_reverse_iterator;
+  typedef
+      typename ft::iterator_traits< iterator >::difference_type difference_type;
+  typedef typename allocator_type::size_type size_type;
+
+ private:
+  /* width of the stored size and capacity */
+  typedef unsigned int _length_type;
+
+  pointer _start;
+  _length_type _size;
+  _length_type _capacity;
+
+ public:
+  explicit compact_vector(const allocator_type& alloc = allocator_type())
+      : _allocator_base(alloc), _start(u_nullptr), _size(0), _capacity(0){};
+
+  explicit compact_vector(size_type n, const value_type& val = value_type(),
+                          const allocator_type& alloc = allocator_type())
+      : _allocator_base(alloc), _start(u_nullptr), _size(0), _capacity(0) {
+    this->assign(n, val);
+  };
+
+  template < class InputIterator >
+  compact_vector(InputIterator first, InputIterator last,
+                 const allocator_type& alloc = allocator_type(),
+                 typename ft::enable_if<
+                     !ft::is_integral< InputIterator >::value >::type* =
+                     u_nullptr)
+      : _allocator_base(alloc), _start(u_nullptr), _size(0), _capacity(0) {
+    this->assign(first, last);
+  };
+
+  compact_vector(const compact_vector& x)
+      : _allocator_base(x._alloc()),
+        _start(u_nullptr),
+        _size(0),
+        _capacity(0) {
+    this->assign(x.begin(), x.end());
+  };
+
+  compact_vector& operator=(const compact_vector& x) {
+    if (this != &x) this->assign(x.begin(), x.end());
+    return *this;
+  };
+
+  ~compact_vector() {
+    this->clear();
+    if (this->_start) this->_alloc().deallocate(this->_start, this->_capacity);
+  };
+
+  iterator begin() { return iterator(this->_start); };
+  const_iterator begin() const { return const_iterator(this->_start); };
+  iterator end() { return iterator(this->_start + this->_size); };
+  const_iterator end() const {
+    return const_iterator(this->_start + this->_size);
+  };
+  reverse_iterator rbegin() { return reverse_iterator(this->end()); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(this->end());
+  };
+  reverse_iterator rend() { return reverse_iterator(this->begin()); };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(this->begin());
+  };
+
+  size_type size() const { return this->_size; };
+  size_type capacity() const { return this->_capacity; };
+  bool empty() const { return this->_size == 0; };
+
+  /**
+   * @brief The allocator's limit, capped by the 32-bit size field.
+   */
+  size_type max_size() const {
+    return std::min< size_type >(this->_alloc().max_size(),
+                                 static_cast< _length_type >(-1));
+  };
+
+  void resize(size_type n, value_type val = value_type()) {
+    if (n > this->max_size()) throw std::out_of_range("ft::compact_vector");
+    while (this->_size > n) this->pop_back();
+    if (n > this->_size) this->insert(this->end(), n - this->_size, val);
+  };
+
+  void reserve(size_type n) {
+    if (n > this->max_size()) throw std::out_of_range("ft::compact_vector");
+    if (n > this->_capacity) this->_reallocate(n);
+  };
+
+  /**
+   * @brief Release unused capacity, so a vector that stopped growing holds
+   * exactly its elements.
+   */
+  void shrink_to_fit() {
+    if (this->_capacity != this->_size) this->_reallocate(this->_size);
+  };
+
+  reference operator[](size_type n) { return this->_start[n]; };
+  const_reference operator[](size_type n) const { return this->_start[n]; };
+
+  reference at(size_type n) {
+    if (n >= this->_size) throw std::out_of_range("ft::compact_vector");
+    return this->_start[n];
+  };
+  const_reference at(size_type n) const {
+    if (n >= this->_size) throw std::out_of_range("ft::compact_vector");
+    return this->_start[n];
+  };
+
+  reference front() { return this->_start[0]; };
+  const_reference front() const { return this->_start[0]; };
+  reference back() { return this->_start[this->_size - 1]; };
+  const_reference back() const { return this->_start[this->_size - 1]; };
+
+  pointer data() { return this->_start; };
+  const_pointer data() const { return this->_start; };
+
+  template < class InputIterator >
+  void assign(
+      InputIterator first, InputIterator last,
+      typename ft::enable_if<
+          !ft::is_integral< InputIterator >::value >::type* = u_nullptr) {
+    this->clear();
+    this->reserve(ft::difference(first, last));
+    for (; first != last; ++first) {
+      this->_alloc().construct(this->_start + this->_size, *first);
+      ++this->_size;
+    }
+  };
+
+  void assign(size_type n, const value_type& val) {
+    value_type copy(val);
+    this->clear();
+    this->reserve(n);
+    while (this->_size < n) {
+      this->_alloc().construct(this->_start + this->_size, copy);
+      ++this->_size;
+    }
+  };
+
+  void push_back(const value_type& val) {
+    if (this->_size == this->_capacity) {
+      value_type copy(val);
+      this->_grow(1);
+      this->_alloc().construct(this->_start + this->_size, copy);
+    } else {
+      this->_alloc().construct(this->_start + this->_size, val);
+    }
+    ++this->_size;
+  };
+
+  void pop_back() {
+    --this->_size;
+    this->_alloc().destroy(this->_start + this->_size);
+  };
+
+  iterator insert(iterator position, const value_type& val) {
+    size_type at = position - this->begin();
+    this->insert(position, 1, val);
+    return this->begin() + at;
+  };
+
+  void insert(iterator position, size_type n, const value_type& val) {
+    if (n == 0) return;
+    value_type copy(val);
+    pointer gap = this->_open(position - this->begin(), n);
+    for (size_type i = 0; i < n; ++i) this->_alloc().construct(gap + i, copy);
+    this->_size += static_cast< _length_type >(n);
+  };
+
+  template < class InputIterator >
+  void insert(
+      iterator position, InputIterator first, InputIterator last,
+      typename ft::enable_if<
+          !ft::is_integral< InputIterator >::value >::type* = u_nullptr) {
+    size_type n = ft::difference(first, last);
+    if (n == 0) return;
+    pointer gap = this->_open(position - this->begin(), n);
+    for (size_type i = 0; i < n; ++i, ++first) {
+      this->_alloc().construct(gap + i, *first);
+    }
+    this->_size += static_cast< _length_type >(n);
+  };
+
+  iterator erase(iterator position) {
+    return this->erase(position, position + 1);
+  };
+
+  iterator erase(iterator first, iterator last) {
+    size_type at = first - this->begin();
+    size_type n = last - first;
+    if (n == 0) return first;
+    pointer target = this->_start + at;
+    for (pointer p = target + n; p != this->_start + this->_size; ++p) {
+      *target++ = *p;
+    }
+    while (n--) this->pop_back();
+    return this->begin() + at;
+  };
+
+  void swap(compact_vector& x) {
+    std::swap(this->_start, x._start);
+    std::swap(this->_size, x._size);
+    std::swap(this->_capacity, x._capacity);
+  };
+
+  void clear() {
+    while (this->_size) this->pop_back();
+  };
+
+  allocator_type get_allocator() const { return this->_alloc(); };
+
+ private:
+  /**
+   * @brief Move the elements into a new block of exactly n slots.
+   */
+  void _reallocate(size_type n) {
+    pointer next = n ? this->_alloc().allocate(n) : pointer(u_nullptr);
+    for (size_type i = 0; i < this->_size; ++i) {
+      this->_alloc().construct(next + i, this->_start[i]);
+      this->_alloc().destroy(this->_start + i);
+    }
+    if (this->_start) this->_alloc().deallocate(this->_start, this->_capacity);
+    this->_start = next;
+    this->_capacity = static_cast< _length_type >(n);
+  };
+
+  /**
+   * @brief Make room for n more elements, doubling up to max_size().
+   */
+  void _grow(size_type n) {
+    size_type limit = this->max_size();
+    if (n > limit - this->_size) throw std::out_of_range("ft::compact_vector");
+    size_type next = this->_capacity ? this->_capacity : 1;
+    while (next < this->_size + n) {
+      next = next > limit / 2 ? limit : next * 2;
+    }
+    this->_reallocate(next);
+  };
+
+  /**
+   * @brief Shift [at, size) up by n and return the raw slots left at `at`;
+   * the caller constructs them and adds n to the size.
+   */
+  pointer _open(size_type at, size_type n) {
+    if (n > this->_capacity - this->_size) this->_grow(n);
+    for (size_type i = this->_size; i > at; --i) {
+      this->_alloc().construct(this->_start + i - 1 + n, this->_start[i - 1]);
+      this->_alloc().destroy(this->_start + i - 1);
+    }
+    return this->_start + at;
+  };
+};
+
+template < class T, class Alloc >
+bool operator==(const compact_vector< T, Alloc >& lhs,
+                const compact_vector< T, Alloc >& rhs) {
+  return lhs.size() == rhs.size() &&
+         ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+};
+
+template < class T, class Alloc >
+bool operator!=(const compact_vector< T, Alloc >& lhs,
+                const compact_vector< T, Alloc >& rhs) {
+  return !(lhs == rhs);
+};
+
+template < class T, class Alloc >
+bool operator<(const compact_vector< T, Alloc >& lhs,
+               const compact_vector< T, Alloc >& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+};
+
+template < class T, class Alloc >
+bool operator<=(const compact_vector< T, Alloc >& lhs,
+                const compact_vector< T, Alloc >& rhs) {
+  return !(rhs < lhs);
+};
+
+template < class T, class Alloc >
+bool operator>(const compact_vector< T, Alloc >& lhs,
+               const compact_vector< T, Alloc >& rhs) {
+  return rhs < lhs;
+};
+
+template < class T, class Alloc >
+bool operator>=(const compact_vector< T, Alloc >& lhs,
+                const compact_vector< T, Alloc >& rhs) {
+  return !(lhs < rhs);
+};
+
+template < class T, class Alloc >
+void swap(compact_vector< T, Alloc >& x, compact_vector< T, Alloc >& y) {
+  x.swap(y);
+};
+
+}  // namespace ft
+
+#endif  // FT__COMPACT_VECTOR_HPP
@@ -0,0 +1,155 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/13
+ * @file src/compact_vector.test.cpp
+ */
+
+#include "compact_vector.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "vector.hpp"
+
+namespace {
+
+/**
+ * @brief std::allocator carrying state, which cannot be elided.
+ */
+template < class T >
+struct cv_test_allocator : public std::allocator< T > {
+  int id;
+
+  template < class U >
+  struct rebind {
+    typedef cv_test_allocator< U > other;
+  };
+
+  explicit cv_test_allocator(int i = 0) : id(i){};
+  template < class U >
+  cv_test_allocator(const cv_test_allocator< U >& other) : id(other.id){};
+};
+
+}  // namespace
+
+void test_compact_vector_footprint(void) {
+  std::cout << "\t footprint" << std::endl;
+
+  // one pointer and two 32-bit lengths, the allocator is elided
+  assert(sizeof(ft::compact_vector< int >) ==
+         sizeof(int*) + 2 * sizeof(unsigned int));
+  assert(sizeof(ft::compact_vector< std::string >) ==
+         sizeof(ft::compact_vector< char >));
+  // ft::vector elides std::allocator too
+  assert(sizeof(ft::vector< int >) == 3 * sizeof(int*));
+  assert(sizeof(ft::vector< int, cv_test_allocator< int > >) >
+         sizeof(ft::vector< int >));
+
+  ft::vector< int, cv_test_allocator< int > > v(cv_test_allocator< int >(7));
+  v.push_back(1);
+  assert(v.get_allocator().id == 7 && v[0] == 1);
+  ft::compact_vector< int, cv_test_allocator< int > > c(
+      cv_test_allocator< int >(9));
+  c.push_back(2);
+  assert(c.get_allocator().id == 9 && c[0] == 2);
+}
+
+void test_compact_vector_basic(void) {
+  std::cout << "\t basic" << std::endl;
+
+  ft::compact_vector< int > v;
+  assert(v.empty() && v.size() == 0 && v.capacity() == 0);
+  assert(v.begin() == v.end());
+  for (int i = 0; i < 100; ++i) v.push_back(i);
+  assert(v.size() == 100 && v.capacity() >= 100);
+  assert(v.front() == 0 && v.back() == 99 && v[42] == 42 && v.at(42) == 42);
+  assert(v.data() == &v[0]);
+  try {
+    v.at(100);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+  assert(v.max_size() <= static_cast< unsigned int >(-1));
+
+  typedef ft::compact_vector< int >::iterator iterator;
+  int n = 0;
+  for (iterator it = v.begin(); it != v.end(); ++it) assert(*it == n++);
+  ft::compact_vector< int >::reverse_iterator rit = v.rbegin();
+  assert(*rit == 99 && rit[99] == 0);
+
+  v.resize(10);
+  assert(v.size() == 10 && v.back() == 9);
+  v.shrink_to_fit();
+  assert(v.capacity() == 10);
+  v.resize(12, -1);
+  assert(v.size() == 12 && v[11] == -1);
+  v.clear();
+  v.shrink_to_fit();
+  assert(v.empty() && v.capacity() == 0 && v.data() == NULL);
+
+  ft::compact_vector< std::string > s(3, "abc");
+  assert(s.size() == 3 && s[2] == "abc");
+  // the value aliases an element that moves
+  s.push_back(s[0]);
+  s.insert(s.begin(), 4, s[1]);
+  assert(s.size() == 8 && s[0] == "abc" && s[7] == "abc");
+}
+
+void test_compact_vector_modifiers(void) {
+  std::cout << "\t modifiers" << std::endl;
+
+  ft::vector< std::string > source;
+  for (int i = 0; i < 5; ++i) source.push_back(std::string(1, 'a' + i));
+  ft::compact_vector< std::string > v(source.begin(), source.end());
+  assert(v.size() == 5 && v[4] == "e");
+
+  ft::compact_vector< std::string >::iterator it =
+      v.insert(v.begin() + 2, "x");
+  assert(*it == "x" && v.size() == 6 && v[3] == "c");
+  v.insert(v.end(), 2, "y");
+  v.insert(v.begin(), source.begin(), source.begin() + 2);
+  // a b a b x c d e y y
+  assert(v.size() == 10 && v[0] == "a" && v[2] == "a" && v[9] == "y");
+
+  it = v.erase(v.begin());
+  assert(*it == "b" && v.size() == 9);
+  it = v.erase(v.begin() + 1, v.begin() + 3);
+  assert(*it == "x" && v.size() == 7);
+  it = v.erase(v.end() - 1);
+  assert(it == v.end() && v.back() == "y");
+
+  ft::compact_vector< std::string > w(v);
+  assert(w == v && !(w < v) && w <= v && w >= v);
+  w[0] = "z";
+  assert(w != v && v < w && w > v);
+  w.swap(v);
+  assert(v[0] == "z");
+  ft::swap(w, v);
+  assert(w[0] == "z");
+  v = w;
+  assert(v == w);
+
+  v.assign(3, "q");
+  assert(v.size() == 3 && v[0] == "q");
+  v.assign(source.begin(), source.end());
+  assert(v.size() == 5 && v[1] == "b");
+  v.pop_back();
+  assert(v.size() == 4 && v.back() == "d");
+}
+
+void test_compact_vector(void) {
+  std::cout << "Test: compact_vector" << std::endl;
+  test_compact_vector_footprint();
+  test_compact_vector_basic();
+  test_compact_vector_modifiers();
+}
@@ -0,0 +1,94 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/08
+ * @file src/concurrent_vector.bench.cpp
+ */
+
+#include <pthread.h>
+
+#include <cstdio>
+#include <iostream>
+
+#include "bench.hpp"
+#include "concurrent_vector.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const std::size_t g_items = 1 << 22;
+
+struct locked_vector {
+  pthread_mutex_t lock;
+  ft::vector< std::size_t > items;
+
+  std::size_t push_back(std::size_t value) {
+    pthread_mutex_lock(&this->lock);
+    std::size_t index = this->items.size();
+    this->items.push_back(value);
+    pthread_mutex_unlock(&this->lock);
+    return index;
+  };
+};
+
+template < class Vector >
+struct append_run {
+  Vector* vec;
+  std::size_t items;
+};
+
+template < class Vector >
+void* append(void* arg) {
+  append_run< Vector >* run = static_cast< append_run< Vector >* >(arg);
+  for (std::size_t i = 0; i < run->items; ++i) run->vec->push_back(i);
+  return NULL;
+}
+
+template < class Vector >
+double scale(Vector* vec, int threads) {
+  append_run< Vector > runs[64];
+  pthread_t ids[64];
+  double start = bench_now();
+  for (int i = 0; i < threads; ++i) {
+    runs[i].vec = vec;
+    runs[i].items = g_items / threads;
+    pthread_create(&ids[i], NULL, append< Vector >, &runs[i]);
+  }
+  for (int i = 0; i < threads; ++i) pthread_join(ids[i], NULL);
+  return bench_now() - start;
+}
+
+}  // namespace
+
+void bench_concurrent_vector(void) {
+  std::cout << "Bench: concurrent_vector" << std::endl;
+
+  int cores = bench_cores();
+  char label[64];
+  std::size_t sum = 0;
+  /* 1, 2, 4, ... and finally the core count itself */
+  for (int threads = 1;; threads = threads * 2 < cores ? threads * 2 : cores) {
+    ft::concurrent_vector< std::size_t > vec;
+    std::snprintf(label, sizeof(label), "concurrent_vector push_back x%d",
+                  threads);
+    bench_report(label, scale(&vec, threads), g_items);
+    sum += vec.size();
+
+    locked_vector locked;
+    pthread_mutex_init(&locked.lock, NULL);
+    std::snprintf(label, sizeof(label), "mutex + ft::vector push_back x%d",
+                  threads);
+    bench_report(label, scale(&locked, threads), g_items);
+    pthread_mutex_destroy(&locked.lock);
+    sum += locked.items.size();
+
+    if (threads == cores) break;
+  }
+  bench_sink(sum);
+}
@@ -0,0 +1,326 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/08
+ * @file src/concurrent_vector.hpp
+ */
+
+#if !defined(FT__CONCURRENT_VECTOR_HPP)
+#define FT__CONCURRENT_VECTOR_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+#include "atomic.hpp"
+#include "util.hpp"
+
+namespace ft {
+
+/**
+ * @brief One power of two bucket of a concurrent_vector: the elements and a
+ * ready flag per element.
+ */
+template < class T >
+struct concurrent_segment {
+  T* data;
+  unsigned char* ready;
+};
+
+/**
+ * @brief Grow-only vector that many threads can append to and read from at
+ * the same time.
+ *
+ * Storage is a list of segments of 8, 16, 32, ... elements, so growing
+ * allocates a new segment and never moves an element: a reference or index
+ * stays valid for the life of the container. push_back and grow_by install
+ * any missing segment with one CAS, reserve indices with another and
+ * construct in place, so appends never wait on each other.
+ *
+ * size() only counts the prefix of fully constructed elements. An append
+ * whose predecessors are all published moves the size over its own elements
+ * with one CAS; otherwise it raises a ready flag per element. Either way it
+ * then pushes the published size forward over every ready element. Reading
+ * operator[](i) for i < size() is therefore always safe.
+ *
+ * clear() and destruction must not run concurrently with anything
+ * else.
+ *
+ * @tparam T Type of the elements.
+ * @tparam _Alloc allocator, rebound for segments and flags.
+ */
+template < class T, class _Alloc = std::allocator< T > >
+class concurrent_vector {
+ public:
+  /* The first template parameter (T) */
+  typedef T value_type;
+  /* The second template parameter (_Alloc) */
+  typedef _Alloc allocator_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  /* an unsigned integral type */
+  typedef std::size_t size_type;
+
+ private:
+  typedef concurrent_segment< T > _segment;
+  typedef typename _Alloc::template rebind< _segment >::other
+      _segment_allocator;
+  typedef typename _Alloc::template rebind< unsigned char >::other
+      _flag_allocator;
+
+  /* log2 of the size of segment 0 */
+  static const size_type _first_log = 3;
+  static const size_type _first_size = size_type(1) << _first_log;
+  static const size_type _max_segments = sizeof(size_type) * 8 - _first_log;
+
+  allocator_type _alloc;
+  _segment_allocator _segment_alloc;
+  _flag_allocator _flag_alloc;
+  ft::atomic< _segment* > _segments[_max_segments];
+  char _pad0[cache_line_size];
+  /* next index to hand out */
+  ft::atomic< size_type > _reserved;
+  char _pad1[cache_line_size];
+  /* every index below is constructed */
+  ft::atomic< size_type > _published;
+  char _pad2[cache_line_size];
+
+  concurrent_vector(const concurrent_vector&);
+  concurrent_vector& operator=(const concurrent_vector&);
+
+ public:
+  /**
+   * @brief empty container constructor (default constructor)
+   */
+  explicit concurrent_vector(const allocator_type& alloc = allocator_type())
+      : _alloc(alloc),
+        _segment_alloc(alloc),
+        _flag_alloc(alloc),
+        _reserved(0),
+        _published(0){};
+
+  ~concurrent_vector() {
+    this->clear();
+    for (size_type k = 0; k < _max_segments; ++k) {
+      _segment* segment = this->_segments[k].load(memory_order_relaxed);
+      if (segment) this->_free_segment(segment, k);
+    }
+  };
+
+  /**
+   * @brief Number of elements, all of them constructed.
+   */
+  size_type size() const {
+    return this->_published.load(memory_order_acquire);
+  };
+
+  bool empty() const { return this->size() == 0; };
+
+  size_type max_size() const { return this->_alloc.max_size(); };
+
+  /**
+   * @brief Number of elements the allocated segments can hold.
+   */
+  size_type capacity() const {
+    size_type k = 0;
+    while (k < _max_segments &&
+           this->_segments[k].load(memory_order_acquire)) {
+      ++k;
+    }
+    return _segment_base(k);
+  };
+
+  /**
+   * @brief Allocate the segments needed for n elements ahead of time. Safe
+   * to call concurrently with appends.
+   */
+  void reserve(size_type n) {
+    if (n) this->_ensure(0, n);
+  };
+
+  /**
+   * @brief Access element. Valid for any n < size(), even while other
+   * threads append.
+   */
+  reference operator[](size_type n) {
+    size_type k = _segment_of(n);
+    return this->_segments[k].load(memory_order_acquire)
+        ->data[n - _segment_base(k)];
+  };
+
+  const_reference operator[](size_type n) const {
+    size_type k = _segment_of(n);
+    return this->_segments[k].load(memory_order_acquire)
+        ->data[n - _segment_base(k)];
+  };
+
+  reference at(size_type n) {
+    if (n >= this->size()) throw std::out_of_range("ft::concurrent_vector");
+    return (*this)[n];
+  };
+
+  const_reference at(size_type n) const {
+    if (n >= this->size()) throw std::out_of_range("ft::concurrent_vector");
+    return (*this)[n];
+  };
+
+  /**
+   * @brief Append a copy of val.
+   *
+   * @return the index of the new element
+   */
+  size_type push_back(const value_type& val) {
+    return this->grow_by(1, val);
+  };
+
+  /**
+   * @brief Append n copies of val at consecutive indices.
+   *
+   * Reserved indices cannot be handed back once later appends hold the ones
+   * after them, so nothing that can fail runs in between: the segments are
+   * allocated before the indices are reserved, and if a copy throws, the
+   * rest of the run is default constructed and published before the
+   * exception is rethrown. The default constructor of T must not throw.
+   *
+   * @return the index of the first new element
+   */
+  size_type grow_by(size_type n, const value_type& val = value_type()) {
+    size_type first = this->_reserved.load(memory_order_relaxed);
+    if (n == 0) return first;
+    do {
+      this->_ensure(first, first + n);
+    } while (!this->_reserved.compare_exchange_weak(first, first + n,
+                                                    memory_order_relaxed));
+    size_type i = first;
+    try {
+      for (; i < first + n; ++i) this->_alloc.construct(&(*this)[i], val);
+    } catch (...) {
+      // in place: construct would copy a temporary, and copies may throw
+      for (; i < first + n; ++i) new (&(*this)[i]) value_type();
+      this->_publish_run(first, n);
+      throw;
+    }
+    this->_publish_run(first, n);
+    return first;
+  };
+
+  /**
+   * @brief Destroy every element, keeping the segments (not thread safe).
+   */
+  void clear() {
+    size_type end = this->_reserved.load(memory_order_relaxed);
+    for (size_type i = 0; i < end; ++i) {
+      size_type k = _segment_of(i);
+      _segment* segment = this->_segments[k].load(memory_order_relaxed);
+      this->_alloc.destroy(segment->data + (i - _segment_base(k)));
+    }
+    for (size_type k = 0; k < _max_segments; ++k) {
+      _segment* segment = this->_segments[k].load(memory_order_relaxed);
+      if (segment) std::memset(segment->ready, 0, _segment_size(k));
+    }
+    this->_reserved.store(0, memory_order_relaxed);
+    this->_published.store(0, memory_order_relaxed);
+  };
+
+  allocator_type get_allocator() const { return this->_alloc; };
+
+ private:
+  static size_type _log2(size_type n) {
+    return sizeof(unsigned long) * 8 - 1 -
+           __builtin_clzl(static_cast< unsigned long >(n));
+  };
+
+  static size_type _segment_of(size_type i) {
+    return _log2(i + _first_size) - _first_log;
+  };
+
+  /* index of the first element of segment k */
+  static size_type _segment_base(size_type k) {
+    return (_first_size << k) - _first_size;
+  };
+
+  static size_type _segment_size(size_type k) { return _first_size << k; };
+
+  /**
+   * @brief Make sure every segment holding an index in [first, last)
+   * exists. Racing threads may each allocate a segment; the CAS loser frees
+   * its copy.
+   */
+  void _ensure(size_type first, size_type last) {
+    for (size_type k = _segment_of(first); k <= _segment_of(last - 1); ++k) {
+      if (this->_segments[k].load(memory_order_acquire)) continue;
+      _segment* fresh = this->_new_segment(k);
+      _segment* expected = ft::u_nullptr;
+      if (!this->_segments[k].compare_exchange_strong(expected, fresh,
+                                                      memory_order_acq_rel)) {
+        this->_free_segment(fresh, k);
+      }
+    }
+  };
+
+  _segment* _new_segment(size_type k) {
+    _segment* segment = this->_segment_alloc.allocate(1);
+    segment->data = this->_alloc.allocate(_segment_size(k));
+    segment->ready = this->_flag_alloc.allocate(_segment_size(k));
+    std::memset(segment->ready, 0, _segment_size(k));
+    return segment;
+  };
+
+  void _free_segment(_segment* segment, size_type k) {
+    this->_alloc.deallocate(segment->data, _segment_size(k));
+    this->_flag_alloc.deallocate(segment->ready, _segment_size(k));
+    this->_segment_alloc.deallocate(segment, 1);
+  };
+
+  /**
+   * @brief Make the constructed elements [first, first + n) visible.
+   */
+  void _publish_run(size_type first, size_type n) {
+    // uncontended: nothing before first is pending, publish in one step
+    size_type expected = first;
+    if (!this->_published.compare_exchange_strong(expected, first + n)) {
+      for (size_type i = first; i < first + n; ++i) {
+        size_type k = _segment_of(i);
+        _segment* segment = this->_segments[k].load(memory_order_relaxed);
+        __atomic_store_n(segment->ready + (i - _segment_base(k)), 1,
+                         __ATOMIC_SEQ_CST);
+      }
+    }
+    this->_publish();
+  };
+
+  bool _is_ready(size_type i) const {
+    size_type k = _segment_of(i);
+    _segment* segment = this->_segments[k].load(memory_order_acquire);
+    // the owner of i may not have installed its segment yet
+    if (!segment) return false;
+    return __atomic_load_n(segment->ready + (i - _segment_base(k)),
+                           __ATOMIC_SEQ_CST);
+  };
+
+  /**
+   * @brief Move the published size over every ready element. The flag
+   * store and this loop are both sequentially consistent, so for each
+   * element either its owner sees the size reach it or the thread that
+   * moved the size there sees its flag.
+   */
+  void _publish() {
+    size_type published = this->_published.load();
+    while (published < this->_reserved.load() && this->_is_ready(published)) {
+      this->_published.compare_exchange_weak(published, published + 1);
+      published = this->_published.load();
+    }
+  };
+};
+
+}  // namespace ft
+
+#endif  // FT__CONCURRENT_VECTOR_HPP
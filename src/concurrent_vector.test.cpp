@@ -0,0 +1,162 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/08
+ * @file src/concurrent_vector.test.cpp
+ */
+
+#include "concurrent_vector.hpp"
+
+#include <pthread.h>
+
+#include <cassert>
+#include <iostream>
+#include <string>
+
+void test_concurrent_vector_single(void) {
+  std::cout << "\t single thread" << std::endl;
+
+  ft::concurrent_vector< std::string > vec;
+  assert(vec.empty() && vec.capacity() == 0);
+
+  assert(vec.push_back("zero") == 0);
+  const std::string* first = &vec[0];
+  for (int i = 1; i < 100; ++i) {
+    assert(vec.push_back(std::string(i % 7 + 1, 'a')) ==
+           static_cast< std::size_t >(i));
+  }
+  // growth never moves elements
+  assert(first == &vec[0] && *first == "zero");
+  assert(vec.size() == 100 && vec.capacity() >= 100);
+  assert(vec[99] == std::string(99 % 7 + 1, 'a'));
+
+  assert(vec.grow_by(50, "fill") == 100 && vec.size() == 150);
+  assert(vec.at(149) == "fill" && vec.at(100) == "fill");
+  try {
+    vec.at(150);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+
+  std::size_t capacity = vec.capacity();
+  vec.clear();
+  assert(vec.empty() && vec.capacity() == capacity);
+  vec.reserve(1000);
+  assert(vec.capacity() >= 1000 && vec.push_back("again") == 0);
+}
+
+namespace {
+
+/* copies left before a concurrent_vector_test_fragile copy throws */
+int g_cv_test_copies = -1;
+
+struct concurrent_vector_test_fragile {
+  int value;
+
+  concurrent_vector_test_fragile() : value(0){};
+  explicit concurrent_vector_test_fragile(int v) : value(v){};
+  concurrent_vector_test_fragile(const concurrent_vector_test_fragile& x)
+      : value(x.value) {
+    if (g_cv_test_copies == 0) throw std::string("copy");
+    if (g_cv_test_copies > 0) --g_cv_test_copies;
+  };
+};
+
+}  // namespace
+
+void test_concurrent_vector_exceptions(void) {
+  std::cout << "\t exceptions" << std::endl;
+
+  // a copy throwing halfway through a run still publishes the whole run,
+  // the failed part default constructed, so later appends show up
+  ft::concurrent_vector< concurrent_vector_test_fragile > vec;
+  concurrent_vector_test_fragile one(1);
+  vec.grow_by(3, one);
+  g_cv_test_copies = 2;
+  try {
+    vec.grow_by(5, one);
+    assert(false);
+  } catch (const std::string& e) {
+  }
+  g_cv_test_copies = -1;
+  assert(vec.size() == 8 && vec[4].value == 1 && vec[5].value == 0);
+  assert(vec.push_back(one) == 8 && vec.size() == 9 && vec[8].value == 1);
+}
+
+namespace {
+
+const unsigned long g_per_thread = 20000;
+const int g_writers = 4;
+
+struct concurrent_vector_test_args {
+  ft::concurrent_vector< unsigned long >* vec;
+  unsigned long id;
+  unsigned long* indices;
+};
+
+void* concurrent_vector_test_writer(void* arg) {
+  concurrent_vector_test_args* args =
+      static_cast< concurrent_vector_test_args* >(arg);
+  for (unsigned long i = 0; i < g_per_thread; i += 2) {
+    // values are never 0, so a torn read of an unconstructed slot shows up
+    unsigned long value = args->id * g_per_thread + i + 1;
+    args->indices[i] = args->vec->push_back(value);
+    args->indices[i + 1] = args->vec->grow_by(1, value + 1);
+  }
+  return NULL;
+}
+
+void* concurrent_vector_test_reader(void* arg) {
+  ft::concurrent_vector< unsigned long >* vec =
+      static_cast< ft::concurrent_vector< unsigned long >* >(arg);
+  const unsigned long total = g_per_thread * g_writers;
+  std::size_t seen = 0;
+  while (seen < total) {
+    std::size_t size = vec->size();
+    for (; seen < size; ++seen) assert((*vec)[seen] != 0);
+    sched_yield();
+  }
+  return NULL;
+}
+
+}  // namespace
+
+void test_concurrent_vector_threads(void) {
+  std::cout << "\t concurrent append / read" << std::endl;
+
+  ft::concurrent_vector< unsigned long > vec;
+  static unsigned long indices[g_writers][g_per_thread];
+  concurrent_vector_test_args args[g_writers];
+  pthread_t writers[g_writers];
+  pthread_t reader;
+
+  pthread_create(&reader, NULL, concurrent_vector_test_reader, &vec);
+  for (int i = 0; i < g_writers; ++i) {
+    args[i].vec = &vec;
+    args[i].id = i;
+    args[i].indices = indices[i];
+    pthread_create(&writers[i], NULL, concurrent_vector_test_writer, &args[i]);
+  }
+  for (int i = 0; i < g_writers; ++i) pthread_join(writers[i], NULL);
+  pthread_join(reader, NULL);
+
+  assert(vec.size() == g_per_thread * g_writers);
+  for (int t = 0; t < g_writers; ++t) {
+    for (unsigned long i = 0; i < g_per_thread; ++i) {
+      assert(vec[indices[t][i]] == t * g_per_thread + i + 1);
+    }
+  }
+}
+
+void test_concurrent_vector(void) {
+  std::cout << "Test: concurrent_vector" << std::endl;
+  test_concurrent_vector_single();
+  test_concurrent_vector_exceptions();
+  test_concurrent_vector_threads();
+}
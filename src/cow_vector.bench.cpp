@@ -0,0 +1,100 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/16
+ * @file src/cow_vector.bench.cpp
+ */
+
+#include <cstdio>
+#include <iostream>
+
+#include "bench.hpp"
+#include "cow_vector.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const std::size_t g_items = 1 << 20;
+const int g_stages = 64;
+
+void cow_bench_write(ft::vector< int >& batch, int at, int value) {
+  batch[at] = value;
+}
+
+void cow_bench_write(ft::cow_vector< int >& batch, int at, int value) {
+  batch.set(at, value);
+}
+
+/**
+ * @brief One pipeline stage: takes the batch by value, reads all of it and
+ * hands it on; every `write_every` stages one element is changed.
+ */
+template < class Vector >
+Vector cow_bench_stage(Vector batch, int stage, int write_every,
+                       std::size_t* sum) {
+  const Vector& view = batch;
+  std::size_t total = 0;
+  for (std::size_t i = 0; i < view.size(); ++i) total += view[i];
+  *sum += total;
+  if (write_every && stage % write_every == 0) {
+    cow_bench_write(batch, stage, view[stage] + 1);
+  }
+  return batch;
+}
+
+template < class Vector >
+std::size_t cow_bench_pipeline(const char* name, int write_every) {
+  char label[64];
+  std::size_t sum = 0;
+  Vector batch(g_items, 1);
+  double start = bench_now();
+  for (int stage = 0; stage < g_stages; ++stage) {
+    batch = cow_bench_stage(batch, stage, write_every, &sum);
+  }
+  if (write_every) {
+    std::snprintf(label, sizeof(label), "%s write 1/%d", name, write_every);
+  } else {
+    std::snprintf(label, sizeof(label), "%s read only", name);
+  }
+  /* per element read */
+  bench_report(label, bench_now() - start, g_items * g_stages);
+  return sum;
+}
+
+}  // namespace
+
+void bench_cow_vector(void) {
+  std::cout << "Bench: cow_vector" << std::endl;
+
+  std::size_t sum = 0;
+  int write_every[] = {0, 8, 1};
+  for (int i = 0; i < 3; ++i) {
+    sum += cow_bench_pipeline< ft::vector< int > >("ft::vector",
+                                                   write_every[i]);
+    sum += cow_bench_pipeline< ft::cow_vector< int > >("ft::cow_vector",
+                                                       write_every[i]);
+  }
+
+  ft::cow_vector< int > source(g_items, 1);
+  double start = bench_now();
+  for (int i = 0; i < 1000; ++i) {
+    ft::cow_vector< int > copy(source);
+    sum += copy.size();
+  }
+  bench_report("ft::cow_vector copy (1M ints)", bench_now() - start, 1000);
+
+  ft::vector< int > plain(g_items, 1);
+  start = bench_now();
+  for (int i = 0; i < 100; ++i) {
+    ft::vector< int > copy(plain);
+    sum += copy.size();
+  }
+  bench_report("ft::vector copy (1M ints)", bench_now() - start, 100);
+  bench_sink(sum);
+}
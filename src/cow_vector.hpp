@@ -0,0 +1,359 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/16
+ * @file src/cow_vector.hpp
+ */
+
+#if !defined(FT__COW_VECTOR_HPP)
+#define FT__COW_VECTOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+#include "algorithm.hpp"
+#include "atomic.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+/**
+ * @brief Reference counted buffer shared by copies of a cow_vector.
+ */
+template < class T, class _Alloc >
+struct cow_buffer {
+  ft::atomic< std::size_t > refs;
+  /* false once a reference into items was handed out */
+  bool shareable;
+  ft::vector< T, _Alloc > items;
+
+  explicit cow_buffer(const _Alloc& alloc)
+      : refs(1), shareable(true), items(alloc){};
+
+  /**
+   * @brief copy Construct: a fresh, unshared copy of the elements
+   */
+  cow_buffer(const cow_buffer& other)
+      : refs(1), shareable(true), items(other.items){};
+};
+
+/**
+ * @brief Vector whose copies share one buffer until one of them is
+ * modified.
+ *
+ * Copying and assigning only bump an atomic reference count; the first
+ * modification through a copy whose buffer is shared copies the elements
+ * first. A buffer is never modified while shared, so copies held by
+ * different threads can all be read at once; a single cow_vector object is
+ * no more thread safe than ft::vector.
+ *
+ * Non-const element access and non-const iterators make the buffer private
+ * and pin it: the returned references must keep pointing into this vector
+ * only, so later copies take a deep copy until the contents are replaced
+ * (assign, clear, operator=). Read through a const reference and write with
+ * set() or the modifiers to keep sharing.
+ *
+ * @tparam T Type of the elements.
+ * @tparam _Alloc Allocator of the elements, rebound for the buffer.
+ */
+template < class T, class _Alloc = std::allocator< T > >
+class cow_vector {
+ public:
+  typedef ft::vector< T, _Alloc > vector_type;
+  typedef typename vector_type::value_type value_type;
+  typedef typename vector_type::allocator_type allocator_type;
+  typedef typename vector_type::reference reference;
+  typedef typename vector_type::const_reference const_reference;
+  typedef typename vector_type::pointer pointer;
+  typedef typename vector_type::const_pointer const_pointer;
+  typedef typename vector_type::iterator iterator;
+  typedef typename vector_type::const_iterator const_iterator;
+  typedef typename vector_type::reverse_iterator reverse_iterator;
+  typedef typename vector_type::const_reverse_iterator const_reverse_iterator;
+  typedef typename vector_type::difference_type difference_type;
+  typedef typename vector_type::size_type size_type;
+
+ private:
+  typedef ft::cow_buffer< T, _Alloc > _buffer_type;
+  typedef typename _Alloc::template rebind< _buffer_type >::other
+      _buffer_allocator;
+
+  allocator_type _alloc;
+  _buffer_allocator _buffer_alloc;
+  /* null while empty and never written */
+  _buffer_type* _buffer;
+
+ public:
+  explicit cow_vector(const allocator_type& alloc = allocator_type())
+      : _alloc(alloc), _buffer_alloc(alloc), _buffer(u_nullptr){};
+
+  explicit cow_vector(size_type n, const value_type& val = value_type(),
+                      const allocator_type& alloc = allocator_type())
+      : _alloc(alloc), _buffer_alloc(alloc), _buffer(u_nullptr) {
+    this->assign(n, val);
+  };
+
+  template < class InputIterator >
+  cow_vector(InputIterator first, InputIterator last,
+             const allocator_type& alloc = allocator_type(),
+             typename ft::enable_if<
+                 !ft::is_integral< InputIterator >::value >::type* = u_nullptr)
+      : _alloc(alloc), _buffer_alloc(alloc), _buffer(u_nullptr) {
+    this->assign(first, last);
+  };
+
+  /**
+   * @brief copy Construct: shares x's buffer, O(1) unless x is pinned
+   */
+  cow_vector(const cow_vector& x)
+      : _alloc(x._alloc), _buffer_alloc(x._buffer_alloc), _buffer(u_nullptr) {
+    this->_share(x);
+  };
+
+  cow_vector& operator=(const cow_vector& x) {
+    if (this != &x) {
+      cow_vector tmp(x);
+      this->swap(tmp);
+    }
+    return *this;
+  };
+
+  ~cow_vector() { this->_release(); };
+
+  /* read access, which keeps the buffer shared */
+
+  const_iterator begin() const { return this->_items().begin(); };
+  const_iterator end() const { return this->_items().end(); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(this->end());
+  };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(this->begin());
+  };
+
+  size_type size() const { return this->_items().size(); };
+  size_type capacity() const { return this->_items().capacity(); };
+  size_type max_size() const { return this->_alloc.max_size(); };
+  bool empty() const { return this->size() == 0; };
+
+  const_reference operator[](size_type n) const { return this->_items()[n]; };
+  const_reference at(size_type n) const {
+    if (n >= this->size()) throw std::out_of_range("ft::cow_vector");
+    return this->_items()[n];
+  };
+  const_reference front() const { return this->_items().front(); };
+  const_reference back() const { return this->_items().back(); };
+
+  /**
+   * @brief The underlying vector, read only and possibly shared.
+   */
+  const vector_type& items() const { return this->_items(); };
+
+  /* write access: unshares, and pins the buffer to this vector */
+
+  iterator begin() { return this->_pin().begin(); };
+  iterator end() { return this->_pin().end(); };
+  reverse_iterator rbegin() { return reverse_iterator(this->end()); };
+  reverse_iterator rend() { return reverse_iterator(this->begin()); };
+  reference operator[](size_type n) { return this->_pin()[n]; };
+  reference at(size_type n) {
+    if (n >= this->size()) throw std::out_of_range("ft::cow_vector");
+    return this->_pin()[n];
+  };
+  reference front() { return this->_pin().front(); };
+  reference back() { return this->_pin().back(); };
+
+  /* modifiers: unshare first */
+
+  void resize(size_type n, value_type val = value_type()) {
+    this->_write().resize(n, val);
+  };
+  void reserve(size_type n) { this->_write().reserve(n); };
+
+  template < class InputIterator >
+  void assign(
+      InputIterator first, InputIterator last,
+      typename ft::enable_if<
+          !ft::is_integral< InputIterator >::value >::type* = u_nullptr) {
+    this->clear();
+    vector_type& items = this->_write();
+    for (; first != last; ++first) items.push_back(*first);
+  };
+
+  void assign(size_type n, const value_type& val) {
+    this->clear();
+    vector_type& items = this->_write();
+    items.insert(items.end(), n, val);
+  };
+
+  /**
+   * @brief Overwrite element n. Unlike operator[], this does not pin the
+   * buffer, so later copies still share it.
+   */
+  void set(size_type n, const value_type& val) { this->_write()[n] = val; };
+
+  void push_back(const value_type& val) { this->_write().push_back(val); };
+  void pop_back() { this->_write().pop_back(); };
+
+  iterator insert(iterator position, const value_type& val) {
+    return this->_write().insert(position, val);
+  };
+  void insert(iterator position, size_type n, const value_type& val) {
+    this->_write().insert(position, n, val);
+  };
+  template < class InputIterator >
+  void insert(
+      iterator position, InputIterator first, InputIterator last,
+      typename ft::enable_if<
+          !ft::is_integral< InputIterator >::value >::type* = u_nullptr) {
+    this->_write().insert(position, first, last);
+  };
+
+  iterator erase(iterator position) {
+    return this->_write().erase(position);
+  };
+  iterator erase(iterator first, iterator last) {
+    return this->_write().erase(first, last);
+  };
+
+  /**
+   * @brief Drop this vector's reference; a shared buffer is left untouched.
+   */
+  void clear() {
+    if (this->_buffer && this->_buffer->refs.load(memory_order_acquire) == 1) {
+      this->_buffer->items.clear();
+      this->_buffer->shareable = true;
+    } else {
+      this->_release();
+    }
+  };
+
+  void swap(cow_vector& x) {
+    _buffer_type* buffer = x._buffer;
+    x._buffer = this->_buffer;
+    this->_buffer = buffer;
+  };
+
+  /**
+   * @brief Give this vector its own copy of a shared buffer now, so the copy
+   * is not paid on a later write.
+   */
+  void unshare() {
+    if (this->_buffer) this->_write();
+  };
+
+  /**
+   * @brief Number of cow_vectors sharing this one's buffer, 0 when empty.
+   */
+  size_type use_count() const {
+    return this->_buffer ? this->_buffer->refs.load(memory_order_acquire) : 0;
+  };
+
+  allocator_type get_allocator() const { return this->_alloc; };
+
+ private:
+  const vector_type& _items() const {
+    static const vector_type empty;
+    return this->_buffer ? this->_buffer->items : empty;
+  };
+
+  void _share(const cow_vector& x) {
+    if (!x._buffer) return;
+    if (x._buffer->shareable) {
+      x._buffer->refs.fetch_add(1, memory_order_relaxed);
+      this->_buffer = x._buffer;
+    } else {
+      this->_buffer = this->_buffer_alloc.allocate(1);
+      this->_buffer_alloc.construct(this->_buffer, *x._buffer);
+    }
+  };
+
+  void _release() {
+    if (!this->_buffer) return;
+    if (this->_buffer->refs.fetch_sub(1, memory_order_acq_rel) == 1) {
+      this->_buffer_alloc.destroy(this->_buffer);
+      this->_buffer_alloc.deallocate(this->_buffer, 1);
+    }
+    this->_buffer = u_nullptr;
+  };
+
+  /**
+   * @brief The elements, owned by this vector alone.
+   */
+  vector_type& _write() {
+    if (!this->_buffer) {
+      this->_buffer = this->_buffer_alloc.allocate(1);
+      this->_buffer_alloc.construct(this->_buffer, _buffer_type(this->_alloc));
+    } else if (this->_buffer->refs.load(memory_order_acquire) != 1) {
+      _buffer_type* copy = this->_buffer_alloc.allocate(1);
+      this->_buffer_alloc.construct(copy, *this->_buffer);
+      this->_release();
+      this->_buffer = copy;
+    }
+    return this->_buffer->items;
+  };
+
+  /**
+   * @brief _write(), and keep later copies off this buffer.
+   */
+  vector_type& _pin() {
+    vector_type& items = this->_write();
+    this->_buffer->shareable = false;
+    return items;
+  };
+};
+
+template < class T, class Alloc >
+bool operator==(const cow_vector< T, Alloc >& lhs,
+                const cow_vector< T, Alloc >& rhs) {
+  // copies sharing a buffer compare equal without a scan
+  return &lhs.items() == &rhs.items() || lhs.items() == rhs.items();
+};
+
+template < class T, class Alloc >
+bool operator!=(const cow_vector< T, Alloc >& lhs,
+                const cow_vector< T, Alloc >& rhs) {
+  return !(lhs == rhs);
+};
+
+template < class T, class Alloc >
+bool operator<(const cow_vector< T, Alloc >& lhs,
+               const cow_vector< T, Alloc >& rhs) {
+  return lhs.items() < rhs.items();
+};
+
+template < class T, class Alloc >
+bool operator<=(const cow_vector< T, Alloc >& lhs,
+                const cow_vector< T, Alloc >& rhs) {
+  return !(rhs < lhs);
+};
+
+template < class T, class Alloc >
+bool operator>(const cow_vector< T, Alloc >& lhs,
+               const cow_vector< T, Alloc >& rhs) {
+  return rhs < lhs;
+};
+
+template < class T, class Alloc >
+bool operator>=(const cow_vector< T, Alloc >& lhs,
+                const cow_vector< T, Alloc >& rhs) {
+  return !(lhs < rhs);
+};
+
+template < class T, class Alloc >
+void swap(cow_vector< T, Alloc >& x, cow_vector< T, Alloc >& y) {
+  x.swap(y);
+};
+
+}  // namespace ft
+
+#endif  // FT__COW_VECTOR_HPP
@@ -0,0 +1,146 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/16
+ * @file src/cow_vector.test.cpp
+ */
+
+#include "cow_vector.hpp"
+
+#include <pthread.h>
+
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+typedef ft::cow_vector< std::string > ft_cow;
+
+void test_cow_vector_sharing(void) {
+  std::cout << "\t sharing" << std::endl;
+
+  ft_cow a;
+  const ft_cow& ca = a;
+  assert(a.empty() && a.use_count() == 0 && ca.begin() == ca.end());
+  for (int i = 0; i < 10; ++i) a.push_back(std::string(1, 'a' + i));
+  assert(a.size() == 10 && a.use_count() == 1);
+
+  ft_cow b(a);
+  ft_cow c;
+  c = b;
+  const ft_cow& cb = b;
+  // copies share, and reading through const keeps sharing
+  assert(a.use_count() == 3 && &a.items() == &b.items() && c == a);
+  assert(cb[3] == "d" && cb.at(9) == "j" && cb.front() == "a");
+  assert(b.use_count() == 3);
+
+  // the first write copies
+  b.push_back("k");
+  assert(b.use_count() == 1 && a.use_count() == 2);
+  assert(b.size() == 11 && a.size() == 10 && b != a);
+  c.unshare();
+  assert(a.use_count() == 1 && c.use_count() == 1 && c == a);
+  assert(&c.items() != &a.items());
+
+  ft_cow e(c);
+  e.set(0, "set");
+  ft_cow f(e);
+  assert(f.use_count() == 2 && f.items()[0] == "set");
+  assert(e.items()[0] == "set" && c.items()[0] == "a");
+  // a non-const operator[] unshares before handing out the reference
+  assert(e[0] == "set" && f.use_count() == 1);
+
+  c.erase(c.begin(), c.begin() + 5);
+  c.insert(c.begin(), "z");
+  assert(c.size() == 6 && c[0] == "z" && a[0] == "a");
+
+  ft_cow d(a);
+  d.clear();
+  assert(d.empty() && a.size() == 10 && a.use_count() == 1);
+  try {
+    d.at(0);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+}
+
+void test_cow_vector_pinning(void) {
+  std::cout << "\t pinning" << std::endl;
+
+  ft_cow a(3, "x");
+  std::string& ref = a[0];
+  // a reference was handed out: copies no longer share
+  ft_cow b(a);
+  assert(b.use_count() == 1 && a.use_count() == 1);
+  ref = "changed";
+  assert(a[0] == "changed" && b[0] == "x");
+
+  ft_cow::iterator it = a.begin();
+  *it = "again";
+  assert(a.front() == "again");
+
+  // replacing the contents makes it shareable again
+  a.assign(2, "y");
+  ft_cow c(a);
+  assert(c.use_count() == 2);
+
+  ft::swap(b, c);
+  assert(b.size() == 2 && c.size() == 3);
+  assert(c < b && b > c && b >= c && c <= b);
+}
+
+namespace {
+
+struct cow_test_reader {
+  ft_cow copy;
+  std::size_t total;
+
+  explicit cow_test_reader(const ft_cow& v) : copy(v), total(0){};
+};
+
+void* cow_test_read(void* arg) {
+  cow_test_reader* reader = static_cast< cow_test_reader* >(arg);
+  for (int round = 0; round < 100; ++round) {
+    ft_cow local(reader->copy);
+    const ft_cow& view = local;
+    for (std::size_t i = 0; i < view.size(); ++i) {
+      reader->total += view[i].size();
+    }
+  }
+  return NULL;
+}
+
+}  // namespace
+
+void test_cow_vector_threads(void) {
+  std::cout << "\t threads" << std::endl;
+
+  ft_cow shared(1000, "abc");
+  cow_test_reader* readers[4];
+  pthread_t threads[4];
+  for (int i = 0; i < 4; ++i) {
+    readers[i] = new cow_test_reader(shared);
+    pthread_create(&threads[i], NULL, cow_test_read, readers[i]);
+  }
+  // the writer unshares while readers copy and read
+  for (int i = 0; i < 100; ++i) shared.push_back("d");
+  for (int i = 0; i < 4; ++i) {
+    pthread_join(threads[i], NULL);
+    assert(readers[i]->total == 100 * 1000 * 3);
+    delete readers[i];
+  }
+  assert(shared.size() == 1100 && shared.use_count() == 1);
+}
+
+void test_cow_vector(void) {
+  std::cout << "Test: cow_vector" << std::endl;
+  test_cow_vector_sharing();
+  test_cow_vector_pinning();
+  test_cow_vector_threads();
+}
@@ -0,0 +1,104 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/04
+ * @file src/flat_map.bench.cpp
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+
+#include "bench.hpp"
+#include "flat_map.hpp"
+#include "vector.hpp"
+
+void bench_flat_map(void) {
+  std::cout << "Bench: flat_map" << std::endl;
+
+  const std::size_t n = 1 << 20;
+  const std::size_t lookups = 1 << 22;
+
+  ft::vector< ft::pair< unsigned int, unsigned int > > input;
+  input.reserve(n);
+  std::srand(42);
+  for (std::size_t i = 0; i < n; ++i) {
+    unsigned int k = static_cast< unsigned int >(std::rand()) * 2u;
+    input.push_back(ft::make_pair(k, static_cast< unsigned int >(i)));
+  }
+  ft::vector< unsigned int > probes;
+  probes.reserve(lookups);
+  for (std::size_t i = 0; i < lookups; ++i) {
+    probes.push_back(input[std::rand() % n].first);
+  }
+
+  double start = bench_now();
+  ft::flat_map< unsigned int, unsigned int > flat(input.begin(), input.end());
+  bench_report("flat_map bulk build (unsorted)", bench_now() - start, n);
+
+  start = bench_now();
+  std::map< unsigned int, unsigned int > tree;
+  for (std::size_t i = 0; i < n; ++i) {
+    tree.insert(std::make_pair(input[i].first, input[i].second));
+  }
+  bench_report("std::map insert", bench_now() - start, n);
+
+  std::size_t sum = 0;
+  start = bench_now();
+  for (std::size_t i = 0; i < lookups; ++i) {
+    sum += flat.find(probes[i])->second;
+  }
+  bench_report("flat_map find (hit)", bench_now() - start, lookups);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < lookups; ++i) {
+    sum += tree.find(probes[i])->second;
+  }
+  bench_report("std::map find (hit)", bench_now() - start, lookups);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < lookups; ++i) {
+    sum += flat.count(probes[i] + 1);
+  }
+  bench_report("flat_map find (miss)", bench_now() - start, lookups);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < lookups; ++i) {
+    sum += tree.count(probes[i] + 1);
+  }
+  bench_report("std::map find (miss)", bench_now() - start, lookups);
+
+  start = bench_now();
+  for (ft::flat_map< unsigned int, unsigned int >::const_iterator it =
+           flat.begin();
+       it != flat.end(); ++it) {
+    sum += it->second;
+  }
+  bench_report("flat_map full scan", bench_now() - start, flat.size());
+
+  start = bench_now();
+  for (std::map< unsigned int, unsigned int >::const_iterator it =
+           tree.begin();
+       it != tree.end(); ++it) {
+    sum += it->second;
+  }
+  bench_report("std::map full scan", bench_now() - start, tree.size());
+
+  ft::vector< ft::pair< unsigned int, unsigned int > > batch;
+  for (std::size_t i = 0; i < n / 16; ++i) {
+    batch.push_back(
+        ft::make_pair(static_cast< unsigned int >(std::rand()) * 2u + 1u, 0u));
+  }
+  start = bench_now();
+  flat.insert(batch.begin(), batch.end());
+  bench_report("flat_map batched insert (n/16)", bench_now() - start,
+               batch.size());
+
+  bench_sink(sum);
+}
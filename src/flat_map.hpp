@@ -0,0 +1,805 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/04
+ * @file src/flat_map.hpp
+ */
+
+#if !defined(FT__FLAT_MAP_HPP)
+#define FT__FLAT_MAP_HPP
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+#include "algorithm.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+/**
+ * @brief Random access iterator over the parallel key / mapped arrays of a
+ * flat_map. Dereferencing yields a pair of references, so the iterator walks
+ * both arrays in lock step.
+ *
+ * @tparam Key key type (always const qualified)
+ * @tparam T mapped type (const qualified for const_iterator)
+ */
+template < class Key, class T >
+class flat_map_iterator
+    : public ft::iterator<
+          ft::random_access_iterator_tag,
+          ft::pair< Key, typename ft::remove_const< T >::type >, std::ptrdiff_t,
+          ft::arrow_proxy< ft::pair_reference< Key, T > >,
+          ft::pair_reference< Key, T > > {
+ public:
+  /* Preserves Iterator's category */
+  typedef ft::random_access_iterator_tag iterator_category;
+  /* pair< const key_type, mapped_type > */
+  typedef ft::pair< Key, typename ft::remove_const< T >::type > value_type;
+  /* a signed integral type */
+  typedef std::ptrdiff_t difference_type;
+  /* pair of references into the key and mapped arrays */
+  typedef ft::pair_reference< Key, T > reference;
+  /* proxy keeping the reference alive for operator-> */
+  typedef ft::arrow_proxy< reference > pointer;
+
+ protected:
+  Key* _key;
+  T* _value;
+
+ public:
+  /**
+   * @brief default constructor
+   */
+  flat_map_iterator() : _key(ft::u_nullptr), _value(ft::u_nullptr){};
+
+  /**
+   * @brief initalization constructor
+   */
+  flat_map_iterator(Key* key, T* value) : _key(key), _value(value){};
+
+  /**
+   * @brief copy Construct
+   */
+  flat_map_iterator(const flat_map_iterator& other)
+      : _key(other._key), _value(other._value){};
+
+  /**
+   * @brief flat_map_iterator< Key, const T > casting operator
+   */
+  operator flat_map_iterator< Key, const T >() const {
+    return flat_map_iterator< Key, const T >(this->_key, this->_value);
+  }
+
+  flat_map_iterator& operator=(const flat_map_iterator& other) {
+    this->_key = other._key;
+    this->_value = other._value;
+    return *this;
+  };
+
+  /**
+   * @brief Returns a pair of references to the pointed key and mapped value.
+   */
+  reference operator*() const { return reference(*_key, *_value); };
+
+  /**
+   * @brief Returns a proxy giving access to first / second.
+   */
+  pointer operator->() const { return pointer(operator*()); };
+
+  flat_map_iterator& operator++() {
+    ++_key;
+    ++_value;
+    return *this;
+  };
+
+  flat_map_iterator operator++(int) {
+    flat_map_iterator tmp = *this;
+    ++(*this);
+    return tmp;
+  };
+
+  flat_map_iterator& operator--() {
+    --_key;
+    --_value;
+    return *this;
+  };
+
+  flat_map_iterator operator--(int) {
+    flat_map_iterator tmp = *this;
+    --(*this);
+    return tmp;
+  };
+
+  flat_map_iterator operator+(difference_type n) const {
+    return flat_map_iterator(_key + n, _value + n);
+  };
+
+  flat_map_iterator& operator+=(difference_type n) {
+    _key += n;
+    _value += n;
+    return *this;
+  };
+
+  flat_map_iterator operator-(difference_type n) const {
+    return flat_map_iterator(_key - n, _value - n);
+  };
+
+  flat_map_iterator& operator-=(difference_type n) {
+    _key -= n;
+    _value -= n;
+    return *this;
+  };
+
+  reference operator[](difference_type n) const {
+    return reference(_key[n], _value[n]);
+  };
+
+  /**
+   * @brief get base key pointer, used for comparisons
+   */
+  Key* const& base() const { return this->_key; }
+
+  /**
+   * @brief get base mapped pointer
+   */
+  T* const& value_base() const { return this->_value; }
+};
+
+template < class K1, class T1, class K2, class T2 >
+bool operator==(const flat_map_iterator< K1, T1 >& lhs,
+                const flat_map_iterator< K2, T2 >& rhs) {
+  return (lhs.base() == rhs.base());
+};
+
+template < class K1, class T1, class K2, class T2 >
+bool operator!=(const flat_map_iterator< K1, T1 >& lhs,
+                const flat_map_iterator< K2, T2 >& rhs) {
+  return (lhs.base() != rhs.base());
+};
+
+template < class K1, class T1, class K2, class T2 >
+bool operator<(const flat_map_iterator< K1, T1 >& lhs,
+               const flat_map_iterator< K2, T2 >& rhs) {
+  return (lhs.base() < rhs.base());
+};
+
+template < class K1, class T1, class K2, class T2 >
+bool operator<=(const flat_map_iterator< K1, T1 >& lhs,
+                const flat_map_iterator< K2, T2 >& rhs) {
+  return (lhs.base() <= rhs.base());
+};
+
+template < class K1, class T1, class K2, class T2 >
+bool operator>(const flat_map_iterator< K1, T1 >& lhs,
+               const flat_map_iterator< K2, T2 >& rhs) {
+  return (lhs.base() > rhs.base());
+};
+
+template < class K1, class T1, class K2, class T2 >
+bool operator>=(const flat_map_iterator< K1, T1 >& lhs,
+                const flat_map_iterator< K2, T2 >& rhs) {
+  return (lhs.base() >= rhs.base());
+};
+
+template < class K, class T >
+flat_map_iterator< K, T > operator+(
+    typename flat_map_iterator< K, T >::difference_type n,
+    const flat_map_iterator< K, T >& iter) {
+  return iter + n;
+};
+
+template < class K1, class T1, class K2, class T2 >
+typename flat_map_iterator< K1, T1 >::difference_type operator-(
+    const flat_map_iterator< K1, T1 >& lhs,
+    const flat_map_iterator< K2, T2 >& rhs) {
+  return lhs.base() - rhs.base();
+};
+
+/**
+ * @brief An associative container of unique keys kept sorted in contiguous
+ * storage. Keys and mapped values live in two parallel ft::vector, so a lookup
+ * is a binary search touching only the key array, and a full scan is a linear
+ * walk over memory.
+ *
+ * Suited for read-mostly tables: lookups and iteration are much cheaper than
+ * in a node based tree, while a single insert or erase costs O(n). Bulk
+ * construction and range insert sort the batch and merge it in one pass.
+ *
+ * @tparam Key Type of the keys.
+ * @tparam T Type of the mapped value.
+ * @tparam Compare strict weak ordering on keys, defaults to `less<Key>`.
+ * @tparam _Alloc allocator, rebound for the key and mapped arrays.
+ */
+template < class Key, class T, class Compare = std::less< Key >,
+           class _Alloc = std::allocator< ft::pair< const Key, T > > >
+class flat_map {
+ public:
+  /* The first template parameter (Key) */
+  typedef Key key_type;
+  /* The second template parameter (T) */
+  typedef T mapped_type;
+  /* pair< const key_type, mapped_type > */
+  typedef ft::pair< const Key, T > value_type;
+  /* The third template parameter (Compare) */
+  typedef Compare key_compare;
+  /* The fourth template parameter (_Alloc) */
+  typedef _Alloc allocator_type;
+  /* storage of the sorted keys */
+  typedef ft::vector< Key, typename _Alloc::template rebind< Key >::other >
+      key_container_type;
+  /* storage of the mapped values, parallel to the keys */
+  typedef ft::vector< T, typename _Alloc::template rebind< T >::other >
+      mapped_container_type;
+  /* pair of references to an element */
+  typedef ft::pair_reference< const Key, T > reference;
+  /* pair of const references to an element */
+  typedef ft::pair_reference< const Key, const T > const_reference;
+  /* a random access iterator to value_type */
+  typedef ft::flat_map_iterator< const Key, T > iterator;
+  /* a random access iterator to const value_type */
+  typedef ft::flat_map_iterator< const Key, const T > const_iterator;
+  /* reverse_iterator<iterator> */
+  typedef ft::reverse_iterator< iterator > reverse_iterator;
+  /* reverse_iterator<const_iterator> */
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+  /* a signed integral type */
+  typedef std::ptrdiff_t difference_type;
+  /* an unsigned integral type */
+  typedef typename key_container_type::size_type size_type;
+
+  /**
+   * @brief Function object that compares two elements by their keys.
+   */
+  class value_compare {
+    friend class flat_map;
+
+   protected:
+    Compare comp;
+    value_compare(Compare c) : comp(c){};
+
+   public:
+    typedef bool result_type;
+    typedef value_type first_argument_type;
+    typedef value_type second_argument_type;
+    bool operator()(const value_type& x, const value_type& y) const {
+      return comp(x.first, y.first);
+    };
+  };
+
+ private:
+  /* mutable element of a batch being sorted before the merge */
+  typedef ft::pair< Key, T > _entry_type;
+  typedef ft::vector< _entry_type, typename _Alloc::template rebind<
+                                       _entry_type >::other >
+      _batch_type;
+
+  /* below this size a batch is sorted by insertion */
+  static const size_type _insertion_sort_threshold = 16;
+
+  key_compare _comp;
+  key_container_type _keys;
+  mapped_container_type _values;
+
+ public:
+  /**
+   * @brief empty container constructor (default constructor)
+   */
+  explicit flat_map(const key_compare& comp = key_compare(),
+                    const allocator_type& alloc = allocator_type())
+      : _comp(comp), _keys(alloc), _values(alloc){};
+
+  /**
+   * @brief range constructor
+   * Builds the map from [first,last) in one pass: the range is copied, sorted
+   * (skipped when already sorted) and deduplicated, keeping the first
+   * occurrence of each key.
+   */
+  template < class InputIterator >
+  flat_map(InputIterator first, InputIterator last,
+           const key_compare& comp = key_compare(),
+           const allocator_type& alloc = allocator_type(),
+           typename ft::enable_if<
+               !ft::is_integral< InputIterator >::value >::type* = u_nullptr)
+      : _comp(comp), _keys(alloc), _values(alloc) {
+    this->insert(first, last);
+  };
+
+  /**
+   * @brief copy constructor
+   */
+  flat_map(const flat_map& x)
+      : _comp(x._comp), _keys(x._keys), _values(x._values){};
+
+  flat_map& operator=(const flat_map& x) {
+    if (this != &x) {
+      this->_comp = x._comp;
+      this->_keys = x._keys;
+      this->_values = x._values;
+    }
+    return *this;
+  };
+
+  ~flat_map(){};
+
+  iterator begin() { return this->_make_iterator(0); };
+  const_iterator begin() const { return this->_make_iterator(0); };
+  iterator end() { return this->_make_iterator(this->size()); };
+  const_iterator end() const { return this->_make_iterator(this->size()); };
+  reverse_iterator rbegin() { return reverse_iterator(this->end()); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(this->end());
+  };
+  reverse_iterator rend() { return reverse_iterator(this->begin()); };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(this->begin());
+  };
+
+  /**
+   * @brief Test whether container is empty
+   */
+  bool empty() const { return this->_keys.empty(); };
+
+  /**
+   * @brief Return container size
+   */
+  size_type size() const { return this->_keys.size(); };
+
+  /**
+   * @brief Return maximum size
+   */
+  size_type max_size() const { return this->_keys.max_size(); };
+
+  /**
+   * @brief Request a change in capacity of both key and mapped storage.
+   */
+  void reserve(size_type n) {
+    this->_keys.reserve(n);
+    this->_values.reserve(n);
+  };
+
+  /**
+   * @brief Return the number of elements that fit without reallocation.
+   */
+  size_type capacity() const { return this->_keys.capacity(); };
+
+  /**
+   * @brief Access element
+   * If k matches the key of an element, returns a reference to its mapped
+   * value. Otherwise a new element is inserted with a value-initialized
+   * mapped value.
+   */
+  mapped_type& operator[](const key_type& k) {
+    size_type i = this->_lower_index(k);
+    if (i == this->size() || this->_comp(k, this->_keys[i])) {
+      this->_insert_at(i, k, mapped_type());
+    }
+    return this->_values[i];
+  };
+
+  /**
+   * @brief Access element
+   * Returns a reference to the mapped value of the element identified with
+   * key k. Throws out_of_range if there is no such element.
+   */
+  mapped_type& at(const key_type& k) {
+    size_type i = this->_find_index(k);
+    if (i == this->size()) throw std::out_of_range("ft::flat_map");
+    return this->_values[i];
+  };
+
+  const mapped_type& at(const key_type& k) const {
+    size_type i = this->_find_index(k);
+    if (i == this->size()) throw std::out_of_range("ft::flat_map");
+    return this->_values[i];
+  };
+
+  /**
+   * @brief Insert element
+   *
+   * @return pair of an iterator to the element with key val.first and a bool
+   * which is true if the element was inserted.
+   */
+  ft::pair< iterator, bool > insert(const value_type& val) {
+    size_type i = this->_lower_index(val.first);
+    if (i != this->size() && !this->_comp(val.first, this->_keys[i])) {
+      return ft::make_pair(this->_make_iterator(i), false);
+    }
+    this->_insert_at(i, val.first, val.second);
+    return ft::make_pair(this->_make_iterator(i), true);
+  };
+
+  /**
+   * @brief Insert element with hint
+   * When val belongs right before position the binary search is skipped.
+   */
+  iterator insert(iterator position, const value_type& val) {
+    size_type i = position - this->begin();
+    bool after_prev = (i == 0 || this->_comp(this->_keys[i - 1], val.first));
+    bool before_next =
+        (i == this->size() || this->_comp(val.first, this->_keys[i]));
+    if (!after_prev || !before_next) return this->insert(val).first;
+    this->_insert_at(i, val.first, val.second);
+    return this->_make_iterator(i);
+  };
+
+  /**
+   * @brief range Insert elements
+   * The range is copied into a batch, sorted and deduplicated, then merged
+   * with the current content in a single linear pass. Keys already present
+   * are left untouched.
+   */
+  template < class InputIterator >
+  void insert(
+      InputIterator first, InputIterator last,
+      typename ft::enable_if<
+          !ft::is_integral< InputIterator >::value >::type* = u_nullptr) {
+    _batch_type batch;
+    for (; first != last; ++first) {
+      batch.push_back(_entry_type(first->first, first->second));
+    }
+    if (batch.empty()) return;
+    this->_sort_batch(batch);
+    this->_merge_batch(batch);
+  };
+
+  /**
+   * @brief Erase element at position
+   */
+  iterator erase(iterator position) {
+    size_type i = position - this->begin();
+    this->_erase_at(i, 1);
+    return this->_make_iterator(i);
+  };
+
+  /**
+   * @brief Erase element by key
+   *
+   * @return the number of elements erased (0 or 1)
+   */
+  size_type erase(const key_type& k) {
+    size_type i = this->_find_index(k);
+    if (i == this->size()) return 0;
+    this->_erase_at(i, 1);
+    return 1;
+  };
+
+  /**
+   * @brief range Erase elements
+   */
+  iterator erase(iterator first, iterator last) {
+    size_type i = first - this->begin();
+    this->_erase_at(i, last - first);
+    return this->_make_iterator(i);
+  };
+
+  /**
+   * @brief Swap content
+   */
+  void swap(flat_map& x) {
+    if (&x == this) return;
+    ft::swap(this->_comp, x._comp);
+    this->_keys.swap(x._keys);
+    this->_values.swap(x._values);
+  };
+
+  /**
+   * @brief Clear content
+   */
+  void clear() {
+    this->_keys.clear();
+    this->_values.clear();
+  };
+
+  /**
+   * @brief Return key comparison object
+   */
+  key_compare key_comp() const { return this->_comp; };
+
+  /**
+   * @brief Return value comparison object
+   */
+  value_compare value_comp() const { return value_compare(this->_comp); };
+
+  /**
+   * @brief Get iterator to element
+   */
+  iterator find(const key_type& k) {
+    return this->_make_iterator(this->_find_index(k));
+  };
+
+  const_iterator find(const key_type& k) const {
+    return this->_make_iterator(this->_find_index(k));
+  };
+
+  /**
+   * @brief Count elements with a specific key (0 or 1)
+   */
+  size_type count(const key_type& k) const {
+    return this->_find_index(k) != this->size();
+  };
+
+  /**
+   * @brief Return iterator to lower bound
+   */
+  iterator lower_bound(const key_type& k) {
+    return this->_make_iterator(this->_lower_index(k));
+  };
+
+  const_iterator lower_bound(const key_type& k) const {
+    return this->_make_iterator(this->_lower_index(k));
+  };
+
+  /**
+   * @brief Return iterator to upper bound
+   */
+  iterator upper_bound(const key_type& k) {
+    return this->_make_iterator(this->_upper_index(k));
+  };
+
+  const_iterator upper_bound(const key_type& k) const {
+    return this->_make_iterator(this->_upper_index(k));
+  };
+
+  /**
+   * @brief Get range of equal elements
+   */
+  ft::pair< iterator, iterator > equal_range(const key_type& k) {
+    return ft::make_pair(this->lower_bound(k), this->upper_bound(k));
+  };
+
+  ft::pair< const_iterator, const_iterator > equal_range(
+      const key_type& k) const {
+    return ft::make_pair(this->lower_bound(k), this->upper_bound(k));
+  };
+
+  /**
+   * @brief Sorted key storage, contiguous.
+   */
+  const key_container_type& keys() const { return this->_keys; };
+
+  /**
+   * @brief Mapped value storage, parallel to keys().
+   */
+  const mapped_container_type& values() const { return this->_values; };
+
+  /**
+   * @brief Get the allocator object
+   */
+  allocator_type get_allocator() const {
+    return allocator_type(this->_keys.get_allocator());
+  };
+
+ private:
+  iterator _make_iterator(size_type i) {
+    return iterator(this->_keys.begin().base() + i,
+                    this->_values.begin().base() + i);
+  };
+
+  const_iterator _make_iterator(size_type i) const {
+    return const_iterator(this->_keys.begin().base() + i,
+                          this->_values.begin().base() + i);
+  };
+
+  /**
+   * @brief Index of the first key not less than k.
+   * Branch free binary search: the loop only narrows a base pointer, which
+   * compilers turn into conditional moves instead of mispredicted jumps.
+   */
+  size_type _lower_index(const key_type& k) const {
+    size_type n = this->_keys.size();
+    if (n == 0) return 0;
+    const Key* first = this->_keys.begin().base();
+    const Key* base = first;
+    while (n > 1) {
+      size_type half = n / 2;
+      base = this->_comp(base[half], k) ? base + half : base;
+      n -= half;
+    }
+    return (base - first) + this->_comp(*base, k);
+  };
+
+  /**
+   * @brief Index of the first key greater than k.
+   */
+  size_type _upper_index(const key_type& k) const {
+    size_type n = this->_keys.size();
+    if (n == 0) return 0;
+    const Key* first = this->_keys.begin().base();
+    const Key* base = first;
+    while (n > 1) {
+      size_type half = n / 2;
+      base = !this->_comp(k, base[half]) ? base + half : base;
+      n -= half;
+    }
+    return (base - first) + !this->_comp(k, *base);
+  };
+
+  /**
+   * @brief Index of the element with key k, or size() if there is none.
+   */
+  size_type _find_index(const key_type& k) const {
+    size_type i = this->_lower_index(k);
+    if (i != this->size() && this->_comp(k, this->_keys[i])) {
+      return this->size();
+    }
+    return i;
+  };
+
+  void _insert_at(size_type i, const key_type& k, const mapped_type& v) {
+    this->_keys.push_back(k);
+    try {
+      this->_values.push_back(v);
+    } catch (...) {
+      // keep both arrays the same size
+      this->_keys.pop_back();
+      throw;
+    }
+    for (size_type j = this->size() - 1; j > i; --j) {
+      this->_keys[j] = this->_keys[j - 1];
+      this->_values[j] = this->_values[j - 1];
+    }
+    this->_keys[i] = k;
+    this->_values[i] = v;
+  };
+
+  void _erase_at(size_type i, size_type n) {
+    if (n == 0) return;
+    for (size_type j = i + n; j < this->size(); ++j) {
+      this->_keys[j - n] = this->_keys[j];
+      this->_values[j - n] = this->_values[j];
+    }
+    while (n--) {
+      this->_keys.pop_back();
+      this->_values.pop_back();
+    }
+  };
+
+  bool _entry_less(const _entry_type& a, const _entry_type& b) const {
+    return this->_comp(a.first, b.first);
+  };
+
+  /**
+   * @brief Stable sort of batch by key then removal of duplicated keys,
+   * keeping the first occurrence. Already sorted input costs a single scan.
+   */
+  void _sort_batch(_batch_type& batch) const {
+    size_type n = batch.size();
+    bool sorted = true;
+    for (size_type i = 1; i < n && sorted; ++i) {
+      sorted = !this->_entry_less(batch[i], batch[i - 1]);
+    }
+    if (!sorted) {
+      _batch_type tmp(batch);
+      this->_merge_sort(batch.begin().base(), tmp.begin().base(), n);
+    }
+    size_type out = 1;
+    for (size_type i = 1; i < n; ++i) {
+      if (this->_comp(batch[out - 1].first, batch[i].first)) {
+        if (out != i) batch[out] = batch[i];
+        ++out;
+      }
+    }
+    while (batch.size() > out) batch.pop_back();
+  };
+
+  /**
+   * @brief Top-down merge sort of data[0,n), tmp holds a copy of data and is
+   * used as scratch. Small runs fall back to insertion sort.
+   */
+  void _merge_sort(_entry_type* data, _entry_type* tmp, size_type n) const {
+    if (n <= _insertion_sort_threshold) {
+      for (size_type i = 1; i < n; ++i) {
+        _entry_type cur = data[i];
+        size_type j = i;
+        for (; j > 0 && this->_entry_less(cur, data[j - 1]); --j) {
+          data[j] = data[j - 1];
+        }
+        data[j] = cur;
+      }
+      return;
+    }
+    size_type half = n / 2;
+    this->_merge_sort(tmp, data, half);
+    this->_merge_sort(tmp + half, data + half, n - half);
+    size_type l = 0, r = half, out = 0;
+    while (l < half && r < n) {
+      data[out++] =
+          this->_entry_less(tmp[r], tmp[l]) ? tmp[r++] : tmp[l++];
+    }
+    while (l < half) data[out++] = tmp[l++];
+    while (r < n) data[out++] = tmp[r++];
+  };
+
+  /**
+   * @brief Merge a sorted, deduplicated batch into the current content.
+   */
+  void _merge_batch(const _batch_type& batch) {
+    key_container_type keys(this->_keys.get_allocator());
+    mapped_container_type values(this->_values.get_allocator());
+    keys.reserve(this->size() + batch.size());
+    values.reserve(this->size() + batch.size());
+
+    size_type i = 0, j = 0;
+    while (i < this->size() && j < batch.size()) {
+      if (this->_comp(batch[j].first, this->_keys[i])) {
+        keys.push_back(batch[j].first);
+        values.push_back(batch[j].second);
+        ++j;
+      } else {
+        if (!this->_comp(this->_keys[i], batch[j].first)) ++j;
+        keys.push_back(this->_keys[i]);
+        values.push_back(this->_values[i]);
+        ++i;
+      }
+    }
+    for (; i < this->size(); ++i) {
+      keys.push_back(this->_keys[i]);
+      values.push_back(this->_values[i]);
+    }
+    for (; j < batch.size(); ++j) {
+      keys.push_back(batch[j].first);
+      values.push_back(batch[j].second);
+    }
+    this->_keys.swap(keys);
+    this->_values.swap(values);
+  };
+};
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator==(const flat_map< Key, T, Compare, Alloc >& lhs,
+                const flat_map< Key, T, Compare, Alloc >& rhs) {
+  return lhs.keys() == rhs.keys() && lhs.values() == rhs.values();
+};
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator!=(const flat_map< Key, T, Compare, Alloc >& lhs,
+                const flat_map< Key, T, Compare, Alloc >& rhs) {
+  return !(lhs == rhs);
+};
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator<(const flat_map< Key, T, Compare, Alloc >& lhs,
+               const flat_map< Key, T, Compare, Alloc >& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+};
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator<=(const flat_map< Key, T, Compare, Alloc >& lhs,
+                const flat_map< Key, T, Compare, Alloc >& rhs) {
+  return !(rhs < lhs);
+};
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator>(const flat_map< Key, T, Compare, Alloc >& lhs,
+               const flat_map< Key, T, Compare, Alloc >& rhs) {
+  return rhs < lhs;
+};
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator>=(const flat_map< Key, T, Compare, Alloc >& lhs,
+                const flat_map< Key, T, Compare, Alloc >& rhs) {
+  return !(lhs < rhs);
+};
+
+template < class Key, class T, class Compare, class Alloc >
+void swap(flat_map< Key, T, Compare, Alloc >& x,
+          flat_map< Key, T, Compare, Alloc >& y) {
+  x.swap(y);
+};
+
+}  // namespace ft
+
+#endif  // FT__FLAT_MAP_HPP
@@ -0,0 +1,196 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/04
+ * @file src/flat_map.test.cpp
+ */
+
+#include "flat_map.hpp"
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+typedef ft::flat_map< int, std::string > ft_flat_map;
+typedef std::map< int, std::string > std_flat_map;
+
+static bool same_content(const ft_flat_map& ft_m, const std_flat_map& std_m) {
+  if (ft_m.size() != std_m.size()) return false;
+  ft_flat_map::const_iterator ft_it = ft_m.begin();
+  std_flat_map::const_iterator std_it = std_m.begin();
+  for (; std_it != std_m.end(); ++ft_it, ++std_it) {
+    if (ft_it->first != std_it->first || ft_it->second != std_it->second)
+      return false;
+  }
+  return ft_it == ft_m.end();
+}
+
+/* whether copying a fm_test_fragile throws */
+static bool g_fm_test_throw = false;
+
+struct fm_test_fragile {
+  int value;
+
+  fm_test_fragile() : value(0){};
+  explicit fm_test_fragile(int v) : value(v){};
+  fm_test_fragile(const fm_test_fragile& x) : value(x.value) {
+    if (g_fm_test_throw) throw std::string("copy");
+  };
+};
+
+void test_flat_map_bulk(void) {
+  std::cout << "\t bulk build" << std::endl;
+
+  std::vector< ft::pair< int, std::string > > input;
+  std::vector< std::pair< int, std::string > > std_input;
+  std::srand(42);
+  for (int i = 0; i < 1000; ++i) {
+    int k = std::rand() % 300;
+    std::string v(1, static_cast< char >('a' + i % 26));
+    input.push_back(ft::make_pair(k, v));
+    std_input.push_back(std::make_pair(k, v));
+  }
+
+  ft_flat_map ft_m(input.begin(), input.end());
+  std_flat_map std_m(std_input.begin(), std_input.end());
+  assert(same_content(ft_m, std_m));
+
+  ft_flat_map sorted(ft_m.begin(), ft_m.end());
+  assert(sorted == ft_m);
+
+  std::vector< ft::pair< int, std::string > > more;
+  std::vector< std::pair< int, std::string > > std_more;
+  for (int i = 0; i < 500; ++i) {
+    int k = std::rand() % 600;
+    more.push_back(ft::make_pair(k, std::string("x")));
+    std_more.push_back(std::make_pair(k, std::string("x")));
+  }
+  ft_m.insert(more.begin(), more.end());
+  std_m.insert(std_more.begin(), std_more.end());
+  assert(same_content(ft_m, std_m));
+}
+
+void test_flat_map_modifiers(void) {
+  std::cout << "\t modifiers" << std::endl;
+
+  ft_flat_map ft_m;
+  std_flat_map std_m;
+
+  std::srand(7);
+  for (int i = 0; i < 2000; ++i) {
+    int k = std::rand() % 500;
+    switch (std::rand() % 4) {
+      case 0:
+        ft_m[k] = "v";
+        std_m[k] = "v";
+        break;
+      case 1:
+        assert(ft_m.insert(ft::make_pair(k, std::string("i"))).second ==
+               std_m.insert(std::make_pair(k, std::string("i"))).second);
+        break;
+      case 2:
+        assert(ft_m.erase(k) == std_m.erase(k));
+        break;
+      default:
+        ft_m.insert(ft_m.lower_bound(k), ft::make_pair(k, std::string("h")));
+        std_m.insert(std_m.lower_bound(k), std::make_pair(k, std::string("h")));
+        break;
+    }
+  }
+  assert(same_content(ft_m, std_m));
+
+  ft_m.erase(ft_m.begin() + 10, ft_m.begin() + 20);
+  std_flat_map::iterator std_first = std_m.begin();
+  std::advance(std_first, 10);
+  std_flat_map::iterator std_last = std_first;
+  std::advance(std_last, 10);
+  std_m.erase(std_first, std_last);
+  assert(same_content(ft_m, std_m));
+
+  ft_flat_map ft_copy(ft_m);
+  ft_flat_map ft_other;
+  ft_other[1] = "one";
+  ft_copy.swap(ft_other);
+  assert(ft_copy.size() == 1 && ft_other == ft_m);
+  ft_copy = ft_m;
+  assert(ft_copy == ft_m && !(ft_copy < ft_m));
+
+  ft_m.clear();
+  assert(ft_m.empty() && ft_m.begin() == ft_m.end());
+
+  // a mapped value failing to copy leaves keys and values in step
+  // (the first insert reallocates the values, the second does not)
+  ft::flat_map< int, fm_test_fragile > fragile;
+  fragile[2] = fm_test_fragile(2);
+  ft::flat_map< int, fm_test_fragile >::value_type one(1, fm_test_fragile(1));
+  for (int pass = 0; pass < 2; ++pass) {
+    if (pass == 1) fragile.reserve(4);
+    g_fm_test_throw = true;
+    try {
+      fragile.insert(one);
+      assert(false);
+    } catch (const std::string& e) {
+    }
+    g_fm_test_throw = false;
+    assert(fragile.size() == 1 && fragile.keys().size() == 1);
+    assert(fragile.values().size() == 1 && fragile.find(1) == fragile.end());
+    assert(fragile[2].value == 2);
+  }
+  fragile.insert(one);
+  assert(fragile[1].value == 1 && fragile[2].value == 2);
+}
+
+void test_flat_map_lookup(void) {
+  std::cout << "\t lookup" << std::endl;
+
+  ft_flat_map ft_m;
+  std_flat_map std_m;
+  for (int i = 0; i < 100; i += 3) {
+    ft_m[i] = "k";
+    std_m[i] = "k";
+  }
+  for (int i = -2; i < 105; ++i) {
+    assert(ft_m.count(i) == std_m.count(i));
+    assert((ft_m.find(i) == ft_m.end()) == (std_m.find(i) == std_m.end()));
+    assert((ft_m.lower_bound(i) == ft_m.end()) ==
+           (std_m.lower_bound(i) == std_m.end()));
+    if (std_m.lower_bound(i) != std_m.end()) {
+      assert(ft_m.lower_bound(i)->first == std_m.lower_bound(i)->first);
+    }
+    if (std_m.upper_bound(i) != std_m.end()) {
+      assert(ft_m.upper_bound(i)->first == std_m.upper_bound(i)->first);
+    }
+  }
+
+  assert(ft_m.at(3) == "k");
+  try {
+    ft_m.at(4);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+
+  ft_flat_map::reverse_iterator ft_rit = ft_m.rbegin();
+  std_flat_map::reverse_iterator std_rit = std_m.rbegin();
+  for (; std_rit != std_m.rend(); ++ft_rit, ++std_rit) {
+    assert((*ft_rit).first == std_rit->first);
+  }
+  assert(ft_rit == ft_m.rend());
+  assert(ft::distance(ft_m.begin(), ft_m.end()) ==
+         static_cast< std::ptrdiff_t >(std_m.size()));
+}
+
+void test_flat_map(void) {
+  std::cout << "Test: flat_map" << std::endl;
+  test_flat_map_bulk();
+  test_flat_map_modifiers();
+  test_flat_map_lookup();
+}
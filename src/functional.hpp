@@ -0,0 +1,105 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/06
+ * @file src/functional.hpp
+ */
+
+#if !defined(FT__FUNCTIONAL_HPP)
+#define FT__FUNCTIONAL_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace ft {
+
+/**
+ * @brief Default hash function object. Only the specializations below are
+ * defined; hashing any other type requires a user supplied Hash.
+ *
+ * @tparam T type of the value to hash
+ */
+template < class T >
+struct hash;
+
+/**
+ * @brief Identity hash for integral types. Containers are expected to mix
+ * the result before using its bits.
+ */
+template < class T >
+struct _integral_hash {
+  typedef T argument_type;
+  typedef std::size_t result_type;
+  std::size_t operator()(T val) const {
+    return static_cast< std::size_t >(val);
+  };
+};
+
+template <>
+struct hash< bool > : public _integral_hash< bool > {};
+template <>
+struct hash< char > : public _integral_hash< char > {};
+template <>
+struct hash< signed char > : public _integral_hash< signed char > {};
+template <>
+struct hash< unsigned char > : public _integral_hash< unsigned char > {};
+template <>
+struct hash< wchar_t > : public _integral_hash< wchar_t > {};
+template <>
+struct hash< short int > : public _integral_hash< short int > {};
+template <>
+struct hash< unsigned short int >
+    : public _integral_hash< unsigned short int > {};
+template <>
+struct hash< int > : public _integral_hash< int > {};
+template <>
+struct hash< unsigned int > : public _integral_hash< unsigned int > {};
+template <>
+struct hash< long int > : public _integral_hash< long int > {};
+template <>
+struct hash< unsigned long int >
+    : public _integral_hash< unsigned long int > {};
+template <>
+struct hash< long long int > : public _integral_hash< long long int > {};
+template <>
+struct hash< unsigned long long int >
+    : public _integral_hash< unsigned long long int > {};
+
+/**
+ * @brief Pointer hash, by address.
+ */
+template < class T >
+struct hash< T* > {
+  typedef T* argument_type;
+  typedef std::size_t result_type;
+  std::size_t operator()(T* val) const {
+    return reinterpret_cast< std::size_t >(val);
+  };
+};
+
+/**
+ * @brief String hash, FNV-1a over the characters.
+ */
+template <>
+struct hash< std::string > {
+  typedef std::string argument_type;
+  typedef std::size_t result_type;
+  std::size_t operator()(const std::string& val) const {
+    unsigned long long h = 14695981039346656037ULL;
+    for (std::string::size_type i = 0; i < val.size(); ++i) {
+      h ^= static_cast< unsigned char >(val[i]);
+      h *= 1099511628211ULL;
+    }
+    return static_cast< std::size_t >(h);
+  };
+};
+
+}  // namespace ft
+
+#endif  // FT__FUNCTIONAL_HPP
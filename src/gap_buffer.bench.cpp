@@ -0,0 +1,148 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/23
+ * @file src/gap_buffer.bench.cpp
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "gap_buffer.hpp"
+#include "vector.hpp"
+
+namespace {
+
+/* a 256k char document edited by a typing trace */
+const std::size_t g_document = 1 << 18;
+const std::size_t g_edits = 1 << 15;
+/* a 16k line log, each edit inserting or dropping a whole line */
+const std::size_t g_lines = 1 << 14;
+
+/**
+ * @brief One step of an edit trace: move the cursor to pos, then type
+ * count copies of the element, or backspace count times when count < 0.
+ */
+struct gb_bench_edit {
+  std::size_t pos;
+  int count;
+};
+
+/**
+ * @brief Edits near the previous one, as a person typing does, with a
+ * jump elsewhere in the document every 64 edits.
+ */
+ft::vector< gb_bench_edit > gb_bench_trace(std::size_t size) {
+  ft::vector< gb_bench_edit > trace(g_edits);
+  std::size_t cursor = size / 2;
+  for (std::size_t i = 0; i < g_edits; ++i) {
+    if (i % 64 == 0) {
+      cursor = std::rand() % size;
+    } else {
+      std::size_t step = std::rand() % 32;
+      cursor = std::rand() % 2 && cursor + step <= size ? cursor + step
+               : cursor >= step                         ? cursor - step
+                                                        : cursor;
+    }
+    int count = std::rand() % 8 + 1;
+    // backspace one time in four, never past the start
+    if (std::rand() % 4 == 0 && cursor >= static_cast< std::size_t >(count)) {
+      count = -count;
+    }
+    trace[i].pos = cursor;
+    trace[i].count = count;
+    // the cursor ends after what was typed, or where the erase began
+    std::size_t length = static_cast< std::size_t >(count < 0 ? -count : count);
+    size = count < 0 ? size - length : size + length;
+    cursor = count < 0 ? cursor - length : cursor + length;
+  }
+  return trace;
+}
+
+/**
+ * @brief Replay the first edits of the trace on a vector-like container,
+ * by position.
+ */
+template < class Vector, class T >
+std::size_t gb_bench_replay_vector(Vector& doc,
+                                   const ft::vector< gb_bench_edit >& trace,
+                                   std::size_t edits, const T& val) {
+  for (std::size_t i = 0; i < edits; ++i) {
+    std::size_t pos = trace[i].pos;
+    if (trace[i].count > 0) {
+      doc.insert(doc.begin() + pos, trace[i].count, val);
+    } else {
+      doc.erase(doc.begin() + (pos + trace[i].count), doc.begin() + pos);
+    }
+  }
+  return doc.size();
+}
+
+/**
+ * @brief Replay the trace on a gap_buffer through its cursor.
+ */
+template < class T >
+std::size_t gb_bench_replay_gap(ft::gap_buffer< T >& doc,
+                                const ft::vector< gb_bench_edit >& trace,
+                                const T& val) {
+  for (std::size_t i = 0; i < trace.size(); ++i) {
+    doc.move_cursor(trace[i].pos);
+    if (trace[i].count > 0) {
+      doc.insert(static_cast< std::size_t >(trace[i].count), val);
+    } else {
+      doc.erase_before(static_cast< std::size_t >(-trace[i].count));
+    }
+  }
+  return doc.size();
+}
+
+/**
+ * @brief The vectors shift the whole tail on every edit, so they only
+ * replay the first vector_edits steps of the trace.
+ */
+template < class T >
+void gb_bench_run(const char* name, std::size_t size, std::size_t vector_edits,
+                  const T& val) {
+  ft::vector< gb_bench_edit > trace = gb_bench_trace(size);
+  std::cout << "\t " << name << std::endl;
+
+  ft::vector< T > fv(size, val);
+  double start = bench_now();
+  std::size_t sum = gb_bench_replay_vector(fv, trace, vector_edits, val);
+  bench_report("  ft::vector insert / erase", bench_now() - start,
+               vector_edits);
+
+  std::vector< T > sv(size, val);
+  start = bench_now();
+  sum += gb_bench_replay_vector(sv, trace, vector_edits, val);
+  bench_report("  std::vector insert / erase", bench_now() - start,
+               vector_edits);
+
+  ft::gap_buffer< T > gb;
+  gb.insert(size, val);
+  start = bench_now();
+  sum += gb_bench_replay_gap(gb, trace, val);
+  bench_report("  ft::gap_buffer at the cursor", bench_now() - start,
+               g_edits);
+  bench_sink(sum);
+}
+
+}  // namespace
+
+void bench_gap_buffer(void) {
+  std::cout << "Bench: gap_buffer" << std::endl;
+
+  std::srand(42);
+  gb_bench_run("chars, 256k document", g_document, g_edits / 16, 'x');
+  gb_bench_run("std::string lines, 16k lines", g_lines, g_edits / 256,
+               std::string("a log line long enough to live on the heap"));
+}
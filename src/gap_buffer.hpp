@@ -0,0 +1,573 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/23
+ * @file src/gap_buffer.hpp
+ */
+
+#if !defined(FT__GAP_BUFFER_HPP)
+#define FT__GAP_BUFFER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+#include "algorithm.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+#include "utility.hpp"
+
+namespace ft {
+
+/**
+ * @brief Random access iterator over a gap_buffer: a logical index mapped
+ * past the gap on dereference, so the gap is never visited.
+ */
+template < class T >
+class gap_iterator : public ft::iterator< ft::random_access_iterator_tag, T > {
+ public:
+  typedef ft::random_access_iterator_tag iterator_category;
+  typedef T value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef T* pointer;
+  typedef T& reference;
+
+ protected:
+  T* _buffer;
+  /* first slot of the gap and its length */
+  difference_type _gap;
+  difference_type _gap_size;
+  difference_type _index;
+
+ public:
+  gap_iterator() : _buffer(u_nullptr), _gap(0), _gap_size(0), _index(0){};
+  gap_iterator(T* buffer, difference_type gap, difference_type gap_size,
+               difference_type index)
+      : _buffer(buffer), _gap(gap), _gap_size(gap_size), _index(index){};
+
+  /**
+   * @brief gap_iterator< const T > casting operator
+   */
+  operator gap_iterator< const T >() const {
+    return gap_iterator< const T >(this->_buffer, this->_gap,
+                                   this->_gap_size, this->_index);
+  };
+
+  reference operator*() const { return *this->_slot(this->_index); };
+  pointer operator->() const { return this->_slot(this->_index); };
+
+  gap_iterator& operator++() {
+    ++this->_index;
+    return *this;
+  };
+
+  gap_iterator operator++(int) {
+    gap_iterator tmp = *this;
+    ++this->_index;
+    return tmp;
+  };
+
+  gap_iterator& operator--() {
+    --this->_index;
+    return *this;
+  };
+
+  gap_iterator operator--(int) {
+    gap_iterator tmp = *this;
+    --this->_index;
+    return tmp;
+  };
+
+  gap_iterator operator+(difference_type n) const {
+    return gap_iterator(this->_buffer, this->_gap, this->_gap_size,
+                        this->_index + n);
+  };
+
+  gap_iterator& operator+=(difference_type n) {
+    this->_index += n;
+    return *this;
+  };
+
+  gap_iterator operator-(difference_type n) const {
+    return gap_iterator(this->_buffer, this->_gap, this->_gap_size,
+                        this->_index - n);
+  };
+
+  gap_iterator& operator-=(difference_type n) {
+    this->_index -= n;
+    return *this;
+  };
+
+  reference operator[](difference_type n) const {
+    return *this->_slot(this->_index + n);
+  };
+
+  /**
+   * @brief get the position in the buffer, used for comparisons
+   */
+  difference_type index() const { return this->_index; };
+
+ private:
+  T* _slot(difference_type i) const {
+    return this->_buffer + (i < this->_gap ? i : i + this->_gap_size);
+  };
+};
+
+template < class T1, class T2 >
+bool operator==(const gap_iterator< T1 >& lhs, const gap_iterator< T2 >& rhs) {
+  return lhs.index() == rhs.index();
+};
+
+template < class T1, class T2 >
+bool operator!=(const gap_iterator< T1 >& lhs, const gap_iterator< T2 >& rhs) {
+  return lhs.index() != rhs.index();
+};
+
+template < class T1, class T2 >
+bool operator<(const gap_iterator< T1 >& lhs, const gap_iterator< T2 >& rhs) {
+  return lhs.index() < rhs.index();
+};
+
+template < class T1, class T2 >
+bool operator<=(const gap_iterator< T1 >& lhs, const gap_iterator< T2 >& rhs) {
+  return lhs.index() <= rhs.index();
+};
+
+template < class T1, class T2 >
+bool operator>(const gap_iterator< T1 >& lhs, const gap_iterator< T2 >& rhs) {
+  return lhs.index() > rhs.index();
+};
+
+template < class T1, class T2 >
+bool operator>=(const gap_iterator< T1 >& lhs, const gap_iterator< T2 >& rhs) {
+  return lhs.index() >= rhs.index();
+};
+
+template < class T >
+gap_iterator< T > operator+(typename gap_iterator< T >::difference_type n,
+                            const gap_iterator< T >& iter) {
+  return iter + n;
+};
+
+template < class T1, class T2 >
+typename gap_iterator< T1 >::difference_type operator-(
+    const gap_iterator< T1 >& lhs, const gap_iterator< T2 >& rhs) {
+  return lhs.index() - rhs.index();
+};
+
+/**
+ * @brief Sequence with a movable cursor for edits that cluster around one
+ * position, as typing in an editor does.
+ *
+ * The buffer holds the elements before the cursor at its start, those after
+ * it at its end, and an unconstructed gap in between. Inserting or erasing
+ * at the cursor only moves a gap edge, O(1) amortized, where ft::vector
+ * shifts the whole tail. Moving the cursor carries the elements it passes
+ * across the gap, O(distance): one memmove when T is trivially copyable,
+ * a construct / destroy per element otherwise. A full gap doubles the
+ * buffer.
+ *
+ * The iterator-taking insert and erase move the cursor to their position
+ * first. Any edit or cursor move invalidates all iterators.
+ *
+ * @tparam T Type of the elements.
+ * @tparam _Alloc allocator of the buffer, defaults to `allocator<T>`.
+ */
+template < class T, class _Alloc = std::allocator< T > >
+class gap_buffer {
+ public:
+  /* The first template parameter (T) */
+  typedef T value_type;
+  /* The second template parameter (_Alloc) */
+  typedef _Alloc allocator_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+  /* a random access iterator to value_type, skipping the gap */
+  typedef ft::gap_iterator< T > iterator;
+  /* a random access iterator to const value_type */
+  typedef ft::gap_iterator< const T > const_iterator;
+  typedef ft::reverse_iterator< iterator > reverse_iterator;
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+  /* a signed integral type */
+  typedef std::ptrdiff_t difference_type;
+  /* an unsigned integral type */
+  typedef typename allocator_type::size_type size_type;
+
+ private:
+  /* capacity of the first buffer */
+  static const size_type _min_capacity = 16;
+
+  /* how elements cross the gap: memmove or construct / destroy */
+  typedef typename ft::is_trivially_copyable< T >::type _trivial;
+
+  allocator_type _alloc;
+  pointer _buffer;
+  size_type _capacity;
+  /* the gap is [_gap_begin, _gap_end), _gap_begin is the cursor */
+  size_type _gap_begin;
+  size_type _gap_end;
+
+ public:
+  /**
+   * @brief empty container constructor (default constructor)
+   */
+  explicit gap_buffer(const allocator_type& alloc = allocator_type())
+      : _alloc(alloc),
+        _buffer(u_nullptr),
+        _capacity(0),
+        _gap_begin(0),
+        _gap_end(0){};
+
+  /**
+   * @brief range constructor, the cursor ends after the last element
+   */
+  template < class InputIterator >
+  gap_buffer(InputIterator first, InputIterator last,
+             const allocator_type& alloc = allocator_type(),
+             typename ft::enable_if<
+                 !ft::is_integral< InputIterator >::value >::type* = u_nullptr)
+      : _alloc(alloc),
+        _buffer(u_nullptr),
+        _capacity(0),
+        _gap_begin(0),
+        _gap_end(0) {
+    this->insert(first, last);
+  };
+
+  /**
+   * @brief copy constructor, keeps x's cursor
+   */
+  gap_buffer(const gap_buffer& x)
+      : _alloc(x._alloc),
+        _buffer(u_nullptr),
+        _capacity(0),
+        _gap_begin(0),
+        _gap_end(0) {
+    if (x._capacity == 0) return;
+    this->_buffer = this->_alloc.allocate(x._capacity);
+    this->_capacity = x._capacity;
+    for (; this->_gap_begin < x._gap_begin; ++this->_gap_begin) {
+      this->_alloc.construct(this->_buffer + this->_gap_begin,
+                             x._buffer[this->_gap_begin]);
+    }
+    this->_gap_end = this->_capacity;
+    while (this->_gap_end > x._gap_end) {
+      --this->_gap_end;
+      this->_alloc.construct(this->_buffer + this->_gap_end,
+                             x._buffer[this->_gap_end]);
+    }
+  };
+
+  gap_buffer& operator=(const gap_buffer& x) {
+    if (this != &x) {
+      gap_buffer tmp(x);
+      this->swap(tmp);
+    }
+    return *this;
+  };
+
+  ~gap_buffer() {
+    this->clear();
+    if (this->_buffer != u_nullptr) {
+      this->_alloc.deallocate(this->_buffer, this->_capacity);
+    }
+  };
+
+  iterator begin() { return this->_iterator(0); };
+  const_iterator begin() const { return this->_iterator(0); };
+  iterator end() { return this->_iterator(this->size()); };
+  const_iterator end() const { return this->_iterator(this->size()); };
+  reverse_iterator rbegin() { return reverse_iterator(this->end()); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(this->end());
+  };
+  reverse_iterator rend() { return reverse_iterator(this->begin()); };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(this->begin());
+  };
+
+  size_type size() const {
+    return this->_capacity - (this->_gap_end - this->_gap_begin);
+  };
+  size_type max_size() const { return this->_alloc.max_size(); };
+  bool empty() const { return this->size() == 0; };
+  size_type capacity() const { return this->_capacity; };
+
+  /**
+   * @brief Make room for at least n elements; keeps the cursor.
+   */
+  void reserve(size_type n) {
+    if (n > this->max_size()) throw std::length_error("ft::gap_buffer");
+    if (n > this->_capacity) this->_reallocate(n);
+  };
+
+  reference operator[](size_type n) { return *this->_slot(n); };
+  const_reference operator[](size_type n) const { return *this->_slot(n); };
+
+  reference at(size_type n) {
+    if (n >= this->size()) throw std::out_of_range("ft::gap_buffer");
+    return *this->_slot(n);
+  };
+
+  const_reference at(size_type n) const {
+    if (n >= this->size()) throw std::out_of_range("ft::gap_buffer");
+    return *this->_slot(n);
+  };
+
+  reference front() { return *this->_slot(0); };
+  const_reference front() const { return *this->_slot(0); };
+  reference back() { return *this->_slot(this->size() - 1); };
+  const_reference back() const { return *this->_slot(this->size() - 1); };
+
+  /**
+   * @brief Position of the cursor: the number of elements before it.
+   */
+  size_type cursor() const { return this->_gap_begin; };
+
+  /**
+   * @brief Put the cursor before element pos (pos == size() for the end),
+   * moving the elements in between across the gap.
+   */
+  void move_cursor(size_type pos) {
+    if (pos > this->size()) throw std::out_of_range("ft::gap_buffer");
+    if (this->_gap_begin == this->_gap_end) {
+      // a full buffer: nothing to carry, and no slot to carry it to
+      this->_gap_begin = pos;
+      this->_gap_end = pos;
+    } else if (pos < this->_gap_begin) {
+      size_type n = this->_gap_begin - pos;
+      this->_relocate(this->_buffer + this->_gap_end - n,
+                      this->_buffer + pos, n, true, _trivial());
+      this->_gap_begin -= n;
+      this->_gap_end -= n;
+    } else if (pos > this->_gap_begin) {
+      size_type n = pos - this->_gap_begin;
+      this->_relocate(this->_buffer + this->_gap_begin,
+                      this->_buffer + this->_gap_end, n, false, _trivial());
+      this->_gap_begin += n;
+      this->_gap_end += n;
+    }
+  };
+
+  /**
+   * @brief Insert val at the cursor; the cursor moves past it, as typing.
+   */
+  void insert(const value_type& val) {
+    if (this->_gap_begin == this->_gap_end) {
+      value_type copy(val);
+      this->_grow(1);
+      this->_alloc.construct(this->_buffer + this->_gap_begin++, copy);
+    } else {
+      this->_alloc.construct(this->_buffer + this->_gap_begin++, val);
+    }
+  };
+
+  /**
+   * @brief Insert [first,last) at the cursor, which ends after them.
+   */
+  template < class InputIterator >
+  void insert(InputIterator first, InputIterator last,
+              typename ft::enable_if<
+                  !ft::is_integral< InputIterator >::value >::type* =
+                  u_nullptr) {
+    for (; first != last; ++first) this->insert(*first);
+  };
+
+  void insert(size_type n, const value_type& val) {
+    if (this->_gap_end - this->_gap_begin < n) {
+      value_type copy(val);
+      this->_grow(n);
+      while (n--) this->insert(copy);
+    } else {
+      while (n--) this->insert(val);
+    }
+  };
+
+  /**
+   * @brief Insert val before position, leaving the cursor after it.
+   */
+  iterator insert(iterator position, const value_type& val) {
+    size_type index = static_cast< size_type >(position.index());
+    if (index != this->_gap_begin) {
+      value_type copy(val);
+      this->move_cursor(index);
+      this->insert(copy);
+    } else {
+      this->insert(val);
+    }
+    return this->_iterator(index);
+  };
+
+  /**
+   * @brief Remove n elements before the cursor, as backspace.
+   */
+  void erase_before(size_type n = 1) {
+    if (n > this->_gap_begin) throw std::out_of_range("ft::gap_buffer");
+    while (n--) this->_alloc.destroy(this->_buffer + --this->_gap_begin);
+  };
+
+  /**
+   * @brief Remove n elements after the cursor, as delete.
+   */
+  void erase_after(size_type n = 1) {
+    if (n > this->_capacity - this->_gap_end) {
+      throw std::out_of_range("ft::gap_buffer");
+    }
+    while (n--) this->_alloc.destroy(this->_buffer + this->_gap_end++);
+  };
+
+  iterator erase(iterator position) {
+    return this->erase(position, position + 1);
+  };
+
+  /**
+   * @brief Remove [first,last), leaving the cursor where they were.
+   */
+  iterator erase(iterator first, iterator last) {
+    size_type index = static_cast< size_type >(first.index());
+    this->move_cursor(index);
+    this->erase_after(static_cast< size_type >(last - first));
+    return this->_iterator(index);
+  };
+
+  void push_back(const value_type& val) {
+    this->move_cursor(this->size());
+    this->insert(val);
+  };
+
+  void pop_back() {
+    this->move_cursor(this->size());
+    this->erase_before();
+  };
+
+  /**
+   * @brief Destroy every element; the buffer is kept.
+   */
+  void clear() {
+    this->erase_before(this->_gap_begin);
+    this->erase_after(this->_capacity - this->_gap_end);
+    this->_gap_begin = 0;
+    this->_gap_end = this->_capacity;
+  };
+
+  void swap(gap_buffer& x) {
+    ft::swap(this->_alloc, x._alloc);
+    ft::swap(this->_buffer, x._buffer);
+    ft::swap(this->_capacity, x._capacity);
+    ft::swap(this->_gap_begin, x._gap_begin);
+    ft::swap(this->_gap_end, x._gap_end);
+  };
+
+  allocator_type get_allocator() const { return this->_alloc; };
+
+ private:
+  pointer _slot(size_type n) const {
+    return this->_buffer +
+           (n < this->_gap_begin ? n : n + this->_gap_end - this->_gap_begin);
+  };
+
+  iterator _iterator(size_type n) {
+    return iterator(this->_buffer,
+                    static_cast< difference_type >(this->_gap_begin),
+                    static_cast< difference_type >(this->_gap_end -
+                                                   this->_gap_begin),
+                    static_cast< difference_type >(n));
+  };
+
+  const_iterator _iterator(size_type n) const {
+    return const_iterator(this->_buffer,
+                          static_cast< difference_type >(this->_gap_begin),
+                          static_cast< difference_type >(this->_gap_end -
+                                                         this->_gap_begin),
+                          static_cast< difference_type >(n));
+  };
+
+  /**
+   * @brief Move n elements from src to the unconstructed dst. The ranges
+   * may overlap; backward copies from the last element down.
+   */
+  void _relocate(pointer dst, pointer src, size_type n, bool backward,
+                 ft::true_type) {
+    (void)backward;
+    if (n) std::memmove(static_cast< void* >(dst), src, n * sizeof(T));
+  };
+
+  void _relocate(pointer dst, pointer src, size_type n, bool backward,
+                 ft::false_type) {
+    if (backward) {
+      while (n--) {
+        this->_alloc.construct(dst + n, src[n]);
+        this->_alloc.destroy(src + n);
+      }
+    } else {
+      for (size_type i = 0; i < n; ++i) {
+        this->_alloc.construct(dst + i, src[i]);
+        this->_alloc.destroy(src + i);
+      }
+    }
+  };
+
+  /**
+   * @brief Widen the gap to at least n slots, doubling the buffer.
+   */
+  void _grow(size_type n) {
+    size_type capacity = this->_capacity ? this->_capacity : _min_capacity;
+    while (capacity - this->size() < n) capacity <<= 1;
+    this->_reallocate(capacity);
+  };
+
+  /**
+   * @brief Move both sides into a buffer of capacity slots, the tail to its
+   * end, so the whole growth lands in the gap at the cursor.
+   */
+  void _reallocate(size_type capacity) {
+    pointer buffer = this->_alloc.allocate(capacity);
+    size_type tail = this->_capacity - this->_gap_end;
+    this->_relocate(buffer, this->_buffer, this->_gap_begin, false,
+                    _trivial());
+    this->_relocate(buffer + capacity - tail, this->_buffer + this->_gap_end,
+                    tail, false, _trivial());
+    if (this->_buffer != u_nullptr) {
+      this->_alloc.deallocate(this->_buffer, this->_capacity);
+    }
+    this->_buffer = buffer;
+    this->_capacity = capacity;
+    this->_gap_end = capacity - tail;
+  };
+};
+
+template < class T, class _Alloc >
+const typename gap_buffer< T, _Alloc >::size_type
+    gap_buffer< T, _Alloc >::_min_capacity;
+
+template < class T, class Alloc >
+bool operator==(const gap_buffer< T, Alloc >& lhs,
+                const gap_buffer< T, Alloc >& rhs) {
+  return lhs.size() == rhs.size() &&
+         ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+};
+
+template < class T, class Alloc >
+bool operator!=(const gap_buffer< T, Alloc >& lhs,
+                const gap_buffer< T, Alloc >& rhs) {
+  return !(lhs == rhs);
+};
+
+template < class T, class Alloc >
+void swap(gap_buffer< T, Alloc >& x, gap_buffer< T, Alloc >& y) {
+  x.swap(y);
+};
+
+}  // namespace ft
+
+#endif  // FT__GAP_BUFFER_HPP
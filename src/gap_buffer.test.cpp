@@ -0,0 +1,154 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/23
+ * @file src/gap_buffer.test.cpp
+ */
+
+#include "gap_buffer.hpp"
+
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+std::string gb_test_text(const ft::gap_buffer< char >& gb) {
+  std::string text;
+  for (ft::gap_buffer< char >::const_iterator it = gb.begin(); it != gb.end();
+       ++it) {
+    text += *it;
+  }
+  return text;
+}
+
+}  // namespace
+
+void test_gap_buffer_cursor(void) {
+  std::cout << "\t cursor" << std::endl;
+
+  const char* hello = "hello world";
+  ft::gap_buffer< char > gb(hello, hello + std::strlen(hello));
+  assert(gb.size() == 11 && gb.cursor() == 11);
+
+  // type a word in the middle, then fix a typo behind the cursor
+  gb.move_cursor(5);
+  const char* typed = ", brave nwe";
+  gb.insert(typed, typed + std::strlen(typed));
+  assert(gb.cursor() == 16 && gb_test_text(gb) == "hello, brave nwe world");
+  gb.erase_before(2);
+  gb.insert('e');
+  gb.insert('w');
+  assert(gb_test_text(gb) == "hello, brave new world");
+
+  // delete forward, move back to the start, move past the end
+  gb.erase_after(6);
+  assert(gb_test_text(gb) == "hello, brave new" && gb.cursor() == 16);
+  gb.move_cursor(0);
+  gb.insert(2, '>');
+  assert(gb_test_text(gb) == ">>hello, brave new" && gb.cursor() == 2);
+  assert(gb.front() == '>' && gb.back() == 'w' && gb[2] == 'h');
+  try {
+    gb.move_cursor(gb.size() + 1);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+  try {
+    gb.erase_before(3);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+  assert(gb.at(17) == 'w' && gb.cursor() == 2);
+
+  // growth keeps both sides and the cursor
+  std::string expected = gb_test_text(gb);
+  for (int i = 0; i < 100; ++i) gb.insert('x');
+  expected.insert(2, 100, 'x');
+  assert(gb_test_text(gb) == expected && gb.cursor() == 102);
+  assert(gb.capacity() >= gb.size());
+
+  gb.push_back('!');
+  assert(gb.back() == '!' && gb.cursor() == gb.size());
+  gb.pop_back();
+  gb.clear();
+  assert(gb.empty() && gb.cursor() == 0 && gb_test_text(gb).empty());
+}
+
+void test_gap_buffer_iterator(void) {
+  std::cout << "\t iterator" << std::endl;
+
+  ft::gap_buffer< int > gb;
+  for (int i = 0; i < 10; ++i) gb.insert(i);
+  gb.move_cursor(4);
+  // 0 1 2 3 | gap | 4 5 6 7 8 9
+  ft::gap_buffer< int >::iterator it = gb.begin();
+  assert(it[3] == 3 && it[4] == 4 && gb.end() - it == 10);
+  it += 5;
+  assert(*it == 5 && *(it - 2) == 3 && it > gb.begin());
+  int sum = 0;
+  for (ft::gap_buffer< int >::const_iterator c = gb.begin(); c != gb.end();
+       ++c) {
+    sum += *c;
+  }
+  assert(sum == 45 && *gb.rbegin() == 9 && gb.rbegin()[9] == 0);
+
+  // iterator edits move the cursor to the position
+  ft::gap_buffer< int >::iterator at = gb.insert(gb.begin() + 8, -1);
+  assert(*at == -1 && gb.cursor() == 9 && gb[9] == 8);
+  at = gb.erase(gb.begin() + 1, gb.begin() + 3);
+  assert(*at == 3 && gb.cursor() == 1 && gb.size() == 9);
+  at = gb.erase(gb.begin());
+  assert(*at == 3 && gb.front() == 3);
+
+  ft::gap_buffer< int > copy(gb);
+  assert(copy == gb && copy.cursor() == gb.cursor());
+  copy[0] = 7;
+  assert(copy != gb);
+  ft::swap(copy, gb);
+  assert(gb.front() == 7);
+}
+
+void test_gap_buffer_objects(void) {
+  std::cout << "\t objects" << std::endl;
+
+  // strings cross the gap by construct / destroy, not memmove
+  ft::gap_buffer< std::string > lines;
+  for (int i = 0; i < 40; ++i) lines.insert(std::string(20, 'a' + i % 26));
+  lines.move_cursor(3);
+  lines.insert(lines[30]);
+  lines.move_cursor(35);
+  lines.erase_before(10);
+  lines.move_cursor(1);
+  assert(lines.size() == 31 && lines[3] == std::string(20, 'e'));
+  assert(lines[4] == std::string(20, 'd') && lines.back()[0] == 'n');
+  // a full buffer has an empty gap to move
+  ft::gap_buffer< std::string > full;
+  full.insert(16, "f");
+  assert(full.capacity() == 16);
+  full.move_cursor(0);
+  full.move_cursor(full.size() / 2);
+  full.insert("g");
+  assert(full.size() == 17 && full[8] == "g" && full[9] == "f");
+
+  ft::gap_buffer< std::string > other;
+  other = lines;
+  assert(other == lines && other.cursor() == 1);
+  // three copies at the cursor
+  other.insert(3, "x");
+  assert(other.size() == 34 && other[3] == "x" && other[4] == lines[1]);
+}
+
+void test_gap_buffer(void) {
+  std::cout << "Test: gap_buffer" << std::endl;
+  test_gap_buffer_cursor();
+  test_gap_buffer_iterator();
+  test_gap_buffer_objects();
+}
@@ -16,6 +16,7 @@
 
 #include <cstddef>
 #include <iostream>
+#include <iterator>
 namespace ft {
 
 /**
@@ -186,6 +187,22 @@ struct iterator_traits< T* const > {
   typedef const T& reference;
 };
 
+/**
+ * @brief Helper returned by operator-> of iterators whose reference type is a
+ * proxy object (e.g. a pair of references) rather than a real reference.
+ * It keeps the proxy alive for the duration of the member access.
+ *
+ * @tparam Reference the proxy reference type of the iterator
+ */
+template < class Reference >
+struct arrow_proxy {
+  Reference ref;
+
+  arrow_proxy(const Reference& r) : ref(r){};
+
+  const Reference* operator->() const { return &ref; };
+};
+
 /**
  * @brief This class reverses the direction in which a bidirectional or
  * random-access iterator iterates through a range.
@@ -426,6 +443,124 @@ typename reverse_iterator< Iterator1 >::difference_type operator-(
   return rhs.base() - lhs.base();
 };
 
+/**
+ * @brief distance implementation for input iterators, walks the range.
+ */
+template < class InputIterator >
+typename iterator_traits< InputIterator >::difference_type _distance(
+    InputIterator first, InputIterator last, input_iterator_tag) {
+  typename iterator_traits< InputIterator >::difference_type n = 0;
+  for (; first != last; ++first) ++n;
+  return n;
+}
+
+/**
+ * @brief distance implementation for random-access iterators, constant time.
+ */
+template < class RandomAccessIterator >
+typename iterator_traits< RandomAccessIterator >::difference_type _distance(
+    RandomAccessIterator first, RandomAccessIterator last,
+    random_access_iterator_tag) {
+  return last - first;
+}
+
+/**
+ * @brief distance implementation for iterators tagged by the std library.
+ */
+template < class InputIterator >
+typename iterator_traits< InputIterator >::difference_type _distance(
+    InputIterator first, InputIterator last, std::input_iterator_tag) {
+  return ft::_distance(first, last, input_iterator_tag());
+}
+
+/**
+ * @brief distance implementation for iterators tagged by the std library.
+ */
+template < class RandomAccessIterator >
+typename iterator_traits< RandomAccessIterator >::difference_type _distance(
+    RandomAccessIterator first, RandomAccessIterator last,
+    std::random_access_iterator_tag) {
+  return last - first;
+}
+
+/**
+ * @brief Return distance between iterators
+ * Calculates the number of elements between first and last. Constant time for
+ * random-access iterators, linear otherwise.
+ */
+template < class InputIterator >
+typename iterator_traits< InputIterator >::difference_type distance(
+    InputIterator first, InputIterator last) {
+  return ft::_distance(
+      first, last,
+      typename iterator_traits< InputIterator >::iterator_category());
+}
+
+/**
+ * @brief advance implementation for input iterators, forward only.
+ */
+template < class InputIterator, class Distance >
+void _advance(InputIterator& it, Distance n, input_iterator_tag) {
+  while (n-- > 0) ++it;
+}
+
+/**
+ * @brief advance implementation for bidirectional iterators.
+ */
+template < class BidirectionalIterator, class Distance >
+void _advance(BidirectionalIterator& it, Distance n,
+              bidirectional_iterator_tag) {
+  if (n >= 0)
+    while (n-- > 0) ++it;
+  else
+    while (n++ < 0) --it;
+}
+
+/**
+ * @brief advance implementation for random-access iterators, constant time.
+ */
+template < class RandomAccessIterator, class Distance >
+void _advance(RandomAccessIterator& it, Distance n,
+              random_access_iterator_tag) {
+  it += n;
+}
+
+/**
+ * @brief advance implementation for iterators tagged by the std library.
+ */
+template < class InputIterator, class Distance >
+void _advance(InputIterator& it, Distance n, std::input_iterator_tag) {
+  ft::_advance(it, n, input_iterator_tag());
+}
+
+/**
+ * @brief advance implementation for iterators tagged by the std library.
+ */
+template < class BidirectionalIterator, class Distance >
+void _advance(BidirectionalIterator& it, Distance n,
+              std::bidirectional_iterator_tag) {
+  ft::_advance(it, n, bidirectional_iterator_tag());
+}
+
+/**
+ * @brief advance implementation for iterators tagged by the std library.
+ */
+template < class RandomAccessIterator, class Distance >
+void _advance(RandomAccessIterator& it, Distance n,
+              std::random_access_iterator_tag) {
+  it += n;
+}
+
+/**
+ * @brief Advance iterator
+ * Advances the iterator it by n element positions.
+ */
+template < class InputIterator, class Distance >
+void advance(InputIterator& it, Distance n) {
+  ft::_advance(it, n,
+               typename iterator_traits< InputIterator >::iterator_category());
+}
+
 }  // namespace ft
 
 #endif  // FT__ITERATOR_HPP
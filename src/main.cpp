@@ -30,7 +30,32 @@ int main(void) {
   // test_utility();
   // test_random_access_iterator();
 
-  // test_vector();
+  test_vector();
+  test_flat_map();
+  test_btree_map();
+  test_unordered_map();
+  test_order_statistic_map();
+  test_spsc_ring();
+  test_mpmc_queue();
+  test_concurrent_vector();
+  test_rcu_vector();
+  test_reclamation();
+  test_thread_cache_allocator();
+  test_thread_pool();
+  test_soa_vector();
+  test_compact_vector();
+  test_vector_bool();
+  test_packed_int_vector();
+  test_cow_vector();
+  test_persistent_vector();
+  test_views();
+  test_span();
+  test_mdarray();
+  test_priority_queue();
+  test_ring_deque();
+  test_gap_buffer();
+  test_pma();
+  test_slot_map();
 
 
   return 0;
@@ -0,0 +1,153 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/20
+ * @file src/mdarray.bench.cpp
+ */
+
+#include <iostream>
+
+#include "bench.hpp"
+#include "mdarray.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const std::size_t g_side = 2048;
+const std::size_t g_block = 32;
+const int g_sweeps = 8;
+
+typedef ft::vector< ft::vector< double > > nested_grid;
+typedef ft::mdarray< double, 2 > flat_grid;
+typedef ft::mdarray< double, 2, ft::layout_tiled< 5 > > tiled_grid;
+
+double mdarray_bench_value(std::size_t i, std::size_t j) {
+  return static_cast< double >((i * 31 + j * 17) % 101);
+}
+
+/**
+ * @brief 5-point Jacobi sweeps over the interior, out <- average of in.
+ */
+template < class Grid >
+void mdarray_bench_stencil(Grid& a, Grid& b) {
+  for (int sweep = 0; sweep < g_sweeps; ++sweep) {
+    Grid& in = sweep % 2 ? b : a;
+    Grid& out = sweep % 2 ? a : b;
+    for (std::size_t i = 1; i + 1 < g_side; ++i) {
+      for (std::size_t j = 1; j + 1 < g_side; ++j) {
+        out(i, j) = 0.2 * (in(i, j) + in(i - 1, j) + in(i + 1, j) +
+                           in(i, j - 1) + in(i, j + 1));
+      }
+    }
+  }
+}
+
+void mdarray_bench_stencil(nested_grid& a, nested_grid& b) {
+  for (int sweep = 0; sweep < g_sweeps; ++sweep) {
+    nested_grid& in = sweep % 2 ? b : a;
+    nested_grid& out = sweep % 2 ? a : b;
+    for (std::size_t i = 1; i + 1 < g_side; ++i) {
+      for (std::size_t j = 1; j + 1 < g_side; ++j) {
+        out[i][j] = 0.2 * (in[i][j] + in[i - 1][j] + in[i + 1][j] +
+                           in[i][j - 1] + in[i][j + 1]);
+      }
+    }
+  }
+}
+
+/**
+ * @brief dst = transpose(src) one pair of g_block tiles at a time.
+ */
+template < class Grid >
+void mdarray_bench_tiled_transpose(const Grid& src, Grid& dst) {
+  for (std::size_t ti = 0; ti < src.tiles(g_block, 0); ++ti) {
+    for (std::size_t tj = 0; tj < src.tiles(g_block, 1); ++tj) {
+      const std::size_t from[2] = {ti, tj};
+      const std::size_t to[2] = {tj, ti};
+      typename Grid::const_subview_type in = src.tile(g_block, from);
+      typename Grid::subview_type out = dst.tile(g_block, to);
+      for (std::size_t i = 0; i < in.extent(0); ++i) {
+        for (std::size_t j = 0; j < in.extent(1); ++j) out(j, i) = in(i, j);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+void bench_mdarray(void) {
+  std::cout << "Bench: mdarray" << std::endl;
+
+  double start = bench_now();
+  nested_grid nested(g_side, ft::vector< double >(g_side));
+  nested_grid nested_out(g_side, ft::vector< double >(g_side));
+  for (std::size_t i = 0; i < g_side; ++i) {
+    for (std::size_t j = 0; j < g_side; ++j) {
+      nested[i][j] = mdarray_bench_value(i, j);
+    }
+  }
+  bench_report("vector of vectors build", bench_now() - start,
+               g_side * g_side);
+
+  start = bench_now();
+  flat_grid flat(g_side, g_side);
+  flat_grid flat_out(g_side, g_side);
+  for (std::size_t i = 0; i < g_side; ++i) {
+    for (std::size_t j = 0; j < g_side; ++j) {
+      flat(i, j) = mdarray_bench_value(i, j);
+    }
+  }
+  bench_report("mdarray build", bench_now() - start, g_side * g_side);
+
+  tiled_grid tiled(g_side, g_side);
+  tiled_grid tiled_out(g_side, g_side);
+  for (std::size_t i = 0; i < g_side; ++i) {
+    for (std::size_t j = 0; j < g_side; ++j) {
+      tiled(i, j) = mdarray_bench_value(i, j);
+    }
+  }
+
+  start = bench_now();
+  for (std::size_t i = 0; i < g_side; ++i) {
+    for (std::size_t j = 0; j < g_side; ++j) nested_out[j][i] = nested[i][j];
+  }
+  bench_report("vector of vectors transpose", bench_now() - start,
+               g_side * g_side);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < g_side; ++i) {
+    for (std::size_t j = 0; j < g_side; ++j) flat_out(j, i) = flat(i, j);
+  }
+  bench_report("mdarray row major transpose", bench_now() - start,
+               g_side * g_side);
+
+  start = bench_now();
+  mdarray_bench_tiled_transpose(flat, flat_out);
+  bench_report("mdarray row major, by tiles", bench_now() - start,
+               g_side * g_side);
+
+  start = bench_now();
+  mdarray_bench_tiled_transpose(tiled, tiled_out);
+  bench_report("mdarray tiled layout, by tiles", bench_now() - start,
+               g_side * g_side);
+
+  start = bench_now();
+  mdarray_bench_stencil(nested, nested_out);
+  bench_report("vector of vectors stencil", bench_now() - start,
+               g_side * g_side * g_sweeps);
+
+  start = bench_now();
+  mdarray_bench_stencil(flat, flat_out);
+  bench_report("mdarray row major stencil", bench_now() - start,
+               g_side * g_side * g_sweeps);
+
+  std::size_t sum = static_cast< std::size_t >(
+      nested_out[3][5] + flat_out(3, 5) + tiled_out(5, 3));
+  bench_sink(sum);
+}
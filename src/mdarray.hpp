@@ -0,0 +1,498 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/20
+ * @file src/mdarray.hpp
+ */
+
+#if !defined(FT__MDARRAY_HPP)
+#define FT__MDARRAY_HPP
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+#include "util.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+/* only md_rank_check< true > is complete: sizeof fails on a wrong arity */
+template < bool >
+struct md_rank_check;
+template <>
+struct md_rank_check< true > {};
+
+/**
+ * @brief Mapping with one stride per dimension: offset = sum index * stride.
+ * Base of the row major, column major and explicit stride mappings.
+ */
+template < std::size_t Rank >
+class md_strided_mapping {
+ public:
+  typedef std::size_t size_type;
+
+ protected:
+  size_type _extents[Rank];
+  size_type _strides[Rank];
+
+ public:
+  md_strided_mapping() {
+    for (size_type r = 0; r < Rank; ++r) {
+      this->_extents[r] = 0;
+      this->_strides[r] = 0;
+    }
+  };
+
+  size_type extent(size_type r) const { return this->_extents[r]; };
+  size_type stride(size_type r) const { return this->_strides[r]; };
+
+  /**
+   * @brief Offset of the element at index.
+   */
+  size_type operator()(const size_type* index) const {
+    size_type offset = 0;
+    for (size_type r = 0; r < Rank; ++r) {
+      offset += index[r] * this->_strides[r];
+    }
+    return offset;
+  };
+
+  /**
+   * @brief Elements spanned in storage, from offset 0.
+   */
+  size_type required_size() const {
+    size_type size = 1;
+    for (size_type r = 0; r < Rank; ++r) {
+      if (this->_extents[r] == 0) return 0;
+      size += (this->_extents[r] - 1) * this->_strides[r];
+    }
+    return size;
+  };
+
+  /**
+   * @brief Offset and strides of the block of extents elements starting at
+   * first, which any strided mapping can view.
+   */
+  size_type block(const size_type* first, const size_type*,
+                  size_type* strides) const {
+    for (size_type r = 0; r < Rank; ++r) strides[r] = this->_strides[r];
+    return (*this)(first);
+  };
+};
+
+/**
+ * @brief Row major layout: the last index varies fastest.
+ */
+struct layout_right {
+  template < std::size_t Rank >
+  class mapping : public md_strided_mapping< Rank > {
+   public:
+    typedef std::size_t size_type;
+
+    mapping(){};
+
+    explicit mapping(const size_type* extents) {
+      size_type stride = 1;
+      for (size_type r = Rank; r-- > 0;) {
+        this->_extents[r] = extents[r];
+        this->_strides[r] = stride;
+        stride *= extents[r];
+      }
+    };
+  };
+};
+
+/**
+ * @brief Column major layout: the first index varies fastest.
+ */
+struct layout_left {
+  template < std::size_t Rank >
+  class mapping : public md_strided_mapping< Rank > {
+   public:
+    typedef std::size_t size_type;
+
+    mapping(){};
+
+    explicit mapping(const size_type* extents) {
+      size_type stride = 1;
+      for (size_type r = 0; r < Rank; ++r) {
+        this->_extents[r] = extents[r];
+        this->_strides[r] = stride;
+        stride *= extents[r];
+      }
+    };
+  };
+};
+
+/**
+ * @brief Any strides: the layout of sub-views.
+ */
+struct layout_stride {
+  template < std::size_t Rank >
+  class mapping : public md_strided_mapping< Rank > {
+   public:
+    typedef std::size_t size_type;
+
+    mapping(){};
+
+    mapping(const size_type* extents, const size_type* strides) {
+      for (size_type r = 0; r < Rank; ++r) {
+        this->_extents[r] = extents[r];
+        this->_strides[r] = strides[r];
+      }
+    };
+  };
+};
+
+/**
+ * @brief Blocked layout: the array is cut into tiles of 2^TileBits elements
+ * per side, each tile stored contiguously in row major order and the tiles
+ * themselves in row major order. Extents are padded up to whole tiles.
+ *
+ * A kernel walking one tile at a time touches one contiguous block, whatever
+ * the dimension it walks along; transposes and stencils stay in cache.
+ */
+template < std::size_t TileBits = 3 >
+struct layout_tiled {
+  static const std::size_t tile_size = std::size_t(1) << TileBits;
+
+  template < std::size_t Rank >
+  class mapping {
+   public:
+    typedef std::size_t size_type;
+
+   protected:
+    size_type _extents[Rank];
+    /* tiles along each dimension */
+    size_type _tiles[Rank];
+
+   public:
+    mapping() {
+      for (size_type r = 0; r < Rank; ++r) {
+        this->_extents[r] = 0;
+        this->_tiles[r] = 0;
+      }
+    };
+
+    explicit mapping(const size_type* extents) {
+      for (size_type r = 0; r < Rank; ++r) {
+        this->_extents[r] = extents[r];
+        this->_tiles[r] = (extents[r] + tile_size - 1) >> TileBits;
+      }
+    };
+
+    size_type extent(size_type r) const { return this->_extents[r]; };
+
+    size_type operator()(const size_type* index) const {
+      size_type tile = 0;
+      size_type inner = 0;
+      for (size_type r = 0; r < Rank; ++r) {
+        tile = tile * this->_tiles[r] + (index[r] >> TileBits);
+        inner = (inner << TileBits) | (index[r] & (tile_size - 1));
+      }
+      return (tile << (TileBits * Rank)) | inner;
+    };
+
+    size_type required_size() const {
+      size_type tiles = 1;
+      for (size_type r = 0; r < Rank; ++r) tiles *= this->_tiles[r];
+      return tiles << (TileBits * Rank);
+    };
+
+    /**
+     * @brief Offset and strides of a block, which must lie inside one tile.
+     * Throws std::invalid_argument otherwise.
+     */
+    size_type block(const size_type* first, const size_type* extents,
+                    size_type* strides) const {
+      for (size_type r = 0; r < Rank; ++r) {
+        if ((first[r] & (tile_size - 1)) + extents[r] > tile_size) {
+          throw std::invalid_argument("ft::layout_tiled");
+        }
+        strides[r] = size_type(1) << (TileBits * (Rank - 1 - r));
+      }
+      return (*this)(first);
+    };
+  };
+};
+
+/**
+ * @brief Non-owning multidimensional view: a pointer and a Layout mapping
+ * from indices to offsets. Sub-views and tiles are strided views of the
+ * same storage.
+ *
+ * @tparam T Element type, const qualified for a read only view.
+ * @tparam Rank Number of dimensions.
+ * @tparam Layout layout_right, layout_left, layout_stride or layout_tiled.
+ */
+template < class T, std::size_t Rank, class Layout = layout_right >
+class mdspan {
+ public:
+  typedef T element_type;
+  typedef std::size_t size_type;
+  typedef T* pointer;
+  typedef T& reference;
+  typedef Layout layout_type;
+  typedef typename Layout::template mapping< Rank > mapping_type;
+  typedef mdspan< T, Rank, layout_stride > subview_type;
+
+ protected:
+  T* _data;
+  mapping_type _map;
+
+ public:
+  mdspan() : _data(u_nullptr), _map(){};
+  mdspan(T* data, const mapping_type& map) : _data(data), _map(map){};
+  mdspan(T* data, const size_type (&extents)[Rank])
+      : _data(data), _map(extents){};
+
+  /**
+   * @brief mdspan< const T > casting operator
+   */
+  operator mdspan< const T, Rank, Layout >() const {
+    return mdspan< const T, Rank, Layout >(this->_data, this->_map);
+  };
+
+  static size_type rank() { return Rank; };
+  size_type extent(size_type r) const { return this->_map.extent(r); };
+  size_type size() const {
+    size_type size = 1;
+    for (size_type r = 0; r < Rank; ++r) size *= this->_map.extent(r);
+    return size;
+  };
+  bool empty() const { return this->size() == 0; };
+  pointer data() const { return this->_data; };
+  const mapping_type& mapping() const { return this->_map; };
+
+  reference operator[](const size_type (&index)[Rank]) const {
+    return this->_data[this->_map(index)];
+  };
+
+  reference operator()(size_type i) const {
+    (void)sizeof(md_rank_check< Rank == 1 >);
+    size_type index[1] = {i};
+    return this->_data[this->_map(index)];
+  };
+
+  reference operator()(size_type i, size_type j) const {
+    (void)sizeof(md_rank_check< Rank == 2 >);
+    size_type index[2] = {i, j};
+    return this->_data[this->_map(index)];
+  };
+
+  reference operator()(size_type i, size_type j, size_type k) const {
+    (void)sizeof(md_rank_check< Rank == 3 >);
+    size_type index[3] = {i, j, k};
+    return this->_data[this->_map(index)];
+  };
+
+  reference at(const size_type (&index)[Rank]) const {
+    for (size_type r = 0; r < Rank; ++r) {
+      if (index[r] >= this->extent(r)) throw std::out_of_range("ft::mdspan");
+    }
+    return this->_data[this->_map(index)];
+  };
+
+  /**
+   * @brief The block of extents elements starting at first. Any block of a
+   * strided layout; a block inside one tile of layout_tiled.
+   */
+  subview_type subview(const size_type (&first)[Rank],
+                       const size_type (&extents)[Rank]) const {
+    size_type strides[Rank];
+    for (size_type r = 0; r < Rank; ++r) {
+      if (first[r] > this->extent(r) ||
+          extents[r] > this->extent(r) - first[r]) {
+        throw std::out_of_range("ft::mdspan");
+      }
+    }
+    size_type offset = this->_map.block(first, extents, strides);
+    return subview_type(this->_data + offset,
+                        layout_stride::mapping< Rank >(extents, strides));
+  };
+
+  /**
+   * @brief Number of tiles of side block along dimension r, counting a
+   * partial one at the end.
+   */
+  size_type tiles(size_type block, size_type r) const {
+    return (this->extent(r) + block - 1) / block;
+  };
+
+  /**
+   * @brief Tile coords of side block, cut short at the edges. With
+   * layout_tiled, block must divide its tile size.
+   */
+  subview_type tile(size_type block, const size_type (&coords)[Rank]) const {
+    size_type first[Rank];
+    size_type extents[Rank];
+    for (size_type r = 0; r < Rank; ++r) {
+      first[r] = coords[r] * block;
+      extents[r] = this->extent(r) - first[r];
+      if (extents[r] > block) extents[r] = block;
+    }
+    return this->subview(first, extents);
+  };
+};
+
+/**
+ * @brief Multidimensional array owning one contiguous buffer, in place of a
+ * vector of vectors: one allocation, and rows (or tiles) next to each other.
+ * Element access and views are those of mdspan.
+ *
+ * @tparam T Type of the elements.
+ * @tparam Rank Number of dimensions.
+ * @tparam Layout layout_right (default), layout_left or layout_tiled.
+ * @tparam _Alloc Allocator of the buffer.
+ */
+template < class T, std::size_t Rank, class Layout = layout_right,
+           class _Alloc = std::allocator< T > >
+class mdarray {
+ public:
+  typedef T value_type;
+  typedef _Alloc allocator_type;
+  typedef std::size_t size_type;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef Layout layout_type;
+  typedef typename Layout::template mapping< Rank > mapping_type;
+  typedef ft::mdspan< T, Rank, Layout > view_type;
+  typedef ft::mdspan< const T, Rank, Layout > const_view_type;
+  typedef mdspan< T, Rank, layout_stride > subview_type;
+  typedef mdspan< const T, Rank, layout_stride > const_subview_type;
+
+ protected:
+  ft::vector< T, _Alloc > _storage;
+  mapping_type _map;
+
+ public:
+  explicit mdarray(const allocator_type& alloc = allocator_type())
+      : _storage(alloc), _map(){};
+
+  explicit mdarray(const size_type (&extents)[Rank],
+                   const value_type& val = value_type(),
+                   const allocator_type& alloc = allocator_type())
+      : _storage(mapping_type(extents).required_size(), val, alloc),
+        _map(extents){};
+
+  /**
+   * @brief A rows x cols grid, Rank 2 only.
+   */
+  mdarray(size_type rows, size_type cols, const value_type& val = value_type(),
+          const allocator_type& alloc = allocator_type())
+      : _storage(_grid(rows, cols).required_size(), val, alloc),
+        _map(_grid(rows, cols)){};
+
+  view_type view() { return view_type(this->data(), this->_map); };
+  const_view_type view() const {
+    return const_view_type(this->data(), this->_map);
+  };
+
+  static size_type rank() { return Rank; };
+  size_type extent(size_type r) const { return this->_map.extent(r); };
+  size_type size() const { return this->view().size(); };
+  bool empty() const { return this->size() == 0; };
+  const mapping_type& mapping() const { return this->_map; };
+
+  /**
+   * @brief The buffer, mapping().required_size() elements long: padding
+   * included for layout_tiled.
+   */
+  pointer data() { return this->_storage.data(); };
+  const_pointer data() const { return this->_storage.data(); };
+
+  reference operator[](const size_type (&index)[Rank]) {
+    return this->data()[this->_map(index)];
+  };
+  const_reference operator[](const size_type (&index)[Rank]) const {
+    return this->data()[this->_map(index)];
+  };
+
+  reference operator()(size_type i) { return this->view()(i); };
+  const_reference operator()(size_type i) const { return this->view()(i); };
+  reference operator()(size_type i, size_type j) {
+    return this->view()(i, j);
+  };
+  const_reference operator()(size_type i, size_type j) const {
+    return this->view()(i, j);
+  };
+  reference operator()(size_type i, size_type j, size_type k) {
+    return this->view()(i, j, k);
+  };
+  const_reference operator()(size_type i, size_type j, size_type k) const {
+    return this->view()(i, j, k);
+  };
+
+  reference at(const size_type (&index)[Rank]) {
+    return this->view().at(index);
+  };
+  const_reference at(const size_type (&index)[Rank]) const {
+    return this->view().at(index);
+  };
+
+  subview_type subview(const size_type (&first)[Rank],
+                       const size_type (&extents)[Rank]) {
+    return this->view().subview(first, extents);
+  };
+  const_subview_type subview(const size_type (&first)[Rank],
+                             const size_type (&extents)[Rank]) const {
+    return this->view().subview(first, extents);
+  };
+
+  size_type tiles(size_type block, size_type r) const {
+    return this->view().tiles(block, r);
+  };
+  subview_type tile(size_type block, const size_type (&coords)[Rank]) {
+    return this->view().tile(block, coords);
+  };
+  const_subview_type tile(size_type block,
+                          const size_type (&coords)[Rank]) const {
+    return this->view().tile(block, coords);
+  };
+
+  /**
+   * @brief Set every element, padding included, to val.
+   */
+  void fill(const value_type& val) {
+    for (size_type i = 0; i < this->_storage.size(); ++i) {
+      this->_storage[i] = val;
+    }
+  };
+
+  void swap(mdarray& x) {
+    this->_storage.swap(x._storage);
+    mapping_type map = x._map;
+    x._map = this->_map;
+    this->_map = map;
+  };
+
+  allocator_type get_allocator() const {
+    return this->_storage.get_allocator();
+  };
+
+ private:
+  static mapping_type _grid(size_type rows, size_type cols) {
+    (void)sizeof(md_rank_check< Rank == 2 >);
+    size_type extents[2] = {rows, cols};
+    return mapping_type(extents);
+  };
+};
+
+template < class T, std::size_t Rank, class Layout, class Alloc >
+void swap(mdarray< T, Rank, Layout, Alloc >& x,
+          mdarray< T, Rank, Layout, Alloc >& y) {
+  x.swap(y);
+};
+
+}  // namespace ft
+
+#endif  // FT__MDARRAY_HPP
@@ -0,0 +1,149 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/20
+ * @file src/mdarray.test.cpp
+ */
+
+#include "mdarray.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+
+typedef ft::mdarray< int, 2 > ft_grid;
+
+void test_mdarray_layouts(void) {
+  std::cout << "\t layouts" << std::endl;
+
+  ft_grid right(3, 5);
+  ft::mdarray< int, 2, ft::layout_left > left(3, 5);
+  ft::mdarray< int, 2, ft::layout_tiled< 2 > > tiled(6, 5, -1);
+  assert(right.extent(0) == 3 && right.extent(1) == 5 && right.size() == 15);
+  assert(right.mapping().stride(0) == 5 && left.mapping().stride(1) == 3);
+  // 6 x 5 padded to 8 x 8 in tiles of 4 x 4
+  assert(tiled.mapping().required_size() == 64 && tiled.size() == 30);
+
+  for (std::size_t i = 0; i < 3; ++i) {
+    for (std::size_t j = 0; j < 5; ++j) {
+      right(i, j) = static_cast< int >(10 * i + j);
+      left(i, j) = static_cast< int >(10 * i + j);
+      tiled(i, j) = static_cast< int >(10 * i + j);
+    }
+  }
+  assert(right.data()[1 * 5 + 2] == 12 && left.data()[2 * 3 + 1] == 12);
+  // (1, 2) sits in tile (0, 0) at row 1, column 2
+  assert(tiled.data()[1 * 4 + 2] == 12);
+  // (2, 4) sits in tile (0, 1), stored after the whole of tile (0, 0)
+  assert(tiled.data()[16 + 2 * 4 + 0] == 24 && tiled(5, 4) == -1);
+
+  const std::size_t index[2] = {2, 3};
+  const ft_grid& cright = right;
+  assert(cright[index] == 23 && left.at(index) == 23 && tiled[index] == 23);
+  const std::size_t outside[2] = {3, 0};
+  try {
+    right.at(outside);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+
+  const std::size_t extents[3] = {2, 3, 4};
+  ft::mdarray< double, 3 > cube(extents, 0.5);
+  cube(1, 2, 3) = 7.0;
+  assert(cube.size() == 24 && cube.data()[23] == 7.0 && cube(0, 0, 0) == 0.5);
+  ft::mdarray< double, 3, ft::layout_tiled< 1 > > tcube(extents);
+  tcube(1, 2, 3) = 7.0;
+  assert(tcube(1, 2, 3) == 7.0 && tcube.mapping().required_size() == 32);
+
+  ft_grid other;
+  ft::swap(other, right);
+  assert(other(2, 4) == 24 && right.empty());
+}
+
+void test_mdarray_views(void) {
+  std::cout << "\t views" << std::endl;
+
+  ft_grid grid(6, 7);
+  for (std::size_t i = 0; i < 6; ++i) {
+    for (std::size_t j = 0; j < 7; ++j) {
+      grid(i, j) = static_cast< int >(10 * i + j);
+    }
+  }
+
+  const std::size_t first[2] = {1, 2};
+  const std::size_t extents[2] = {3, 4};
+  ft_grid::subview_type sub = grid.subview(first, extents);
+  assert(sub.extent(0) == 3 && sub.extent(1) == 4 && sub(0, 0) == 12);
+  assert(sub(2, 3) == 35 && sub.mapping().stride(0) == 7);
+  sub(1, 1) = -1;
+  assert(grid(2, 3) == -1);
+
+  // a sub-view of a sub-view stays in the same storage
+  const std::size_t inner_first[2] = {1, 1};
+  const std::size_t inner_extents[2] = {2, 2};
+  assert(sub.subview(inner_first, inner_extents)(0, 0) == -1);
+
+  const std::size_t too_far[2] = {6, 4};
+  try {
+    grid.subview(first, too_far);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+
+  // 6 x 7 in tiles of 4: 2 x 2 tiles, the last ones cut short
+  assert(grid.tiles(4, 0) == 2 && grid.tiles(4, 1) == 2);
+  const std::size_t corner[2] = {1, 1};
+  ft_grid::subview_type t = grid.tile(4, corner);
+  assert(t.extent(0) == 2 && t.extent(1) == 3 && t(0, 0) == 44);
+  long sum = 0;
+  for (std::size_t ti = 0; ti < grid.tiles(4, 0); ++ti) {
+    for (std::size_t tj = 0; tj < grid.tiles(4, 1); ++tj) {
+      const std::size_t coords[2] = {ti, tj};
+      ft_grid::const_subview_type block =
+          static_cast< const ft_grid& >(grid).tile(4, coords);
+      for (std::size_t i = 0; i < block.extent(0); ++i) {
+        for (std::size_t j = 0; j < block.extent(1); ++j) sum += block(i, j);
+      }
+    }
+  }
+  long expected = 0;
+  for (std::size_t i = 0; i < 6; ++i) {
+    for (std::size_t j = 0; j < 7; ++j) expected += grid(i, j);
+  }
+  assert(sum == expected);
+
+  // tiles of a tiled layout are contiguous row major blocks
+  ft::mdarray< int, 2, ft::layout_tiled< 2 > > tiled(6, 7);
+  for (std::size_t i = 0; i < 6; ++i) {
+    for (std::size_t j = 0; j < 7; ++j) {
+      tiled(i, j) = static_cast< int >(10 * i + j);
+    }
+  }
+  ft::mdspan< int, 2, ft::layout_stride > tt = tiled.tile(4, corner);
+  assert(tt.data() == tiled.data() + 3 * 16 && tt.mapping().stride(0) == 4);
+  assert(tt(1, 2) == 56 && tt.extent(1) == 3);
+  try {
+    tiled.subview(first, extents);
+    assert(false);
+  } catch (const std::invalid_argument& e) {
+  }
+
+  ft::mdspan< const int, 2 > ro = grid.view();
+  assert(ro(5, 6) == 56 && ro.size() == 42 && ro.rank() == 2);
+  int raw[6] = {1, 2, 3, 4, 5, 6};
+  const std::size_t shape[2] = {2, 3};
+  ft::mdspan< int, 2, ft::layout_left > over(raw, shape);
+  assert(over(1, 0) == 2 && over(0, 2) == 5);
+}
+
+void test_mdarray(void) {
+  std::cout << "Test: mdarray" << std::endl;
+  test_mdarray_layouts();
+  test_mdarray_views();
+}
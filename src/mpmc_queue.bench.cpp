@@ -0,0 +1,146 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/08
+ * @file src/mpmc_queue.bench.cpp
+ */
+
+#include <pthread.h>
+
+#include <cstdio>
+#include <deque>
+#include <iostream>
+
+#include "bench.hpp"
+#include "mpmc_queue.hpp"
+
+namespace {
+
+const std::size_t g_items = 1 << 22;
+
+struct locked_deque {
+  pthread_mutex_t lock;
+  std::deque< std::size_t > items;
+
+  bool try_push(std::size_t value) {
+    pthread_mutex_lock(&this->lock);
+    this->items.push_back(value);
+    pthread_mutex_unlock(&this->lock);
+    return true;
+  };
+
+  bool try_pop(std::size_t& value) {
+    pthread_mutex_lock(&this->lock);
+    bool got = !this->items.empty();
+    if (got) {
+      value = this->items.front();
+      this->items.pop_front();
+    }
+    pthread_mutex_unlock(&this->lock);
+    return got;
+  };
+};
+
+template < class Queue >
+struct run {
+  Queue* queue;
+  std::size_t items;
+  ft::atomic< std::size_t >* consumed;
+  std::size_t sum;
+};
+
+template < class Queue >
+void* produce(void* arg) {
+  run< Queue >* r = static_cast< run< Queue >* >(arg);
+  ft::backoff wait;
+  for (std::size_t i = 0; i < r->items;) {
+    if (r->queue->try_push(i)) {
+      ++i;
+      wait.reset();
+    } else {
+      wait.pause();
+    }
+  }
+  return NULL;
+}
+
+template < class Queue >
+void* consume(void* arg) {
+  run< Queue >* r = static_cast< run< Queue >* >(arg);
+  ft::backoff wait;
+  std::size_t value;
+  while (r->consumed->load(ft::memory_order_relaxed) < g_items) {
+    if (r->queue->try_pop(value)) {
+      r->sum += value;
+      r->consumed->fetch_add(1, ft::memory_order_relaxed);
+      wait.reset();
+    } else {
+      wait.pause();
+    }
+  }
+  return NULL;
+}
+
+/**
+ * @brief Move g_items through queue with threads producers and as many
+ * consumers.
+ */
+template < class Queue >
+double scale(Queue* queue, int threads, std::size_t* sum) {
+  ft::atomic< std::size_t > consumed(0);
+  run< Queue > runs[2 * 64];
+  pthread_t ids[2 * 64];
+  for (int i = 0; i < 2 * threads; ++i) {
+    runs[i].queue = queue;
+    /* consumers ignore items; the first producer takes the remainder */
+    runs[i].items = g_items / threads + (i == threads ? g_items % threads : 0);
+    runs[i].consumed = &consumed;
+    runs[i].sum = 0;
+  }
+
+  double start = bench_now();
+  for (int i = 0; i < threads; ++i) {
+    pthread_create(&ids[i], NULL, consume< Queue >, &runs[i]);
+    pthread_create(&ids[threads + i], NULL, produce< Queue >,
+                   &runs[threads + i]);
+  }
+  for (int i = 0; i < 2 * threads; ++i) {
+    pthread_join(ids[i], NULL);
+    *sum += runs[i].sum;
+  }
+  return bench_now() - start;
+}
+
+}  // namespace
+
+void bench_mpmc_queue(void) {
+  std::cout << "Bench: mpmc_queue" << std::endl;
+
+  int cores = bench_cores();
+
+  std::size_t sum = 0;
+  char label[64];
+  /* 1, 2, 4, ... and finally the core count itself */
+  for (int threads = 1;; threads = threads * 2 < cores ? threads * 2 : cores) {
+    ft::mpmc_queue< std::size_t > queue(1 << 12);
+    std::snprintf(label, sizeof(label), "mpmc_queue %dP/%dC", threads,
+                  threads);
+    bench_report(label, scale(&queue, threads, &sum), g_items);
+
+    locked_deque locked;
+    pthread_mutex_init(&locked.lock, NULL);
+    std::snprintf(label, sizeof(label), "mutex + std::deque %dP/%dC", threads,
+                  threads);
+    bench_report(label, scale(&locked, threads, &sum), g_items);
+    pthread_mutex_destroy(&locked.lock);
+
+    if (threads == cores) break;
+  }
+  bench_sink(sum);
+}
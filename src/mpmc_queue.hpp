@@ -0,0 +1,251 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/08
+ * @file src/mpmc_queue.hpp
+ */
+
+#if !defined(FT__MPMC_QUEUE_HPP)
+#define FT__MPMC_QUEUE_HPP
+
+#include <cstddef>
+#include <memory>
+
+#include "atomic.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+/**
+ * @brief One slot of an mpmc_queue: the value and the sequence number that
+ * tells which lap of the ring may touch it next.
+ */
+template < class T >
+struct mpmc_cell {
+  ft::atomic< std::size_t > sequence;
+  T value;
+
+  mpmc_cell() : sequence(0), value(){};
+  mpmc_cell(const mpmc_cell& other)
+      : sequence(other.sequence.load(memory_order_relaxed)),
+        value(other.value){};
+
+  mpmc_cell& operator=(const mpmc_cell& other) {
+    this->sequence.store(other.sequence.load(memory_order_relaxed),
+                         memory_order_relaxed);
+    this->value = other.value;
+    return *this;
+  };
+};
+
+/**
+ * @brief Bounded lock-free queue for any number of producers and consumers
+ * (Dmitry Vyukov's array queue).
+ *
+ * Slots are allocated once, in an ft::vector, and never move. Slot i starts
+ * with sequence i. A producer that claims position p writes the slot when
+ * its sequence equals p, then publishes p + 1; a consumer that claims p
+ * reads it when the sequence equals p + 1, then hands it to the next lap
+ * with p + capacity. Claiming a position is one CAS on a counter kept on
+ * its own cache line, so producers and consumers only contend with their
+ * own side.
+ *
+ * T must be default constructible and assignable: values are assigned into
+ * and out of slots.
+ *
+ * @tparam T Type of the elements.
+ * @tparam _Alloc allocator, rebound for the slots.
+ */
+template < class T, class _Alloc = std::allocator< T > >
+class mpmc_queue {
+ public:
+  /* The first template parameter (T) */
+  typedef T value_type;
+  /* The second template parameter (_Alloc) */
+  typedef _Alloc allocator_type;
+  /* an unsigned integral type */
+  typedef std::size_t size_type;
+
+ private:
+  typedef mpmc_cell< T > _cell;
+  typedef typename _Alloc::template rebind< _cell >::other _cell_allocator;
+
+  char _pad0[cache_line_size];
+  /* read only after construction */
+  ft::vector< _cell, _cell_allocator > _cells;
+  size_type _mask;
+  char _pad1[cache_line_size];
+  ft::atomic< size_type > _enqueue_pos;
+  char _pad2[cache_line_size];
+  ft::atomic< size_type > _dequeue_pos;
+  char _pad3[cache_line_size];
+
+  mpmc_queue(const mpmc_queue&);
+  mpmc_queue& operator=(const mpmc_queue&);
+
+ public:
+  /**
+   * @brief Queue holding at least capacity elements, rounded up to a power
+   * of two.
+   */
+  explicit mpmc_queue(size_type capacity,
+                      const allocator_type& alloc = allocator_type())
+      : _cells(_round_up(capacity), _cell(), _cell_allocator(alloc)),
+        _mask(_round_up(capacity) - 1),
+        _enqueue_pos(0),
+        _dequeue_pos(0) {
+    for (size_type i = 0; i < this->_cells.size(); ++i) {
+      this->_cells[i].sequence.store(i, memory_order_relaxed);
+    }
+  };
+
+  size_type capacity() const { return this->_mask + 1; };
+
+  /**
+   * @brief Number of queued elements. Exact only when the queue is idle.
+   */
+  size_type size() const {
+    size_type head = this->_dequeue_pos.load(memory_order_acquire);
+    size_type tail = this->_enqueue_pos.load(memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  };
+
+  bool empty() const { return this->size() == 0; };
+
+  allocator_type get_allocator() const {
+    return allocator_type(this->_cells.get_allocator());
+  };
+
+  /**
+   * @brief Enqueue a copy of val unless the queue is full.
+   */
+  bool try_push(const value_type& val) {
+    size_type pos = this->_enqueue_pos.load(memory_order_relaxed);
+    for (;;) {
+      _cell& cell = this->_cells[pos & this->_mask];
+      size_type seq = cell.sequence.load(memory_order_acquire);
+      std::ptrdiff_t diff = static_cast< std::ptrdiff_t >(seq - pos);
+      if (diff == 0) {
+        if (this->_enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                                     memory_order_relaxed)) {
+          cell.value = val;
+          cell.sequence.store(pos + 1, memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = this->_enqueue_pos.load(memory_order_relaxed);
+      }
+    }
+  };
+
+  /**
+   * @brief Dequeue the oldest element into val unless the queue is empty.
+   */
+  bool try_pop(value_type& val) {
+    size_type pos = this->_dequeue_pos.load(memory_order_relaxed);
+    for (;;) {
+      _cell& cell = this->_cells[pos & this->_mask];
+      size_type seq = cell.sequence.load(memory_order_acquire);
+      std::ptrdiff_t diff = static_cast< std::ptrdiff_t >(seq - (pos + 1));
+      if (diff == 0) {
+        if (this->_dequeue_pos.compare_exchange_weak(pos, pos + 1,
+                                                     memory_order_relaxed)) {
+          val = cell.value;
+          cell.sequence.store(pos + this->_mask + 1, memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = this->_dequeue_pos.load(memory_order_relaxed);
+      }
+    }
+  };
+
+  /**
+   * @brief Dequeue up to n elements into dst, claiming the whole run of
+   * ready slots with a single CAS.
+   *
+   * @return the number of elements dequeued
+   */
+  size_type try_pop_n(value_type* dst, size_type n) {
+    if (n == 0) return 0;
+    size_type pos = this->_dequeue_pos.load(memory_order_relaxed);
+    size_type ready;
+    for (;;) {
+      ready = 0;
+      while (ready < n) {
+        size_type p = pos + ready;
+        size_type seq =
+            this->_cells[p & this->_mask].sequence.load(memory_order_acquire);
+        if (seq != p + 1) break;
+        ++ready;
+      }
+      if (ready == 0) {
+        size_type seq =
+            this->_cells[pos & this->_mask].sequence.load(memory_order_relaxed);
+        // the slot belongs to an earlier lap: the queue is empty
+        if (static_cast< std::ptrdiff_t >(seq - (pos + 1)) < 0) return 0;
+        pos = this->_dequeue_pos.load(memory_order_relaxed);
+        continue;
+      }
+      if (this->_dequeue_pos.compare_exchange_weak(pos, pos + ready,
+                                                   memory_order_relaxed)) {
+        break;
+      }
+    }
+    for (size_type i = 0; i < ready; ++i) {
+      _cell& cell = this->_cells[(pos + i) & this->_mask];
+      dst[i] = cell.value;
+      cell.sequence.store(pos + i + this->_mask + 1, memory_order_release);
+    }
+    return ready;
+  };
+
+  /**
+   * @brief Enqueue a copy of val, waiting while the queue is full.
+   */
+  void push(const value_type& val) {
+    ft::backoff wait;
+    while (!this->try_push(val)) wait.pause();
+  };
+
+  /**
+   * @brief Dequeue the oldest element, waiting while the queue is empty.
+   */
+  void pop(value_type& val) {
+    ft::backoff wait;
+    while (!this->try_pop(val)) wait.pause();
+  };
+
+  /**
+   * @brief Dequeue between 1 and n elements, waiting while the queue is
+   * empty.
+   */
+  size_type pop_n(value_type* dst, size_type n) {
+    if (n == 0) return 0;
+    ft::backoff wait;
+    size_type got;
+    while ((got = this->try_pop_n(dst, n)) == 0) wait.pause();
+    return got;
+  };
+
+ private:
+  static size_type _round_up(size_type capacity) {
+    size_type n = 2;
+    while (n < capacity) n <<= 1;
+    return n;
+  };
+};
+
+}  // namespace ft
+
+#endif  // FT__MPMC_QUEUE_HPP
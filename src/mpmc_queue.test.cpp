@@ -0,0 +1,130 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/08
+ * @file src/mpmc_queue.test.cpp
+ */
+
+#include "mpmc_queue.hpp"
+
+#include <pthread.h>
+
+#include <cassert>
+#include <iostream>
+#include <string>
+
+void test_mpmc_queue_single(void) {
+  std::cout << "\t single thread" << std::endl;
+
+  ft::mpmc_queue< std::string > queue(3);
+  assert(queue.capacity() == 4 && queue.empty());
+
+  std::string out;
+  assert(!queue.try_pop(out));
+  for (int lap = 0; lap < 3; ++lap) {
+    for (int i = 0; i < 4; ++i) assert(queue.try_push(std::string(i + 1, 'q')));
+    assert(!queue.try_push("full") && queue.size() == 4);
+    assert(queue.try_pop(out) && out == "q");
+    queue.push("tail");
+    std::string batch[8];
+    assert(queue.try_pop_n(batch, 0) == 0 && queue.size() == 4);
+    assert(queue.try_pop_n(batch, 2) == 2 && batch[1] == "qqq");
+    assert(queue.pop_n(batch, 8) == 2 && batch[0] == "qqqq");
+    assert(batch[1] == "tail" && queue.try_pop_n(batch, 8) == 0);
+  }
+}
+
+namespace {
+
+const unsigned long g_per_producer = 50000;
+const int g_producers = 3;
+const int g_consumers = 3;
+
+struct mpmc_test_shared {
+  ft::mpmc_queue< unsigned long >* queue;
+  ft::atomic< unsigned long > consumed;
+  ft::atomic< unsigned long > sum;
+};
+
+struct mpmc_test_producer_args {
+  mpmc_test_shared* shared;
+  unsigned long id;
+};
+
+void* mpmc_test_producer(void* arg) {
+  mpmc_test_producer_args* args = static_cast< mpmc_test_producer_args* >(arg);
+  for (unsigned long i = 0; i < g_per_producer; ++i) {
+    args->shared->queue->push(args->id * g_per_producer + i);
+  }
+  return NULL;
+}
+
+void* mpmc_test_consumer(void* arg) {
+  mpmc_test_shared* shared = static_cast< mpmc_test_shared* >(arg);
+  const unsigned long total = g_per_producer * g_producers;
+  unsigned long last[g_producers];
+  for (int i = 0; i < g_producers; ++i) last[i] = 0;
+  unsigned long batch[4];
+  unsigned long sum = 0;
+  ft::backoff wait;
+  while (shared->consumed.load() < total) {
+    std::size_t n = shared->queue->try_pop_n(batch, 4);
+    if (n == 0) {
+      wait.pause();
+      continue;
+    }
+    wait.reset();
+    for (std::size_t i = 0; i < n; ++i) {
+      unsigned long producer = batch[i] / g_per_producer;
+      unsigned long seq = batch[i] % g_per_producer + 1;
+      // items of one producer reach any single consumer in order
+      assert(seq > last[producer]);
+      last[producer] = seq;
+      sum += batch[i];
+    }
+    shared->consumed.fetch_add(n);
+  }
+  shared->sum.fetch_add(sum);
+  return NULL;
+}
+
+}  // namespace
+
+void test_mpmc_queue_threads(void) {
+  std::cout << "\t producers / consumers" << std::endl;
+
+  ft::mpmc_queue< unsigned long > queue(128);
+  mpmc_test_shared shared;
+  shared.queue = &queue;
+
+  pthread_t producers[g_producers];
+  pthread_t consumers[g_consumers];
+  mpmc_test_producer_args args[g_producers];
+  for (int i = 0; i < g_consumers; ++i) {
+    pthread_create(&consumers[i], NULL, mpmc_test_consumer, &shared);
+  }
+  for (int i = 0; i < g_producers; ++i) {
+    args[i].shared = &shared;
+    args[i].id = i;
+    pthread_create(&producers[i], NULL, mpmc_test_producer, &args[i]);
+  }
+  for (int i = 0; i < g_producers; ++i) pthread_join(producers[i], NULL);
+  for (int i = 0; i < g_consumers; ++i) pthread_join(consumers[i], NULL);
+
+  unsigned long total = g_per_producer * g_producers;
+  assert(shared.consumed.load() == total);
+  assert(shared.sum.load() == total * (total - 1) / 2);
+  assert(queue.empty());
+}
+
+void test_mpmc_queue(void) {
+  std::cout << "Test: mpmc_queue" << std::endl;
+  test_mpmc_queue_single();
+  test_mpmc_queue_threads();
+}
@@ -0,0 +1,88 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/07
+ * @file src/order_statistic_map.bench.cpp
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <map>
+
+#include "bench.hpp"
+#include "order_statistic_map.hpp"
+#include "vector.hpp"
+
+void bench_order_statistic_map(void) {
+  std::cout << "Bench: order_statistic_map" << std::endl;
+
+  const std::size_t n = 1 << 18;
+  const std::size_t queries = 1 << 20;
+  /* the linear std::map baselines only get a few dozen queries */
+  const std::size_t slow_queries = 32;
+
+  ft::vector< unsigned int > keys;
+  keys.reserve(n);
+  std::srand(42);
+  for (std::size_t i = 0; i < n; ++i) {
+    keys.push_back(static_cast< unsigned int >(std::rand()));
+  }
+
+  double start = bench_now();
+  ft::order_statistic_map< unsigned int, unsigned int > ranked;
+  for (std::size_t i = 0; i < n; ++i) ranked[keys[i]] = i;
+  bench_report("order_statistic_map insert", bench_now() - start, n);
+
+  start = bench_now();
+  std::map< unsigned int, unsigned int > tree;
+  for (std::size_t i = 0; i < n; ++i) tree[keys[i]] = i;
+  bench_report("std::map insert", bench_now() - start, n);
+
+  std::size_t sum = 0;
+  start = bench_now();
+  for (std::size_t i = 0; i < queries; ++i) {
+    sum += ranked.find(keys[i % n])->second;
+  }
+  bench_report("order_statistic_map find", bench_now() - start, queries);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < queries; ++i) {
+    sum += tree.find(keys[i % n])->second;
+  }
+  bench_report("std::map find", bench_now() - start, queries);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < queries; ++i) sum += ranked.rank(keys[i % n]);
+  bench_report("order_statistic_map rank", bench_now() - start, queries);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < slow_queries; ++i) {
+    sum += std::distance(tree.begin(), tree.find(keys[i]));
+  }
+  bench_report("std::map rank (distance)", bench_now() - start,
+               slow_queries);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < queries; ++i) {
+    sum += ranked.select(keys[i % n] % ranked.size())->second;
+  }
+  bench_report("order_statistic_map select", bench_now() - start, queries);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < slow_queries; ++i) {
+    std::map< unsigned int, unsigned int >::const_iterator it = tree.begin();
+    std::advance(it, keys[i] % tree.size());
+    sum += it->second;
+  }
+  bench_report("std::map select (advance)", bench_now() - start,
+               slow_queries);
+
+  bench_sink(sum);
+}
@@ -0,0 +1,888 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/07
+ * @file src/order_statistic_map.hpp
+ */
+
+#if !defined(FT__ORDER_STATISTIC_MAP_HPP)
+#define FT__ORDER_STATISTIC_MAP_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+#include "algorithm.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+#include "utility.hpp"
+
+namespace ft {
+
+/**
+ * @brief Link part of an order statistic tree node. The root has no parent;
+ * the tree header keeps the root in parent and the first and last nodes in
+ * left and right.
+ */
+struct ost_node_base {
+  ost_node_base* parent;
+  ost_node_base* left;
+  ost_node_base* right;
+  /* number of nodes in the subtree rooted here */
+  std::size_t size;
+  /* AVL height, 1 for a leaf */
+  int height;
+};
+
+template < class V >
+struct ost_node : public ost_node_base {
+  V value;
+};
+
+inline std::size_t ost_size(const ost_node_base* node) {
+  return node ? node->size : 0;
+}
+
+inline int ost_height(const ost_node_base* node) {
+  return node ? node->height : 0;
+}
+
+inline ost_node_base* ost_minimum(ost_node_base* node) {
+  while (node->left) node = node->left;
+  return node;
+}
+
+inline ost_node_base* ost_maximum(ost_node_base* node) {
+  while (node->right) node = node->right;
+  return node;
+}
+
+/**
+ * @brief In-order successor, header after the last node.
+ */
+inline ost_node_base* ost_next(ost_node_base* node, ost_node_base* header) {
+  if (node->right) return ost_minimum(node->right);
+  ost_node_base* parent = node->parent;
+  while (parent && node == parent->right) {
+    node = parent;
+    parent = parent->parent;
+  }
+  return parent ? parent : header;
+}
+
+/**
+ * @brief In-order predecessor, the last node before header.
+ */
+inline ost_node_base* ost_prev(ost_node_base* node, ost_node_base* header) {
+  if (node == header) return header->right;
+  if (node->left) return ost_maximum(node->left);
+  ost_node_base* parent = node->parent;
+  while (parent && node == parent->left) {
+    node = parent;
+    parent = parent->parent;
+  }
+  return parent ? parent : header;
+}
+
+/**
+ * @brief Position of node in key order, size of the tree for header. Walks
+ * up to the root adding the left subtrees passed on the way: O(log n).
+ */
+inline std::size_t ost_rank(const ost_node_base* node,
+                            const ost_node_base* header) {
+  if (node == header) return ost_size(header->parent);
+  std::size_t rank = ost_size(node->left);
+  for (; node->parent; node = node->parent) {
+    if (node == node->parent->right) rank += ost_size(node->parent->left) + 1;
+  }
+  return rank;
+}
+
+/**
+ * @brief Node at position i in key order, header when i is out of range.
+ * Walks down from the root steering by subtree sizes: O(log n).
+ */
+inline ost_node_base* ost_select(ost_node_base* header, std::size_t i) {
+  ost_node_base* node = header->parent;
+  while (node) {
+    std::size_t left = ost_size(node->left);
+    if (i < left) {
+      node = node->left;
+    } else if (i == left) {
+      return node;
+    } else {
+      i -= left + 1;
+      node = node->right;
+    }
+  }
+  return header;
+}
+
+/**
+ * @brief Iterator over an order statistic tree. Every jump goes through
+ * ost_rank and ost_select, so `+ n`, `- n`, `[]` and the difference of two
+ * iterators cost O(log n) instead of O(n); the iterator is tagged random
+ * access so ft::advance and ft::distance pick those operators.
+ *
+ * @tparam T value type (const qualified for const_iterator)
+ */
+template < class T >
+class ost_iterator : public ft::iterator< ft::random_access_iterator_tag, T > {
+ public:
+  /* Preserves Iterator's category */
+  typedef ft::random_access_iterator_tag iterator_category;
+  /* Preserves Iterator's value type */
+  typedef typename ft::remove_const< T >::type value_type;
+  /* Preserves Iterator's difference type */
+  typedef std::ptrdiff_t difference_type;
+  /* Preserves Iterator's pointer */
+  typedef T* pointer;
+  /* Preserves Iterator's reference */
+  typedef T& reference;
+
+ protected:
+  ost_node_base* _node;
+  ost_node_base* _header;
+
+ public:
+  /**
+   * @brief default constructor
+   */
+  ost_iterator() : _node(ft::u_nullptr), _header(ft::u_nullptr){};
+
+  /**
+   * @brief initalization constructor
+   */
+  ost_iterator(ost_node_base* node, ost_node_base* header)
+      : _node(node), _header(header){};
+
+  /**
+   * @brief copy Construct
+   */
+  ost_iterator(const ost_iterator& other)
+      : _node(other._node), _header(other._header){};
+
+  /**
+   * @brief ost_iterator< const T > casting operator
+   */
+  operator ost_iterator< const T >() const {
+    return ost_iterator< const T >(this->_node, this->_header);
+  }
+
+  ost_iterator& operator=(const ost_iterator& other) {
+    this->_node = other._node;
+    this->_header = other._header;
+    return *this;
+  };
+
+  reference operator*() const {
+    return static_cast< ost_node< value_type >* >(this->_node)->value;
+  };
+
+  pointer operator->() const { return &(operator*()); };
+
+  ost_iterator& operator++() {
+    this->_node = ost_next(this->_node, this->_header);
+    return *this;
+  };
+
+  ost_iterator operator++(int) {
+    ost_iterator tmp = *this;
+    ++(*this);
+    return tmp;
+  };
+
+  ost_iterator& operator--() {
+    this->_node = ost_prev(this->_node, this->_header);
+    return *this;
+  };
+
+  ost_iterator operator--(int) {
+    ost_iterator tmp = *this;
+    --(*this);
+    return tmp;
+  };
+
+  ost_iterator& operator+=(difference_type n) {
+    std::size_t rank = ost_rank(this->_node, this->_header);
+    this->_node = ost_select(this->_header, rank + n);
+    return *this;
+  };
+
+  ost_iterator& operator-=(difference_type n) { return *this += -n; };
+
+  ost_iterator operator+(difference_type n) const {
+    ost_iterator tmp = *this;
+    return tmp += n;
+  };
+
+  ost_iterator operator-(difference_type n) const {
+    ost_iterator tmp = *this;
+    return tmp -= n;
+  };
+
+  reference operator[](difference_type n) const { return *(*this + n); };
+
+  ost_node_base* const& node() const { return this->_node; }
+
+  ost_node_base* const& header() const { return this->_header; }
+};
+
+template < class T1, class T2 >
+bool operator==(const ost_iterator< T1 >& lhs, const ost_iterator< T2 >& rhs) {
+  return lhs.node() == rhs.node();
+};
+
+template < class T1, class T2 >
+bool operator!=(const ost_iterator< T1 >& lhs, const ost_iterator< T2 >& rhs) {
+  return lhs.node() != rhs.node();
+};
+
+template < class T1, class T2 >
+bool operator<(const ost_iterator< T1 >& lhs, const ost_iterator< T2 >& rhs) {
+  return ost_rank(lhs.node(), lhs.header()) <
+         ost_rank(rhs.node(), rhs.header());
+};
+
+template < class T1, class T2 >
+bool operator>(const ost_iterator< T1 >& lhs, const ost_iterator< T2 >& rhs) {
+  return rhs < lhs;
+};
+
+template < class T1, class T2 >
+bool operator<=(const ost_iterator< T1 >& lhs, const ost_iterator< T2 >& rhs) {
+  return !(rhs < lhs);
+};
+
+template < class T1, class T2 >
+bool operator>=(const ost_iterator< T1 >& lhs, const ost_iterator< T2 >& rhs) {
+  return !(lhs < rhs);
+};
+
+template < class T1, class T2 >
+typename ost_iterator< T1 >::difference_type operator-(
+    const ost_iterator< T1 >& lhs, const ost_iterator< T2 >& rhs) {
+  return static_cast< typename ost_iterator< T1 >::difference_type >(
+             ost_rank(lhs.node(), lhs.header())) -
+         static_cast< typename ost_iterator< T1 >::difference_type >(
+             ost_rank(rhs.node(), rhs.header()));
+};
+
+template < class T >
+ost_iterator< T > operator+(typename ost_iterator< T >::difference_type n,
+                            const ost_iterator< T >& it) {
+  return it + n;
+};
+
+/**
+ * @brief An ordered associative container of unique keys that also answers
+ * positional queries: rank(k) counts the keys less than k and select(i)
+ * returns the i-th element, both in O(log n).
+ *
+ * The tree is an AVL tree whose nodes also count the size of their subtree;
+ * rotations and the walk back to the root after insert or erase keep the
+ * counts exact. Erase relinks nodes instead of moving values, so only
+ * iterators to the erased element are invalidated.
+ *
+ * @tparam Key Type of the keys.
+ * @tparam T Type of the mapped value.
+ * @tparam Compare strict weak ordering on keys, defaults to `less<Key>`.
+ * @tparam _Alloc allocator, rebound for the node type.
+ */
+template < class Key, class T, class Compare = std::less< Key >,
+           class _Alloc = std::allocator< ft::pair< const Key, T > > >
+class order_statistic_map {
+ public:
+  /* The first template parameter (Key) */
+  typedef Key key_type;
+  /* The second template parameter (T) */
+  typedef T mapped_type;
+  /* pair< const key_type, mapped_type > */
+  typedef ft::pair< const Key, T > value_type;
+  /* The third template parameter (Compare) */
+  typedef Compare key_compare;
+  /* The fourth template parameter (_Alloc) */
+  typedef _Alloc allocator_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+  /* a random access iterator to value_type, O(log n) jumps */
+  typedef ft::ost_iterator< value_type > iterator;
+  /* a random access iterator to const value_type, O(log n) jumps */
+  typedef ft::ost_iterator< const value_type > const_iterator;
+  /* reverse_iterator<iterator> */
+  typedef ft::reverse_iterator< iterator > reverse_iterator;
+  /* reverse_iterator<const_iterator> */
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+  /* an unsigned integral type */
+  typedef std::size_t size_type;
+  /* a signed integral type */
+  typedef std::ptrdiff_t difference_type;
+
+  /**
+   * @brief Function object that compares two elements by their keys.
+   */
+  class value_compare {
+    friend class order_statistic_map;
+
+   protected:
+    Compare comp;
+    value_compare(Compare c) : comp(c){};
+
+   public:
+    typedef bool result_type;
+    typedef value_type first_argument_type;
+    typedef value_type second_argument_type;
+    bool operator()(const value_type& x, const value_type& y) const {
+      return comp(x.first, y.first);
+    };
+  };
+
+ private:
+  typedef ost_node_base _base;
+  typedef ost_node< value_type > _node;
+  typedef typename _Alloc::template rebind< _node >::other _node_allocator;
+  typedef typename _Alloc::template rebind< _base >::other _base_allocator;
+
+  key_compare _comp;
+  allocator_type _alloc;
+  _node_allocator _node_alloc;
+  _base_allocator _base_alloc;
+  /* heap allocated so iterators stay valid across swap */
+  _base* _header;
+
+ public:
+  /**
+   * @brief empty container constructor (default constructor)
+   */
+  explicit order_statistic_map(const key_compare& comp = key_compare(),
+                               const allocator_type& alloc = allocator_type())
+      : _comp(comp), _alloc(alloc), _node_alloc(alloc), _base_alloc(alloc) {
+    this->_init();
+  };
+
+  /**
+   * @brief range constructor
+   */
+  template < class InputIterator >
+  order_statistic_map(
+      InputIterator first, InputIterator last,
+      const key_compare& comp = key_compare(),
+      const allocator_type& alloc = allocator_type(),
+      typename ft::enable_if<
+          !ft::is_integral< InputIterator >::value >::type* = u_nullptr)
+      : _comp(comp), _alloc(alloc), _node_alloc(alloc), _base_alloc(alloc) {
+    this->_init();
+    this->insert(first, last);
+  };
+
+  /**
+   * @brief copy constructor
+   * Copies the tree shape as is, sizes and heights included.
+   */
+  order_statistic_map(const order_statistic_map& x)
+      : _comp(x._comp),
+        _alloc(x._alloc),
+        _node_alloc(x._node_alloc),
+        _base_alloc(x._base_alloc) {
+    this->_init();
+    this->_adopt(this->_clone(x._header->parent, ft::u_nullptr));
+  };
+
+  order_statistic_map& operator=(const order_statistic_map& x) {
+    if (this != &x) {
+      order_statistic_map tmp(x);
+      this->swap(tmp);
+    }
+    return *this;
+  };
+
+  ~order_statistic_map() {
+    this->_destroy(this->_header->parent);
+    this->_base_alloc.deallocate(this->_header, 1);
+  };
+
+  iterator begin() { return iterator(this->_header->left, this->_header); };
+  const_iterator begin() const {
+    return const_iterator(this->_header->left, this->_header);
+  };
+  iterator end() { return iterator(this->_header, this->_header); };
+  const_iterator end() const {
+    return const_iterator(this->_header, this->_header);
+  };
+  reverse_iterator rbegin() { return reverse_iterator(this->end()); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(this->end());
+  };
+  reverse_iterator rend() { return reverse_iterator(this->begin()); };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(this->begin());
+  };
+
+  bool empty() const { return this->_header->parent == ft::u_nullptr; };
+  size_type size() const { return ost_size(this->_header->parent); };
+  size_type max_size() const { return this->_node_alloc.max_size(); };
+
+  /**
+   * @brief Access element, inserting a value-initialized one if k is absent.
+   */
+  mapped_type& operator[](const key_type& k) {
+    return this->_insert_unique(value_type(k, mapped_type())).first->second;
+  };
+
+  mapped_type& at(const key_type& k) {
+    iterator it = this->find(k);
+    if (it == this->end()) throw std::out_of_range("ft::order_statistic_map");
+    return it->second;
+  };
+
+  const mapped_type& at(const key_type& k) const {
+    const_iterator it = this->find(k);
+    if (it == this->end()) throw std::out_of_range("ft::order_statistic_map");
+    return it->second;
+  };
+
+  /**
+   * @brief Insert element
+   */
+  ft::pair< iterator, bool > insert(const value_type& val) {
+    return this->_insert_unique(val);
+  };
+
+  /**
+   * @brief Insert element with hint. The hint is not used: the walk back to
+   * the root that fixes the subtree sizes costs O(log n) anyway.
+   */
+  iterator insert(iterator position, const value_type& val) {
+    (void)position;
+    return this->_insert_unique(val).first;
+  };
+
+  /**
+   * @brief range Insert elements
+   */
+  template < class InputIterator >
+  void insert(
+      InputIterator first, InputIterator last,
+      typename ft::enable_if<
+          !ft::is_integral< InputIterator >::value >::type* = u_nullptr) {
+    for (; first != last; ++first) this->_insert_unique(*first);
+  };
+
+  /**
+   * @brief Erase element at position
+   */
+  void erase(iterator position) { this->_erase_node(position.node()); };
+
+  /**
+   * @brief Erase element by key
+   *
+   * @return the number of elements erased (0 or 1)
+   */
+  size_type erase(const key_type& k) {
+    iterator it = this->find(k);
+    if (it == this->end()) return 0;
+    this->_erase_node(it.node());
+    return 1;
+  };
+
+  /**
+   * @brief range Erase elements
+   */
+  void erase(iterator first, iterator last) {
+    if (first == this->begin() && last == this->end()) {
+      this->clear();
+      return;
+    }
+    while (first != last) this->erase(first++);
+  };
+
+  void swap(order_statistic_map& x) {
+    ft::swap(this->_comp, x._comp);
+    ft::swap(this->_header, x._header);
+  };
+
+  void clear() {
+    this->_destroy(this->_header->parent);
+    this->_adopt(ft::u_nullptr);
+  };
+
+  key_compare key_comp() const { return this->_comp; };
+
+  value_compare value_comp() const { return value_compare(this->_comp); };
+
+  iterator find(const key_type& k) {
+    _base* node = this->_lower(k);
+    if (node == this->_header || this->_comp(k, _key(node))) {
+      return this->end();
+    }
+    return iterator(node, this->_header);
+  };
+
+  const_iterator find(const key_type& k) const {
+    _base* node = this->_lower(k);
+    if (node == this->_header || this->_comp(k, _key(node))) {
+      return this->end();
+    }
+    return const_iterator(node, this->_header);
+  };
+
+  size_type count(const key_type& k) const {
+    return this->find(k) != this->end();
+  };
+
+  iterator lower_bound(const key_type& k) {
+    return iterator(this->_lower(k), this->_header);
+  };
+
+  const_iterator lower_bound(const key_type& k) const {
+    return const_iterator(this->_lower(k), this->_header);
+  };
+
+  iterator upper_bound(const key_type& k) {
+    return iterator(this->_upper(k), this->_header);
+  };
+
+  const_iterator upper_bound(const key_type& k) const {
+    return const_iterator(this->_upper(k), this->_header);
+  };
+
+  ft::pair< iterator, iterator > equal_range(const key_type& k) {
+    return ft::make_pair(this->lower_bound(k), this->upper_bound(k));
+  };
+
+  ft::pair< const_iterator, const_iterator > equal_range(
+      const key_type& k) const {
+    return ft::make_pair(this->lower_bound(k), this->upper_bound(k));
+  };
+
+  /**
+   * @brief Number of keys less than k, whether or not k is present: the
+   * position k has or would have in key order.
+   */
+  size_type rank(const key_type& k) const {
+    size_type rank = 0;
+    _base* node = this->_header->parent;
+    while (node) {
+      if (this->_comp(_key(node), k)) {
+        rank += ost_size(node->left) + 1;
+        node = node->right;
+      } else {
+        node = node->left;
+      }
+    }
+    return rank;
+  };
+
+  /**
+   * @brief The element at position i in key order, end() if i >= size().
+   */
+  iterator select(size_type i) {
+    return iterator(ost_select(this->_header, i), this->_header);
+  };
+
+  const_iterator select(size_type i) const {
+    return const_iterator(ost_select(this->_header, i), this->_header);
+  };
+
+  allocator_type get_allocator() const { return this->_alloc; };
+
+ private:
+  static const key_type& _key(const _base* node) {
+    return static_cast< const _node* >(node)->value.first;
+  };
+
+  void _init() {
+    this->_header = this->_base_alloc.allocate(1);
+    this->_adopt(ft::u_nullptr);
+  };
+
+  /**
+   * @brief Install root as the whole tree and refresh the header links.
+   */
+  void _adopt(_base* root) {
+    this->_header->parent = root;
+    this->_header->size = 0;
+    this->_header->height = 0;
+    if (root) {
+      root->parent = ft::u_nullptr;
+      this->_header->left = ost_minimum(root);
+      this->_header->right = ost_maximum(root);
+    } else {
+      this->_header->left = this->_header;
+      this->_header->right = this->_header;
+    }
+  };
+
+  _base* _new_node(const value_type& val, _base* parent) {
+    _node* node = this->_node_alloc.allocate(1);
+    try {
+      this->_alloc.construct(&node->value, val);
+    } catch (...) {
+      this->_node_alloc.deallocate(node, 1);
+      throw;
+    }
+    node->parent = parent;
+    node->left = ft::u_nullptr;
+    node->right = ft::u_nullptr;
+    node->size = 1;
+    node->height = 1;
+    return node;
+  };
+
+  void _free_node(_base* node) {
+    _node* n = static_cast< _node* >(node);
+    this->_alloc.destroy(&n->value);
+    this->_node_alloc.deallocate(n, 1);
+  };
+
+  void _destroy(_base* node) {
+    while (node) {
+      this->_destroy(node->right);
+      _base* left = node->left;
+      this->_free_node(node);
+      node = left;
+    }
+  };
+
+  _base* _clone(const _base* src, _base* parent) {
+    if (!src) return ft::u_nullptr;
+    _base* node =
+        this->_new_node(static_cast< const _node* >(src)->value, parent);
+    node->size = src->size;
+    node->height = src->height;
+    node->left = this->_clone(src->left, node);
+    node->right = this->_clone(src->right, node);
+    return node;
+  };
+
+  _base* _lower(const key_type& k) const {
+    _base* result = this->_header;
+    _base* node = this->_header->parent;
+    while (node) {
+      if (!this->_comp(_key(node), k)) {
+        result = node;
+        node = node->left;
+      } else {
+        node = node->right;
+      }
+    }
+    return result;
+  };
+
+  _base* _upper(const key_type& k) const {
+    _base* result = this->_header;
+    _base* node = this->_header->parent;
+    while (node) {
+      if (this->_comp(k, _key(node))) {
+        result = node;
+        node = node->left;
+      } else {
+        node = node->right;
+      }
+    }
+    return result;
+  };
+
+  ft::pair< iterator, bool > _insert_unique(const value_type& val) {
+    _base* parent = ft::u_nullptr;
+    _base* node = this->_header->parent;
+    bool left = true;
+    while (node) {
+      parent = node;
+      if (this->_comp(val.first, _key(node))) {
+        left = true;
+        node = node->left;
+      } else if (this->_comp(_key(node), val.first)) {
+        left = false;
+        node = node->right;
+      } else {
+        return ft::make_pair(iterator(node, this->_header), false);
+      }
+    }
+
+    node = this->_new_node(val, parent);
+    if (!parent) {
+      this->_adopt(node);
+      return ft::make_pair(iterator(node, this->_header), true);
+    }
+    if (left) {
+      parent->left = node;
+      if (parent == this->_header->left) this->_header->left = node;
+    } else {
+      parent->right = node;
+      if (parent == this->_header->right) this->_header->right = node;
+    }
+    this->_fixup(parent);
+    return ft::make_pair(iterator(node, this->_header), true);
+  };
+
+  /**
+   * @brief Unlink node, splicing its successor in its place when it has two
+   * children, then rebalance from the lowest node whose subtree changed.
+   */
+  void _erase_node(_base* node) {
+    if (node == this->_header->left) {
+      this->_header->left = ost_next(node, this->_header);
+    }
+    if (node == this->_header->right) {
+      this->_header->right = ost_prev(node, this->_header);
+    }
+
+    _base* fix;
+    if (!node->left || !node->right) {
+      _base* child = node->left ? node->left : node->right;
+      fix = node->parent;
+      if (child) child->parent = node->parent;
+      this->_replace_child(node->parent, node, child);
+    } else {
+      _base* next = ost_minimum(node->right);
+      if (next->parent == node) {
+        fix = next;
+      } else {
+        fix = next->parent;
+        fix->left = next->right;
+        if (next->right) next->right->parent = fix;
+        next->right = node->right;
+        node->right->parent = next;
+      }
+      next->left = node->left;
+      node->left->parent = next;
+      next->parent = node->parent;
+      this->_replace_child(node->parent, node, next);
+    }
+    this->_fixup(fix);
+    this->_free_node(node);
+  };
+
+  void _replace_child(_base* parent, _base* old_child, _base* new_child) {
+    if (!parent) {
+      this->_header->parent = new_child;
+    } else if (parent->left == old_child) {
+      parent->left = new_child;
+    } else {
+      parent->right = new_child;
+    }
+  };
+
+  static void _update(_base* node) {
+    int lh = ost_height(node->left);
+    int rh = ost_height(node->right);
+    node->size = ost_size(node->left) + ost_size(node->right) + 1;
+    node->height = (lh > rh ? lh : rh) + 1;
+  };
+
+  _base* _rotate_left(_base* node) {
+    _base* up = node->right;
+    node->right = up->left;
+    if (up->left) up->left->parent = node;
+    up->parent = node->parent;
+    this->_replace_child(node->parent, node, up);
+    up->left = node;
+    node->parent = up;
+    _update(node);
+    _update(up);
+    return up;
+  };
+
+  _base* _rotate_right(_base* node) {
+    _base* up = node->left;
+    node->left = up->right;
+    if (up->right) up->right->parent = node;
+    up->parent = node->parent;
+    this->_replace_child(node->parent, node, up);
+    up->right = node;
+    node->parent = up;
+    _update(node);
+    _update(up);
+    return up;
+  };
+
+  /**
+   * @brief Restore the AVL balance of node, returning the subtree root.
+   */
+  _base* _rebalance(_base* node) {
+    int balance = ost_height(node->left) - ost_height(node->right);
+    if (balance > 1) {
+      if (ost_height(node->left->left) < ost_height(node->left->right)) {
+        this->_rotate_left(node->left);
+      }
+      return this->_rotate_right(node);
+    }
+    if (balance < -1) {
+      if (ost_height(node->right->right) < ost_height(node->right->left)) {
+        this->_rotate_right(node->right);
+      }
+      return this->_rotate_left(node);
+    }
+    return node;
+  };
+
+  /**
+   * @brief Refresh sizes and heights from node up to the root. Sizes change
+   * on every ancestor, so the walk always reaches the root.
+   */
+  void _fixup(_base* node) {
+    while (node) {
+      _update(node);
+      node = this->_rebalance(node)->parent;
+    }
+  };
+};
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator==(const order_statistic_map< Key, T, Compare, Alloc >& lhs,
+                const order_statistic_map< Key, T, Compare, Alloc >& rhs) {
+  return lhs.size() == rhs.size() &&
+         ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+};
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator!=(const order_statistic_map< Key, T, Compare, Alloc >& lhs,
+                const order_statistic_map< Key, T, Compare, Alloc >& rhs) {
+  return !(lhs == rhs);
+};
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator<(const order_statistic_map< Key, T, Compare, Alloc >& lhs,
+               const order_statistic_map< Key, T, Compare, Alloc >& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+};
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator<=(const order_statistic_map< Key, T, Compare, Alloc >& lhs,
+                const order_statistic_map< Key, T, Compare, Alloc >& rhs) {
+  return !(rhs < lhs);
+};
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator>(const order_statistic_map< Key, T, Compare, Alloc >& lhs,
+               const order_statistic_map< Key, T, Compare, Alloc >& rhs) {
+  return rhs < lhs;
+};
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator>=(const order_statistic_map< Key, T, Compare, Alloc >& lhs,
+                const order_statistic_map< Key, T, Compare, Alloc >& rhs) {
+  return !(lhs < rhs);
+};
+
+template < class Key, class T, class Compare, class Alloc >
+void swap(order_statistic_map< Key, T, Compare, Alloc >& x,
+          order_statistic_map< Key, T, Compare, Alloc >& y) {
+  x.swap(y);
+};
+
+}  // namespace ft
+
+#endif  // FT__ORDER_STATISTIC_MAP_HPP
@@ -0,0 +1,156 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/07
+ * @file src/order_statistic_map.test.cpp
+ */
+
+#include "order_statistic_map.hpp"
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <map>
+
+typedef ft::order_statistic_map< int, int > ft_os_map;
+typedef std::map< int, int > std_os_map;
+
+static bool same_content(const ft_os_map& ft_m, const std_os_map& std_m) {
+  if (ft_m.size() != std_m.size()) return false;
+  ft_os_map::const_iterator ft_it = ft_m.begin();
+  std_os_map::const_iterator std_it = std_m.begin();
+  for (; std_it != std_m.end(); ++ft_it, ++std_it) {
+    if (ft_it->first != std_it->first || ft_it->second != std_it->second)
+      return false;
+  }
+  if (ft_it != ft_m.end()) return false;
+
+  ft_os_map::const_reverse_iterator ft_rit = ft_m.rbegin();
+  std_os_map::const_reverse_iterator std_rit = std_m.rbegin();
+  for (; std_rit != std_m.rend(); ++ft_rit, ++std_rit) {
+    if (ft_rit->first != std_rit->first) return false;
+  }
+  return ft_rit == ft_m.rend();
+}
+
+void test_order_statistic_map_modifiers(void) {
+  std::cout << "\t modifiers" << std::endl;
+
+  ft_os_map ft_m;
+  std_os_map std_m;
+
+  std::srand(3);
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 3000; ++i) {
+      int k = std::rand() % 1000;
+      ft_m[k] = i;
+      std_m[k] = i;
+    }
+    assert(same_content(ft_m, std_m));
+    for (int i = 0; i < 3000; ++i) {
+      int k = std::rand() % 1000;
+      assert(ft_m.erase(k) == std_m.erase(k));
+    }
+    assert(same_content(ft_m, std_m));
+  }
+
+  // erasing one element leaves iterators to the others valid
+  ft_os_map::iterator kept = ft_m.begin();
+  std_os_map::iterator std_kept = std_m.begin();
+  ft_os_map::iterator it = ft_m.begin();
+  ++it;
+  while (it != ft_m.end()) {
+    std_m.erase(it->first);
+    ft_m.erase(it++);
+    if (it != ft_m.end()) ++it;
+  }
+  assert(kept->first == std_kept->first && same_content(ft_m, std_m));
+
+  ft_m.erase(ft_m.begin() + 2, ft_m.end() - 2);
+  std_os_map::iterator std_first = std_m.begin();
+  std::advance(std_first, 2);
+  std_os_map::iterator std_last = std_m.end();
+  std::advance(std_last, -2);
+  std_m.erase(std_first, std_last);
+  assert(ft_m.size() == 4 && same_content(ft_m, std_m));
+
+  ft_os_map ft_copy(ft_m);
+  assert(ft_copy == ft_m);
+  ft_os_map ft_other;
+  ft_other[1] = 1;
+  ft_os_map::iterator other_begin = ft_other.begin();
+  ft_copy.swap(ft_other);
+  assert(other_begin == ft_copy.begin() && ++other_begin == ft_copy.end());
+  assert(ft_other == ft_m);
+  ft_copy = ft_m;
+  assert(ft_copy == ft_m && !(ft_copy < ft_m));
+
+  ft_m.erase(ft_m.begin(), ft_m.end());
+  assert(ft_m.empty() && ft_m.begin() == ft_m.end());
+  ft_copy.clear();
+  assert(ft_copy.empty() && ft_copy.rank(5) == 0);
+}
+
+void test_order_statistic_map_rank(void) {
+  std::cout << "\t rank / select" << std::endl;
+
+  ft_os_map ft_m;
+  std_os_map std_m;
+  std::srand(5);
+  for (int i = 0; i < 2000; ++i) {
+    int k = std::rand() % 5000;
+    ft_m.insert(ft::make_pair(k, i));
+    std_m.insert(std::make_pair(k, i));
+  }
+
+  for (int k = -1; k < 5001; k += 7) {
+    std::size_t expected = static_cast< std::size_t >(
+        std::distance(std_m.begin(), std_m.lower_bound(k)));
+    assert(ft_m.rank(k) == expected);
+  }
+
+  std_os_map::const_iterator std_it = std_m.begin();
+  for (std::size_t i = 0; i < std_m.size(); ++i, ++std_it) {
+    assert(ft_m.select(i)->first == std_it->first);
+  }
+  assert(ft_m.select(ft_m.size()) == ft_m.end());
+
+  const ft_os_map& cref = ft_m;
+  ft_os_map::const_iterator first = cref.begin();
+  ft_os_map::const_iterator last = cref.end();
+  assert(last - first == static_cast< std::ptrdiff_t >(cref.size()));
+  assert(ft::distance(first, last) ==
+         static_cast< std::ptrdiff_t >(cref.size()));
+  for (std::size_t i = 0; i < cref.size(); i += 37) {
+    ft_os_map::const_iterator at = first + i;
+    assert(at == cref.select(i) && at - first == static_cast< long >(i));
+    assert(first[i].first == at->first);
+    assert((last - (cref.size() - i)) == at);
+    assert(first <= at && at < last);
+  }
+  ft_os_map::const_iterator moved = first;
+  ft::advance(moved, 100);
+  assert(moved == cref.select(100));
+  moved -= 40;
+  assert(moved == cref.select(60));
+
+  assert(cref.at(std_m.begin()->first) == std_m.begin()->second);
+  try {
+    cref.at(-1);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+}
+
+void test_order_statistic_map(void) {
+  std::cout << "Test: order_statistic_map" << std::endl;
+  test_order_statistic_map_modifiers();
+  test_order_statistic_map_rank();
+}
@@ -0,0 +1,111 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/15
+ * @file src/packed_int_vector.bench.cpp
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+#include "bench.hpp"
+#include "packed_int_vector.hpp"
+#include "vector.hpp"
+
+namespace {
+
+/* a posting list: sorted 64-bit ids with gaps of 1 to 64 */
+const std::size_t g_ids = 1 << 24;
+const std::size_t g_probes = 1 << 20;
+const int g_passes = 4;
+
+}  // namespace
+
+void bench_packed_int_vector(void) {
+  std::cout << "Bench: packed_int_vector" << std::endl;
+
+  ft::vector< unsigned long long > plain;
+  ft::packed_int_vector< unsigned long long > packed;
+  plain.reserve(g_ids);
+  unsigned long long id = 1ULL << 40;
+  std::srand(42);
+  for (std::size_t i = 0; i < g_ids; ++i) {
+    id += 1 + std::rand() % 64;
+    plain.push_back(id);
+  }
+  double start = bench_now();
+  for (std::size_t i = 0; i < g_ids; ++i) packed.push_back(plain[i]);
+  bench_report("packed_int_vector push_back", bench_now() - start, g_ids);
+  packed.shrink_to_fit();
+
+  std::size_t plain_bytes = plain.capacity() * sizeof(unsigned long long);
+  std::cout << "\t packed_int_vector bytes per value: "
+            << static_cast< double >(packed.memory_usage()) / g_ids
+            << " (ratio "
+            << static_cast< double >(plain_bytes) / packed.memory_usage()
+            << "x)" << std::endl;
+
+  std::size_t sum = 0;
+  ft::vector< unsigned long long > out(g_ids);
+  start = bench_now();
+  for (int pass = 0; pass < g_passes; ++pass) {
+    packed.decode(0, &out[0], g_ids);
+    sum += out[g_ids / 2];
+  }
+  double seconds = bench_now() - start;
+  bench_report("packed_int_vector decode", seconds, g_ids * g_passes);
+  std::cout << "\t packed_int_vector decode GB/s: "
+            << g_ids * g_passes * sizeof(unsigned long long) / seconds / 1e9
+            << std::endl;
+
+  start = bench_now();
+  for (int pass = 0; pass < g_passes; ++pass) {
+    for (std::size_t i = 0; i < g_ids; ++i) out[i] = plain[i];
+    sum += out[g_ids / 2];
+  }
+  seconds = bench_now() - start;
+  bench_report("ft::vector copy", seconds, g_ids * g_passes);
+  std::cout << "\t ft::vector copy GB/s: "
+            << g_ids * g_passes * sizeof(unsigned long long) / seconds / 1e9
+            << std::endl;
+
+  ft::vector< std::size_t > positions(g_probes);
+  ft::vector< unsigned long long > probes(g_probes);
+  for (std::size_t i = 0; i < g_probes; ++i) {
+    positions[i] = std::rand() % g_ids;
+    probes[i] = plain[positions[i]] - std::rand() % 2;
+  }
+
+  start = bench_now();
+  for (std::size_t i = 0; i < g_probes; ++i) sum += packed[positions[i]];
+  bench_report("packed_int_vector random access", bench_now() - start,
+               g_probes);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < g_probes; ++i) sum += plain[positions[i]];
+  bench_report("ft::vector random access", bench_now() - start, g_probes);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < g_probes; ++i) {
+    sum += packed.lower_bound(probes[i]);
+  }
+  bench_report("packed_int_vector lower_bound", bench_now() - start,
+               g_probes);
+
+  const unsigned long long* first = &plain[0];
+  const unsigned long long* last = first + g_ids;
+  start = bench_now();
+  for (std::size_t i = 0; i < g_probes; ++i) {
+    sum += std::lower_bound(first, last, probes[i]) - first;
+  }
+  bench_report("ft::vector std::lower_bound", bench_now() - start, g_probes);
+
+  bench_sink(sum);
+}
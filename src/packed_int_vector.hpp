@@ -0,0 +1,524 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/15
+ * @file src/packed_int_vector.hpp
+ */
+
+#if !defined(FT__PACKED_INT_VECTOR_HPP)
+#define FT__PACKED_INT_VECTOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+/* storage unit of the packed stream */
+typedef unsigned long long packed_word;
+
+/**
+ * @brief Header of one packed block: the frame of reference every value is
+ * stored relative to, the bit width of those deltas and the word the block
+ * starts at, so any block is reached without decoding the ones before it.
+ */
+template < class T >
+struct packed_int_block {
+  T base;
+  std::size_t offset;
+  unsigned int width;
+};
+
+/**
+ * @brief Decode one full block whose bit width is the compile time constant
+ * W. With the shifts and masks known, the compiler unrolls and vectorizes the
+ * loop, which a runtime width prevents.
+ */
+template < class T, unsigned int W, std::size_t N >
+struct packed_int_unpack {
+  static void run(const packed_word* in, T base, T* out) {
+    if (W == 0) {
+      for (std::size_t i = 0; i < N; ++i) out[i] = base;
+      return;
+    }
+    const packed_word mask = W ? ~packed_word(0) >> ((64 - W) & 63) : 0;
+    for (std::size_t i = 0; i < N; ++i) {
+      std::size_t bit = i * W;
+      std::size_t shift = bit % 64;
+      packed_word word = in[bit / 64] >> shift;
+      if (shift + W > 64) word |= in[bit / 64 + 1] << (64 - shift);
+      out[i] = base + static_cast< T >(word & mask);
+    }
+  };
+};
+
+/**
+ * @brief Fill a table with packed_int_unpack<T, w, N>::run for w in [0, W].
+ */
+template < class T, unsigned int W, std::size_t N >
+struct packed_int_unpack_table {
+  typedef void (*function)(const packed_word*, T, T*);
+
+  static void fill(function* table) {
+    table[W] = &packed_int_unpack< T, W, N >::run;
+    packed_int_unpack_table< T, W - 1, N >::fill(table);
+  };
+};
+
+template < class T, std::size_t N >
+struct packed_int_unpack_table< T, 0, N > {
+  typedef void (*function)(const packed_word*, T, T*);
+
+  static void fill(function* table) {
+    table[0] = &packed_int_unpack< T, 0, N >::run;
+  };
+};
+
+/**
+ * @brief The unpackers of every width a T can need, indexed by width.
+ */
+template < class T, std::size_t N >
+struct packed_int_unpackers {
+  static const unsigned int max_width = sizeof(T) * 8;
+
+  typename packed_int_unpack_table< T, max_width, N >::function
+      table[max_width + 1];
+
+  packed_int_unpackers() {
+    packed_int_unpack_table< T, max_width, N >::fill(this->table);
+  };
+};
+
+/**
+ * @brief Read only random access iterator over a packed_int_vector, yielding
+ * values.
+ */
+template < class Container >
+class packed_int_iterator
+    : public ft::iterator< ft::random_access_iterator_tag,
+                           typename Container::value_type, std::ptrdiff_t,
+                           void, typename Container::value_type > {
+ public:
+  typedef ft::random_access_iterator_tag iterator_category;
+  typedef typename Container::value_type value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef void pointer;
+  /* values are decoded, not referenced */
+  typedef value_type reference;
+
+ protected:
+  const Container* _container;
+  std::size_t _index;
+
+ public:
+  packed_int_iterator() : _container(ft::u_nullptr), _index(0){};
+
+  packed_int_iterator(const Container* container, std::size_t index)
+      : _container(container), _index(index){};
+
+  reference operator*() const { return (*this->_container)[this->_index]; };
+
+  packed_int_iterator& operator++() {
+    ++this->_index;
+    return *this;
+  };
+
+  packed_int_iterator operator++(int) {
+    packed_int_iterator tmp = *this;
+    ++this->_index;
+    return tmp;
+  };
+
+  packed_int_iterator& operator--() {
+    --this->_index;
+    return *this;
+  };
+
+  packed_int_iterator operator--(int) {
+    packed_int_iterator tmp = *this;
+    --this->_index;
+    return tmp;
+  };
+
+  packed_int_iterator operator+(difference_type n) const {
+    return packed_int_iterator(this->_container, this->_index + n);
+  };
+
+  packed_int_iterator& operator+=(difference_type n) {
+    this->_index += n;
+    return *this;
+  };
+
+  packed_int_iterator operator-(difference_type n) const {
+    return packed_int_iterator(this->_container, this->_index - n);
+  };
+
+  packed_int_iterator& operator-=(difference_type n) {
+    this->_index -= n;
+    return *this;
+  };
+
+  reference operator[](difference_type n) const {
+    return (*this->_container)[this->_index + n];
+  };
+
+  /**
+   * @brief get the element index, used for comparisons
+   */
+  std::size_t index() const { return this->_index; }
+};
+
+template < class C >
+bool operator==(const packed_int_iterator< C >& lhs,
+                const packed_int_iterator< C >& rhs) {
+  return lhs.index() == rhs.index();
+};
+
+template < class C >
+bool operator!=(const packed_int_iterator< C >& lhs,
+                const packed_int_iterator< C >& rhs) {
+  return lhs.index() != rhs.index();
+};
+
+template < class C >
+bool operator<(const packed_int_iterator< C >& lhs,
+               const packed_int_iterator< C >& rhs) {
+  return lhs.index() < rhs.index();
+};
+
+template < class C >
+bool operator<=(const packed_int_iterator< C >& lhs,
+                const packed_int_iterator< C >& rhs) {
+  return lhs.index() <= rhs.index();
+};
+
+template < class C >
+bool operator>(const packed_int_iterator< C >& lhs,
+               const packed_int_iterator< C >& rhs) {
+  return lhs.index() > rhs.index();
+};
+
+template < class C >
+bool operator>=(const packed_int_iterator< C >& lhs,
+                const packed_int_iterator< C >& rhs) {
+  return lhs.index() >= rhs.index();
+};
+
+template < class C >
+packed_int_iterator< C > operator+(
+    typename packed_int_iterator< C >::difference_type n,
+    const packed_int_iterator< C >& iter) {
+  return iter + n;
+};
+
+template < class C >
+typename packed_int_iterator< C >::difference_type operator-(
+    const packed_int_iterator< C >& lhs, const packed_int_iterator< C >& rhs) {
+  return static_cast< std::ptrdiff_t >(lhs.index()) -
+         static_cast< std::ptrdiff_t >(rhs.index());
+};
+
+/**
+ * @brief Append only sequence of unsigned integers compressed with frame of
+ * reference and bit packing, for sorted id lists and other values that sit
+ * close together.
+ *
+ * Values are grouped in blocks of 128. A full block keeps its minimum as the
+ * base and the differences to it in just as many bits as the largest one
+ * needs; a sorted list of ids with small gaps packs 4-8x. The block headers
+ * locate every block directly, so operator[] is constant time and
+ * lower_bound() binary searches the bases before the block. The last,
+ * incomplete block stays unpacked until it fills.
+ *
+ * Values are read by copy: there is no reference into the packed stream.
+ *
+ * @tparam _T Unsigned integral type of at most 64 bits.
+ * @tparam _Alloc Allocator of _T, rebound for the internal storage.
+ */
+template < class _T = unsigned long long, class _Alloc = std::allocator< _T > >
+class packed_int_vector {
+ public:
+  typedef _T value_type;
+  typedef _Alloc allocator_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  /* values are decoded on access */
+  typedef value_type const_reference;
+  typedef ft::packed_int_iterator< packed_int_vector > const_iterator;
+  typedef const_iterator iterator;
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+  typedef const_reverse_iterator reverse_iterator;
+
+  /* values per block */
+  static const size_type block_size = 128;
+
+ private:
+  typedef ft::packed_int_block< value_type > _block;
+  typedef ft::vector<
+      packed_word, typename _Alloc::template rebind< packed_word >::other >
+      _word_vector;
+  typedef ft::vector< _block,
+                      typename _Alloc::template rebind< _block >::other >
+      _block_vector;
+  typedef ft::vector< value_type, _Alloc > _value_vector;
+  _word_vector _data;
+  _block_vector _blocks;
+  /* values of the incomplete last block */
+  _value_vector _tail;
+
+ public:
+  explicit packed_int_vector(const allocator_type& alloc = allocator_type())
+      : _data(alloc), _blocks(alloc), _tail(alloc){};
+
+  template < class InputIterator >
+  packed_int_vector(InputIterator first, InputIterator last,
+                    const allocator_type& alloc = allocator_type(),
+                    typename ft::enable_if<
+                        !ft::is_integral< InputIterator >::value >::type* =
+                        u_nullptr)
+      : _data(alloc), _blocks(alloc), _tail(alloc) {
+    for (; first != last; ++first) this->push_back(*first);
+  };
+
+  const_iterator begin() const { return const_iterator(this, 0); };
+  const_iterator end() const { return const_iterator(this, this->size()); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(this->end());
+  };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(this->begin());
+  };
+
+  size_type size() const {
+    return this->_blocks.size() * block_size + this->_tail.size();
+  };
+
+  bool empty() const { return this->size() == 0; };
+
+  /**
+   * @brief Decode the value at n: one or two word reads and a shift.
+   */
+  value_type operator[](size_type n) const {
+    size_type b = n / block_size;
+    if (b == this->_blocks.size()) return this->_tail[n % block_size];
+    const _block& block = this->_blocks[b];
+    if (block.width == 0) return block.base;
+    size_type bit = (n % block_size) * block.width;
+    size_type shift = bit % 64;
+    const packed_word* in = &this->_data[block.offset + bit / 64];
+    packed_word word = in[0] >> shift;
+    if (shift + block.width > 64) word |= in[1] << (64 - shift);
+    return block.base +
+           static_cast< value_type >(word & _mask_of(block.width));
+  };
+
+  value_type at(size_type n) const {
+    if (n >= this->size()) throw std::out_of_range("ft::packed_int_vector");
+    return (*this)[n];
+  };
+
+  value_type front() const { return (*this)[0]; };
+  value_type back() const { return (*this)[this->size() - 1]; };
+
+  void push_back(value_type value) {
+    if (this->_tail.capacity() < block_size) this->_tail.reserve(block_size);
+    this->_tail.push_back(value);
+    if (this->_tail.size() == block_size) this->_pack_tail();
+  };
+
+  /**
+   * @brief Remove the last value, unpacking the last block if the tail is
+   * empty.
+   */
+  void pop_back() {
+    if (this->_tail.empty()) {
+      const _block& block = this->_blocks.back();
+      this->_tail.resize(block_size);
+      this->_unpack(block, &this->_tail[0]);
+      this->_data.resize(block.offset);
+      this->_blocks.pop_back();
+    }
+    this->_tail.pop_back();
+  };
+
+  /**
+   * @brief Decode n values starting at pos into out. Whole blocks go through
+   * the unpacker for their width.
+   *
+   * @return size_type number of values written, n clamped to the size
+   */
+  size_type decode(size_type pos, value_type* out, size_type n) const {
+    size_type size = this->size();
+    if (pos >= size) return 0;
+    if (n > size - pos) n = size - pos;
+    size_type done = 0;
+    while (done < n) {
+      size_type b = (pos + done) / block_size;
+      if ((pos + done) % block_size == 0 && n - done >= block_size &&
+          b < this->_blocks.size()) {
+        this->_unpack(this->_blocks[b], out + done);
+        done += block_size;
+      } else {
+        out[done] = (*this)[pos + done];
+        ++done;
+      }
+    }
+    return n;
+  };
+
+  /**
+   * @brief Index of the first value not less than value, or size(). The
+   * values must be sorted.
+   */
+  size_type lower_bound(value_type value) const {
+    // the first block starting at or above value; equal values may run
+    // back into the blocks before it
+    size_type lo = 0;
+    size_type hi = this->_blocks.size();
+    while (lo < hi) {
+      size_type mid = lo + (hi - lo) / 2;
+      if (this->_blocks[mid].base < value) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    if (lo == 0 && !this->_blocks.empty()) return 0;
+    // block lo - 1 starts below value: the answer is in it, or starts the
+    // next one. With no blocks yet every value is in the tail
+    size_type first = lo == 0 ? 0 : (lo - 1) * block_size;
+    size_type last =
+        lo == this->_blocks.size() ? this->size() : lo * block_size;
+    while (first < last) {
+      size_type mid = first + (last - first) / 2;
+      if ((*this)[mid] < value) {
+        first = mid + 1;
+      } else {
+        last = mid;
+      }
+    }
+    return first;
+  };
+
+  void clear() {
+    this->_data.clear();
+    this->_blocks.clear();
+    this->_tail.clear();
+  };
+
+  void swap(packed_int_vector& x) {
+    this->_data.swap(x._data);
+    this->_blocks.swap(x._blocks);
+    this->_tail.swap(x._tail);
+  };
+
+  /**
+   * @brief Drop the slack doubling left in the packed stream.
+   */
+  void shrink_to_fit() {
+    _word_vector(this->_data).swap(this->_data);
+    _block_vector(this->_blocks).swap(this->_blocks);
+  };
+
+  /**
+   * @brief Bytes held for the values: packed words, block headers and the
+   * unpacked tail.
+   */
+  size_type memory_usage() const {
+    return this->_data.capacity() * sizeof(packed_word) +
+           this->_blocks.capacity() * sizeof(_block) +
+           this->_tail.capacity() * sizeof(value_type);
+  };
+
+  allocator_type get_allocator() const { return this->_tail.get_allocator(); };
+
+ private:
+  static packed_word _mask_of(unsigned int width) {
+    return width ? ~packed_word(0) >> ((64 - width) & 63) : 0;
+  };
+
+  /**
+   * @brief Pack the full tail as a new block.
+   */
+  void _pack_tail() {
+    value_type base = this->_tail[0];
+    for (size_type i = 1; i < block_size; ++i) {
+      if (this->_tail[i] < base) base = this->_tail[i];
+    }
+    packed_word spread = 0;
+    for (size_type i = 0; i < block_size; ++i) {
+      spread |= static_cast< packed_word >(this->_tail[i] - base);
+    }
+    unsigned int width = spread ? 64 - __builtin_clzll(spread) : 0;
+
+    _block block;
+    block.base = base;
+    block.offset = this->_data.size();
+    block.width = width;
+    // one extra word is never needed: the last value ends in the last word
+    size_type words = block.offset + (block_size * width + 63) / 64;
+    if (words > this->_data.capacity()) {
+      // resize() grows to the exact size, so double here
+      size_type capacity = this->_data.capacity() * 2;
+      this->_data.reserve(words > capacity ? words : capacity);
+    }
+    this->_data.resize(words, 0);
+    packed_word* out = width ? &this->_data[block.offset] : u_nullptr;
+    for (size_type i = 0; width && i < block_size; ++i) {
+      packed_word delta = static_cast< packed_word >(this->_tail[i] - base);
+      size_type bit = i * width;
+      size_type shift = bit % 64;
+      out[bit / 64] |= delta << shift;
+      if (shift + width > 64) out[bit / 64 + 1] |= delta >> (64 - shift);
+    }
+    this->_blocks.push_back(block);
+    this->_tail.clear();
+  };
+
+  void _unpack(const _block& block, value_type* out) const {
+    /* built on first use, under the compiler's static init guard */
+    static const ft::packed_int_unpackers< value_type, block_size > unpackers;
+    const packed_word* in = block.width ? &this->_data[block.offset] : 0;
+    unpackers.table[block.width](in, block.base, out);
+  };
+};
+
+template < class T, class Alloc >
+const typename packed_int_vector< T, Alloc >::size_type
+    packed_int_vector< T, Alloc >::block_size;
+
+template < class T, class Alloc >
+bool operator==(const packed_int_vector< T, Alloc >& lhs,
+                const packed_int_vector< T, Alloc >& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    if (lhs[i] != rhs[i]) return false;
+  }
+  return true;
+};
+
+template < class T, class Alloc >
+bool operator!=(const packed_int_vector< T, Alloc >& lhs,
+                const packed_int_vector< T, Alloc >& rhs) {
+  return !(lhs == rhs);
+};
+
+template < class T, class Alloc >
+void swap(packed_int_vector< T, Alloc >& x, packed_int_vector< T, Alloc >& y) {
+  x.swap(y);
+};
+
+}  // namespace ft
+
+#endif  // FT__PACKED_INT_VECTOR_HPP
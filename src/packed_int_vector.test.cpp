@@ -0,0 +1,135 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/15
+ * @file src/packed_int_vector.test.cpp
+ */
+
+#include "packed_int_vector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "algorithm.hpp"
+#include "vector.hpp"
+
+typedef ft::packed_int_vector<> ft_packed;
+
+void test_packed_int_vector_basic(void) {
+  std::cout << "\t basic" << std::endl;
+
+  ft_packed v;
+  assert(v.empty() && v.begin() == v.end());
+  ft::vector< unsigned long long > expect;
+  std::srand(3);
+  // blocks of one value, of full 64-bit spread, of random small and tail
+  for (int i = 0; i < 128; ++i) expect.push_back(42);
+  for (int i = 0; i < 128; ++i) expect.push_back(i % 2 ? ~0ULL : 0);
+  for (int i = 0; i < 1000; ++i) expect.push_back(1000 + std::rand() % 5000);
+  for (std::size_t i = 0; i < expect.size(); ++i) v.push_back(expect[i]);
+
+  assert(v.size() == expect.size() && !v.empty());
+  for (std::size_t i = 0; i < expect.size(); ++i) assert(v[i] == expect[i]);
+  assert(v.front() == 42 && v.back() == expect.back());
+  assert(v.at(200) == expect[200]);
+  try {
+    v.at(expect.size());
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+  assert(ft::equal(v.begin(), v.end(), expect.begin()));
+  assert(v.end() - v.begin() == static_cast< long >(expect.size()));
+  assert(v.begin()[300] == expect[300] && *v.rbegin() == expect.back());
+
+  // pop_back unpacks full blocks back into the tail
+  while (v.size() > 100) {
+    v.pop_back();
+    expect.pop_back();
+  }
+  assert(v.back() == 42 && v.size() == 100);
+  ft_packed copy(v);
+  assert(copy == v);
+  copy.push_back(1);
+  assert(copy != v);
+  ft::swap(copy, v);
+  assert(v.size() == 101);
+  v.clear();
+  assert(v.empty());
+
+  ft::packed_int_vector< unsigned int > small;
+  for (unsigned int i = 0; i < 1000; ++i) small.push_back(i * 7 + 0xF0000000u);
+  for (unsigned int i = 0; i < 1000; ++i) {
+    assert(small[i] == i * 7 + 0xF0000000u);
+  }
+}
+
+void test_packed_int_vector_decode(void) {
+  std::cout << "\t decode / lower_bound" << std::endl;
+
+  ft_packed ids;
+  ft::vector< unsigned long long > expect;
+  unsigned long long id = 1ULL << 40;
+  std::srand(5);
+  for (int i = 0; i < 10000; ++i) {
+    id += 1 + std::rand() % 100;
+    ids.push_back(id);
+    expect.push_back(id);
+  }
+  ids.shrink_to_fit();
+  // gaps under 128 need 14 bits a value, not 64
+  assert(ids.memory_usage() * 4 < ids.size() * sizeof(unsigned long long));
+
+  ft::vector< unsigned long long > out(10000);
+  assert(ids.decode(0, &out[0], 10000) == 10000);
+  assert(out == expect);
+  assert(ids.decode(77, &out[0], 500) == 500);
+  for (int i = 0; i < 500; ++i) assert(out[i] == expect[77 + i]);
+  assert(ids.decode(9990, &out[0], 500) == 10);
+  assert(ids.decode(10000, &out[0], 1) == 0);
+
+  const unsigned long long* first = &expect[0];
+  const unsigned long long* last = first + expect.size();
+  for (int i = 0; i < 2000; ++i) {
+    unsigned long long probe = (1ULL << 40) + std::rand() % 520000;
+    std::size_t at = std::lower_bound(first, last, probe) - first;
+    assert(ids.lower_bound(probe) == at);
+  }
+  assert(ids.lower_bound(0) == 0);
+  assert(ids.lower_bound(expect[0]) == 0);
+  assert(ids.lower_bound(expect[128]) == 128);
+  assert(ids.lower_bound(expect.back()) == expect.size() - 1);
+  assert(ids.lower_bound(expect.back() + 1) == expect.size());
+
+  // a run of equal values spanning several blocks
+  ft_packed dups;
+  for (unsigned long long i = 0; i < 120; ++i) dups.push_back(i);
+  for (int i = 0; i < 300; ++i) dups.push_back(500);
+  for (unsigned long long i = 0; i < 200; ++i) dups.push_back(1000 + i);
+  assert(dups.lower_bound(500) == 120);
+  assert(dups.lower_bound(499) == 120 && dups.lower_bound(501) == 420);
+  assert(dups.lower_bound(1000) == 420 && dups.lower_bound(1199) == 619);
+
+  // fewer values than a block: all of them are in the unpacked tail
+  ft_packed small;
+  assert(small.lower_bound(7) == 0);
+  small.push_back(10);
+  small.push_back(20);
+  small.push_back(30);
+  assert(small.lower_bound(5) == 0 && small.lower_bound(20) == 1);
+  assert(small.lower_bound(30) == 2 && small.lower_bound(100) == 3);
+}
+
+void test_packed_int_vector(void) {
+  std::cout << "Test: packed_int_vector" << std::endl;
+  test_packed_int_vector_basic();
+  test_packed_int_vector_decode();
+}
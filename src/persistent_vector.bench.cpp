@@ -0,0 +1,155 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/17
+ * @file src/persistent_vector.bench.cpp
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+
+#include "bench.hpp"
+#include "persistent_vector.hpp"
+#include "vector.hpp"
+
+static std::size_t g_persistent_bench_bytes = 0;
+
+/**
+ * @brief Stateless std::allocator that tracks live bytes, to measure what
+ * each kept version costs.
+ */
+template < class T >
+class persistent_counting_allocator : public std::allocator< T > {
+ public:
+  typedef typename std::allocator< T >::pointer pointer;
+  typedef typename std::allocator< T >::size_type size_type;
+
+  template < class U >
+  struct rebind {
+    typedef persistent_counting_allocator< U > other;
+  };
+
+  persistent_counting_allocator() {}
+  persistent_counting_allocator(const persistent_counting_allocator& other)
+      : std::allocator< T >(other) {}
+  template < class U >
+  persistent_counting_allocator(
+      const persistent_counting_allocator< U >& other)
+      : std::allocator< T >(other) {}
+
+  pointer allocate(size_type n, const void* hint = 0) {
+    g_persistent_bench_bytes += n * sizeof(T);
+    return std::allocator< T >::allocate(n, hint);
+  }
+
+  void deallocate(pointer p, size_type n) {
+    g_persistent_bench_bytes -= n * sizeof(T);
+    std::allocator< T >::deallocate(p, n);
+  }
+};
+
+namespace {
+
+/* an undo history: 1M ints, one random update per kept version */
+const std::size_t g_items = 1 << 20;
+const std::size_t g_versions = 1 << 12;
+const std::size_t g_updates = 1 << 20;
+
+typedef ft::persistent_vector< int, persistent_counting_allocator< int > >
+    counted_pvec;
+
+}  // namespace
+
+void bench_persistent_vector(void) {
+  std::cout << "Bench: persistent_vector" << std::endl;
+
+  std::size_t sum = 0;
+  ft::vector< std::size_t > positions(g_updates);
+  std::srand(42);
+  for (std::size_t i = 0; i < g_updates; ++i) {
+    positions[i] = std::rand() % g_items;
+  }
+
+  double start = bench_now();
+  ft::persistent_vector< int > built;
+  for (std::size_t i = 0; i < g_items; ++i) {
+    built = built.push_back(static_cast< int >(i));
+  }
+  bench_report("persistent_vector push_back", bench_now() - start, g_items);
+
+  start = bench_now();
+  ft::persistent_vector< int >::transient_type batch =
+      ft::persistent_vector< int >().transient();
+  for (std::size_t i = 0; i < g_items; ++i) {
+    batch.push_back(static_cast< int >(i));
+  }
+  sum += batch.persistent().size();
+  bench_report("persistent_vector transient push_back", bench_now() - start,
+               g_items);
+
+  ft::vector< int > plain;
+  start = bench_now();
+  for (std::size_t i = 0; i < g_items; ++i) {
+    plain.push_back(static_cast< int >(i));
+  }
+  bench_report("ft::vector push_back", bench_now() - start, g_items);
+
+  start = bench_now();
+  ft::persistent_vector< int > current = built;
+  for (std::size_t i = 0; i < g_updates; ++i) {
+    current = current.set(positions[i], static_cast< int >(i));
+  }
+  sum += current[positions[0]];
+  bench_report("persistent_vector set (new version)", bench_now() - start,
+               g_updates);
+
+  start = bench_now();
+  batch = built.transient();
+  for (std::size_t i = 0; i < g_updates; ++i) {
+    batch.set(positions[i], static_cast< int >(i));
+  }
+  sum += batch[positions[0]];
+  bench_report("persistent_vector transient set", bench_now() - start,
+               g_updates);
+
+  /* the flat alternative copies the whole vector per version */
+  start = bench_now();
+  for (std::size_t i = 0; i < g_versions; ++i) {
+    ft::vector< int > next(plain);
+    next[positions[i]] = static_cast< int >(i);
+    sum += next[positions[i]];
+  }
+  bench_report("ft::vector copy + write (new version)", bench_now() - start,
+               g_versions);
+
+  g_persistent_bench_bytes = 0;
+  {
+    counted_pvec history;
+    for (std::size_t i = 0; i < g_items; ++i) {
+      history = history.push_back(static_cast< int >(i));
+    }
+    std::size_t base_bytes = g_persistent_bench_bytes;
+    ft::vector< counted_pvec > kept;
+    kept.reserve(g_versions);
+    std::size_t reserved = g_persistent_bench_bytes;
+    for (std::size_t i = 0; i < g_versions; ++i) {
+      history = history.set(positions[i], static_cast< int >(i));
+      kept.push_back(history);
+    }
+    std::cout << "\t persistent_vector bytes per element: "
+              << static_cast< double >(base_bytes) / g_items << std::endl;
+    std::cout << "\t persistent_vector bytes per kept version: "
+              << static_cast< double >(g_persistent_bench_bytes - reserved) /
+                     g_versions
+              << " (full copy " << g_items * sizeof(int) << ")" << std::endl;
+    sum += kept.back()[positions[0]];
+  }
+  bench_sink(sum);
+}
@@ -0,0 +1,681 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/17
+ * @file src/persistent_vector.hpp
+ */
+
+#if !defined(FT__PERSISTENT_VECTOR_HPP)
+#define FT__PERSISTENT_VECTOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+#include "atomic.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+
+namespace ft {
+
+/* log2 of the trie fan-out */
+static const std::size_t persistent_bits = 5;
+/* children per branch and elements per leaf */
+static const std::size_t persistent_width = 1 << persistent_bits;
+static const std::size_t persistent_mask = persistent_width - 1;
+
+/**
+ * @brief Reference count shared by the branches and leaves of a
+ * persistent_vector trie. A node is only ever changed while its count is 1.
+ */
+struct persistent_node {
+  ft::atomic< std::size_t > refs;
+
+  persistent_node() : refs(1){};
+
+  /**
+   * @brief copy Construct: the copy starts with its own single reference
+   */
+  persistent_node(const persistent_node&) : refs(1){};
+};
+
+/**
+ * @brief Inner node: up to persistent_width children, filled left to right.
+ */
+struct persistent_branch : public persistent_node {
+  persistent_node* children[persistent_width];
+
+  persistent_branch() {
+    for (std::size_t i = 0; i < persistent_width; ++i) this->children[i] = 0;
+  };
+};
+
+/**
+ * @brief Leaf: `count` constructed elements in a block of persistent_width.
+ */
+template < class T >
+struct persistent_leaf : public persistent_node {
+  std::size_t count;
+  T* values;
+
+  persistent_leaf() : count(0), values(0){};
+};
+
+/**
+ * @brief Read only random access iterator over a persistent_vector, by
+ * index.
+ */
+template < class Container >
+class persistent_vector_iterator
+    : public ft::iterator< ft::random_access_iterator_tag,
+                           typename Container::value_type, std::ptrdiff_t,
+                           const typename Container::value_type*,
+                           const typename Container::value_type& > {
+ public:
+  typedef ft::random_access_iterator_tag iterator_category;
+  typedef typename Container::value_type value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef const value_type* pointer;
+  typedef const value_type& reference;
+
+ protected:
+  const Container* _container;
+  std::size_t _index;
+
+ public:
+  persistent_vector_iterator() : _container(ft::u_nullptr), _index(0){};
+
+  persistent_vector_iterator(const Container* container, std::size_t index)
+      : _container(container), _index(index){};
+
+  reference operator*() const { return (*this->_container)[this->_index]; };
+  pointer operator->() const { return &(*this->_container)[this->_index]; };
+
+  persistent_vector_iterator& operator++() {
+    ++this->_index;
+    return *this;
+  };
+
+  persistent_vector_iterator operator++(int) {
+    persistent_vector_iterator tmp = *this;
+    ++this->_index;
+    return tmp;
+  };
+
+  persistent_vector_iterator& operator--() {
+    --this->_index;
+    return *this;
+  };
+
+  persistent_vector_iterator operator--(int) {
+    persistent_vector_iterator tmp = *this;
+    --this->_index;
+    return tmp;
+  };
+
+  persistent_vector_iterator operator+(difference_type n) const {
+    return persistent_vector_iterator(this->_container, this->_index + n);
+  };
+
+  persistent_vector_iterator& operator+=(difference_type n) {
+    this->_index += n;
+    return *this;
+  };
+
+  persistent_vector_iterator operator-(difference_type n) const {
+    return persistent_vector_iterator(this->_container, this->_index - n);
+  };
+
+  persistent_vector_iterator& operator-=(difference_type n) {
+    this->_index -= n;
+    return *this;
+  };
+
+  reference operator[](difference_type n) const {
+    return (*this->_container)[this->_index + n];
+  };
+
+  /**
+   * @brief get the element index, used for comparisons
+   */
+  std::size_t index() const { return this->_index; }
+};
+
+template < class C >
+bool operator==(const persistent_vector_iterator< C >& lhs,
+                const persistent_vector_iterator< C >& rhs) {
+  return lhs.index() == rhs.index();
+};
+
+template < class C >
+bool operator!=(const persistent_vector_iterator< C >& lhs,
+                const persistent_vector_iterator< C >& rhs) {
+  return lhs.index() != rhs.index();
+};
+
+template < class C >
+bool operator<(const persistent_vector_iterator< C >& lhs,
+               const persistent_vector_iterator< C >& rhs) {
+  return lhs.index() < rhs.index();
+};
+
+template < class C >
+bool operator<=(const persistent_vector_iterator< C >& lhs,
+                const persistent_vector_iterator< C >& rhs) {
+  return lhs.index() <= rhs.index();
+};
+
+template < class C >
+bool operator>(const persistent_vector_iterator< C >& lhs,
+               const persistent_vector_iterator< C >& rhs) {
+  return lhs.index() > rhs.index();
+};
+
+template < class C >
+bool operator>=(const persistent_vector_iterator< C >& lhs,
+                const persistent_vector_iterator< C >& rhs) {
+  return lhs.index() >= rhs.index();
+};
+
+template < class C >
+persistent_vector_iterator< C > operator+(
+    typename persistent_vector_iterator< C >::difference_type n,
+    const persistent_vector_iterator< C >& iter) {
+  return iter + n;
+};
+
+template < class C >
+typename persistent_vector_iterator< C >::difference_type operator-(
+    const persistent_vector_iterator< C >& lhs,
+    const persistent_vector_iterator< C >& rhs) {
+  return static_cast< std::ptrdiff_t >(lhs.index()) -
+         static_cast< std::ptrdiff_t >(rhs.index());
+};
+
+/**
+ * @brief Immutable vector whose versions share structure: a 32-way radix
+ * trie of leaves plus a separate tail leaf holding the last 1 to 32
+ * elements.
+ *
+ * push_back(), set() and pop_back() leave *this untouched and return a new
+ * version in O(log32 n): only the path to the changed leaf is copied, every
+ * other node is shared by reference count. Appends mostly touch the tail
+ * only. Versions can be read and copied from several threads at once.
+ *
+ * A transient_type edits a version in place for batches of updates. It
+ * changes a node directly when its reference count shows it is not shared
+ * and copies it otherwise, so each node is copied at most once per batch
+ * and versions taken before or during the batch never see its changes.
+ *
+ * @tparam T Type of the elements.
+ * @tparam _Alloc Allocator of T, rebound for the trie nodes.
+ */
+template < class T, class _Alloc = std::allocator< T > >
+class persistent_vector {
+ public:
+  typedef T value_type;
+  typedef _Alloc allocator_type;
+  typedef const T& const_reference;
+  typedef const T& reference;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef ft::persistent_vector_iterator< persistent_vector > const_iterator;
+  typedef const_iterator iterator;
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+  typedef const_reverse_iterator reverse_iterator;
+
+  /**
+   * @brief Mutable handle on a version, for batches of updates.
+   */
+  class transient_type {
+    friend class persistent_vector;
+
+   private:
+    persistent_vector _version;
+
+    explicit transient_type(const persistent_vector& version)
+        : _version(version){};
+
+   public:
+    size_type size() const { return this->_version.size(); };
+    bool empty() const { return this->_version.empty(); };
+    const_reference operator[](size_type n) const {
+      return this->_version[n];
+    };
+
+    void push_back(const value_type& val) { this->_version._push(val); };
+    void set(size_type n, const value_type& val) {
+      this->_version._assign(n, val);
+    };
+    void pop_back() { this->_version._pop(); };
+
+    /**
+     * @brief The current contents as a version. Later edits through this
+     * transient copy whatever that version shares.
+     */
+    persistent_vector persistent() const { return this->_version; };
+  };
+
+  friend class transient_type;
+
+ private:
+  typedef ft::persistent_leaf< T > _leaf;
+  typedef ft::persistent_branch _branch;
+  typedef typename _Alloc::template rebind< _leaf >::other _leaf_allocator;
+  typedef typename _Alloc::template rebind< _branch >::other _branch_allocator;
+
+  allocator_type _alloc;
+  _leaf_allocator _leaf_alloc;
+  _branch_allocator _branch_alloc;
+  size_type _size;
+  /* level of the root: its children are leaves when it is persistent_bits */
+  size_type _shift;
+  /* null while every element fits in the tail */
+  _branch* _root;
+  /* null while empty */
+  _leaf* _tail;
+
+ public:
+  explicit persistent_vector(const allocator_type& alloc = allocator_type())
+      : _alloc(alloc),
+        _leaf_alloc(alloc),
+        _branch_alloc(alloc),
+        _size(0),
+        _shift(persistent_bits),
+        _root(u_nullptr),
+        _tail(u_nullptr){};
+
+  explicit persistent_vector(size_type n, const value_type& val = value_type(),
+                             const allocator_type& alloc = allocator_type())
+      : _alloc(alloc),
+        _leaf_alloc(alloc),
+        _branch_alloc(alloc),
+        _size(0),
+        _shift(persistent_bits),
+        _root(u_nullptr),
+        _tail(u_nullptr) {
+    while (n--) this->_push(val);
+  };
+
+  template < class InputIterator >
+  persistent_vector(InputIterator first, InputIterator last,
+                    const allocator_type& alloc = allocator_type(),
+                    typename ft::enable_if<
+                        !ft::is_integral< InputIterator >::value >::type* =
+                        u_nullptr)
+      : _alloc(alloc),
+        _leaf_alloc(alloc),
+        _branch_alloc(alloc),
+        _size(0),
+        _shift(persistent_bits),
+        _root(u_nullptr),
+        _tail(u_nullptr) {
+    for (; first != last; ++first) this->_push(*first);
+  };
+
+  /**
+   * @brief copy Construct: O(1), shares every node
+   */
+  persistent_vector(const persistent_vector& x)
+      : _alloc(x._alloc),
+        _leaf_alloc(x._leaf_alloc),
+        _branch_alloc(x._branch_alloc),
+        _size(x._size),
+        _shift(x._shift),
+        _root(x._root),
+        _tail(x._tail) {
+    if (this->_root) this->_root->refs.fetch_add(1, memory_order_relaxed);
+    if (this->_tail) this->_tail->refs.fetch_add(1, memory_order_relaxed);
+  };
+
+  persistent_vector& operator=(const persistent_vector& x) {
+    persistent_vector tmp(x);
+    this->swap(tmp);
+    return *this;
+  };
+
+  ~persistent_vector() {
+    this->_release(this->_root, this->_shift);
+    this->_release(this->_tail);
+  };
+
+  const_iterator begin() const { return const_iterator(this, 0); };
+  const_iterator end() const { return const_iterator(this, this->_size); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(this->end());
+  };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(this->begin());
+  };
+
+  size_type size() const { return this->_size; };
+  bool empty() const { return this->_size == 0; };
+  size_type max_size() const { return this->_alloc.max_size(); };
+
+  const_reference operator[](size_type n) const {
+    if (n >= this->_tail_offset()) {
+      return this->_tail->values[n & persistent_mask];
+    }
+    return this->_leaf_for(n)->values[n & persistent_mask];
+  };
+
+  const_reference at(size_type n) const {
+    if (n >= this->_size) throw std::out_of_range("ft::persistent_vector");
+    return (*this)[n];
+  };
+
+  const_reference front() const { return (*this)[0]; };
+  const_reference back() const { return (*this)[this->_size - 1]; };
+
+  /**
+   * @brief A new version with val appended.
+   */
+  persistent_vector push_back(const value_type& val) const {
+    persistent_vector next(*this);
+    next._push(val);
+    return next;
+  };
+
+  /**
+   * @brief A new version with element n replaced by val.
+   */
+  persistent_vector set(size_type n, const value_type& val) const {
+    if (n >= this->_size) throw std::out_of_range("ft::persistent_vector");
+    persistent_vector next(*this);
+    next._assign(n, val);
+    return next;
+  };
+
+  /**
+   * @brief A new version without the last element.
+   */
+  persistent_vector pop_back() const {
+    persistent_vector next(*this);
+    next._pop();
+    return next;
+  };
+
+  /**
+   * @brief A handle to edit this version in place, starting from its
+   * contents.
+   */
+  transient_type transient() const { return transient_type(*this); };
+
+  void swap(persistent_vector& x) {
+    size_type size = x._size;
+    size_type shift = x._shift;
+    _branch* root = x._root;
+    _leaf* tail = x._tail;
+    x._size = this->_size;
+    x._shift = this->_shift;
+    x._root = this->_root;
+    x._tail = this->_tail;
+    this->_size = size;
+    this->_shift = shift;
+    this->_root = root;
+    this->_tail = tail;
+  };
+
+  allocator_type get_allocator() const { return this->_alloc; };
+
+ private:
+  /**
+   * @brief Index of the first element kept in the tail.
+   */
+  size_type _tail_offset() const {
+    if (this->_size < persistent_width) return 0;
+    return ((this->_size - 1) >> persistent_bits) << persistent_bits;
+  };
+
+  /**
+   * @brief The trie leaf holding element n, n < _tail_offset().
+   */
+  const _leaf* _leaf_for(size_type n) const {
+    const persistent_node* node = this->_root;
+    for (size_type level = this->_shift; level > 0; level -= persistent_bits) {
+      node = static_cast< const _branch* >(node)
+                 ->children[(n >> level) & persistent_mask];
+    }
+    return static_cast< const _leaf* >(node);
+  };
+
+  static bool _unique(const persistent_node* node) {
+    return node->refs.load(memory_order_acquire) == 1;
+  };
+
+  _leaf* _new_leaf() {
+    _leaf* leaf = this->_leaf_alloc.allocate(1);
+    this->_leaf_alloc.construct(leaf, _leaf());
+    leaf->values = this->_alloc.allocate(persistent_width);
+    return leaf;
+  };
+
+  _branch* _new_branch() {
+    _branch* branch = this->_branch_alloc.allocate(1);
+    this->_branch_alloc.construct(branch, _branch());
+    return branch;
+  };
+
+  void _release(_leaf* leaf) {
+    if (!leaf || leaf->refs.fetch_sub(1, memory_order_acq_rel) != 1) return;
+    for (size_type i = 0; i < leaf->count; ++i) {
+      this->_alloc.destroy(leaf->values + i);
+    }
+    this->_alloc.deallocate(leaf->values, persistent_width);
+    this->_leaf_alloc.destroy(leaf);
+    this->_leaf_alloc.deallocate(leaf, 1);
+  };
+
+  /**
+   * @brief Drop a reference to a branch at `level`, freeing the subtree
+   * nodes no other version holds.
+   */
+  void _release(_branch* branch, size_type level) {
+    if (!branch || branch->refs.fetch_sub(1, memory_order_acq_rel) != 1) {
+      return;
+    }
+    for (size_type i = 0; i < persistent_width; ++i) {
+      if (level == persistent_bits) {
+        this->_release(static_cast< _leaf* >(branch->children[i]));
+      } else {
+        this->_release(static_cast< _branch* >(branch->children[i]),
+                       level - persistent_bits);
+      }
+    }
+    this->_branch_alloc.destroy(branch);
+    this->_branch_alloc.deallocate(branch, 1);
+  };
+
+  /**
+   * @brief leaf itself if this vector holds the only reference, else a copy
+   * replacing that reference.
+   */
+  _leaf* _writable(_leaf* leaf) {
+    if (_unique(leaf)) return leaf;
+    _leaf* copy = this->_new_leaf();
+    for (; copy->count < leaf->count; ++copy->count) {
+      this->_alloc.construct(copy->values + copy->count,
+                             leaf->values[copy->count]);
+    }
+    this->_release(leaf);
+    return copy;
+  };
+
+  _branch* _writable(_branch* branch, size_type level) {
+    if (_unique(branch)) return branch;
+    _branch* copy = this->_new_branch();
+    for (size_type i = 0; i < persistent_width; ++i) {
+      copy->children[i] = branch->children[i];
+      if (copy->children[i]) {
+        copy->children[i]->refs.fetch_add(1, memory_order_relaxed);
+      }
+    }
+    this->_release(branch, level);
+    return copy;
+  };
+
+  /**
+   * @brief A chain of single child branches from `level` down to node.
+   */
+  persistent_node* _new_path(size_type level, persistent_node* node) {
+    if (level == 0) return node;
+    _branch* branch = this->_new_branch();
+    branch->children[0] = this->_new_path(level - persistent_bits, node);
+    return branch;
+  };
+
+  /**
+   * @brief Hang the full tail under parent, a writable branch at level.
+   */
+  void _push_tail(size_type level, _branch* parent, _leaf* tail) {
+    size_type at = ((this->_size - 1) >> level) & persistent_mask;
+    if (level == persistent_bits) {
+      parent->children[at] = tail;
+      return;
+    }
+    _branch* child = static_cast< _branch* >(parent->children[at]);
+    if (child) {
+      child = this->_writable(child, level - persistent_bits);
+      parent->children[at] = child;
+      this->_push_tail(level - persistent_bits, child, tail);
+    } else {
+      parent->children[at] = this->_new_path(level - persistent_bits, tail);
+    }
+  };
+
+  void _push(const value_type& val) {
+    if (this->_tail && this->_tail->count < persistent_width) {
+      this->_tail = this->_writable(this->_tail);
+      this->_alloc.construct(this->_tail->values + this->_tail->count, val);
+      ++this->_tail->count;
+      ++this->_size;
+      return;
+    }
+    _leaf* leaf = this->_new_leaf();
+    this->_alloc.construct(leaf->values, val);
+    leaf->count = 1;
+    if (this->_tail) {
+      // the full tail moves into the trie
+      if (!this->_root) this->_root = this->_new_branch();
+      if ((this->_size >> persistent_bits) > (size_type(1) << this->_shift)) {
+        _branch* root = this->_new_branch();
+        root->children[0] = this->_root;
+        root->children[1] = this->_new_path(this->_shift, this->_tail);
+        this->_root = root;
+        this->_shift += persistent_bits;
+      } else {
+        this->_root = this->_writable(this->_root, this->_shift);
+        this->_push_tail(this->_shift, this->_root, this->_tail);
+      }
+    }
+    this->_tail = leaf;
+    ++this->_size;
+  };
+
+  void _assign(size_type n, const value_type& val) {
+    if (n >= this->_tail_offset()) {
+      this->_tail = this->_writable(this->_tail);
+      this->_tail->values[n & persistent_mask] = val;
+      return;
+    }
+    this->_root = this->_writable(this->_root, this->_shift);
+    _branch* node = this->_root;
+    size_type level = this->_shift;
+    for (; level > persistent_bits; level -= persistent_bits) {
+      size_type at = (n >> level) & persistent_mask;
+      _branch* child = this->_writable(
+          static_cast< _branch* >(node->children[at]), level - persistent_bits);
+      node->children[at] = child;
+      node = child;
+    }
+    size_type at = (n >> level) & persistent_mask;
+    _leaf* leaf = this->_writable(static_cast< _leaf* >(node->children[at]));
+    node->children[at] = leaf;
+    leaf->values[n & persistent_mask] = val;
+  };
+
+  /**
+   * @brief Unhook the last trie leaf below node, a writable branch at level.
+   *
+   * @return true if node was left without children
+   */
+  bool _pop_tail(size_type level, _branch* node) {
+    size_type at = ((this->_size - 2) >> level) & persistent_mask;
+    if (level > persistent_bits) {
+      _branch* child = this->_writable(
+          static_cast< _branch* >(node->children[at]), level - persistent_bits);
+      node->children[at] = child;
+      if (!this->_pop_tail(level - persistent_bits, child)) return false;
+      this->_release(child, level - persistent_bits);
+      node->children[at] = u_nullptr;
+    } else {
+      this->_release(static_cast< _leaf* >(node->children[at]));
+      node->children[at] = u_nullptr;
+    }
+    return at == 0;
+  };
+
+  void _pop() {
+    if (this->_size - this->_tail_offset() > 1) {
+      this->_tail = this->_writable(this->_tail);
+      this->_alloc.destroy(this->_tail->values + --this->_tail->count);
+      --this->_size;
+      return;
+    }
+    _leaf* leaf = u_nullptr;
+    if (this->_size > 1) {
+      // the last trie leaf becomes the tail
+      leaf = const_cast< _leaf* >(this->_leaf_for(this->_size - 2));
+      leaf->refs.fetch_add(1, memory_order_relaxed);
+      this->_root = this->_writable(this->_root, this->_shift);
+      this->_pop_tail(this->_shift, this->_root);
+      if (this->_shift > persistent_bits && !this->_root->children[1]) {
+        _branch* root = this->_root;
+        this->_root = static_cast< _branch* >(root->children[0]);
+        this->_root->refs.fetch_add(1, memory_order_relaxed);
+        this->_release(root, this->_shift);
+        this->_shift -= persistent_bits;
+      }
+    }
+    this->_release(this->_tail);
+    this->_tail = leaf;
+    --this->_size;
+    if (this->_size <= persistent_width && this->_root) {
+      this->_release(this->_root, this->_shift);
+      this->_root = u_nullptr;
+      this->_shift = persistent_bits;
+    }
+  };
+};
+
+template < class T, class Alloc >
+bool operator==(const persistent_vector< T, Alloc >& lhs,
+                const persistent_vector< T, Alloc >& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    if (!(lhs[i] == rhs[i])) return false;
+  }
+  return true;
+};
+
+template < class T, class Alloc >
+bool operator!=(const persistent_vector< T, Alloc >& lhs,
+                const persistent_vector< T, Alloc >& rhs) {
+  return !(lhs == rhs);
+};
+
+template < class T, class Alloc >
+void swap(persistent_vector< T, Alloc >& x, persistent_vector< T, Alloc >& y) {
+  x.swap(y);
+};
+
+}  // namespace ft
+
+#endif  // FT__PERSISTENT_VECTOR_HPP
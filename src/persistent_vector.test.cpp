@@ -0,0 +1,168 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/17
+ * @file src/persistent_vector.test.cpp
+ */
+
+#include "persistent_vector.hpp"
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "vector.hpp"
+
+typedef ft::persistent_vector< int > ft_pvec;
+
+namespace {
+
+bool pv_test_same(const ft_pvec& v, const std::vector< int >& model) {
+  if (v.size() != model.size()) return false;
+  for (std::size_t i = 0; i < model.size(); ++i) {
+    if (v[i] != model[i]) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+void test_persistent_vector_versions(void) {
+  std::cout << "\t versions" << std::endl;
+
+  ft_pvec empty;
+  assert(empty.empty() && empty.begin() == empty.end());
+  ft_pvec one = empty.push_back(7);
+  assert(empty.size() == 0 && one.size() == 1 && one.front() == 7);
+  assert(one.pop_back().empty() && one.back() == 7);
+
+  // grow past the tail, one trie level and two trie levels
+  ft::vector< ft_pvec > versions;
+  std::vector< int > model;
+  ft_pvec v;
+  versions.push_back(v);
+  for (int i = 0; i < 40000; ++i) {
+    v = v.push_back(i);
+    if (i % 997 == 0 || i == 31 || i == 32 || i == 1055 || i == 1056) {
+      versions.push_back(v);
+    }
+  }
+  assert(v.size() == 40000);
+  for (int i = 0; i < 40000; ++i) assert(v[i] == i);
+  // every kept version still sees exactly its own prefix
+  for (std::size_t k = 0; k < versions.size(); ++k) {
+    for (std::size_t i = 0; i < versions[k].size(); ++i) {
+      assert(versions[k][i] == static_cast< int >(i));
+    }
+  }
+
+  ft_pvec w = v.set(5, -5).set(39999, -1).set(20000, -2);
+  assert(w[5] == -5 && w[39999] == -1 && w[20000] == -2);
+  assert(w.size() == v.size());
+  assert(v[5] == 5 && v[39999] == 39999 && v[20000] == 20000);
+  assert(w != v && ft_pvec(v) == v);
+
+  // shrink back through every boundary
+  ft_pvec p = v;
+  while (p.size() > 10) {
+    p = p.pop_back();
+    assert(p.back() == static_cast< int >(p.size()) - 1);
+  }
+  assert(v.size() == 40000 && v.back() == 39999);
+
+  ft_pvec::const_iterator it = v.begin() + 100;
+  assert(*it == 100 && it[5] == 105 && v.end() - it == 39900);
+  assert(*v.rbegin() == 39999);
+  try {
+    v.at(40000);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+  try {
+    v.set(40000, 0);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+
+  ft::persistent_vector< std::string > s(70, "x");
+  ft::persistent_vector< std::string > t = s.set(3, "y").pop_back();
+  assert(s[3] == "x" && t[3] == "y" && t.size() == 69);
+}
+
+void test_persistent_vector_random(void) {
+  std::cout << "\t random" << std::endl;
+
+  // random edits on random older versions, checked against copies
+  std::srand(42);
+  ft::vector< ft_pvec > versions(1);
+  std::vector< std::vector< int > > models(1);
+  for (int step = 0; step < 3000; ++step) {
+    std::size_t k = std::rand() % versions.size();
+    ft_pvec v = versions[k];
+    std::vector< int > model = models[k];
+    int op = std::rand() % 4;
+    if (op == 0 && !model.empty()) {
+      v = v.pop_back();
+      model.pop_back();
+    } else if (op == 1 && !model.empty()) {
+      std::size_t at = std::rand() % model.size();
+      v = v.set(at, step);
+      model[at] = step;
+    } else {
+      int n = 1 + std::rand() % 200;
+      for (int i = 0; i < n; ++i) {
+        v = v.push_back(step + i);
+        model.push_back(step + i);
+      }
+    }
+    assert(pv_test_same(v, model));
+    if (versions.size() < 64) {
+      versions.push_back(v);
+      models.push_back(model);
+    } else {
+      versions[k] = v;
+      models[k] = model;
+    }
+  }
+  for (std::size_t k = 0; k < versions.size(); ++k) {
+    assert(pv_test_same(versions[k], models[k]));
+  }
+}
+
+void test_persistent_vector_transient(void) {
+  std::cout << "\t transient" << std::endl;
+
+  ft_pvec base(100, 1);
+  ft_pvec::transient_type t = base.transient();
+  for (int i = 0; i < 5000; ++i) t.push_back(i);
+  ft_pvec snapshot = t.persistent();
+  // edits after a snapshot leave the snapshot alone
+  t.set(0, -1);
+  t.set(2000, -2);
+  t.pop_back();
+  assert(base.size() == 100 && base[0] == 1);
+  assert(snapshot.size() == 5100 && snapshot[0] == 1 && snapshot[2000] == 1900);
+  assert(t.size() == 5099 && t[0] == -1 && t[2000] == -2);
+  while (!t.empty()) t.pop_back();
+  assert(t.persistent().empty() && snapshot.back() == 4999);
+
+  const int values[] = {3, 1, 4, 1, 5};
+  ft_pvec r(values, values + 5);
+  assert(r.size() == 5 && r[2] == 4 && r.back() == 5);
+}
+
+void test_persistent_vector(void) {
+  std::cout << "Test: persistent_vector" << std::endl;
+  test_persistent_vector_versions();
+  test_persistent_vector_random();
+  test_persistent_vector_transient();
+}
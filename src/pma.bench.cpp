@@ -0,0 +1,113 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/24
+ * @file src/pma.bench.cpp
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <set>
+
+#include "algorithm.hpp"
+#include "bench.hpp"
+#include "btree_map.hpp"
+#include "pma.hpp"
+#include "vector.hpp"
+
+namespace {
+
+/* random keys streamed in, then scanned and searched */
+const std::size_t g_keys = 1 << 20;
+const std::size_t g_lookups = 1 << 20;
+/* the sorted vector shifts half of itself per insert: a shorter stream */
+const std::size_t g_vector_keys = 1 << 16;
+
+typedef ft::vector< unsigned int > pma_bench_sorted;
+typedef std::multiset< unsigned int > pma_bench_tree;
+typedef ft::btree_map< unsigned int, unsigned int > pma_bench_btree;
+typedef ft::pma< unsigned int > pma_bench_pma;
+
+void pma_bench_insert(pma_bench_sorted& c, unsigned int key) {
+  c.insert(ft::upper_bound(c.begin(), c.end(), key), key);
+}
+void pma_bench_insert(pma_bench_tree& c, unsigned int key) { c.insert(key); }
+void pma_bench_insert(pma_bench_btree& c, unsigned int key) { c[key] = key; }
+void pma_bench_insert(pma_bench_pma& c, unsigned int key) { c.insert(key); }
+
+pma_bench_sorted::const_iterator pma_bench_lower(const pma_bench_sorted& c,
+                                                 unsigned int key) {
+  return ft::lower_bound(c.begin(), c.end(), key);
+}
+template < class Container >
+typename Container::const_iterator pma_bench_lower(const Container& c,
+                                                   unsigned int key) {
+  return c.lower_bound(key);
+}
+
+unsigned int pma_bench_key(pma_bench_btree::const_iterator it) {
+  return it->first;
+}
+template < class Iterator >
+unsigned int pma_bench_key(Iterator it) {
+  return *it;
+}
+
+/**
+ * @brief Insert the first n keys, then time a full scan and g_lookups
+ * lower_bound calls, each followed by a 16 element walk.
+ */
+template < class Container >
+void pma_bench_run(const char* name, const ft::vector< unsigned int >& keys,
+                   std::size_t n) {
+  typedef typename Container::const_iterator const_iterator;
+  std::cout << "\t " << name << std::endl;
+
+  Container c;
+  double start = bench_now();
+  for (std::size_t i = 0; i < n; ++i) pma_bench_insert(c, keys[i]);
+  bench_report("  insert", bench_now() - start, n);
+
+  std::size_t sum = 0;
+  start = bench_now();
+  for (const_iterator it = c.begin(); it != c.end(); ++it) {
+    sum += pma_bench_key(it);
+  }
+  bench_report("  full scan", bench_now() - start, c.size());
+
+  start = bench_now();
+  for (std::size_t i = 0; i < g_lookups; ++i) {
+    const_iterator it = pma_bench_lower(c, keys[(i * 7919) % n]);
+    for (std::size_t j = 0; j < 16 && it != c.end(); ++j, ++it) {
+      sum += pma_bench_key(it);
+    }
+  }
+  bench_report("  lower_bound + 16 step walk", bench_now() - start, g_lookups);
+  bench_sink(sum);
+}
+
+}  // namespace
+
+void bench_pma(void) {
+  std::cout << "Bench: pma" << std::endl;
+
+  std::srand(42);
+  ft::vector< unsigned int > keys;
+  keys.reserve(g_keys);
+  for (std::size_t i = 0; i < g_keys; ++i) {
+    keys.push_back(static_cast< unsigned int >(std::rand()));
+  }
+
+  pma_bench_run< pma_bench_sorted >("sorted ft::vector, 64k keys", keys,
+                                    g_vector_keys);
+  pma_bench_run< pma_bench_pma >("ft::pma, 64k keys", keys, g_vector_keys);
+  pma_bench_run< pma_bench_tree >("std::multiset, 1M keys", keys, g_keys);
+  pma_bench_run< pma_bench_btree >("ft::btree_map, 1M keys", keys, g_keys);
+  pma_bench_run< pma_bench_pma >("ft::pma, 1M keys", keys, g_keys);
+}
@@ -0,0 +1,641 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/24
+ * @file src/pma.hpp
+ */
+
+#if !defined(FT__PMA_HPP)
+#define FT__PMA_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include "algorithm.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+#include "views.hpp"
+
+namespace ft {
+
+/**
+ * @brief Bidirectional iterator over a pma: a segment and an offset in it.
+ * Stepping past the last element of a segment moves to the next segment
+ * holding any, so scans only touch occupied slots.
+ */
+template < class T >
+class pma_iterator
+    : public ft::iterator< ft::bidirectional_iterator_tag, const T > {
+ public:
+  typedef ft::bidirectional_iterator_tag iterator_category;
+  typedef T value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef const T* pointer;
+  typedef const T& reference;
+
+ protected:
+  const T* _slots;
+  const std::size_t* _counts;
+  std::size_t _segment_size;
+  std::size_t _segments;
+  std::size_t _segment;
+  std::size_t _offset;
+
+ public:
+  pma_iterator()
+      : _slots(u_nullptr),
+        _counts(u_nullptr),
+        _segment_size(0),
+        _segments(0),
+        _segment(0),
+        _offset(0){};
+  pma_iterator(const T* slots, const std::size_t* counts,
+               std::size_t segment_size, std::size_t segments,
+               std::size_t segment, std::size_t offset)
+      : _slots(slots),
+        _counts(counts),
+        _segment_size(segment_size),
+        _segments(segments),
+        _segment(segment),
+        _offset(offset) {
+    this->_skip_empty();
+  };
+
+  reference operator*() const {
+    return this->_slots[this->_segment * this->_segment_size + this->_offset];
+  };
+  pointer operator->() const { return &(operator*()); };
+
+  pma_iterator& operator++() {
+    ++this->_offset;
+    this->_skip_empty();
+    return *this;
+  };
+
+  pma_iterator operator++(int) {
+    pma_iterator tmp = *this;
+    ++(*this);
+    return tmp;
+  };
+
+  pma_iterator& operator--() {
+    while (this->_offset == 0) {
+      --this->_segment;
+      this->_offset = this->_counts[this->_segment];
+    }
+    --this->_offset;
+    return *this;
+  };
+
+  pma_iterator operator--(int) {
+    pma_iterator tmp = *this;
+    --(*this);
+    return tmp;
+  };
+
+  std::size_t segment() const { return this->_segment; };
+  std::size_t offset() const { return this->_offset; };
+
+ private:
+  /**
+   * @brief From the end of a segment, move to the start of the next
+   * non-empty one, or to end(): segment == segments, offset 0.
+   */
+  void _skip_empty() {
+    while (this->_segment < this->_segments &&
+           this->_offset == this->_counts[this->_segment]) {
+      ++this->_segment;
+      this->_offset = 0;
+    }
+  };
+};
+
+template < class T >
+bool operator==(const pma_iterator< T >& lhs, const pma_iterator< T >& rhs) {
+  return lhs.segment() == rhs.segment() && lhs.offset() == rhs.offset();
+};
+
+template < class T >
+bool operator!=(const pma_iterator< T >& lhs, const pma_iterator< T >& rhs) {
+  return !(lhs == rhs);
+};
+
+/**
+ * @brief Sorted sequence (a multiset) in a packed memory array: one
+ * ft::vector of slots, cut into segments of Θ(log n) slots, each holding
+ * its elements packed at its start.
+ *
+ * An insert or erase shifts only the rest of one segment. When that
+ * segment is full (or nearly empty) the smallest enclosing window of
+ * 2^d segments whose density is inside the bounds for level d is found
+ * and its elements are spread evenly over it. The bounds tighten toward
+ * the root, from [1/8, 1] for a segment to [1/4, 3/4] for the whole array,
+ * so a window that was just spread stays valid for a number of updates
+ * proportional to its size: O(log^2 n) amortized moves per update.
+ * Leaving the root bounds rebuilds the array at half density.
+ *
+ * Unlike a tree, the elements stay in one array in order, so a scan is a
+ * sequential walk with a few empty slots per segment to step over, and
+ * lower_bound is a binary search over segment heads, then inside one
+ * segment.
+ *
+ * Elements are immutable through iterators. Every insert or erase
+ * invalidates all iterators.
+ *
+ * @tparam T Type of the elements, default constructible and assignable.
+ * @tparam Compare strict weak ordering, defaults to `less<T>`.
+ * @tparam _Alloc allocator of the slots, defaults to `allocator<T>`.
+ */
+template < class T, class Compare = std::less< T >,
+           class _Alloc = std::allocator< T > >
+class pma {
+ public:
+  /* The first template parameter (T) */
+  typedef T value_type;
+  /* The second template parameter (Compare) */
+  typedef Compare value_compare;
+  /* The third template parameter (_Alloc) */
+  typedef _Alloc allocator_type;
+  typedef const T& reference;
+  typedef const T& const_reference;
+  /* a bidirectional iterator to const value_type */
+  typedef ft::pma_iterator< T > iterator;
+  typedef ft::pma_iterator< T > const_iterator;
+  typedef ft::reverse_iterator< iterator > reverse_iterator;
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+  /* a [first, last) pair of iterators, see views.hpp */
+  typedef ft::iterator_range< const_iterator > range_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef std::size_t size_type;
+
+ private:
+  typedef ft::vector< T, _Alloc > _slot_container;
+  typedef ft::vector< size_type,
+                      typename _Alloc::template rebind< size_type >::other >
+      _count_container;
+
+  /* smallest segment, and the slots of an empty array */
+  static const size_type _min_segment_size = 16;
+
+  Compare _comp;
+  _slot_container _slots;
+  /* elements held at the start of each segment */
+  _count_container _counts;
+  /* a copy of the first element of each segment, searched by lower_bound
+   * without touching one cache line per probe in _slots */
+  _slot_container _heads;
+  size_type _segment_size;
+  size_type _size;
+  /* the levels of the implicit tree over the segments, root = _height */
+  size_type _height;
+
+ public:
+  /**
+   * @brief empty container constructor (default constructor)
+   */
+  explicit pma(const value_compare& comp = value_compare(),
+               const allocator_type& alloc = allocator_type())
+      : _comp(comp),
+        _slots(_min_segment_size, value_type(), alloc),
+        _counts(1, 0),
+        _heads(1, value_type(), alloc),
+        _segment_size(_min_segment_size),
+        _size(0),
+        _height(0){};
+
+  /**
+   * @brief range constructor: the range is sorted once and laid out at half
+   * density, instead of inserted element by element. Equal elements keep
+   * their order in the range, as they would with insert.
+   */
+  template < class InputIterator >
+  pma(InputIterator first, InputIterator last,
+      const value_compare& comp = value_compare(),
+      const allocator_type& alloc = allocator_type(),
+      typename ft::enable_if<
+          !ft::is_integral< InputIterator >::value >::type* = u_nullptr)
+      : _comp(comp),
+        _slots(_min_segment_size, value_type(), alloc),
+        _counts(1, 0),
+        _heads(1, value_type(), alloc),
+        _segment_size(_min_segment_size),
+        _size(0),
+        _height(0) {
+    _slot_container sorted(alloc);
+    for (; first != last; ++first) sorted.push_back(*first);
+    if (sorted.empty()) return;
+    this->_sort(sorted);
+    this->_rebuild(sorted);
+  };
+
+  const_iterator begin() const { return this->_iterator(0, 0); };
+  const_iterator end() const { return this->_iterator(this->_segments(), 0); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(this->end());
+  };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(this->begin());
+  };
+
+  size_type size() const { return this->_size; };
+  bool empty() const { return this->_size == 0; };
+  size_type max_size() const { return this->_slots.max_size(); };
+
+  /**
+   * @brief Number of slots, occupied or not.
+   */
+  size_type capacity() const { return this->_slots.size(); };
+
+  /**
+   * @brief Slots per segment.
+   */
+  size_type segment_size() const { return this->_segment_size; };
+
+  value_compare value_comp() const { return this->_comp; };
+  allocator_type get_allocator() const { return this->_slots.get_allocator(); };
+
+  /**
+   * @brief Insert val after the elements equal to it.
+   *
+   * @return an iterator to the inserted element
+   */
+  iterator insert(const value_type& val) {
+    size_type segment = this->_segment_for(val, true);
+    size_type start = segment * this->_segment_size;
+    size_type count = this->_counts[segment];
+    size_type offset = this->_upper_offset(start, count, val);
+    if (count < this->_segment_size) {
+      for (size_type i = start + count; i > start + offset; --i) {
+        this->_slots[i] = this->_slots[i - 1];
+      }
+      this->_slots[start + offset] = val;
+      if (offset == 0) this->_heads[segment] = val;
+      ++this->_counts[segment];
+      ++this->_size;
+      return this->_iterator(segment, offset);
+    }
+    return this->_insert_rebalance(segment, offset, val);
+  };
+
+  /**
+   * @brief Insert every element of [first,last).
+   */
+  template < class InputIterator >
+  void insert(InputIterator first, InputIterator last,
+              typename ft::enable_if<
+                  !ft::is_integral< InputIterator >::value >::type* =
+                  u_nullptr) {
+    for (; first != last; ++first) this->insert(*first);
+  };
+
+  /**
+   * @brief Remove the element at position.
+   */
+  void erase(const_iterator position) {
+    size_type segment = position.segment();
+    size_type start = segment * this->_segment_size;
+    size_type count = this->_counts[segment];
+    for (size_type i = start + position.offset(); i + 1 < start + count; ++i) {
+      this->_slots[i] = this->_slots[i + 1];
+    }
+    this->_counts[segment] = --count;
+    if (position.offset() == 0 && count > 0) {
+      this->_heads[segment] = this->_slots[start];
+    }
+    --this->_size;
+    if (this->_height > 0 && count < this->_segment_size / 8) {
+      this->_erase_rebalance(segment);
+    }
+  };
+
+  /**
+   * @brief Remove every element equal to val.
+   *
+   * @return the number of elements removed
+   */
+  size_type erase(const value_type& val) {
+    size_type removed = 0;
+    for (const_iterator it = this->find(val); it != this->end();
+         it = this->find(val)) {
+      this->erase(it);
+      ++removed;
+    }
+    return removed;
+  };
+
+  void clear() {
+    pma tmp(this->_comp, this->get_allocator());
+    this->swap(tmp);
+  };
+
+  void swap(pma& x) {
+    ft::swap(this->_comp, x._comp);
+    this->_slots.swap(x._slots);
+    this->_counts.swap(x._counts);
+    this->_heads.swap(x._heads);
+    ft::swap(this->_segment_size, x._segment_size);
+    ft::swap(this->_size, x._size);
+    ft::swap(this->_height, x._height);
+  };
+
+  /**
+   * @brief First element not less than val.
+   */
+  const_iterator lower_bound(const value_type& val) const {
+    size_type segment = this->_segment_for(val, false);
+    size_type start = segment * this->_segment_size;
+    return this->_iterator(
+        segment,
+        ft::lower_bound(this->_slots.begin() + start,
+                        this->_slots.begin() + start + this->_counts[segment],
+                        val, this->_comp) -
+            (this->_slots.begin() + start));
+  };
+
+  /**
+   * @brief First element greater than val.
+   */
+  const_iterator upper_bound(const value_type& val) const {
+    size_type segment = this->_segment_for(val, true);
+    size_type start = segment * this->_segment_size;
+    return this->_iterator(
+        segment, this->_upper_offset(start, this->_counts[segment], val));
+  };
+
+  ft::pair< const_iterator, const_iterator > equal_range(
+      const value_type& val) const {
+    return ft::make_pair(this->lower_bound(val), this->upper_bound(val));
+  };
+
+  const_iterator find(const value_type& val) const {
+    const_iterator it = this->lower_bound(val);
+    if (it == this->end() || this->_comp(val, *it)) return this->end();
+    return it;
+  };
+
+  size_type count(const value_type& val) const {
+    size_type n = 0;
+    for (const_iterator it = this->lower_bound(val);
+         it != this->end() && !this->_comp(val, *it); ++it) {
+      ++n;
+    }
+    return n;
+  };
+
+  /**
+   * @brief The elements in [lo, hi), as a range for views.hpp.
+   */
+  range_type range(const value_type& lo, const value_type& hi) const {
+    return range_type(this->lower_bound(lo), this->lower_bound(hi));
+  };
+
+ private:
+  size_type _segments() const { return this->_counts.size(); };
+
+  const_iterator _iterator(size_type segment, size_type offset) const {
+    return const_iterator(this->_slots.data(), this->_counts.data(),
+                          this->_segment_size, this->_segments(), segment,
+                          offset);
+  };
+
+  /**
+   * @brief The segment an element goes in: the last one whose head is not
+   * greater than val (upper) or is less than val (lower), or the first.
+   * Every segment holds an element unless the array has only one.
+   */
+  size_type _segment_for(const value_type& val, bool upper) const {
+    size_type lo = 0;
+    size_type hi = this->_segments();
+    while (hi - lo > 1) {
+      size_type mid = lo + (hi - lo) / 2;
+      const value_type& head = this->_heads[mid];
+      if (upper ? !this->_comp(val, head) : this->_comp(head, val)) {
+        lo = mid;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  };
+
+  size_type _upper_offset(size_type start, size_type count,
+                          const value_type& val) const {
+    return ft::upper_bound(this->_slots.begin() + start,
+                           this->_slots.begin() + start + count, val,
+                           this->_comp) -
+           (this->_slots.begin() + start);
+  };
+
+  /**
+   * @brief Upper density bound of a window at level d: 1 for a segment
+   * down to 3/4 for the root.
+   */
+  bool _within_upper(size_type n, size_type level, size_type segments) const {
+    // n <= (1 - level / (4 * height)) * slots, in integers
+    size_type slots = segments * this->_segment_size;
+    return 4 * this->_height * n <= (4 * this->_height - level) * slots;
+  };
+
+  /**
+   * @brief Lower density bound of a window at level d: 1/8 for a segment
+   * up to 1/4 for the root.
+   */
+  bool _within_lower(size_type n, size_type level, size_type segments) const {
+    // n >= (1 / 8 + level / (8 * height)) * slots, in integers
+    size_type slots = segments * this->_segment_size;
+    return 8 * this->_height * n >= (this->_height + level) * slots;
+  };
+
+  /**
+   * @brief The target segment is full: spread the smallest window with
+   * room for one more, val merged in, or grow the array.
+   */
+  iterator _insert_rebalance(size_type segment, size_type offset,
+                             const value_type& val) {
+    for (size_type level = 1; level <= this->_height; ++level) {
+      size_type segments = size_type(1) << level;
+      size_type first = segment & ~(segments - 1);
+      size_type n = 1;
+      for (size_type s = first; s < first + segments; ++s) {
+        n += this->_counts[s];
+      }
+      if (!this->_within_upper(n, level, segments)) continue;
+      _slot_container window(this->get_allocator());
+      window.reserve(n);
+      size_type index = this->_gather(first, segment, segments, window);
+      index += offset;
+      window.insert(window.begin() + index, val);
+      this->_spread(first, segments, window);
+      ++this->_size;
+      return this->_locate(first, index);
+    }
+    _slot_container all(this->get_allocator());
+    all.reserve(this->_size + 1);
+    size_type index = this->_gather(0, segment, this->_segments(), all);
+    index += offset;
+    all.insert(all.begin() + index, val);
+    this->_rebuild(all);
+    return this->_locate(0, index);
+  };
+
+  /**
+   * @brief segment dropped under its lower bound: spread the smallest
+   * window that is within its own, or rebuild the array.
+   */
+  void _erase_rebalance(size_type segment) {
+    for (size_type level = 1; level <= this->_height; ++level) {
+      size_type segments = size_type(1) << level;
+      size_type first = segment & ~(segments - 1);
+      size_type n = 0;
+      for (size_type s = first; s < first + segments; ++s) {
+        n += this->_counts[s];
+      }
+      if (!this->_within_lower(n, level, segments)) continue;
+      _slot_container window(this->get_allocator());
+      window.reserve(n);
+      this->_gather(first, segment, segments, window);
+      this->_spread(first, segments, window);
+      return;
+    }
+    _slot_container all(this->get_allocator());
+    all.reserve(this->_size);
+    this->_gather(0, segment, this->_segments(), all);
+    this->_rebuild(all);
+  };
+
+  /**
+   * @brief Append the elements of segments [first, first + segments) to
+   * out, in order.
+   *
+   * @return the number of them before segment mark
+   */
+  size_type _gather(size_type first, size_type mark, size_type segments,
+                    _slot_container& out) const {
+    size_type before = 0;
+    for (size_type s = first; s < first + segments; ++s) {
+      if (s == mark) before = out.size();
+      size_type start = s * this->_segment_size;
+      for (size_type i = 0; i < this->_counts[s]; ++i) {
+        out.push_back(this->_slots[start + i]);
+      }
+    }
+    return before;
+  };
+
+  /**
+   * @brief Lay elements out evenly over segments [first, first + segments),
+   * the first n % segments of them taking one extra.
+   */
+  void _spread(size_type first, size_type segments,
+               const _slot_container& elements) {
+    size_type base = elements.size() / segments;
+    size_type extra = elements.size() % segments;
+    size_type next = 0;
+    for (size_type s = first; s < first + segments; ++s) {
+      size_type count = base + (s - first < extra ? 1 : 0);
+      size_type start = s * this->_segment_size;
+      for (size_type i = 0; i < count; ++i) {
+        this->_slots[start + i] = elements[next++];
+      }
+      this->_counts[s] = count;
+      if (count > 0) this->_heads[s] = this->_slots[start];
+    }
+  };
+
+  /**
+   * @brief The index-th element laid out from segment first by _spread.
+   */
+  iterator _locate(size_type first, size_type index) const {
+    size_type s = first;
+    while (index >= this->_counts[s]) index -= this->_counts[s++];
+    return this->_iterator(s, index);
+  };
+
+  /**
+   * @brief Stable bottom-up merge sort by _comp, runs of width 1, 2, 4, ...
+   * merged back and forth between elements and one buffer.
+   */
+  void _sort(_slot_container& elements) const {
+    size_type n = elements.size();
+    _slot_container buffer(elements);
+    _slot_container* from = &elements;
+    _slot_container* to = &buffer;
+    for (size_type width = 1; width < n; width *= 2) {
+      for (size_type lo = 0; lo < n; lo += 2 * width) {
+        size_type mid = n - lo < width ? n : lo + width;
+        size_type hi = n - mid < width ? n : mid + width;
+        size_type i = lo;
+        size_type j = mid;
+        for (size_type k = lo; k < hi; ++k) {
+          // ties take the left run, which keeps equal elements in order
+          if (j == hi || (i < mid && !this->_comp((*from)[j], (*from)[i]))) {
+            (*to)[k] = (*from)[i++];
+          } else {
+            (*to)[k] = (*from)[j++];
+          }
+        }
+      }
+      ft::swap(from, to);
+    }
+    if (from != &elements) elements.swap(buffer);
+  };
+
+  /**
+   * @brief Reallocate for the sorted elements at density at most 1/2, with
+   * segments of about log2(capacity) slots, and spread them evenly.
+   */
+  void _rebuild(const _slot_container& elements) {
+    size_type capacity = _min_segment_size;
+    while (capacity < 2 * elements.size()) capacity <<= 1;
+    size_type segment_size = _min_segment_size;
+    size_type log = 0;
+    while ((size_type(1) << log) < capacity) ++log;
+    while (segment_size < log) segment_size <<= 1;
+    size_type segments = capacity / segment_size;
+
+    this->_segment_size = segment_size;
+    this->_height = 0;
+    while ((size_type(1) << this->_height) < segments) ++this->_height;
+    this->_slots.assign(capacity, value_type());
+    this->_counts.assign(segments, 0);
+    this->_heads.assign(segments, value_type());
+    this->_spread(0, segments, elements);
+    this->_size = elements.size();
+  };
+};
+
+template < class T, class Compare, class _Alloc >
+const typename pma< T, Compare, _Alloc >::size_type
+    pma< T, Compare, _Alloc >::_min_segment_size;
+
+template < class T, class Compare, class Alloc >
+bool operator==(const pma< T, Compare, Alloc >& lhs,
+                const pma< T, Compare, Alloc >& rhs) {
+  return lhs.size() == rhs.size() &&
+         ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+};
+
+template < class T, class Compare, class Alloc >
+bool operator!=(const pma< T, Compare, Alloc >& lhs,
+                const pma< T, Compare, Alloc >& rhs) {
+  return !(lhs == rhs);
+};
+
+template < class T, class Compare, class Alloc >
+void swap(pma< T, Compare, Alloc >& x, pma< T, Compare, Alloc >& y) {
+  x.swap(y);
+};
+
+}  // namespace ft
+
+#endif  // FT__PMA_HPP
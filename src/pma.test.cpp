@@ -0,0 +1,195 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/24
+ * @file src/pma.test.cpp
+ */
+
+#include "pma.hpp"
+
+#include <cassert>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <set>
+#include <string>
+
+namespace {
+
+template < class T, class Compare >
+bool pma_test_same(const ft::pma< T, Compare >& pma,
+                   const std::multiset< T, Compare >& ref) {
+  if (pma.size() != ref.size()) return false;
+  typename std::multiset< T, Compare >::const_iterator r = ref.begin();
+  for (typename ft::pma< T, Compare >::const_iterator it = pma.begin();
+       it != pma.end(); ++it, ++r) {
+    if (*it != *r) return false;
+  }
+  return true;
+}
+
+/* orders pairs by their first member only */
+struct pma_test_first_less {
+  bool operator()(const ft::pair< int, int >& lhs,
+                  const ft::pair< int, int >& rhs) const {
+    return lhs.first < rhs.first;
+  }
+};
+
+}  // namespace
+
+void test_pma_insert(void) {
+  std::cout << "\t insert" << std::endl;
+
+  ft::pma< int > pma;
+  assert(pma.empty() && pma.begin() == pma.end());
+  ft::pma< int >::iterator it = pma.insert(5);
+  assert(*it == 5 && pma.size() == 1 && pma.begin() == it);
+
+  // ascending, descending and random runs each force rebalances and
+  // rebuilds at different ends of the array
+  std::multiset< int > ref;
+  ref.insert(5);
+  for (int i = 0; i < 2000; ++i) {
+    int val = i % 3 == 0 ? i : i % 3 == 1 ? -i : std::rand() % 1000;
+    it = pma.insert(val);
+    ref.insert(val);
+    assert(*it == val);
+    // equal elements go after the ones already there
+    ft::pma< int >::iterator next = it;
+    ++next;
+    assert(next == pma.end() || *next > val);
+  }
+  assert(pma_test_same(pma, ref));
+  assert(4 * pma.size() <= 3 * pma.capacity());
+  assert(pma.capacity() % pma.segment_size() == 0);
+
+  // a greater-than ordering of strings
+  ft::pma< std::string, std::greater< std::string > > words;
+  std::multiset< std::string, std::greater< std::string > > word_ref;
+  for (int i = 0; i < 300; ++i) {
+    std::string word(1 + i % 5, static_cast< char >('a' + (i * 7) % 26));
+    words.insert(word);
+    word_ref.insert(word);
+  }
+  assert(pma_test_same(words, word_ref));
+  assert(words.begin()->size() > 0 && *words.rbegin() == *word_ref.rbegin());
+
+  int values[] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+  ft::pma< int > built(values, values + 11);
+  std::multiset< int > built_ref(values, values + 11);
+  assert(pma_test_same(built, built_ref));
+
+  // the range constructor keeps equal elements in range order, as insert
+  ft::pair< int, int > pairs[500];
+  ft::pma< ft::pair< int, int >, pma_test_first_less > inserted;
+  for (int i = 0; i < 500; ++i) {
+    pairs[i] = ft::make_pair(std::rand() % 20, i);
+    inserted.insert(pairs[i]);
+  }
+  ft::pma< ft::pair< int, int >, pma_test_first_less > stable(pairs,
+                                                              pairs + 500);
+  assert(stable == inserted);
+}
+
+void test_pma_erase(void) {
+  std::cout << "\t erase" << std::endl;
+
+  ft::pma< int > pma;
+  std::multiset< int > ref;
+  for (int i = 0; i < 3000; ++i) {
+    int val = std::rand() % 500;
+    pma.insert(val);
+    ref.insert(val);
+  }
+  std::size_t full = pma.capacity();
+  // erase in random order, down to nothing, shrinking on the way
+  while (!ref.empty()) {
+    int val = std::rand() % 500;
+    ft::pma< int >::const_iterator it = pma.find(val);
+    std::multiset< int >::iterator r = ref.find(val);
+    assert((it == pma.end()) == (r == ref.end()));
+    if (r == ref.end()) continue;
+    pma.erase(it);
+    ref.erase(r);
+    if (ref.size() % 97 == 0) assert(pma_test_same(pma, ref));
+  }
+  assert(pma.empty() && pma.begin() == pma.end());
+  assert(pma.capacity() < full);
+
+  // erase by value removes every copy
+  for (int i = 0; i < 200; ++i) pma.insert(i % 10);
+  assert(pma.count(4) == 20);
+  assert(pma.erase(4) == 20 && pma.size() == 180);
+  assert(pma.count(4) == 0 && pma.erase(4) == 0);
+
+  ft::pma< int > other;
+  other.insert(1);
+  ft::swap(pma, other);
+  assert(pma.size() == 1 && other.size() == 180);
+  other.clear();
+  assert(other.empty() && other != pma);
+  other.insert(1);
+  assert(other == pma);
+}
+
+void test_pma_search(void) {
+  std::cout << "\t search" << std::endl;
+
+  ft::pma< int > pma;
+  std::multiset< int > ref;
+  for (int i = 0; i < 1500; ++i) {
+    // even values only, several copies of some
+    int val = 2 * (std::rand() % 600);
+    pma.insert(val);
+    ref.insert(val);
+  }
+  for (int val = -2; val < 1202; ++val) {
+    ft::pma< int >::const_iterator lo = pma.lower_bound(val);
+    ft::pma< int >::const_iterator hi = pma.upper_bound(val);
+    std::multiset< int >::iterator rlo = ref.lower_bound(val);
+    std::multiset< int >::iterator rhi = ref.upper_bound(val);
+    assert((lo == pma.end()) == (rlo == ref.end()));
+    assert((hi == pma.end()) == (rhi == ref.end()));
+    if (rlo != ref.end()) assert(*lo == *rlo);
+    if (rhi != ref.end()) assert(*hi == *rhi);
+    assert(pma.count(val) == ref.count(val));
+    assert((pma.find(val) == pma.end()) == (ref.find(val) == ref.end()));
+    ft::pair< ft::pma< int >::const_iterator, ft::pma< int >::const_iterator >
+        eq = pma.equal_range(val);
+    assert(eq.first == lo && eq.second == hi);
+  }
+
+  // a range walks forward and backward over the elements in [lo, hi)
+  ft::pma< int >::range_type range = pma.range(100, 300);
+  assert(range.size() == static_cast< std::size_t >(std::distance(
+                              ref.lower_bound(100), ref.lower_bound(300))));
+  assert(range.empty() || range.front() >= 100);
+  int prev = 100;
+  for (ft::pma< int >::const_iterator it = range.begin(); it != range.end();
+       ++it) {
+    assert(*it >= prev && *it < 300);
+    prev = *it;
+  }
+  ft::pma< int >::const_iterator back = pma.end();
+  std::multiset< int >::reverse_iterator rback = ref.rbegin();
+  for (std::size_t i = 0; i < ref.size(); ++i, ++rback) {
+    --back;
+    assert(*back == *rback);
+  }
+  assert(back == pma.begin());
+  assert(pma.range(301, 301).empty());
+}
+
+void test_pma(void) {
+  std::cout << "Test: pma" << std::endl;
+  test_pma_insert();
+  test_pma_erase();
+  test_pma_search();
+}
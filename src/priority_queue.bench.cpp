@@ -0,0 +1,191 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/21
+ * @file src/priority_queue.bench.cpp
+ */
+
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <vector>
+
+#include "bench.hpp"
+#include "priority_queue.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace {
+
+/* 1M random keys pushed then popped, and a 64k node sparse graph */
+const std::size_t g_items = 1 << 20;
+const std::size_t g_nodes = 1 << 16;
+const std::size_t g_degree = 8;
+
+/**
+ * @brief Pushes every key, then pops them all; the two phases are reported
+ * apart since arity moves cost from one to the other.
+ */
+template < class Queue >
+void pq_bench_run(const char* name, const ft::vector< int >& keys) {
+  Queue q;
+  double start = bench_now();
+  for (std::size_t i = 0; i < keys.size(); ++i) q.push(keys[i]);
+  double pushed = bench_now();
+  std::size_t sum = 0;
+  for (std::size_t i = 0; !q.empty(); ++i) {
+    sum += static_cast< std::size_t >(q.top()) * (i & 7);
+    q.pop();
+  }
+  double popped = bench_now();
+  std::cout << "\t " << name << std::endl;
+  bench_report("  push", pushed - start, keys.size());
+  bench_report("  pop", popped - pushed, keys.size());
+  bench_sink(sum);
+}
+
+/* adjacency as one array: node n owns edges [n * g_degree, +g_degree) */
+struct pq_bench_edge {
+  std::size_t to;
+  unsigned int weight;
+};
+
+const unsigned int g_infinity = static_cast< unsigned int >(-1);
+
+/**
+ * @brief Dijkstra with a binary std heap: relaxations push duplicates and
+ * stale entries are skipped on pop.
+ */
+std::size_t pq_bench_dijkstra_lazy(const ft::vector< pq_bench_edge >& edges,
+                                   ft::vector< unsigned int >& dist) {
+  typedef ft::pair< unsigned int, std::size_t > entry;
+  std::priority_queue< entry, std::vector< entry >, std::greater< entry > > q;
+  std::size_t pops = 0;
+  dist.assign(g_nodes, g_infinity);
+  dist[0] = 0;
+  q.push(entry(0, 0));
+  while (!q.empty()) {
+    entry top = q.top();
+    q.pop();
+    ++pops;
+    if (top.first != dist[top.second]) continue;
+    for (std::size_t e = top.second * g_degree;
+         e < (top.second + 1) * g_degree; ++e) {
+      unsigned int d = top.first + edges[e].weight;
+      if (d < dist[edges[e].to]) {
+        dist[edges[e].to] = d;
+        q.push(entry(d, edges[e].to));
+      }
+    }
+  }
+  return pops;
+}
+
+/**
+ * @brief Dijkstra with decrease_key: one queue entry per reached node.
+ */
+template < std::size_t Arity >
+std::size_t pq_bench_dijkstra_handles(
+    const ft::vector< pq_bench_edge >& edges,
+    ft::vector< unsigned int >& dist) {
+  typedef ft::mutable_priority_queue< ft::pair< unsigned int, std::size_t >,
+                                      std::greater< ft::pair< unsigned int,
+                                                              std::size_t > >,
+                                      Arity >
+      queue_type;
+  typedef typename queue_type::value_type entry;
+  queue_type q;
+  ft::vector< std::size_t > handle(g_nodes, 0);
+  ft::vector< bool > queued(g_nodes, false);
+  std::size_t pops = 0;
+  dist.assign(g_nodes, g_infinity);
+  dist[0] = 0;
+  handle[0] = q.push(entry(0, 0));
+  queued[0] = true;
+  while (!q.empty()) {
+    entry top = q.top();
+    q.pop();
+    queued[top.second] = false;
+    ++pops;
+    for (std::size_t e = top.second * g_degree;
+         e < (top.second + 1) * g_degree; ++e) {
+      unsigned int d = top.first + edges[e].weight;
+      std::size_t to = edges[e].to;
+      if (d >= dist[to]) continue;
+      dist[to] = d;
+      if (queued[to]) {
+        q.decrease_key(handle[to], entry(d, to));
+      } else {
+        handle[to] = q.push(entry(d, to));
+        queued[to] = true;
+      }
+    }
+  }
+  return pops;
+}
+
+}  // namespace
+
+void bench_priority_queue(void) {
+  std::cout << "Bench: priority_queue" << std::endl;
+
+  std::srand(42);
+  ft::vector< int > keys(g_items);
+  for (std::size_t i = 0; i < g_items; ++i) keys[i] = std::rand();
+
+  pq_bench_run< std::priority_queue< int > >("std::priority_queue",
+                                             keys);
+  pq_bench_run<
+      ft::priority_queue< int, ft::vector< int >, std::less< int >, 2 > >(
+      "ft::priority_queue<2>", keys);
+  pq_bench_run<
+      ft::priority_queue< int, ft::vector< int >, std::less< int >, 4 > >(
+      "ft::priority_queue<4>", keys);
+  pq_bench_run<
+      ft::priority_queue< int, ft::vector< int >, std::less< int >, 8 > >(
+      "ft::priority_queue<8>", keys);
+
+  double start = bench_now();
+  ft::priority_queue< int > built(std::less< int >(), keys);
+  bench_report("ft::priority_queue<4> O(n) build", bench_now() - start,
+               g_items);
+  bench_sink(static_cast< std::size_t >(built.top()));
+
+  ft::vector< pq_bench_edge > edges(g_nodes * g_degree);
+  for (std::size_t n = 0; n < g_nodes; ++n) {
+    for (std::size_t k = 0; k < g_degree; ++k) {
+      // a ring keeps the graph connected, the rest are random shortcuts
+      edges[n * g_degree + k].to =
+          k == 0 ? (n + 1) % g_nodes : std::rand() % g_nodes;
+      edges[n * g_degree + k].weight = 1 + std::rand() % 1000;
+    }
+  }
+  ft::vector< unsigned int > dist;
+  std::size_t pops;
+
+  start = bench_now();
+  pops = pq_bench_dijkstra_lazy(edges, dist);
+  bench_report("dijkstra, std heap with stale entries", bench_now() - start,
+               g_nodes);
+  std::cout << "\t\t pops: " << pops << std::endl;
+  std::size_t check = dist[g_nodes - 1];
+
+  start = bench_now();
+  pops = pq_bench_dijkstra_handles< 2 >(edges, dist);
+  bench_report("dijkstra, mutable<2> decrease_key", bench_now() - start,
+               g_nodes);
+
+  start = bench_now();
+  pops = pq_bench_dijkstra_handles< 4 >(edges, dist);
+  bench_report("dijkstra, mutable<4> decrease_key", bench_now() - start,
+               g_nodes);
+  std::cout << "\t\t pops: " << pops << std::endl;
+  bench_sink(check + dist[g_nodes - 1]);
+}
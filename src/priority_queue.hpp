@@ -0,0 +1,324 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/21
+ * @file src/priority_queue.hpp
+ */
+
+#if !defined(FT__PRIORITY_QUEUE_HPP)
+#define FT__PRIORITY_QUEUE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+
+#include "algorithm.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+/**
+ * @brief Container adaptor keeping its greatest element on top, as
+ * std::priority_queue, over an Arity-ary implicit heap.
+ *
+ * A node's Arity children sit next to each other in the container, so with
+ * a 4 or 8 wide heap a sift down compares a whole cache line of children per
+ * level and walks a tree half or a third as deep as the binary one. push gets
+ * cheaper with the height; pop trades the lost levels for wider compares.
+ *
+ * @tparam T Type of the elements.
+ * @tparam Container random access container with front, push_back and
+ * pop_back, defaults to ft::vector.
+ * @tparam Compare strict weak ordering, defaults to `less<T>` (a max heap).
+ * @tparam Arity children per node, 2 gives the classic binary heap.
+ */
+template < class T, class Container = ft::vector< T >,
+           class Compare = std::less< typename Container::value_type >,
+           std::size_t Arity = 4 >
+class priority_queue {
+ public:
+  /* The first template parameter (T) */
+  typedef typename Container::value_type value_type;
+  /* The second template parameter (Container) */
+  typedef Container container_type;
+  /* The third template parameter (Compare) */
+  typedef Compare value_compare;
+  /* an unsigned integral type */
+  typedef typename Container::size_type size_type;
+  typedef typename Container::reference reference;
+  typedef typename Container::const_reference const_reference;
+
+  /* children per node */
+  static const std::size_t arity = Arity;
+
+ protected:
+  Container c;
+  Compare comp;
+
+ public:
+  /**
+   * @brief initialize constructor
+   * Takes a copy of ctnr and makes it a heap in O(n).
+   */
+  explicit priority_queue(const Compare& comp = Compare(),
+                          const Container& ctnr = Container())
+      : c(ctnr), comp(comp) {
+    ft::_heap_make< Arity >(this->c.begin(), this->c.end(), this->comp);
+  };
+
+  /**
+   * @brief range constructor
+   * Appends [first,last) to a copy of ctnr and makes the whole a heap in
+   * O(n), instead of n pushes in O(n log n).
+   */
+  template < class InputIterator >
+  priority_queue(InputIterator first, InputIterator last,
+                 const Compare& comp = Compare(),
+                 const Container& ctnr = Container(),
+                 typename ft::enable_if<
+                     !ft::is_integral< InputIterator >::value >::type* =
+                     u_nullptr)
+      : c(ctnr), comp(comp) {
+    this->c.insert(this->c.end(), first, last);
+    ft::_heap_make< Arity >(this->c.begin(), this->c.end(), this->comp);
+  };
+
+  bool empty(void) const { return this->c.empty(); };
+
+  size_type size(void) const { return this->c.size(); };
+
+  /**
+   * @brief Returns a constant reference to the greatest element.
+   */
+  const_reference top(void) const { return this->c.front(); };
+
+  /**
+   * @brief Inserts val, O(log n / log Arity) moves.
+   */
+  void push(const value_type& val) {
+    this->c.push_back(val);
+    ft::_heap_push< Arity >(this->c.begin(), this->c.end(), this->comp);
+  };
+
+  /**
+   * @brief Removes the greatest element.
+   */
+  void pop(void) {
+    ft::_heap_pop< Arity >(this->c.begin(), this->c.end(), this->comp);
+    this->c.pop_back();
+  };
+
+  void swap(priority_queue& x) {
+    ft::swap(this->c, x.c);
+    ft::swap(this->comp, x.comp);
+  };
+};
+
+template < class T, class Container, class Compare, std::size_t Arity >
+const std::size_t priority_queue< T, Container, Compare, Arity >::arity;
+
+template < class T, class Container, class Compare, std::size_t Arity >
+void swap(priority_queue< T, Container, Compare, Arity >& x,
+          priority_queue< T, Container, Compare, Arity >& y) {
+  x.swap(y);
+};
+
+/**
+ * @brief Arity-ary heap whose elements can be reprioritized in place.
+ *
+ * push returns a handle that stays valid until its element leaves the queue.
+ * decrease_key moves an element toward the top in O(log n), as Dijkstra or
+ * Prim need, instead of pushing a duplicate and skipping stale entries on
+ * pop. Heap slots hold the value next to its handle so a sift stays in one
+ * array; a second array maps each handle to its current slot. Handles of
+ * popped elements are recycled.
+ *
+ * @tparam T Type of the elements.
+ * @tparam Compare strict weak ordering, defaults to `less<T>` (a max heap).
+ * With `greater<T>` the top is the smallest key and decrease_key lowers it.
+ * @tparam Arity children per node.
+ */
+template < class T, class Compare = std::less< T >, std::size_t Arity = 4 >
+class mutable_priority_queue {
+ public:
+  typedef T value_type;
+  typedef Compare value_compare;
+  typedef std::size_t size_type;
+  typedef const T& const_reference;
+  /* stable name of an element while it is queued */
+  typedef std::size_t handle_type;
+
+ private:
+  typedef ft::pair< T, handle_type > _slot_type;
+
+  /* position of a handle that is not queued */
+  static const size_type _npos = static_cast< size_type >(-1);
+
+  ft::vector< _slot_type > _heap;
+  ft::vector< size_type > _pos;
+  ft::vector< handle_type > _free;
+  Compare _comp;
+
+ public:
+  explicit mutable_priority_queue(const Compare& comp = Compare())
+      : _heap(), _pos(), _free(), _comp(comp){};
+
+  bool empty(void) const { return this->_heap.empty(); };
+
+  size_type size(void) const { return this->_heap.size(); };
+
+  const_reference top(void) const { return this->_heap.front().first; };
+
+  handle_type top_handle(void) const { return this->_heap.front().second; };
+
+  /**
+   * @brief Whether h names an element still in the queue.
+   */
+  bool contains(handle_type h) const {
+    return h < this->_pos.size() && this->_pos[h] != _npos;
+  };
+
+  /**
+   * @brief Value of the queued element h.
+   */
+  const_reference value(handle_type h) const {
+    return this->_heap[this->_pos[h]].first;
+  };
+
+  /**
+   * @brief Inserts val and returns its handle.
+   */
+  handle_type push(const value_type& val) {
+    handle_type h;
+    if (this->_free.empty()) {
+      h = this->_pos.size();
+      this->_pos.push_back(_npos);
+    } else {
+      h = this->_free.back();
+      this->_free.pop_back();
+    }
+    this->_heap.push_back(_slot_type(val, h));
+    this->_sift_up(this->_heap.size() - 1, _slot_type(val, h));
+    return h;
+  };
+
+  /**
+   * @brief Removes the top element; its handle may be reused.
+   */
+  void pop(void) { this->erase(this->top_handle()); };
+
+  /**
+   * @brief Removes the queued element h.
+   */
+  void erase(handle_type h) {
+    size_type hole = this->_pos[h];
+    _slot_type last = this->_heap.back();
+    this->_heap.pop_back();
+    this->_pos[h] = _npos;
+    this->_free.push_back(h);
+    if (hole < this->_heap.size()) this->_reseat(hole, last);
+  };
+
+  /**
+   * @brief Replaces the value of h with one that does not compare less, and
+   * sifts it toward the top. With `greater<T>` that is a smaller key.
+   *
+   * @exception std::invalid_argument val compares less than the current
+   * value; use update to move an element either way.
+   */
+  void decrease_key(handle_type h, const value_type& val) {
+    size_type hole = this->_pos[h];
+    if (this->_comp(val, this->_heap[hole].first))
+      throw std::invalid_argument("ft::mutable_priority_queue");
+    this->_sift_up(hole, _slot_type(val, h));
+  };
+
+  /**
+   * @brief Replaces the value of h with val, sifting it up or down.
+   */
+  void update(handle_type h, const value_type& val) {
+    this->_reseat(this->_pos[h], _slot_type(val, h));
+  };
+
+  void clear(void) {
+    this->_heap.clear();
+    this->_pos.clear();
+    this->_free.clear();
+  };
+
+  void swap(mutable_priority_queue& x) {
+    this->_heap.swap(x._heap);
+    this->_pos.swap(x._pos);
+    this->_free.swap(x._free);
+    ft::swap(this->_comp, x._comp);
+  };
+
+ private:
+  void _place(size_type hole, const _slot_type& slot) {
+    this->_heap[hole] = slot;
+    this->_pos[slot.second] = hole;
+  };
+
+  /**
+   * @brief Puts slot at hole, sifting whichever way the heap order needs.
+   */
+  void _reseat(size_type hole, const _slot_type& slot) {
+    if (hole > 0 &&
+        this->_comp(this->_heap[(hole - 1) / Arity].first, slot.first)) {
+      this->_sift_up(hole, slot);
+    } else {
+      this->_sift_down(hole, slot);
+    }
+  };
+
+  void _sift_up(size_type hole, const _slot_type& slot) {
+    while (hole > 0) {
+      size_type parent = (hole - 1) / Arity;
+      if (!this->_comp(this->_heap[parent].first, slot.first)) break;
+      this->_place(hole, this->_heap[parent]);
+      hole = parent;
+    }
+    this->_place(hole, slot);
+  };
+
+  void _sift_down(size_type hole, const _slot_type& slot) {
+    const size_type len = this->_heap.size();
+    for (;;) {
+      size_type child = hole * Arity + 1;
+      if (child >= len) break;
+      size_type last = len - child > Arity ? child + Arity : len;
+      size_type best = child;
+      for (++child; child < last; ++child) {
+        if (this->_comp(this->_heap[best].first, this->_heap[child].first))
+          best = child;
+      }
+      if (!this->_comp(slot.first, this->_heap[best].first)) break;
+      this->_place(hole, this->_heap[best]);
+      hole = best;
+    }
+    this->_place(hole, slot);
+  };
+};
+
+template < class T, class Compare, std::size_t Arity >
+const typename mutable_priority_queue< T, Compare, Arity >::size_type
+    mutable_priority_queue< T, Compare, Arity >::_npos;
+
+template < class T, class Compare, std::size_t Arity >
+void swap(mutable_priority_queue< T, Compare, Arity >& x,
+          mutable_priority_queue< T, Compare, Arity >& y) {
+  x.swap(y);
+};
+
+}  // namespace ft
+
+#endif  // FT__PRIORITY_QUEUE_HPP
@@ -0,0 +1,193 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/21
+ * @file src/priority_queue.test.cpp
+ */
+
+#include "priority_queue.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <stdexcept>
+#include <vector>
+
+#include "algorithm.hpp"
+#include "vector.hpp"
+
+namespace {
+
+int pq_test_value(int i) { return (i * 7919) % 1009; }
+
+/**
+ * @brief Pops q empty, checking each top against std::priority_queue.
+ */
+template < class Queue, class Compare >
+void pq_test_drain(Queue& q, const std::vector< int >& values, Compare comp) {
+  std::priority_queue< int, std::vector< int >, Compare > ref(
+      values.begin(), values.end(), comp);
+  assert(q.size() == ref.size());
+  while (!ref.empty()) {
+    assert(!q.empty() && q.top() == ref.top());
+    q.pop();
+    ref.pop();
+  }
+  assert(q.empty());
+}
+
+}  // namespace
+
+void test_priority_queue_heap(void) {
+  std::cout << "\t heap" << std::endl;
+
+  std::vector< int > values;
+  for (int i = 0; i < 200; ++i) values.push_back(pq_test_value(i));
+
+  ft::vector< int > heap(values.begin(), values.end());
+  ft::make_heap(heap.begin(), heap.end());
+  assert(ft::is_heap(heap.begin(), heap.end()));
+  assert(heap.front() == *std::max_element(values.begin(), values.end()));
+
+  ft::pop_heap(heap.begin(), heap.end());
+  assert(ft::is_heap(heap.begin(), heap.end() - 1));
+  assert(heap.back() == *std::max_element(values.begin(), values.end()));
+  heap.back() = 2000;
+  ft::push_heap(heap.begin(), heap.end());
+  assert(heap.front() == 2000 && ft::is_heap(heap.begin(), heap.end()));
+
+  std::vector< int > sorted(values);
+  ft::make_heap(sorted.begin(), sorted.end(), std::greater< int >());
+  assert(!ft::is_heap(sorted.begin(), sorted.end()));
+  assert(ft::is_heap(sorted.begin(), sorted.end(), std::greater< int >()));
+  ft::sort_heap(sorted.begin(), sorted.end(), std::greater< int >());
+  std::vector< int > expected(values);
+  std::sort(expected.begin(), expected.end(), std::greater< int >());
+  assert(sorted == expected);
+
+  int raw[] = {3, 1, 4, 1, 5, 9, 2, 6};
+  ft::make_heap(raw, raw + 8);
+  ft::sort_heap(raw, raw + 8);
+  assert(ft::is_sorted(raw, raw + 8) && raw[7] == 9);
+  ft::make_heap(raw, raw);
+  ft::pop_heap(raw, raw + 1);
+  assert(raw[0] == 1);
+}
+
+void test_priority_queue_adaptor(void) {
+  std::cout << "\t adaptor" << std::endl;
+
+  std::vector< int > values;
+  for (int i = 0; i < 500; ++i) values.push_back(pq_test_value(i));
+
+  ft::priority_queue< int, ft::vector< int >, std::less< int >, 2 > binary;
+  ft::priority_queue< int > quad;
+  ft::priority_queue< int, ft::vector< int >, std::less< int >, 8 > octal;
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    binary.push(values[i]);
+    quad.push(values[i]);
+    octal.push(values[i]);
+  }
+  assert(quad.arity == 4 && octal.size() == values.size());
+  pq_test_drain(binary, values, std::less< int >());
+  pq_test_drain(quad, values, std::less< int >());
+  pq_test_drain(octal, values, std::less< int >());
+
+  ft::priority_queue< int, ft::vector< int >, std::greater< int >, 8 > low(
+      values.begin(), values.end());
+  assert(low.top() == *std::min_element(values.begin(), values.end()));
+  low.push(-1);
+  assert(low.top() == -1);
+  low.pop();
+  pq_test_drain(low, values, std::greater< int >());
+
+  // interleaved pushes and pops against the std binary heap
+  ft::priority_queue< int, std::vector< int > > mixed;
+  std::priority_queue< int > ref;
+  for (int i = 0; i < 1000; ++i) {
+    mixed.push(pq_test_value(i));
+    ref.push(pq_test_value(i));
+    if (i % 3 == 0) {
+      assert(mixed.top() == ref.top());
+      mixed.pop();
+      ref.pop();
+    }
+  }
+  assert(mixed.size() == ref.size() && mixed.top() == ref.top());
+
+  ft::priority_queue< int > other(std::less< int >(), ft::vector< int >(3, 7));
+  ft::swap(other, quad);
+  assert(other.empty() && quad.size() == 3 && quad.top() == 7);
+}
+
+void test_priority_queue_mutable(void) {
+  std::cout << "\t mutable" << std::endl;
+
+  typedef ft::mutable_priority_queue< int, std::greater< int > > min_queue;
+  min_queue q;
+  ft::vector< min_queue::handle_type > handles;
+  for (int i = 0; i < 100; ++i) handles.push_back(q.push(100 + i));
+  assert(q.size() == 100 && q.top() == 100 && q.top_handle() == handles[0]);
+
+  q.decrease_key(handles[50], 5);
+  assert(q.top() == 5 && q.top_handle() == handles[50]);
+  assert(q.value(handles[50]) == 5);
+  try {
+    q.decrease_key(handles[10], 500);
+    assert(false);
+  } catch (const std::invalid_argument& e) {
+  }
+  assert(q.value(handles[10]) == 110);
+
+  q.update(handles[50], 1000);
+  assert(q.top() == 100);
+  q.update(handles[99], 0);
+  assert(q.top_handle() == handles[99]);
+  q.erase(handles[99]);
+  assert(!q.contains(handles[99]) && q.top() == 100 && q.size() == 99);
+
+  // a freed handle is reused by the next push
+  min_queue::handle_type again = q.push(50);
+  assert(again == handles[99] && q.top() == 50);
+
+  int last = -1;
+  while (!q.empty()) {
+    assert(q.top() >= last);
+    last = q.top();
+    assert(q.contains(q.top_handle()));
+    q.pop();
+  }
+  assert(last == 1000);
+
+  // random reprioritizations keep the order of a re-sorted copy
+  ft::mutable_priority_queue< int, std::less< int >, 8 > max;
+  std::vector< int > shadow;
+  for (int i = 0; i < 300; ++i) {
+    max.push(pq_test_value(i));
+    shadow.push_back(pq_test_value(i));
+  }
+  for (int i = 0; i < 300; i += 7) {
+    max.update(static_cast< std::size_t >(i), pq_test_value(i + 1000));
+    shadow[i] = pq_test_value(i + 1000);
+  }
+  std::sort(shadow.begin(), shadow.end(), std::greater< int >());
+  for (std::size_t i = 0; i < shadow.size(); ++i) {
+    assert(max.top() == shadow[i]);
+    max.pop();
+  }
+}
+
+void test_priority_queue(void) {
+  std::cout << "Test: priority_queue" << std::endl;
+  test_priority_queue_heap();
+  test_priority_queue_adaptor();
+  test_priority_queue_mutable();
+}
@@ -0,0 +1,149 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/08
+ * @file src/rcu_vector.bench.cpp
+ */
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <iostream>
+
+#include "bench.hpp"
+#include "rcu_vector.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const std::size_t g_reads = 1 << 20;
+const std::size_t g_table = 256;
+
+struct locked_table {
+  pthread_rwlock_t lock;
+  ft::vector< std::size_t > table;
+
+  std::size_t lookup(std::size_t i) {
+    pthread_rwlock_rdlock(&this->lock);
+    std::size_t value = this->table[i % this->table.size()];
+    pthread_rwlock_unlock(&this->lock);
+    return value;
+  };
+
+  void replace(const ft::vector< std::size_t >& next) {
+    pthread_rwlock_wrlock(&this->lock);
+    this->table = next;
+    pthread_rwlock_unlock(&this->lock);
+  };
+};
+
+struct rcu_table {
+  ft::rcu_vector< std::size_t > table;
+
+  std::size_t lookup(std::size_t i) {
+    ft::rcu_vector< std::size_t >::snapshot snap = this->table.read();
+    return snap[i % snap.size()];
+  };
+
+  void replace(const ft::vector< std::size_t >& next) {
+    this->table.publish(next);
+  };
+};
+
+template < class Table >
+struct read_run {
+  Table* table;
+  std::size_t sum;
+};
+
+template < class Table >
+void* read_loop(void* arg) {
+  read_run< Table >* run = static_cast< read_run< Table >* >(arg);
+  for (std::size_t i = 0; i < g_reads; ++i) run->sum += run->table->lookup(i);
+  return NULL;
+}
+
+template < class Table >
+struct write_run {
+  Table* table;
+  ft::atomic< int >* stop;
+  std::size_t updates;
+};
+
+template < class Table >
+void* write_loop(void* arg) {
+  write_run< Table >* run = static_cast< write_run< Table >* >(arg);
+  ft::vector< std::size_t > next(g_table, 0);
+  while (!run->stop->load(ft::memory_order_relaxed)) {
+    next[run->updates % g_table] = run->updates;
+    run->table->replace(next);
+    ++run->updates;
+    usleep(1000);
+  }
+  return NULL;
+}
+
+/**
+ * @brief readers threads doing g_reads lookups each while one writer
+ * replaces the table every millisecond.
+ */
+template < class Table >
+double readers_under_update(Table* table, int readers, std::size_t* sum) {
+  ft::atomic< int > stop(0);
+  write_run< Table > writer = {table, &stop, 0};
+  read_run< Table > runs[64];
+  pthread_t ids[64];
+  pthread_t writer_id;
+
+  table->replace(ft::vector< std::size_t >(g_table, 1));
+  pthread_create(&writer_id, NULL, write_loop< Table >, &writer);
+  double start = bench_now();
+  for (int i = 0; i < readers; ++i) {
+    runs[i].table = table;
+    runs[i].sum = 0;
+    pthread_create(&ids[i], NULL, read_loop< Table >, &runs[i]);
+  }
+  for (int i = 0; i < readers; ++i) {
+    pthread_join(ids[i], NULL);
+    *sum += runs[i].sum;
+  }
+  double elapsed = bench_now() - start;
+  stop.store(1);
+  pthread_join(writer_id, NULL);
+  return elapsed;
+}
+
+}  // namespace
+
+void bench_rcu_vector(void) {
+  std::cout << "Bench: rcu_vector" << std::endl;
+
+  int cores = bench_cores();
+  char label[64];
+  std::size_t sum = 0;
+  /* 1, 2, 4, ... and finally the core count itself */
+  for (int threads = 1;; threads = threads * 2 < cores ? threads * 2 : cores) {
+    rcu_table rcu;
+    std::snprintf(label, sizeof(label), "rcu_vector read x%d", threads);
+    bench_report(label, readers_under_update(&rcu, threads, &sum),
+                 g_reads * threads);
+
+    locked_table locked;
+    pthread_rwlock_init(&locked.lock, NULL);
+    std::snprintf(label, sizeof(label), "rwlock + ft::vector read x%d",
+                  threads);
+    bench_report(label, readers_under_update(&locked, threads, &sum),
+                 g_reads * threads);
+    pthread_rwlock_destroy(&locked.lock);
+
+    if (threads == cores) break;
+  }
+  bench_sink(sum);
+}
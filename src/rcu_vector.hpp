@@ -0,0 +1,324 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/08
+ * @file src/rcu_vector.hpp
+ */
+
+#if !defined(FT__RCU_VECTOR_HPP)
+#define FT__RCU_VECTOR_HPP
+
+#include <pthread.h>
+
+#include <cstddef>
+#include <memory>
+
+#include "atomic.hpp"
+#include "util.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+/**
+ * @brief Reader counters of one stripe of an rcu_vector, one per parity,
+ * alone on a cache line.
+ */
+struct rcu_stripe {
+  ft::atomic< std::size_t > readers[2];
+  char pad[cache_line_size - 2 * sizeof(std::size_t)];
+};
+
+/**
+ * @brief Read-mostly vector: readers take wait-free snapshots of the
+ * current version while writers publish whole new versions.
+ *
+ * A reader bumps a counter on its own stripe for the current parity and
+ * loads the version pointer; the snapshot keeps that version alive until it
+ * is destroyed. A writer copies the current version, changes the copy,
+ * swaps the pointer and retires the old version, tagged with the current
+ * epoch. The parity flips (and the epoch advances) only once every reader
+ * of the idle parity has left, so two flips after a retire no reader can
+ * still hold the retired version and it is freed. Writers never wait on
+ * readers: versions held by a long snapshot just stay retired until a later
+ * write or reclaim() finds them free. Writers are serialized by a mutex.
+ *
+ * @tparam T Type of the elements.
+ * @tparam _Alloc allocator of the versions and their elements.
+ */
+template < class T, class _Alloc = std::allocator< T > >
+class rcu_vector {
+ public:
+  /* The first template parameter (T) */
+  typedef T value_type;
+  /* The second template parameter (_Alloc) */
+  typedef _Alloc allocator_type;
+  /* one immutable version of the contents */
+  typedef ft::vector< T, _Alloc > version_type;
+  /* an unsigned integral type */
+  typedef std::size_t size_type;
+
+  /* number of reader counter stripes */
+  static const size_type stripes = 16;
+
+  /**
+   * @brief A reader's view of one version. The version cannot be freed
+   * while a snapshot of it exists; copies share the same hold.
+   */
+  class snapshot {
+    friend class rcu_vector;
+
+   private:
+    const version_type* _version;
+    ft::atomic< size_type >* _hold;
+
+    snapshot(const version_type* version, ft::atomic< size_type >* hold)
+        : _version(version), _hold(hold){};
+
+    snapshot& operator=(const snapshot&);
+
+   public:
+    snapshot(const snapshot& other)
+        : _version(other._version), _hold(other._hold) {
+      this->_hold->fetch_add(1);
+    };
+
+    ~snapshot() { this->_hold->fetch_sub(1, memory_order_release); };
+
+    const version_type& operator*() const { return *this->_version; };
+    const version_type* operator->() const { return this->_version; };
+
+    size_type size() const { return this->_version->size(); };
+    const T& operator[](size_type n) const { return (*this->_version)[n]; };
+  };
+
+ private:
+  typedef typename _Alloc::template rebind< version_type >::other
+      _version_allocator;
+
+  typedef ft::pair< version_type*, size_type > _retired_entry;
+  typedef typename _Alloc::template rebind< _retired_entry >::other
+      _retired_allocator;
+
+  _version_allocator _version_alloc;
+  ft::atomic< version_type* > _current;
+  ft::atomic< size_type > _parity;
+  mutable pthread_mutex_t _write_lock;
+  /* guarded by _write_lock: flip count and versions waiting to be freed */
+  size_type _epoch;
+  ft::vector< _retired_entry, _retired_allocator > _retired;
+  rcu_stripe _stripes[stripes];
+
+  rcu_vector(const rcu_vector&);
+  rcu_vector& operator=(const rcu_vector&);
+
+ public:
+  /**
+   * @brief empty container constructor (default constructor)
+   */
+  explicit rcu_vector(const allocator_type& alloc = allocator_type())
+      : _version_alloc(alloc), _parity(0), _epoch(0), _retired(alloc) {
+    pthread_mutex_init(&this->_write_lock, NULL);
+    this->_current.store(this->_new_version(version_type(alloc)));
+  };
+
+  /**
+   * @brief Start from a copy of initial.
+   */
+  explicit rcu_vector(const version_type& initial)
+      : _version_alloc(initial.get_allocator()),
+        _parity(0),
+        _epoch(0),
+        _retired(initial.get_allocator()) {
+    pthread_mutex_init(&this->_write_lock, NULL);
+    this->_current.store(this->_new_version(initial));
+  };
+
+  /**
+   * @brief No snapshot may outlive the container.
+   */
+  ~rcu_vector() {
+    for (size_type i = 0; i < this->_retired.size(); ++i) {
+      this->_free_version(this->_retired[i].first);
+    }
+    this->_free_version(this->_current.load());
+    pthread_mutex_destroy(&this->_write_lock);
+  };
+
+  /**
+   * @brief Wait-free: one fetch_add and two loads, never a retry.
+   */
+  snapshot read() const {
+    rcu_stripe& stripe =
+        const_cast< rcu_stripe& >(this->_stripes[_stripe_here()]);
+    ft::atomic< size_type >* hold =
+        &stripe.readers[this->_parity.load(memory_order_relaxed)];
+    hold->fetch_add(1);
+    return snapshot(this->_current.load(), hold);
+  };
+
+  /**
+   * @brief Size of the current version.
+   */
+  size_type size() const { return this->read().size(); };
+
+  allocator_type get_allocator() const {
+    return allocator_type(this->_version_alloc);
+  };
+
+  /**
+   * @brief Replace the contents with a copy of next.
+   */
+  void publish(const version_type& next) {
+    version_type* version = this->_new_version(next);
+    pthread_mutex_lock(&this->_write_lock);
+    try {
+      this->_replace(version);
+    } catch (...) {
+      pthread_mutex_unlock(&this->_write_lock);
+      this->_free_version(version);
+      throw;
+    }
+    pthread_mutex_unlock(&this->_write_lock);
+  };
+
+  /**
+   * @brief Copy the current version, apply f to the copy and publish it.
+   * Writers queue on a mutex, so concurrent updates never lose each other.
+   *
+   * @tparam Function callable as f(version_type&)
+   */
+  template < class Function >
+  void update(Function f) {
+    pthread_mutex_lock(&this->_write_lock);
+    version_type* next = ft::u_nullptr;
+    try {
+      next = this->_new_version(*this->_current.load(memory_order_relaxed));
+      f(*next);
+      this->_replace(next);
+    } catch (...) {
+      if (next) this->_free_version(next);
+      pthread_mutex_unlock(&this->_write_lock);
+      throw;
+    }
+    pthread_mutex_unlock(&this->_write_lock);
+  };
+
+  void push_back(const value_type& val) {
+    this->update(_push_back_fn(val));
+  };
+
+  void clear() { this->publish(version_type(this->get_allocator())); };
+
+  /**
+   * @brief Free every retired version no reader holds any more. Writers do
+   * this on their own; call it after releasing long-lived snapshots.
+   */
+  void reclaim() {
+    pthread_mutex_lock(&this->_write_lock);
+    this->_reclaim();
+    pthread_mutex_unlock(&this->_write_lock);
+  };
+
+  /**
+   * @brief Number of replaced versions not freed yet.
+   */
+  size_type retired() const {
+    pthread_mutex_lock(&this->_write_lock);
+    size_type n = this->_retired.size();
+    pthread_mutex_unlock(&this->_write_lock);
+    return n;
+  };
+
+ private:
+  struct _push_back_fn {
+    const value_type& val;
+    explicit _push_back_fn(const value_type& v) : val(v){};
+    void operator()(version_type& v) const { v.push_back(this->val); };
+  };
+
+  /**
+   * @brief Pick a stripe from the address of the caller's stack: threads
+   * run on different stacks, so they mostly land on different stripes.
+   */
+  static size_type _stripe_here() {
+    char probe;
+    size_type h = reinterpret_cast< size_type >(&probe) >> 16;
+    h *= static_cast< size_type >(0x9E3779B97F4A7C15ULL);
+    return (h >> (sizeof(size_type) * 8 - 8)) % stripes;
+  };
+
+  version_type* _new_version(const version_type& from) {
+    version_type* version = this->_version_alloc.allocate(1);
+    try {
+      this->_version_alloc.construct(version, from);
+    } catch (...) {
+      this->_version_alloc.deallocate(version, 1);
+      throw;
+    }
+    return version;
+  };
+
+  void _free_version(version_type* version) {
+    this->_version_alloc.destroy(version);
+    this->_version_alloc.deallocate(version, 1);
+  };
+
+  /**
+   * @brief Publish next and retire the previous version. Called with the
+   * write lock held, so _current only changes here. The previous version is
+   * retired before next goes in: if that push_back throws, nothing was
+   * published and the caller still owns next.
+   */
+  void _replace(version_type* next) {
+    version_type* old = this->_current.load(memory_order_relaxed);
+    this->_retired.push_back(_retired_entry(old, this->_epoch));
+    this->_current.exchange(next);
+    this->_reclaim();
+  };
+
+  bool _drained(size_type parity) const {
+    for (size_type i = 0; i < stripes; ++i) {
+      if (this->_stripes[i].readers[parity].load() != 0) return false;
+    }
+    return true;
+  };
+
+  /**
+   * @brief Flip the parity as long as the idle one has no reader left, then
+   * free what was retired two or more flips ago. A reader that held a
+   * version retired at epoch e counted on the parity of epoch e or e - 1;
+   * the flips to e + 1 and e + 2 each saw one of those drained. Called with
+   * the write lock held.
+   */
+  void _reclaim() {
+    if (this->_retired.empty()) return;
+    size_type target = this->_retired.back().second + 2;
+    while (this->_epoch < target) {
+      size_type idle = this->_parity.load(memory_order_relaxed) ^ 1;
+      if (!this->_drained(idle)) break;
+      this->_parity.store(idle);
+      ++this->_epoch;
+    }
+
+    size_type kept = 0;
+    for (size_type i = 0; i < this->_retired.size(); ++i) {
+      if (this->_retired[i].second + 2 <= this->_epoch) {
+        this->_free_version(this->_retired[i].first);
+      } else {
+        this->_retired[kept++] = this->_retired[i];
+      }
+    }
+    while (this->_retired.size() > kept) this->_retired.pop_back();
+  };
+};
+
+}  // namespace ft
+
+#endif  // FT__RCU_VECTOR_HPP
@@ -0,0 +1,198 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/08
+ * @file src/rcu_vector.test.cpp
+ */
+
+#include "rcu_vector.hpp"
+
+#include <pthread.h>
+
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+
+typedef ft::rcu_vector< std::string > ft_rcu_vector;
+
+namespace {
+
+struct rcu_test_append_twice {
+  void operator()(ft_rcu_vector::version_type& v) const {
+    v.push_back("twice");
+    v.push_back("twice");
+  };
+};
+
+struct rcu_test_throw {
+  void operator()(ft_rcu_vector::version_type& v) const {
+    v.push_back("lost");
+    throw std::string("abort");
+  };
+};
+
+/* allocations left before rcu_test_allocator throws */
+std::size_t g_rcu_test_budget = static_cast< std::size_t >(-1);
+
+template < class T >
+class rcu_test_allocator : public std::allocator< T > {
+ public:
+  template < class U >
+  struct rebind {
+    typedef rcu_test_allocator< U > other;
+  };
+
+  rcu_test_allocator() : std::allocator< T >(){};
+  template < class U >
+  rcu_test_allocator(const rcu_test_allocator< U >& x)
+      : std::allocator< T >(x){};
+
+  T* allocate(std::size_t n, const void* = 0) {
+    if (g_rcu_test_budget == 0) throw std::bad_alloc();
+    --g_rcu_test_budget;
+    return std::allocator< T >::allocate(n);
+  };
+};
+
+}  // namespace
+
+void test_rcu_vector_single(void) {
+  std::cout << "\t single thread" << std::endl;
+
+  ft_rcu_vector vec;
+  assert(vec.size() == 0);
+
+  ft_rcu_vector::snapshot before = vec.read();
+  vec.push_back("one");
+  vec.update(rcu_test_append_twice());
+  // an old snapshot keeps seeing its own version
+  assert(before.size() == 0 && vec.size() == 3);
+
+  ft_rcu_vector::snapshot now = vec.read();
+  ft_rcu_vector::snapshot copy(now);
+  assert(copy[0] == "one" && copy[2] == "twice" && now->back() == "twice");
+
+  try {
+    vec.update(rcu_test_throw());
+    assert(false);
+  } catch (const std::string& e) {
+  }
+  assert(vec.size() == 3);
+
+  ft::vector< std::string > next(2, "next");
+  vec.publish(next);
+  assert(vec.read()[1] == "next" && (*now).size() == 3);
+  vec.clear();
+  assert(vec.size() == 0);
+
+  // versions held by live snapshots stay retired until released
+  assert(vec.retired() > 0);
+}
+
+void test_rcu_vector_exceptions(void) {
+  std::cout << "\t exceptions" << std::endl;
+
+  // a writer failing at any allocation, the retired list's included,
+  // publishes nothing and leaves the write lock free for the next one.
+  // The held snapshot keeps versions retired, so the list has to grow
+  typedef ft::rcu_vector< int, rcu_test_allocator< int > > counting_rcu;
+  for (std::size_t budget = 0; budget < 8; ++budget) {
+    counting_rcu vec;
+    counting_rcu::snapshot held = vec.read();
+    vec.push_back(1);
+    g_rcu_test_budget = budget;
+    bool threw = false;
+    try {
+      vec.push_back(2);
+    } catch (const std::bad_alloc& e) {
+      threw = true;
+    }
+    g_rcu_test_budget = budget;
+    try {
+      vec.publish(counting_rcu::version_type(3, 4));
+    } catch (const std::bad_alloc& e) {
+    }
+    g_rcu_test_budget = static_cast< std::size_t >(-1);
+    vec.push_back(5);
+    counting_rcu::snapshot now = vec.read();
+    assert(now->back() == 5 && (now.size() == 4 || now[0] == 1));
+    assert(now.size() == 4 || now.size() == (threw ? 2u : 3u));
+  }
+}
+
+void test_rcu_vector_reclaim(void) {
+  std::cout << "\t reclaim" << std::endl;
+
+  ft_rcu_vector vec;
+  {
+    ft_rcu_vector::snapshot held = vec.read();
+    for (int i = 0; i < 10; ++i) vec.push_back("x");
+    assert(vec.retired() == 10 && held.size() == 0);
+  }
+  vec.reclaim();
+  assert(vec.retired() == 0 && vec.size() == 10);
+
+  // without readers every write frees the version it replaces
+  vec.push_back("y");
+  assert(vec.retired() == 0);
+}
+
+namespace {
+
+const int g_versions = 2000;
+
+struct rcu_test_shared {
+  ft::rcu_vector< int >* vec;
+  ft::atomic< int > done;
+};
+
+void* rcu_test_reader(void* arg) {
+  rcu_test_shared* shared = static_cast< rcu_test_shared* >(arg);
+  int last = 0;
+  while (!shared->done.load()) {
+    ft::rcu_vector< int >::snapshot snap = shared->vec->read();
+    // version v holds v copies of v
+    int version = static_cast< int >(snap.size());
+    assert(version >= last);
+    for (int i = 0; i < version; ++i) assert(snap[i] == version);
+    last = version;
+  }
+  return NULL;
+}
+
+}  // namespace
+
+void test_rcu_vector_threads(void) {
+  std::cout << "\t readers / writer" << std::endl;
+
+  ft::rcu_vector< int > vec;
+  rcu_test_shared shared;
+  shared.vec = &vec;
+
+  pthread_t readers[3];
+  for (int i = 0; i < 3; ++i) {
+    pthread_create(&readers[i], NULL, rcu_test_reader, &shared);
+  }
+  for (int v = 1; v <= g_versions; ++v) {
+    vec.publish(ft::vector< int >(v, v));
+  }
+  shared.done.store(1);
+  for (int i = 0; i < 3; ++i) pthread_join(readers[i], NULL);
+  assert(vec.size() == static_cast< std::size_t >(g_versions));
+}
+
+void test_rcu_vector(void) {
+  std::cout << "Test: rcu_vector" << std::endl;
+  test_rcu_vector_single();
+  test_rcu_vector_exceptions();
+  test_rcu_vector_reclaim();
+  test_rcu_vector_threads();
+}
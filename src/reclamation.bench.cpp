@@ -0,0 +1,222 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/09
+ * @file src/reclamation.bench.cpp
+ */
+
+#include <pthread.h>
+
+#include <cstdio>
+#include <iostream>
+
+#include "bench.hpp"
+#include "reclamation.hpp"
+
+namespace {
+
+const std::size_t g_reads = 1 << 22;
+const std::size_t g_pairs = 1 << 18;
+
+struct bench_node {
+  std::size_t value;
+  bench_node* next;
+};
+
+typedef ft::epoch_domain< bench_node > epoch_type;
+typedef ft::hazard_domain< bench_node > hazard_type;
+
+/**
+ * @brief Cost of guarding a single read of a shared pointer.
+ */
+void bench_read_side(std::size_t* sum) {
+  bench_node node = {1, ft::u_nullptr};
+  ft::atomic< bench_node* > shared(&node);
+  double start;
+
+  start = bench_now();
+  for (std::size_t i = 0; i < g_reads; ++i) *sum += shared.load()->value;
+  bench_report("unprotected read", bench_now() - start, g_reads);
+
+  epoch_type epoch;
+  epoch_type::handle eh(epoch);
+  start = bench_now();
+  for (std::size_t i = 0; i < g_reads; ++i) {
+    epoch_type::guard guard(eh);
+    *sum += shared.load()->value;
+  }
+  bench_report("epoch guard + read", bench_now() - start, g_reads);
+
+  hazard_type hazard;
+  hazard_type::handle hh(hazard);
+  start = bench_now();
+  for (std::size_t i = 0; i < g_reads; ++i) {
+    *sum += hh.protect(0, shared)->value;
+    hh.clear(0);
+  }
+  bench_report("hazard protect + read", bench_now() - start, g_reads);
+}
+
+struct locked_stack {
+  pthread_mutex_t lock;
+  bench_node* top;
+
+  void push(bench_node* node) {
+    pthread_mutex_lock(&this->lock);
+    node->next = this->top;
+    this->top = node;
+    pthread_mutex_unlock(&this->lock);
+  };
+
+  bench_node* pop() {
+    pthread_mutex_lock(&this->lock);
+    bench_node* node = this->top;
+    if (node) this->top = node->next;
+    pthread_mutex_unlock(&this->lock);
+    return node;
+  };
+};
+
+/**
+ * @brief Treiber stack reclaiming through Domain; the baseline frees
+ * directly under a mutex.
+ */
+template < class Domain >
+struct lockfree_stack {
+  Domain domain;
+  ft::atomic< bench_node* > top;
+
+  void push(bench_node* node) {
+    bench_node* head = this->top.load(ft::memory_order_relaxed);
+    do {
+      node->next = head;
+    } while (!this->top.compare_exchange_weak(head, node));
+  };
+};
+
+bench_node* stack_pop(lockfree_stack< epoch_type >& stack,
+                      epoch_type::handle& h) {
+  epoch_type::guard guard(h);
+  bench_node* head = stack.top.load();
+  while (head && !stack.top.compare_exchange_weak(head, head->next)) {
+  }
+  return head;
+}
+
+bench_node* stack_pop(lockfree_stack< hazard_type >& stack,
+                      hazard_type::handle& h) {
+  bench_node* head;
+  do {
+    head = h.protect(0, stack.top);
+  } while (head && !stack.top.compare_exchange_weak(head, head->next));
+  h.clear(0);
+  return head;
+}
+
+template < class Stack >
+struct stack_run {
+  Stack* stack;
+  std::size_t sum;
+};
+
+template < class Domain >
+void* lockfree_loop(void* arg) {
+  stack_run< lockfree_stack< Domain > >* run =
+      static_cast< stack_run< lockfree_stack< Domain > >* >(arg);
+  std::allocator< bench_node > alloc;
+  typename Domain::handle h(run->stack->domain);
+  for (std::size_t i = 0; i < g_pairs; ++i) {
+    bench_node* node = alloc.allocate(1);
+    node->value = i;
+    run->stack->push(node);
+    node = stack_pop(*run->stack, h);
+    if (node) {
+      run->sum += node->value;
+      h.retire(node);
+    }
+  }
+  return NULL;
+}
+
+void* locked_loop(void* arg) {
+  stack_run< locked_stack >* run =
+      static_cast< stack_run< locked_stack >* >(arg);
+  std::allocator< bench_node > alloc;
+  for (std::size_t i = 0; i < g_pairs; ++i) {
+    bench_node* node = alloc.allocate(1);
+    node->value = i;
+    run->stack->push(node);
+    node = run->stack->pop();
+    if (node) {
+      run->sum += node->value;
+      alloc.deallocate(node, 1);
+    }
+  }
+  return NULL;
+}
+
+template < class Stack >
+double push_pop(Stack* stack, void* (*loop)(void*), int threads,
+                std::size_t* sum) {
+  stack_run< Stack > runs[64];
+  pthread_t ids[64];
+  double start = bench_now();
+  for (int i = 0; i < threads; ++i) {
+    runs[i].stack = stack;
+    runs[i].sum = 0;
+    pthread_create(&ids[i], NULL, loop, &runs[i]);
+  }
+  for (int i = 0; i < threads; ++i) {
+    pthread_join(ids[i], NULL);
+    *sum += runs[i].sum;
+  }
+  return bench_now() - start;
+}
+
+}  // namespace
+
+void bench_reclamation(void) {
+  std::cout << "Bench: reclamation" << std::endl;
+
+  std::size_t sum = 0;
+  bench_read_side(&sum);
+
+  int cores = bench_cores();
+  char label[64];
+  /* 1, 2, 4, ... and finally the core count itself */
+  for (int threads = 1;; threads = threads * 2 < cores ? threads * 2 : cores) {
+    {
+      lockfree_stack< epoch_type > stack;
+      std::snprintf(label, sizeof(label), "treiber + epoch push/pop x%d",
+                    threads);
+      bench_report(label,
+                   push_pop(&stack, lockfree_loop< epoch_type >, threads, &sum),
+                   g_pairs * threads);
+    }
+    {
+      lockfree_stack< hazard_type > stack;
+      std::snprintf(label, sizeof(label), "treiber + hazard push/pop x%d",
+                    threads);
+      bench_report(
+          label, push_pop(&stack, lockfree_loop< hazard_type >, threads, &sum),
+          g_pairs * threads);
+    }
+    {
+      locked_stack stack;
+      pthread_mutex_init(&stack.lock, NULL);
+      stack.top = ft::u_nullptr;
+      std::snprintf(label, sizeof(label), "mutex stack push/pop x%d", threads);
+      bench_report(label, push_pop(&stack, locked_loop, threads, &sum),
+                   g_pairs * threads);
+      pthread_mutex_destroy(&stack.lock);
+    }
+    if (threads == cores) break;
+  }
+  bench_sink(sum);
+}
@@ -0,0 +1,479 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/09
+ * @file src/reclamation.hpp
+ */
+
+#if !defined(FT__RECLAMATION_HPP)
+#define FT__RECLAMATION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+#include "algorithm.hpp"
+#include "atomic.hpp"
+#include "util.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+/**
+ * @brief Per-thread state of an epoch_domain. Records are linked once and
+ * never unlinked; a thread that leaves hands its record, with whatever it
+ * still has to free, to the next thread that joins.
+ */
+template < class T, class _Alloc >
+struct epoch_record {
+  typedef typename _Alloc::template rebind< T* >::other pointer_allocator;
+
+  epoch_record* next;
+  ft::atomic< int > in_use;
+  /* (epoch << 1) | 1 inside a critical section, 0 outside */
+  ft::atomic< std::size_t > state;
+  char pad[cache_line_size];
+  /* owner only: objects retired during limbo_epoch[e % 3] */
+  ft::vector< T*, pointer_allocator > limbo[3];
+  std::size_t limbo_epoch[3];
+  std::size_t since_collect;
+
+  explicit epoch_record(const _Alloc& alloc)
+      : next(ft::u_nullptr), in_use(1), state(0), since_collect(0) {
+    for (int i = 0; i < 3; ++i) {
+      this->limbo[i] = ft::vector< T*, pointer_allocator >(alloc);
+      this->limbo_epoch[i] = 0;
+    }
+  };
+
+  epoch_record(const epoch_record& other)
+      : next(other.next), in_use(1), state(0), since_collect(0) {
+    for (int i = 0; i < 3; ++i) {
+      this->limbo[i] = other.limbo[i];
+      this->limbo_epoch[i] = other.limbo_epoch[i];
+    }
+  };
+
+ private:
+  epoch_record& operator=(const epoch_record&);
+};
+
+/**
+ * @brief Epoch-based memory reclamation for objects of type T.
+ *
+ * Threads read shared objects inside critical sections (guard). Each one
+ * announces the global epoch it entered in; the global epoch moves from e
+ * to e + 1 only when every thread inside a critical section announced e.
+ * An object retired during epoch e was unlinked before any thread could
+ * enter e + 1, so once the epoch reaches e + 2 no thread can still hold
+ * it: it is destroyed and deallocated through _Alloc.
+ *
+ * Reads cost one atomic exchange per critical section and never retry; a
+ * thread stalled inside a critical section holds back every free.
+ *
+ * @tparam T type of the reclaimed objects
+ * @tparam _Alloc allocator the objects were allocated with
+ */
+template < class T, class _Alloc = std::allocator< T > >
+class epoch_domain {
+ public:
+  /* The first template parameter (T) */
+  typedef T value_type;
+  /* The second template parameter (_Alloc) */
+  typedef _Alloc allocator_type;
+  /* an unsigned integral type */
+  typedef std::size_t size_type;
+
+  /* retires between two collection attempts */
+  static const size_type batch = 64;
+
+ private:
+  typedef epoch_record< T, _Alloc > _record;
+  typedef typename _Alloc::template rebind< _record >::other _record_allocator;
+
+  allocator_type _alloc;
+  _record_allocator _record_alloc;
+  ft::atomic< _record* > _records;
+  char _pad[cache_line_size];
+  ft::atomic< size_type > _epoch;
+
+  epoch_domain(const epoch_domain&);
+  epoch_domain& operator=(const epoch_domain&);
+
+ public:
+  /**
+   * @brief A thread's membership in the domain. Each thread that reads or
+   * retires needs its own handle; a handle must not be shared.
+   */
+  class handle {
+    friend class epoch_domain;
+
+   private:
+    epoch_domain* _domain;
+    _record* _record_ptr;
+    size_type _depth;
+
+    handle(const handle&);
+    handle& operator=(const handle&);
+
+   public:
+    explicit handle(epoch_domain& domain)
+        : _domain(&domain), _record_ptr(domain._acquire()), _depth(0){};
+
+    ~handle() {
+      if (this->_depth) this->_record_ptr->state.store(0);
+      this->collect();
+      this->_record_ptr->in_use.store(0, memory_order_release);
+    };
+
+    /**
+     * @brief Start a critical section; sections nest.
+     */
+    void enter() {
+      if (this->_depth++) return;
+      size_type epoch = this->_domain->_epoch.load(memory_order_acquire);
+      // a full barrier: the announcement is visible before any read
+      this->_record_ptr->state.exchange((epoch << 1) | 1);
+    };
+
+    void leave() {
+      if (--this->_depth) return;
+      this->_record_ptr->state.store(0, memory_order_release);
+    };
+
+    /**
+     * @brief Hand over an object already unlinked from every shared
+     * structure. It is freed once no critical section can still see it.
+     */
+    void retire(T* p) {
+      _record& r = *this->_record_ptr;
+      size_type epoch = this->_domain->_epoch.load(memory_order_acquire);
+      size_type bucket = epoch % 3;
+      if (r.limbo_epoch[bucket] != epoch) {
+        // the bucket holds epoch - 3 or older: safe
+        this->_domain->_free_all(r.limbo[bucket]);
+        r.limbo_epoch[bucket] = epoch;
+      }
+      r.limbo[bucket].push_back(p);
+      if (++r.since_collect >= batch) this->collect();
+    };
+
+    /**
+     * @brief Try to advance the epoch and free every bucket that is two
+     * epochs old.
+     */
+    void collect() {
+      _record& r = *this->_record_ptr;
+      r.since_collect = 0;
+      size_type epoch = this->_domain->_try_advance();
+      for (int i = 0; i < 3; ++i) {
+        if (!r.limbo[i].empty() && r.limbo_epoch[i] + 2 <= epoch) {
+          this->_domain->_free_all(r.limbo[i]);
+        }
+      }
+    };
+  };
+
+  /**
+   * @brief Critical section for the lifetime of the guard.
+   */
+  class guard {
+   private:
+    handle& _handle;
+
+    guard(const guard&);
+    guard& operator=(const guard&);
+
+   public:
+    explicit guard(handle& h) : _handle(h) { this->_handle.enter(); };
+    ~guard() { this->_handle.leave(); };
+  };
+
+  explicit epoch_domain(const allocator_type& alloc = allocator_type())
+      : _alloc(alloc), _record_alloc(alloc), _epoch(0){};
+
+  /**
+   * @brief Frees everything still retired. No handle may outlive the
+   * domain.
+   */
+  ~epoch_domain() {
+    _record* r = this->_records.load();
+    while (r) {
+      _record* next = r->next;
+      for (int i = 0; i < 3; ++i) this->_free_all(r->limbo[i]);
+      this->_record_alloc.destroy(r);
+      this->_record_alloc.deallocate(r, 1);
+      r = next;
+    }
+  };
+
+  size_type epoch() const { return this->_epoch.load(); };
+
+  /**
+   * @brief Number of retired objects not freed yet (a racy snapshot).
+   */
+  size_type pending() const {
+    size_type n = 0;
+    for (_record* r = this->_records.load(); r; r = r->next) {
+      for (int i = 0; i < 3; ++i) n += r->limbo[i].size();
+    }
+    return n;
+  };
+
+ private:
+  _record* _acquire() {
+    for (_record* r = this->_records.load(); r; r = r->next) {
+      int expected = 0;
+      if (r->in_use.compare_exchange_strong(expected, 1)) return r;
+    }
+    _record* r = this->_record_alloc.allocate(1);
+    this->_record_alloc.construct(r, _record(this->_alloc));
+    _record* head = this->_records.load(memory_order_relaxed);
+    do {
+      r->next = head;
+    } while (!this->_records.compare_exchange_weak(head, r));
+    return r;
+  };
+
+  /**
+   * @brief Move the epoch forward if every active thread has caught up.
+   *
+   * @return the current epoch
+   */
+  size_type _try_advance() {
+    size_type epoch = this->_epoch.load();
+    for (_record* r = this->_records.load(); r; r = r->next) {
+      size_type state = r->state.load();
+      if ((state & 1) && (state >> 1) != epoch) return epoch;
+    }
+    if (this->_epoch.compare_exchange_strong(epoch, epoch + 1)) ++epoch;
+    return epoch;
+  };
+
+  template < class Vector >
+  void _free_all(Vector& objects) {
+    for (size_type i = 0; i < objects.size(); ++i) {
+      this->_alloc.destroy(objects[i]);
+      this->_alloc.deallocate(objects[i], 1);
+    }
+    objects.clear();
+  };
+};
+
+/**
+ * @brief Per-thread state of a hazard_domain: the published hazard
+ * pointers and the owner's retired objects.
+ */
+template < class T, class _Alloc, std::size_t N >
+struct hazard_record {
+  typedef typename _Alloc::template rebind< T* >::other pointer_allocator;
+
+  hazard_record* next;
+  ft::atomic< int > in_use;
+  ft::atomic< T* > hazards[N];
+  char pad[cache_line_size];
+  /* owner only */
+  ft::vector< T*, pointer_allocator > retired;
+
+  explicit hazard_record(const _Alloc& alloc)
+      : next(ft::u_nullptr), in_use(1), retired(alloc){};
+
+  hazard_record(const hazard_record& other)
+      : next(other.next), in_use(1), retired(other.retired){};
+
+ private:
+  hazard_record& operator=(const hazard_record&);
+};
+
+/**
+ * @brief Hazard pointer memory reclamation for objects of type T.
+ *
+ * Before dereferencing a shared pointer a thread publishes it in one of its
+ * _Slots hazard slots and checks that it is still reachable. A retired
+ * object is only freed by a scan that finds it in no hazard slot. Scans
+ * run every batch retires and free in bulk through _Alloc.
+ *
+ * Unlike epochs, a stalled reader only keeps the objects it points to
+ * alive, at the price of a fence per protected pointer.
+ *
+ * @tparam T type of the reclaimed objects
+ * @tparam _Alloc allocator the objects were allocated with
+ * @tparam _Slots hazard pointers per thread, defaults to 2
+ */
+template < class T, class _Alloc = std::allocator< T >,
+           std::size_t _Slots = 2 >
+class hazard_domain {
+ public:
+  /* The first template parameter (T) */
+  typedef T value_type;
+  /* The second template parameter (_Alloc) */
+  typedef _Alloc allocator_type;
+  /* an unsigned integral type */
+  typedef std::size_t size_type;
+
+  /* hazard pointers per thread */
+  static const size_type slots = _Slots;
+  /* retires between two scans */
+  static const size_type batch = 64;
+
+ private:
+  typedef hazard_record< T, _Alloc, _Slots > _record;
+  typedef typename _Alloc::template rebind< _record >::other _record_allocator;
+  typedef typename _Alloc::template rebind< T* >::other _pointer_allocator;
+
+  allocator_type _alloc;
+  _record_allocator _record_alloc;
+  ft::atomic< _record* > _records;
+
+  hazard_domain(const hazard_domain&);
+  hazard_domain& operator=(const hazard_domain&);
+
+ public:
+  /**
+   * @brief A thread's membership in the domain, owning _Slots hazard
+   * pointers. A handle must not be shared between threads.
+   */
+  class handle {
+    friend class hazard_domain;
+
+   private:
+    hazard_domain* _domain;
+    _record* _record_ptr;
+
+    handle(const handle&);
+    handle& operator=(const handle&);
+
+   public:
+    explicit handle(hazard_domain& domain)
+        : _domain(&domain), _record_ptr(domain._acquire()){};
+
+    ~handle() {
+      for (size_type i = 0; i < _Slots; ++i) this->clear(i);
+      this->scan();
+      this->_record_ptr->in_use.store(0, memory_order_release);
+    };
+
+    /**
+     * @brief Load src into hazard slot i and return it once the published
+     * value is known to still be in src.
+     */
+    T* protect(size_type i, const ft::atomic< T* >& src) {
+      T* p = src.load(memory_order_relaxed);
+      for (;;) {
+        this->_record_ptr->hazards[i].store(p);
+        T* again = src.load();
+        if (again == p) return p;
+        p = again;
+      }
+    };
+
+    void clear(size_type i) {
+      this->_record_ptr->hazards[i].store(ft::u_nullptr,
+                                          memory_order_release);
+    };
+
+    /**
+     * @brief Hand over an object already unlinked from every shared
+     * structure. It is freed by a scan that finds no hazard on it.
+     */
+    void retire(T* p) {
+      this->_record_ptr->retired.push_back(p);
+      if (this->_record_ptr->retired.size() >= batch) this->scan();
+    };
+
+    /**
+     * @brief Free every retired object no thread has a hazard on.
+     */
+    void scan() { this->_domain->_scan(*this->_record_ptr); };
+  };
+
+  explicit hazard_domain(const allocator_type& alloc = allocator_type())
+      : _alloc(alloc), _record_alloc(alloc){};
+
+  /**
+   * @brief Frees everything still retired. No handle may outlive the
+   * domain.
+   */
+  ~hazard_domain() {
+    _record* r = this->_records.load();
+    while (r) {
+      _record* next = r->next;
+      for (size_type i = 0; i < r->retired.size(); ++i) {
+        this->_free(r->retired[i]);
+      }
+      this->_record_alloc.destroy(r);
+      this->_record_alloc.deallocate(r, 1);
+      r = next;
+    }
+  };
+
+  /**
+   * @brief Number of retired objects not freed yet (a racy snapshot).
+   */
+  size_type pending() const {
+    size_type n = 0;
+    for (_record* r = this->_records.load(); r; r = r->next) {
+      n += r->retired.size();
+    }
+    return n;
+  };
+
+ private:
+  _record* _acquire() {
+    for (_record* r = this->_records.load(); r; r = r->next) {
+      int expected = 0;
+      if (r->in_use.compare_exchange_strong(expected, 1)) return r;
+    }
+    _record* r = this->_record_alloc.allocate(1);
+    this->_record_alloc.construct(r, _record(this->_alloc));
+    _record* head = this->_records.load(memory_order_relaxed);
+    do {
+      r->next = head;
+    } while (!this->_records.compare_exchange_weak(head, r));
+    return r;
+  };
+
+  void _free(T* p) {
+    this->_alloc.destroy(p);
+    this->_alloc.deallocate(p, 1);
+  };
+
+  /**
+   * @brief Snapshot every hazard, sort them, and free each of the owner's
+   * retired objects that is not among them.
+   */
+  void _scan(_record& owner) {
+    ft::vector< T*, _pointer_allocator > hazards(this->_alloc);
+    for (_record* r = this->_records.load(); r; r = r->next) {
+      for (size_type i = 0; i < _Slots; ++i) {
+        T* p = r->hazards[i].load();
+        if (p) hazards.push_back(p);
+      }
+    }
+    T** first = hazards.empty() ? ft::u_nullptr : &hazards[0];
+    T** last = first + hazards.size();
+    std::sort(first, last);
+
+    size_type kept = 0;
+    for (size_type i = 0; i < owner.retired.size(); ++i) {
+      T* p = owner.retired[i];
+      T** found = ft::lower_bound(first, last, p);
+      if (found != last && *found == p) {
+        owner.retired[kept++] = p;
+      } else {
+        this->_free(p);
+      }
+    }
+    while (owner.retired.size() > kept) owner.retired.pop_back();
+  };
+};
+
+}  // namespace ft
+
+#endif  // FT__RECLAMATION_HPP
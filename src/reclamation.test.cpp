@@ -0,0 +1,244 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/09
+ * @file src/reclamation.test.cpp
+ */
+
+#include "reclamation.hpp"
+
+#include <pthread.h>
+
+#include <cassert>
+#include <iostream>
+
+namespace {
+
+ft::atomic< long > g_live(0);
+
+struct rec_node {
+  long value;
+  rec_node* next;
+
+  explicit rec_node(long v = 0) : value(v), next(ft::u_nullptr) {
+    g_live.fetch_add(1);
+  };
+  rec_node(const rec_node& other) : value(other.value), next(other.next) {
+    g_live.fetch_add(1);
+  };
+  ~rec_node() { g_live.fetch_sub(1); };
+};
+
+typedef ft::epoch_domain< rec_node > rec_epoch;
+typedef ft::hazard_domain< rec_node > rec_hazard;
+
+rec_node* rec_new(long value) {
+  std::allocator< rec_node > alloc;
+  rec_node* node = alloc.allocate(1);
+  alloc.construct(node, rec_node(value));
+  return node;
+}
+
+/**
+ * @brief Treiber stack: push never dereferences a shared node, pop reads
+ * top->next and so needs it protected.
+ */
+struct rec_stack {
+  ft::atomic< rec_node* > top;
+
+  void push(rec_node* node) {
+    rec_node* head = this->top.load();
+    do {
+      node->next = head;
+    } while (!this->top.compare_exchange_weak(head, node));
+  };
+
+  bool pop(rec_epoch::handle& h, long& value) {
+    rec_epoch::guard guard(h);
+    rec_node* head = this->top.load();
+    while (head && !this->top.compare_exchange_weak(head, head->next)) {
+    }
+    if (!head) return false;
+    value = head->value;
+    h.retire(head);
+    return true;
+  };
+
+  bool pop(rec_hazard::handle& h, long& value) {
+    rec_node* head;
+    for (;;) {
+      head = h.protect(0, this->top);
+      if (!head) return false;
+      if (this->top.compare_exchange_weak(head, head->next)) break;
+    }
+    h.clear(0);
+    value = head->value;
+    h.retire(head);
+    return true;
+  };
+};
+
+}  // namespace
+
+void test_reclamation_epoch(void) {
+  std::cout << "\t epoch" << std::endl;
+
+  {
+    rec_epoch domain;
+    rec_epoch::handle writer(domain);
+    rec_epoch::handle reader(domain);
+
+    reader.enter();
+    for (long i = 0; i < 10; ++i) writer.retire(rec_new(i));
+    assert(domain.pending() == 10);
+    // the reader may still see them: at most one epoch step
+    for (int i = 0; i < 5; ++i) writer.collect();
+    assert(domain.pending() == 10 && domain.epoch() <= 1);
+    reader.leave();
+
+    writer.collect();
+    writer.collect();
+    assert(domain.pending() == 0 && g_live.load() == 0);
+
+    // nesting only leaves on the outermost leave
+    {
+      rec_epoch::guard outer(reader);
+      { rec_epoch::guard inner(reader); }
+      writer.retire(rec_new(0));
+      for (int i = 0; i < 5; ++i) writer.collect();
+      assert(domain.pending() == 1);
+    }
+
+    // batches free on their own
+    for (long i = 0; i < 1000; ++i) writer.retire(rec_new(i));
+    assert(domain.pending() < 1000);
+  }
+  // the domain frees whatever is left
+  assert(g_live.load() == 0);
+
+  {
+    rec_epoch domain;
+    { rec_epoch::handle first(domain); }
+    // a released record is reused
+    rec_epoch::handle second(domain);
+    second.retire(rec_new(1));
+  }
+  assert(g_live.load() == 0);
+}
+
+void test_reclamation_hazard(void) {
+  std::cout << "\t hazard pointers" << std::endl;
+
+  {
+    rec_hazard domain;
+    rec_hazard::handle writer(domain);
+    rec_hazard::handle reader(domain);
+
+    ft::atomic< rec_node* > shared(rec_new(42));
+    rec_node* seen = reader.protect(1, shared);
+    assert(seen->value == 42);
+
+    shared.store(ft::u_nullptr);
+    writer.retire(seen);
+    for (long i = 0; i < 9; ++i) writer.retire(rec_new(i));
+    writer.scan();
+    // only the protected node survives the scan
+    assert(domain.pending() == 1 && g_live.load() == 1);
+    assert(seen->value == 42);
+
+    reader.clear(1);
+    writer.scan();
+    assert(domain.pending() == 0 && g_live.load() == 0);
+
+    for (long i = 0; i < 1000; ++i) writer.retire(rec_new(i));
+    assert(domain.pending() < rec_hazard::batch);
+  }
+  assert(g_live.load() == 0);
+}
+
+namespace {
+
+const int g_rounds = 20000;
+const int g_threads = 4;
+
+template < class Domain >
+struct rec_test_shared {
+  Domain* domain;
+  rec_stack* stack;
+  ft::atomic< long > popped;
+  ft::atomic< long > sum;
+};
+
+template < class Domain >
+void* rec_test_worker(void* arg) {
+  rec_test_shared< Domain >* shared =
+      static_cast< rec_test_shared< Domain >* >(arg);
+  typename Domain::handle h(*shared->domain);
+  long popped = 0;
+  long sum = 0;
+  for (int i = 0; i < g_rounds; ++i) {
+    shared->stack->push(rec_new(i));
+    if (i % 3 != 2) {
+      long value;
+      if (shared->stack->pop(h, value)) {
+        ++popped;
+        sum += value;
+      }
+    }
+  }
+  shared->popped.fetch_add(popped);
+  shared->sum.fetch_add(sum);
+  return NULL;
+}
+
+template < class Domain >
+void rec_test_stress(void) {
+  rec_stack stack;
+  {
+    Domain domain;
+    rec_test_shared< Domain > shared;
+    shared.domain = &domain;
+    shared.stack = &stack;
+
+    pthread_t ids[g_threads];
+    for (int i = 0; i < g_threads; ++i) {
+      pthread_create(&ids[i], NULL, rec_test_worker< Domain >, &shared);
+    }
+    for (int i = 0; i < g_threads; ++i) pthread_join(ids[i], NULL);
+
+    // drain: every pushed value comes out exactly once
+    typename Domain::handle h(domain);
+    long popped = shared.popped.load();
+    long sum = shared.sum.load();
+    long value;
+    while (stack.pop(h, value)) {
+      ++popped;
+      sum += value;
+    }
+    long per_thread = static_cast< long >(g_rounds) * (g_rounds - 1) / 2;
+    assert(popped == static_cast< long >(g_rounds) * g_threads);
+    assert(sum == per_thread * g_threads);
+  }
+  assert(g_live.load() == 0);
+}
+
+}  // namespace
+
+void test_reclamation_stress(void) {
+  std::cout << "\t stress (treiber stack)" << std::endl;
+  rec_test_stress< rec_epoch >();
+  rec_test_stress< rec_hazard >();
+}
+
+void test_reclamation(void) {
+  std::cout << "Test: reclamation" << std::endl;
+  test_reclamation_epoch();
+  test_reclamation_hazard();
+  test_reclamation_stress();
+}
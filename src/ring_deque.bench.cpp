@@ -0,0 +1,111 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/22
+ * @file src/ring_deque.bench.cpp
+ */
+
+#include <deque>
+#include <iostream>
+
+#include "bench.hpp"
+#include "ring_deque.hpp"
+#include "vector.hpp"
+
+namespace {
+
+/* a FIFO filled then drained, and a fixed size window sliding over ints */
+const std::size_t g_fill = 1 << 15;
+const std::size_t g_window = 1 << 12;
+const std::size_t g_slides = 1 << 20;
+/* the vector queue is O(window) per pop, so it gets fewer slides */
+const std::size_t g_vector_slides = 1 << 14;
+
+void rd_bench_pop_front(ft::vector< int >& q) { q.erase(q.begin()); }
+void rd_bench_pop_front(std::deque< int >& q) { q.pop_front(); }
+void rd_bench_pop_front(ft::ring_deque< int >& q) { q.pop_front(); }
+
+/**
+ * @brief Push g_fill ints, then pop them all from the front.
+ */
+template < class Queue >
+void rd_bench_fill_drain(const char* label) {
+  Queue q;
+  std::size_t sum = 0;
+  double start = bench_now();
+  for (std::size_t i = 0; i < g_fill; ++i) q.push_back(static_cast< int >(i));
+  while (!q.empty()) {
+    sum += static_cast< std::size_t >(q.front());
+    rd_bench_pop_front(q);
+  }
+  bench_report(label, bench_now() - start, g_fill);
+  bench_sink(sum);
+}
+
+/**
+ * @brief Keep g_window ints queued: each slide pushes one and pops one.
+ */
+template < class Queue >
+void rd_bench_slide(const char* label, std::size_t slides) {
+  Queue q;
+  for (std::size_t i = 0; i < g_window; ++i) {
+    q.push_back(static_cast< int >(i));
+  }
+  std::size_t sum = 0;
+  double start = bench_now();
+  for (std::size_t i = 0; i < slides; ++i) {
+    q.push_back(static_cast< int >(i));
+    sum += static_cast< std::size_t >(q.front());
+    rd_bench_pop_front(q);
+  }
+  bench_report(label, bench_now() - start, slides);
+  bench_sink(sum);
+}
+
+/**
+ * @brief Indexed scan of a window that wraps around the ring.
+ */
+template < class Queue >
+void rd_bench_index(const char* label) {
+  Queue q;
+  for (std::size_t i = 0; i < g_window; ++i) {
+    q.push_back(static_cast< int >(i));
+  }
+  for (std::size_t i = 0; i < g_window / 2; ++i) {
+    q.push_back(static_cast< int >(i));
+    q.pop_front();
+  }
+  std::size_t sum = 0;
+  double start = bench_now();
+  for (std::size_t round = 0; round < 256; ++round) {
+    for (std::size_t i = 0; i < q.size(); ++i) {
+      sum += static_cast< std::size_t >(q[i]);
+    }
+  }
+  bench_report(label, bench_now() - start, 256 * g_window);
+  bench_sink(sum);
+}
+
+}  // namespace
+
+void bench_ring_deque(void) {
+  std::cout << "Bench: ring_deque" << std::endl;
+
+  rd_bench_fill_drain< ft::vector< int > >("fill+drain, vector erase(begin)");
+  rd_bench_fill_drain< std::deque< int > >("fill+drain, std::deque");
+  rd_bench_fill_drain< ft::ring_deque< int > >("fill+drain, ft::ring_deque");
+
+  rd_bench_slide< ft::vector< int > >("slide, vector erase(begin)",
+                                      g_vector_slides);
+  rd_bench_slide< std::deque< int > >("slide, std::deque", g_slides);
+  rd_bench_slide< ft::ring_deque< int > >("slide, ft::ring_deque", g_slides);
+
+  rd_bench_index< std::deque< int > >("indexed scan, std::deque");
+  rd_bench_index< ft::ring_deque< int > >("indexed scan, ft::ring_deque");
+}
@@ -0,0 +1,538 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/22
+ * @file src/ring_deque.hpp
+ */
+
+#if !defined(FT__RING_DEQUE_HPP)
+#define FT__RING_DEQUE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+#include "algorithm.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+#include "utility.hpp"
+
+namespace ft {
+
+/**
+ * @brief Random access iterator over a ring_deque: the buffer, its mask, the
+ * physical slot of the front and a logical index, so it wraps around the end
+ * of the buffer and compares by position in the deque.
+ */
+template < class T >
+class ring_iterator : public ft::iterator< ft::random_access_iterator_tag, T > {
+ public:
+  typedef ft::random_access_iterator_tag iterator_category;
+  typedef T value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef T* pointer;
+  typedef T& reference;
+
+ protected:
+  T* _buffer;
+  std::size_t _mask;
+  std::size_t _head;
+  difference_type _index;
+
+ public:
+  ring_iterator() : _buffer(u_nullptr), _mask(0), _head(0), _index(0){};
+  ring_iterator(T* buffer, std::size_t mask, std::size_t head,
+                difference_type index)
+      : _buffer(buffer), _mask(mask), _head(head), _index(index){};
+
+  /**
+   * @brief ring_iterator< const T > casting operator
+   */
+  operator ring_iterator< const T >() const {
+    return ring_iterator< const T >(this->_buffer, this->_mask, this->_head,
+                                    this->_index);
+  };
+
+  reference operator*() const {
+    return this->_buffer[(this->_head + this->_index) & this->_mask];
+  };
+  pointer operator->() const { return &(operator*()); };
+
+  ring_iterator& operator++() {
+    ++this->_index;
+    return *this;
+  };
+
+  ring_iterator operator++(int) {
+    ring_iterator tmp = *this;
+    ++this->_index;
+    return tmp;
+  };
+
+  ring_iterator& operator--() {
+    --this->_index;
+    return *this;
+  };
+
+  ring_iterator operator--(int) {
+    ring_iterator tmp = *this;
+    --this->_index;
+    return tmp;
+  };
+
+  ring_iterator operator+(difference_type n) const {
+    return ring_iterator(this->_buffer, this->_mask, this->_head,
+                         this->_index + n);
+  };
+
+  ring_iterator& operator+=(difference_type n) {
+    this->_index += n;
+    return *this;
+  };
+
+  ring_iterator operator-(difference_type n) const {
+    return ring_iterator(this->_buffer, this->_mask, this->_head,
+                         this->_index - n);
+  };
+
+  ring_iterator& operator-=(difference_type n) {
+    this->_index -= n;
+    return *this;
+  };
+
+  reference operator[](difference_type n) const {
+    return this->_buffer[(this->_head + this->_index + n) & this->_mask];
+  };
+
+  /**
+   * @brief get the position in the deque, used for comparisons
+   */
+  difference_type index() const { return this->_index; };
+};
+
+template < class T1, class T2 >
+bool operator==(const ring_iterator< T1 >& lhs,
+                const ring_iterator< T2 >& rhs) {
+  return lhs.index() == rhs.index();
+};
+
+template < class T1, class T2 >
+bool operator!=(const ring_iterator< T1 >& lhs,
+                const ring_iterator< T2 >& rhs) {
+  return lhs.index() != rhs.index();
+};
+
+template < class T1, class T2 >
+bool operator<(const ring_iterator< T1 >& lhs,
+               const ring_iterator< T2 >& rhs) {
+  return lhs.index() < rhs.index();
+};
+
+template < class T1, class T2 >
+bool operator<=(const ring_iterator< T1 >& lhs,
+                const ring_iterator< T2 >& rhs) {
+  return lhs.index() <= rhs.index();
+};
+
+template < class T1, class T2 >
+bool operator>(const ring_iterator< T1 >& lhs,
+               const ring_iterator< T2 >& rhs) {
+  return lhs.index() > rhs.index();
+};
+
+template < class T1, class T2 >
+bool operator>=(const ring_iterator< T1 >& lhs,
+                const ring_iterator< T2 >& rhs) {
+  return lhs.index() >= rhs.index();
+};
+
+template < class T >
+ring_iterator< T > operator+(typename ring_iterator< T >::difference_type n,
+                             const ring_iterator< T >& iter) {
+  return iter + n;
+};
+
+template < class T1, class T2 >
+typename ring_iterator< T1 >::difference_type operator-(
+    const ring_iterator< T1 >& lhs, const ring_iterator< T2 >& rhs) {
+  return lhs.index() - rhs.index();
+};
+
+/**
+ * @brief Double ended queue over a single power of two ring buffer.
+ *
+ * The elements occupy size() consecutive slots starting at the front slot,
+ * wrapping past the end of the buffer, so push and pop at either end are
+ * O(1) and indexing is one add and one mask. Where a queue kept in an
+ * ft::vector pays an erase(begin()) that shifts every element, the ring
+ * only moves its front slot. When full, the buffer doubles and the ring is
+ * unrolled into it, front first, so the elements start at slot 0 again.
+ *
+ * insert and erase in the middle shift the shorter side. Any insertion or
+ * removal invalidates all iterators.
+ *
+ * @tparam T Type of the elements.
+ * @tparam _Alloc allocator of the buffer, defaults to `allocator<T>`.
+ */
+template < class T, class _Alloc = std::allocator< T > >
+class ring_deque {
+ public:
+  /* The first template parameter (T) */
+  typedef T value_type;
+  /* The second template parameter (_Alloc) */
+  typedef _Alloc allocator_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+  /* a random access iterator to value_type, wrapping around the buffer */
+  typedef ft::ring_iterator< T > iterator;
+  /* a random access iterator to const value_type */
+  typedef ft::ring_iterator< const T > const_iterator;
+  typedef ft::reverse_iterator< iterator > reverse_iterator;
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+  /* a signed integral type */
+  typedef std::ptrdiff_t difference_type;
+  /* an unsigned integral type */
+  typedef typename allocator_type::size_type size_type;
+
+ private:
+  /* capacity of the first buffer */
+  static const size_type _min_capacity = 8;
+
+  allocator_type _alloc;
+  pointer _buffer;
+  /* 0, or a power of two */
+  size_type _capacity;
+  /* slot of the front element */
+  size_type _head;
+  size_type _size;
+
+ public:
+  /**
+   * @brief empty container constructor (default constructor)
+   */
+  explicit ring_deque(const allocator_type& alloc = allocator_type())
+      : _alloc(alloc),
+        _buffer(u_nullptr),
+        _capacity(0),
+        _head(0),
+        _size(0){};
+
+  /**
+   * @brief fill constructor
+   */
+  explicit ring_deque(size_type n, const value_type& val = value_type(),
+                      const allocator_type& alloc = allocator_type())
+      : _alloc(alloc),
+        _buffer(u_nullptr),
+        _capacity(0),
+        _head(0),
+        _size(0) {
+    this->reserve(n);
+    while (this->_size < n) this->push_back(val);
+  };
+
+  /**
+   * @brief range constructor
+   */
+  template < class InputIterator >
+  ring_deque(InputIterator first, InputIterator last,
+             const allocator_type& alloc = allocator_type(),
+             typename ft::enable_if<
+                 !ft::is_integral< InputIterator >::value >::type* = u_nullptr)
+      : _alloc(alloc),
+        _buffer(u_nullptr),
+        _capacity(0),
+        _head(0),
+        _size(0) {
+    for (; first != last; ++first) this->push_back(*first);
+  };
+
+  /**
+   * @brief copy constructor, unrolls x's ring so the copy starts at slot 0
+   */
+  ring_deque(const ring_deque& x)
+      : _alloc(x._alloc),
+        _buffer(u_nullptr),
+        _capacity(0),
+        _head(0),
+        _size(0) {
+    this->reserve(x._size);
+    for (size_type i = 0; i < x._size; ++i) this->push_back(x[i]);
+  };
+
+  ring_deque& operator=(const ring_deque& x) {
+    if (this != &x) {
+      ring_deque tmp(x);
+      this->swap(tmp);
+    }
+    return *this;
+  };
+
+  ~ring_deque() {
+    this->clear();
+    if (this->_buffer != u_nullptr) {
+      this->_alloc.deallocate(this->_buffer, this->_capacity);
+    }
+  };
+
+  iterator begin() { return this->_iterator(0); };
+  const_iterator begin() const { return this->_iterator(0); };
+  iterator end() { return this->_iterator(this->_size); };
+  const_iterator end() const { return this->_iterator(this->_size); };
+  reverse_iterator rbegin() { return reverse_iterator(this->end()); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(this->end());
+  };
+  reverse_iterator rend() { return reverse_iterator(this->begin()); };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(this->begin());
+  };
+
+  size_type size() const { return this->_size; };
+  size_type max_size() const { return this->_alloc.max_size(); };
+  bool empty() const { return this->_size == 0; };
+
+  /**
+   * @brief Number of slots in the ring, a power of two.
+   */
+  size_type capacity() const { return this->_capacity; };
+
+  /**
+   * @brief Grow the ring to at least n slots, rounded up to a power of two.
+   */
+  void reserve(size_type n) {
+    if (n > this->max_size()) throw std::length_error("ft::ring_deque");
+    if (n <= this->_capacity) return;
+    size_type capacity = _min_capacity;
+    while (capacity < n) capacity <<= 1;
+    this->_reallocate(capacity);
+  };
+
+  void resize(size_type n, value_type val = value_type()) {
+    if (n > this->max_size()) throw std::length_error("ft::ring_deque");
+    while (this->_size > n) this->pop_back();
+    this->reserve(n);
+    while (this->_size < n) this->push_back(val);
+  };
+
+  reference operator[](size_type n) { return *this->_slot(n); };
+  const_reference operator[](size_type n) const { return *this->_slot(n); };
+
+  reference at(size_type n) {
+    if (n >= this->_size) throw std::out_of_range("ft::ring_deque");
+    return *this->_slot(n);
+  };
+
+  const_reference at(size_type n) const {
+    if (n >= this->_size) throw std::out_of_range("ft::ring_deque");
+    return *this->_slot(n);
+  };
+
+  reference front() { return *this->_slot(0); };
+  const_reference front() const { return *this->_slot(0); };
+  reference back() { return *this->_slot(this->_size - 1); };
+  const_reference back() const { return *this->_slot(this->_size - 1); };
+
+  void push_back(const value_type& val) {
+    if (this->_size == this->_capacity) {
+      value_type copy(val);
+      this->_grow();
+      this->_alloc.construct(this->_slot(this->_size), copy);
+    } else {
+      this->_alloc.construct(this->_slot(this->_size), val);
+    }
+    ++this->_size;
+  };
+
+  void push_front(const value_type& val) {
+    if (this->_size == this->_capacity) {
+      value_type copy(val);
+      this->_grow();
+      this->_alloc.construct(this->_slot(this->_capacity - 1), copy);
+    } else {
+      this->_alloc.construct(this->_slot(this->_capacity - 1), val);
+    }
+    this->_head = (this->_head - 1) & (this->_capacity - 1);
+    ++this->_size;
+  };
+
+  void pop_back() {
+    this->_alloc.destroy(this->_slot(--this->_size));
+  };
+
+  void pop_front() {
+    this->_alloc.destroy(this->_slot(0));
+    this->_head = (this->_head + 1) & (this->_capacity - 1);
+    --this->_size;
+  };
+
+  /**
+   * @brief Insert val before position, shifting the shorter side by one.
+   */
+  iterator insert(iterator position, const value_type& val) {
+    size_type index = static_cast< size_type >(position - this->begin());
+    if (index == 0) {
+      this->push_front(val);
+    } else if (index == this->_size) {
+      this->push_back(val);
+    } else {
+      value_type copy(val);
+      if (index < this->_size - index) {
+        this->push_front(this->front());
+        for (size_type i = 1; i < index; ++i) (*this)[i] = (*this)[i + 1];
+      } else {
+        this->push_back(this->back());
+        for (size_type i = this->_size - 2; i > index; --i) {
+          (*this)[i] = (*this)[i - 1];
+        }
+      }
+      (*this)[index] = copy;
+    }
+    return this->begin() + index;
+  };
+
+  iterator erase(iterator position) {
+    return this->erase(position, position + 1);
+  };
+
+  /**
+   * @brief Remove [first,last), shifting the shorter side over the gap.
+   */
+  iterator erase(iterator first, iterator last) {
+    size_type index = static_cast< size_type >(first - this->begin());
+    size_type n = static_cast< size_type >(last - first);
+    if (index < this->_size - index - n) {
+      for (size_type i = index; i-- > 0;) (*this)[i + n] = (*this)[i];
+      while (n--) this->pop_front();
+    } else {
+      for (size_type i = index + n; i < this->_size; ++i) {
+        (*this)[i - n] = (*this)[i];
+      }
+      while (n--) this->pop_back();
+    }
+    return this->begin() + index;
+  };
+
+  /**
+   * @brief Destroy every element; the buffer is kept.
+   */
+  void clear() {
+    while (this->_size) this->pop_back();
+    this->_head = 0;
+  };
+
+  void swap(ring_deque& x) {
+    ft::swap(this->_alloc, x._alloc);
+    ft::swap(this->_buffer, x._buffer);
+    ft::swap(this->_capacity, x._capacity);
+    ft::swap(this->_head, x._head);
+    ft::swap(this->_size, x._size);
+  };
+
+  allocator_type get_allocator() const { return this->_alloc; };
+
+ private:
+  pointer _slot(size_type n) const {
+    return this->_buffer + ((this->_head + n) & (this->_capacity - 1));
+  };
+
+  iterator _iterator(size_type n) {
+    return iterator(this->_buffer, this->_capacity - 1, this->_head,
+                    static_cast< difference_type >(n));
+  };
+
+  const_iterator _iterator(size_type n) const {
+    return const_iterator(this->_buffer, this->_capacity - 1, this->_head,
+                          static_cast< difference_type >(n));
+  };
+
+  void _grow() {
+    this->_reallocate(this->_capacity ? this->_capacity << 1 : _min_capacity);
+  };
+
+  /**
+   * @brief Move the ring into a buffer of capacity slots: the run from the
+   * front slot to the end of the old buffer, then the wrapped run from slot
+   * 0, so the elements land in order from slot 0.
+   */
+  void _reallocate(size_type capacity) {
+    pointer buffer = this->_alloc.allocate(capacity);
+    size_type first_run = this->_capacity - this->_head;
+    if (first_run > this->_size) first_run = this->_size;
+    pointer out = buffer;
+    for (size_type i = 0; i < first_run; ++i) {
+      this->_alloc.construct(out++, this->_buffer[this->_head + i]);
+      this->_alloc.destroy(this->_buffer + this->_head + i);
+    }
+    for (size_type i = 0; i < this->_size - first_run; ++i) {
+      this->_alloc.construct(out++, this->_buffer[i]);
+      this->_alloc.destroy(this->_buffer + i);
+    }
+    if (this->_buffer != u_nullptr) {
+      this->_alloc.deallocate(this->_buffer, this->_capacity);
+    }
+    this->_buffer = buffer;
+    this->_capacity = capacity;
+    this->_head = 0;
+  };
+};
+
+template < class T, class _Alloc >
+const typename ring_deque< T, _Alloc >::size_type
+    ring_deque< T, _Alloc >::_min_capacity;
+
+template < class T, class Alloc >
+bool operator==(const ring_deque< T, Alloc >& lhs,
+                const ring_deque< T, Alloc >& rhs) {
+  return lhs.size() == rhs.size() &&
+         ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+};
+
+template < class T, class Alloc >
+bool operator!=(const ring_deque< T, Alloc >& lhs,
+                const ring_deque< T, Alloc >& rhs) {
+  return !(lhs == rhs);
+};
+
+template < class T, class Alloc >
+bool operator<(const ring_deque< T, Alloc >& lhs,
+               const ring_deque< T, Alloc >& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+};
+
+template < class T, class Alloc >
+bool operator<=(const ring_deque< T, Alloc >& lhs,
+                const ring_deque< T, Alloc >& rhs) {
+  return !(rhs < lhs);
+};
+
+template < class T, class Alloc >
+bool operator>(const ring_deque< T, Alloc >& lhs,
+               const ring_deque< T, Alloc >& rhs) {
+  return rhs < lhs;
+};
+
+template < class T, class Alloc >
+bool operator>=(const ring_deque< T, Alloc >& lhs,
+                const ring_deque< T, Alloc >& rhs) {
+  return !(lhs < rhs);
+};
+
+template < class T, class Alloc >
+void swap(ring_deque< T, Alloc >& x, ring_deque< T, Alloc >& y) {
+  x.swap(y);
+};
+
+}  // namespace ft
+
+#endif  // FT__RING_DEQUE_HPP
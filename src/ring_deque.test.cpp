@@ -0,0 +1,173 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/22
+ * @file src/ring_deque.test.cpp
+ */
+
+#include "ring_deque.hpp"
+
+#include <cassert>
+#include <deque>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+/**
+ * @brief Element by element comparison with the std::deque reference.
+ */
+template < class T >
+bool rd_test_same(const ft::ring_deque< T >& rd, const std::deque< T >& ref) {
+  if (rd.size() != ref.size()) return false;
+  for (std::size_t i = 0; i < ref.size(); ++i) {
+    if (!(rd[i] == ref[i])) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+void test_ring_deque_ends(void) {
+  std::cout << "\t ends" << std::endl;
+
+  ft::ring_deque< int > rd;
+  std::deque< int > ref;
+  assert(rd.empty() && rd.capacity() == 0);
+
+  // a sliding window: the front slot walks around the ring many times
+  for (int i = 0; i < 6; ++i) {
+    rd.push_back(i);
+    ref.push_back(i);
+  }
+  assert(rd.capacity() == 8);
+  for (int i = 6; i < 100; ++i) {
+    rd.push_back(i);
+    rd.pop_front();
+    ref.push_back(i);
+    ref.pop_front();
+  }
+  assert(rd.capacity() == 8 && rd_test_same(rd, ref));
+  assert(rd.front() == 94 && rd.back() == 99);
+
+  // growth while wrapped unrolls the ring in order
+  for (int i = 0; i < 20; ++i) {
+    rd.push_front(-i);
+    ref.push_front(-i);
+    rd.push_back(100 + i);
+    ref.push_back(100 + i);
+  }
+  assert(rd.capacity() == 64 && rd_test_same(rd, ref));
+  while (!ref.empty()) {
+    assert(rd.front() == ref.front() && rd.back() == ref.back());
+    if (ref.size() % 2) {
+      rd.pop_front();
+      ref.pop_front();
+    } else {
+      rd.pop_back();
+      ref.pop_back();
+    }
+  }
+  assert(rd.empty());
+
+  // pushing an element of the deque itself survives the growth
+  ft::ring_deque< std::string > words(8, "word");
+  words.push_back(words.front());
+  words.push_front(words.back());
+  assert(words.size() == 10 && words.front() == "word");
+
+  try {
+    words.at(10);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+  words.clear();
+  assert(words.empty() && words.capacity() == 16);
+}
+
+void test_ring_deque_iterator(void) {
+  std::cout << "\t iterator" << std::endl;
+
+  ft::ring_deque< int > rd;
+  for (int i = 0; i < 5; ++i) rd.push_back(i);
+  for (int i = 1; i < 4; ++i) rd.push_front(-i);
+  // -3 -2 -1 0 1 2 3 4, wrapped around the end of the buffer
+  ft::ring_deque< int >::iterator it = rd.begin();
+  assert(*it == -3 && it[7] == 4 && rd.end() - it == 8);
+  it += 3;
+  assert(*it == 0 && *(it - 1) == -1 && *(2 + it) == 2);
+  assert(it > rd.begin() && it < rd.end() && it != rd.begin());
+
+  int sum = 0;
+  for (ft::ring_deque< int >::const_iterator c = rd.begin(); c != rd.end();
+       ++c) {
+    sum += *c;
+  }
+  assert(sum == 4);
+  ft::ring_deque< int >::reverse_iterator r = rd.rbegin();
+  assert(*r == 4 && r[7] == -3 && rd.rend() - r == 8);
+
+  const ft::ring_deque< int >& crd = rd;
+  ft::ring_deque< int > copy(crd.begin(), crd.end());
+  assert(copy == rd && !(copy < rd) && copy.capacity() == 8);
+  copy.back() = 5;
+  assert(rd < copy && copy > rd && rd != copy);
+}
+
+void test_ring_deque_modifiers(void) {
+  std::cout << "\t modifiers" << std::endl;
+
+  ft::ring_deque< int > rd;
+  std::deque< int > ref;
+  for (int i = 0; i < 10; ++i) {
+    rd.push_front(i);
+    ref.push_front(i);
+  }
+  // inserts near the front and near the back shift different sides
+  for (int i = 0; i < 30; ++i) {
+    std::size_t pos = static_cast< std::size_t >((i * 7) % (ref.size() + 1));
+    rd.insert(rd.begin() + pos, 100 + i);
+    ref.insert(ref.begin() + pos, 100 + i);
+  }
+  assert(rd_test_same(rd, ref));
+  assert(*rd.insert(rd.begin() + 3, rd[5]) == ref[5]);
+  ref.insert(ref.begin() + 3, ref[5]);
+  assert(rd_test_same(rd, ref));
+
+  assert(*rd.erase(rd.begin() + 2) == ref[3]);
+  ref.erase(ref.begin() + 2);
+  rd.erase(rd.end() - 5, rd.end() - 2);
+  ref.erase(ref.end() - 5, ref.end() - 2);
+  rd.erase(rd.begin() + 1, rd.begin() + 4);
+  ref.erase(ref.begin() + 1, ref.begin() + 4);
+  assert(rd_test_same(rd, ref));
+  ft::ring_deque< int >::iterator last = rd.erase(rd.begin(), rd.end());
+  assert(last == rd.end() && rd.empty());
+
+  rd.resize(5, 7);
+  assert(rd.size() == 5 && rd.back() == 7);
+  rd.resize(2);
+  assert(rd.size() == 2 && rd.capacity() == 64);
+  rd.reserve(100);
+  assert(rd.capacity() == 128 && rd[1] == 7);
+
+  ft::ring_deque< int > other(3, 1);
+  ft::swap(rd, other);
+  assert(rd.size() == 3 && other.size() == 2 && other.capacity() == 128);
+  other = rd;
+  assert(other == rd && other.capacity() == 8);
+}
+
+void test_ring_deque(void) {
+  std::cout << "Test: ring_deque" << std::endl;
+  test_ring_deque_ends();
+  test_ring_deque_iterator();
+  test_ring_deque_modifiers();
+}
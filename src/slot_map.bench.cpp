@@ -0,0 +1,174 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/25
+ * @file src/slot_map.bench.cpp
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+
+#include "bench.hpp"
+#include "slot_map.hpp"
+#include "unordered_map.hpp"
+#include "vector.hpp"
+
+namespace {
+
+/* a simulation of 64k live entities, each step killing one and spawning
+ * one, and moving every entity once per frame */
+const std::size_t g_entities = 1 << 16;
+const std::size_t g_steps = 1 << 20;
+const std::size_t g_frames = 64;
+
+struct sm_bench_entity {
+  float x;
+  float y;
+  float vx;
+  float vy;
+};
+
+sm_bench_entity sm_bench_spawn(std::size_t i) {
+  sm_bench_entity e;
+  e.x = static_cast< float >(i % 1024);
+  e.y = static_cast< float >(i / 1024);
+  e.vx = 0.5f;
+  e.vy = -0.25f;
+  return e;
+}
+
+/**
+ * @brief The pointer-based baselines: ids mapped to heap allocated
+ * entities, as an entity system without a dense store keeps them.
+ */
+typedef std::map< unsigned int, sm_bench_entity* > sm_bench_tree;
+typedef ft::unordered_map< unsigned int, sm_bench_entity* > sm_bench_hash;
+typedef ft::slot_map< sm_bench_entity > sm_bench_slots;
+
+template < class Map >
+unsigned int sm_bench_add(Map& c, std::size_t i, unsigned int& next_id) {
+  c[next_id] = new sm_bench_entity(sm_bench_spawn(i));
+  return next_id++;
+}
+
+template < class Map >
+void sm_bench_remove(Map& c, unsigned int id) {
+  typename Map::iterator it = c.find(id);
+  delete it->second;
+  c.erase(it);
+}
+
+float sm_bench_frame(sm_bench_slots& c) {
+  float sum = 0;
+  for (sm_bench_slots::iterator it = c.begin(); it != c.end(); ++it) {
+    it->x += it->vx;
+    it->y += it->vy;
+    sum += it->x;
+  }
+  return sum;
+}
+
+template < class Map >
+float sm_bench_frame(Map& c) {
+  float sum = 0;
+  for (typename Map::iterator it = c.begin(); it != c.end(); ++it) {
+    sm_bench_entity* e = it->second;
+    e->x += e->vx;
+    e->y += e->vy;
+    sum += e->x;
+  }
+  return sum;
+}
+
+template < class Map >
+void sm_bench_clear(Map& c) {
+  for (typename Map::iterator it = c.begin(); it != c.end(); ++it) {
+    delete it->second;
+  }
+}
+
+/**
+ * @brief Fill the map, churn it (kill a random entity, spawn one), then
+ * run frames over what is left.
+ */
+template < class Map >
+void sm_bench_map(const char* name) {
+  std::cout << "\t " << name << std::endl;
+  std::srand(42);
+  Map c;
+  unsigned int next_id = 0;
+  ft::vector< unsigned int > ids;
+  for (std::size_t i = 0; i < g_entities; ++i) {
+    ids.push_back(sm_bench_add(c, i, next_id));
+  }
+
+  double start = bench_now();
+  for (std::size_t i = 0; i < g_steps; ++i) {
+    std::size_t at = std::rand() % ids.size();
+    sm_bench_remove(c, ids[at]);
+    ids[at] = sm_bench_add(c, i, next_id);
+  }
+  bench_report("  churn (erase + insert)", bench_now() - start, g_steps);
+
+  float sum = 0;
+  start = bench_now();
+  for (std::size_t f = 0; f < g_frames; ++f) sum += sm_bench_frame(c);
+  bench_report("  iterate and update", bench_now() - start,
+               g_frames * c.size());
+
+  start = bench_now();
+  for (std::size_t i = 0; i < g_steps; ++i) {
+    sum += c.find(ids[std::rand() % ids.size()])->second->x;
+  }
+  bench_report("  lookup by id", bench_now() - start, g_steps);
+  bench_sink(static_cast< std::size_t >(sum));
+  sm_bench_clear(c);
+}
+
+void sm_bench_slot_map(void) {
+  std::cout << "\t ft::slot_map" << std::endl;
+  std::srand(42);
+  sm_bench_slots c;
+  ft::vector< ft::slot_map_key > keys;
+  for (std::size_t i = 0; i < g_entities; ++i) {
+    keys.push_back(c.insert(sm_bench_spawn(i)));
+  }
+
+  double start = bench_now();
+  for (std::size_t i = 0; i < g_steps; ++i) {
+    std::size_t at = std::rand() % keys.size();
+    c.erase(keys[at]);
+    keys[at] = c.insert(sm_bench_spawn(i));
+  }
+  bench_report("  churn (erase + insert)", bench_now() - start, g_steps);
+
+  float sum = 0;
+  start = bench_now();
+  for (std::size_t f = 0; f < g_frames; ++f) sum += sm_bench_frame(c);
+  bench_report("  iterate and update", bench_now() - start,
+               g_frames * c.size());
+
+  start = bench_now();
+  for (std::size_t i = 0; i < g_steps; ++i) {
+    sum += c[keys[std::rand() % keys.size()]].x;
+  }
+  bench_report("  lookup by key", bench_now() - start, g_steps);
+  bench_sink(static_cast< std::size_t >(sum));
+}
+
+}  // namespace
+
+void bench_slot_map(void) {
+  std::cout << "Bench: slot_map" << std::endl;
+
+  sm_bench_map< sm_bench_tree >("std::map of pointers");
+  sm_bench_map< sm_bench_hash >("ft::unordered_map of pointers");
+  sm_bench_slot_map();
+}
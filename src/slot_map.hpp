@@ -0,0 +1,321 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/25
+ * @file src/slot_map.hpp
+ */
+
+#if !defined(FT__SLOT_MAP_HPP)
+#define FT__SLOT_MAP_HPP
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+#include "util.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+/**
+ * @brief Handle to an element of a slot_map: the slot it was given and the
+ * generation that slot had at the time. Erasing bumps the generation, so an
+ * old handle no longer matches even after the slot is reused.
+ */
+struct slot_map_key {
+  unsigned int index;
+  unsigned int generation;
+
+  slot_map_key() : index(0), generation(0){};
+  slot_map_key(unsigned int index, unsigned int generation)
+      : index(index), generation(generation){};
+};
+
+inline bool operator==(const slot_map_key& lhs, const slot_map_key& rhs) {
+  return lhs.index == rhs.index && lhs.generation == rhs.generation;
+};
+
+inline bool operator!=(const slot_map_key& lhs, const slot_map_key& rhs) {
+  return !(lhs == rhs);
+};
+
+inline bool operator<(const slot_map_key& lhs, const slot_map_key& rhs) {
+  return lhs.index < rhs.index ||
+         (lhs.index == rhs.index && lhs.generation < rhs.generation);
+};
+
+/**
+ * @brief Unordered container that hands out stable keys to elements stored
+ * densely in one ft::vector.
+ *
+ * Elements are packed at [begin(), end()), so iteration is a plain vector
+ * scan. Erase moves the last element into the hole (swap and pop), which
+ * reorders elements but never shifts more than one. Keys do not point into
+ * that array: a key names a slot, and the slot records where its element
+ * currently is and its generation. Lookup by key is two indexed loads; a key
+ * whose element was erased is detected by the generation mismatch instead of
+ * reading whatever now lives there. Freed slots are kept on a free list and
+ * reused by insert.
+ *
+ * Insert may reallocate and erase moves the last element, so iterators and
+ * references are invalidated by both; keys stay valid until their own
+ * element is erased. A slot's generation wraps after 2^32 reuses.
+ *
+ * @tparam T Type of the elements, assignable.
+ * @tparam _Alloc allocator of the elements, defaults to `allocator<T>`.
+ */
+template < class T, class _Alloc = std::allocator< T > >
+class slot_map {
+ public:
+  /* The first template parameter (T) */
+  typedef T value_type;
+  /* The second template parameter (_Alloc) */
+  typedef _Alloc allocator_type;
+  /* stable name of an element until it is erased */
+  typedef ft::slot_map_key key_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+  /* a random access iterator over the dense elements */
+  typedef typename ft::vector< T, _Alloc >::iterator iterator;
+  typedef typename ft::vector< T, _Alloc >::const_iterator const_iterator;
+  typedef typename ft::vector< T, _Alloc >::reverse_iterator reverse_iterator;
+  typedef typename ft::vector< T, _Alloc >::const_reverse_iterator
+      const_reverse_iterator;
+  typedef std::ptrdiff_t difference_type;
+  typedef std::size_t size_type;
+
+ private:
+  /**
+   * @brief Where a live slot's element is in _values, or the next free slot.
+   */
+  struct _slot {
+    unsigned int index;
+    unsigned int generation;
+  };
+
+  typedef ft::vector< _slot,
+                      typename _Alloc::template rebind< _slot >::other >
+      _slot_container;
+  typedef ft::vector< unsigned int,
+                      typename _Alloc::template rebind< unsigned int >::other >
+      _index_container;
+
+  /* end of the free list */
+  static const unsigned int _npos = static_cast< unsigned int >(-1);
+
+  ft::vector< T, _Alloc > _values;
+  /* slot of each element of _values, to fix it up when the element moves */
+  _index_container _slot_of;
+  _slot_container _slots;
+  unsigned int _free_head;
+
+ public:
+  /**
+   * @brief empty container constructor (default constructor)
+   */
+  explicit slot_map(const allocator_type& alloc = allocator_type())
+      : _values(alloc), _slot_of(), _slots(), _free_head(_npos){};
+
+  iterator begin() { return this->_values.begin(); };
+  const_iterator begin() const { return this->_values.begin(); };
+  iterator end() { return this->_values.end(); };
+  const_iterator end() const { return this->_values.end(); };
+  reverse_iterator rbegin() { return this->_values.rbegin(); };
+  const_reverse_iterator rbegin() const { return this->_values.rbegin(); };
+  reverse_iterator rend() { return this->_values.rend(); };
+  const_reverse_iterator rend() const { return this->_values.rend(); };
+
+  size_type size() const { return this->_values.size(); };
+  bool empty() const { return this->_values.empty(); };
+  size_type capacity() const { return this->_values.capacity(); };
+
+  /**
+   * @brief Keys are 32 bit slot numbers, one of which marks the free list
+   * end.
+   */
+  size_type max_size() const {
+    size_type keys = static_cast< size_type >(_npos);
+    return this->_values.max_size() < keys ? this->_values.max_size() : keys;
+  };
+
+  /**
+   * @brief Reserve room for n elements and their slots, so that the next
+   * n - size() inserts do not reallocate.
+   */
+  void reserve(size_type n) {
+    if (n > this->max_size()) throw std::length_error("ft::slot_map");
+    this->_values.reserve(n);
+    this->_slot_of.reserve(n);
+    this->_slots.reserve(n);
+  };
+
+  pointer data() { return this->_values.data(); };
+  const_pointer data() const { return this->_values.data(); };
+
+  allocator_type get_allocator() const {
+    return this->_values.get_allocator();
+  };
+
+  /**
+   * @brief Whether k names an element still in the container.
+   */
+  bool contains(const key_type& k) const {
+    return k.index < this->_slots.size() &&
+           this->_slots[k.index].generation == k.generation;
+  };
+
+  /**
+   * @brief Element named by k, which must be valid.
+   */
+  reference operator[](const key_type& k) {
+    return this->_values[this->_slots[k.index].index];
+  };
+  const_reference operator[](const key_type& k) const {
+    return this->_values[this->_slots[k.index].index];
+  };
+
+  /**
+   * @brief Element named by k, checking it first.
+   *
+   * @throw std::out_of_range if the element of k was erased
+   */
+  reference at(const key_type& k) {
+    if (!this->contains(k)) throw std::out_of_range("ft::slot_map");
+    return (*this)[k];
+  };
+  const_reference at(const key_type& k) const {
+    if (!this->contains(k)) throw std::out_of_range("ft::slot_map");
+    return (*this)[k];
+  };
+
+  /**
+   * @brief Iterator to the element named by k, or end() if k is stale.
+   */
+  iterator find(const key_type& k) {
+    if (!this->contains(k)) return this->end();
+    return this->begin() + this->_slots[k.index].index;
+  };
+  const_iterator find(const key_type& k) const {
+    if (!this->contains(k)) return this->end();
+    return this->begin() + this->_slots[k.index].index;
+  };
+
+  /**
+   * @brief Key of the element at position.
+   */
+  key_type key_of(const_iterator position) const {
+    unsigned int slot = this->_slot_of[position - this->begin()];
+    return key_type(slot, this->_slots[slot].generation);
+  };
+
+  /**
+   * @brief Appends val and returns its key, reusing a free slot if any.
+   */
+  key_type insert(const value_type& val) {
+    if (this->_free_head == _npos && this->_slots.size() >= this->max_size())
+      throw std::length_error("ft::slot_map");
+    unsigned int slot = this->_free_head;
+    if (slot == _npos) slot = static_cast< unsigned int >(this->_slots.size());
+    this->_values.push_back(val);
+    try {
+      this->_slot_of.push_back(slot);
+      // the new slot goes in last, so no state names it if a push throws
+      if (slot == this->_slots.size()) {
+        _slot fresh = {0, 0};
+        this->_slots.push_back(fresh);
+      }
+    } catch (...) {
+      if (this->_slot_of.size() == this->_values.size()) {
+        this->_slot_of.pop_back();
+      }
+      this->_values.pop_back();
+      throw;
+    }
+    if (slot == this->_free_head) {
+      this->_free_head = this->_slots[slot].index;
+    }
+    this->_slots[slot].index =
+        static_cast< unsigned int >(this->_values.size() - 1);
+    return key_type(slot, this->_slots[slot].generation);
+  };
+
+  /**
+   * @brief Erases the element at position by moving the last element into
+   * its place.
+   *
+   * @return position, now holding the moved element, or end()
+   */
+  iterator erase(iterator position) {
+    size_type i = position - this->begin();
+    unsigned int slot = this->_slot_of[i];
+    size_type last = this->_values.size() - 1;
+    if (i != last) {
+      this->_values[i] = this->_values[last];
+      this->_slot_of[i] = this->_slot_of[last];
+      this->_slots[this->_slot_of[i]].index = static_cast< unsigned int >(i);
+    }
+    this->_values.pop_back();
+    this->_slot_of.pop_back();
+    ++this->_slots[slot].generation;
+    this->_slots[slot].index = this->_free_head;
+    this->_free_head = slot;
+    return this->begin() + i;
+  };
+
+  /**
+   * @brief Erases the element named by k, if it is still there.
+   *
+   * @return the number of elements erased, 0 or 1
+   */
+  size_type erase(const key_type& k) {
+    if (!this->contains(k)) return 0;
+    this->erase(this->begin() + this->_slots[k.index].index);
+    return 1;
+  };
+
+  /**
+   * @brief Erases every element. Every key handed out so far becomes stale
+   * and every slot goes back on the free list.
+   */
+  void clear() {
+    // free slots already have a generation no key carries
+    for (size_type i = 0; i < this->_slot_of.size(); ++i) {
+      ++this->_slots[this->_slot_of[i]].generation;
+    }
+    this->_values.clear();
+    this->_slot_of.clear();
+    this->_free_head = _npos;
+    for (size_type i = this->_slots.size(); i > 0; --i) {
+      this->_slots[i - 1].index = this->_free_head;
+      this->_free_head = static_cast< unsigned int >(i - 1);
+    }
+  };
+
+  void swap(slot_map& x) {
+    this->_values.swap(x._values);
+    this->_slot_of.swap(x._slot_of);
+    this->_slots.swap(x._slots);
+    ft::swap(this->_free_head, x._free_head);
+  };
+};
+
+template < class T, class _Alloc >
+const unsigned int slot_map< T, _Alloc >::_npos;
+
+template < class T, class Alloc >
+void swap(slot_map< T, Alloc >& x, slot_map< T, Alloc >& y) {
+  x.swap(y);
+};
+
+}  // namespace ft
+
+#endif  // FT__SLOT_MAP_HPP
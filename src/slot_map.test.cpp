@@ -0,0 +1,195 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/25
+ * @file src/slot_map.test.cpp
+ */
+
+#include "slot_map.hpp"
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+/* allocations left before sm_test_allocator throws */
+std::size_t g_sm_test_budget = static_cast< std::size_t >(-1);
+
+template < class T >
+class sm_test_allocator : public std::allocator< T > {
+ public:
+  template < class U >
+  struct rebind {
+    typedef sm_test_allocator< U > other;
+  };
+
+  sm_test_allocator() : std::allocator< T >(){};
+  template < class U >
+  sm_test_allocator(const sm_test_allocator< U >& x) : std::allocator< T >(x){};
+
+  T* allocate(std::size_t n, const void* = 0) {
+    if (g_sm_test_budget == 0) throw std::bad_alloc();
+    --g_sm_test_budget;
+    return std::allocator< T >::allocate(n);
+  };
+};
+
+}  // namespace
+
+void test_slot_map_keys(void) {
+  std::cout << "\t keys" << std::endl;
+
+  ft::slot_map< int > sm;
+  assert(sm.empty() && sm.begin() == sm.end());
+  ft::slot_map< int >::key_type a = sm.insert(10);
+  ft::slot_map< int >::key_type b = sm.insert(20);
+  ft::slot_map< int >::key_type c = sm.insert(30);
+  assert(sm.size() == 3 && sm[a] == 10 && sm[b] == 20 && sm.at(c) == 30);
+
+  // erasing a key leaves the others pointing at their own elements
+  assert(sm.erase(a) == 1);
+  assert(!sm.contains(a) && sm.contains(b) && sm.contains(c));
+  assert(sm[b] == 20 && sm[c] == 30 && sm.size() == 2);
+  assert(sm.find(a) == sm.end() && *sm.find(c) == 30);
+  try {
+    sm.at(a);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+  assert(sm.erase(a) == 0);
+
+  // the freed slot is reused, under a new generation
+  ft::slot_map< int >::key_type d = sm.insert(40);
+  assert(d.index == a.index && d != a && !sm.contains(a));
+  assert(sm[d] == 40 && sm.size() == 3);
+  sm[d] = 41;
+  assert(sm.at(d) == 41);
+
+  // clear makes every key stale; new keys reuse the slots
+  sm.clear();
+  assert(sm.empty() && !sm.contains(b) && !sm.contains(d));
+  ft::slot_map< int >::key_type e = sm.insert(50);
+  assert(sm.contains(e) && e != b && e != c && e != d);
+  assert(!sm.contains(ft::slot_map< int >::key_type(1000, 0)));
+}
+
+void test_slot_map_iteration(void) {
+  std::cout << "\t iteration" << std::endl;
+
+  ft::slot_map< int > sm;
+  ft::slot_map< int >::key_type keys[10];
+  for (int i = 0; i < 10; ++i) keys[i] = sm.insert(i);
+
+  // the elements are dense, and key_of maps a position back to its key
+  int sum = 0;
+  for (ft::slot_map< int >::const_iterator it = sm.begin(); it != sm.end();
+       ++it) {
+    sum += *it;
+    assert(sm.key_of(it) == keys[*it]);
+  }
+  assert(sum == 45 && sm.end() - sm.begin() == 10 && sm.data()[9] == 9);
+
+  // erase the odd ones while walking: the last element fills each hole
+  for (ft::slot_map< int >::iterator it = sm.begin(); it != sm.end();) {
+    if (*it % 2) {
+      it = sm.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  assert(sm.size() == 5);
+  for (int i = 0; i < 10; ++i) {
+    assert(sm.contains(keys[i]) == (i % 2 == 0));
+    if (i % 2 == 0) assert(sm[keys[i]] == i);
+  }
+  assert(*sm.rbegin() == sm.data()[4]);
+
+  ft::slot_map< int > other;
+  ft::slot_map< int >::key_type o = other.insert(7);
+  ft::swap(sm, other);
+  assert(sm.size() == 1 && sm[o] == 7 && other[keys[4]] == 4);
+}
+
+void test_slot_map_churn(void) {
+  std::cout << "\t churn" << std::endl;
+
+  // random inserts and erases of strings against a std::map reference
+  ft::slot_map< std::string > sm;
+  std::map< ft::slot_map_key, std::string > ref;
+  ft::slot_map< std::string >::key_type stale[64];
+  std::size_t n_stale = 0;
+  for (int i = 0; i < 5000; ++i) {
+    if (ref.empty() || std::rand() % 3) {
+      std::string val(1 + std::rand() % 40, static_cast< char >('a' + i % 26));
+      ref[sm.insert(val)] = val;
+    } else {
+      std::map< ft::slot_map_key, std::string >::iterator it = ref.begin();
+      std::advance(it, std::rand() % ref.size());
+      assert(sm.erase(it->first) == 1);
+      if (n_stale < 64) stale[n_stale++] = it->first;
+      ref.erase(it);
+    }
+  }
+  assert(sm.size() == ref.size());
+  for (std::map< ft::slot_map_key, std::string >::iterator it = ref.begin();
+       it != ref.end(); ++it) {
+    assert(sm.contains(it->first) && sm[it->first] == it->second);
+  }
+  for (std::size_t i = 0; i < n_stale; ++i) {
+    assert(!sm.contains(stale[i]) && sm.find(stale[i]) == sm.end());
+  }
+  std::size_t live = 0;
+  for (ft::slot_map< std::string >::iterator it = sm.begin(); it != sm.end();
+       ++it) {
+    assert(ref[sm.key_of(it)] == *it);
+    ++live;
+  }
+  assert(live == ref.size());
+
+  ft::slot_map_key first = ref.begin()->first;
+  ft::slot_map< std::string > copy(sm);
+  assert(copy.size() == sm.size() && copy[first] == ref[first]);
+  sm.reserve(2 * sm.size());
+  assert(sm.capacity() >= 2 * ref.size() && sm[first] == ref[first]);
+}
+
+void test_slot_map_exceptions(void) {
+  std::cout << "\t exceptions" << std::endl;
+
+  // the first insert allocates the elements, their slot numbers and the
+  // slots; a failure at any step leaves no half inserted slot behind
+  for (std::size_t budget = 0; budget < 3; ++budget) {
+    ft::slot_map< int, sm_test_allocator< int > > sm;
+    g_sm_test_budget = budget;
+    try {
+      sm.insert(1);
+      assert(false);
+    } catch (const std::bad_alloc& e) {
+    }
+    g_sm_test_budget = static_cast< std::size_t >(-1);
+    assert(sm.empty() && !sm.contains(ft::slot_map_key(0, 0)));
+    ft::slot_map_key k = sm.insert(2);
+    assert(k == ft::slot_map_key(0, 0) && sm.size() == 1 && sm[k] == 2);
+  }
+}
+
+void test_slot_map(void) {
+  std::cout << "Test: slot_map" << std::endl;
+  test_slot_map_keys();
+  test_slot_map_iteration();
+  test_slot_map_churn();
+  test_slot_map_exceptions();
+}
@@ -0,0 +1,96 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/12
+ * @file src/soa_vector.bench.cpp
+ */
+
+#include <iostream>
+
+#include "bench.hpp"
+#include "soa_vector.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const std::size_t g_count = 1 << 22;
+const int g_passes = 8;
+
+typedef ft::pair< unsigned int, double > record;
+
+}  // namespace
+
+void bench_soa_vector(void) {
+  std::cout << "Bench: soa_vector" << std::endl;
+
+  ft::vector< record > aos;
+  ft::soa_vector< unsigned int, double > soa;
+  aos.reserve(g_count);
+  soa.reserve(g_count);
+  for (std::size_t i = 0; i < g_count; ++i) {
+    unsigned int key = static_cast< unsigned int >(i * 2654435761u);
+    aos.push_back(record(key, i * 0.25));
+    soa.push_back(key, i * 0.25);
+  }
+
+  std::size_t sink = 0;
+  double start;
+
+  // sum one field
+  double sum = 0;
+  start = bench_now();
+  for (int pass = 0; pass < g_passes; ++pass) {
+    for (std::size_t i = 0; i < aos.size(); ++i) sum += aos[i].second;
+  }
+  bench_report("ft::vector<pair> sum second", bench_now() - start,
+               g_count * g_passes);
+
+  start = bench_now();
+  for (int pass = 0; pass < g_passes; ++pass) {
+    ft::soa_column< const double > column =
+        static_cast< const ft::soa_vector< unsigned int, double >& >(soa)
+            .second_column();
+    for (const double* p = column.begin(); p != column.end(); ++p) sum += *p;
+  }
+  bench_report("soa_vector column sum second", bench_now() - start,
+               g_count * g_passes);
+
+  start = bench_now();
+  for (int pass = 0; pass < g_passes; ++pass) {
+    for (std::size_t i = 0; i < soa.size(); ++i) sum += soa[i].second;
+  }
+  bench_report("soa_vector proxy sum second", bench_now() - start,
+               g_count * g_passes);
+  sink += static_cast< std::size_t >(sum);
+
+  // count keys under a threshold
+  std::size_t hits = 0;
+  start = bench_now();
+  for (int pass = 0; pass < g_passes; ++pass) {
+    for (std::size_t i = 0; i < aos.size(); ++i) {
+      hits += aos[i].first < 0x40000000u;
+    }
+  }
+  bench_report("ft::vector<pair> filter first", bench_now() - start,
+               g_count * g_passes);
+
+  start = bench_now();
+  for (int pass = 0; pass < g_passes; ++pass) {
+    ft::soa_column< unsigned int > column = soa.first_column();
+    for (std::size_t i = 0; i < column.size(); ++i) {
+      hits += column[i] < 0x40000000u;
+    }
+  }
+  bench_report("soa_vector column filter first", bench_now() - start,
+               g_count * g_passes);
+  sink += hits;
+
+  bench_sink(sink);
+}
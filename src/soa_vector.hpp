@@ -0,0 +1,584 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/12
+ * @file src/soa_vector.hpp
+ */
+
+#if !defined(FT__SOA_VECTOR_HPP)
+#define FT__SOA_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+#include "algorithm.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+/**
+ * @brief Random access iterator over the two columns of a soa_vector.
+ * Dereferencing yields a pair of references, so code written against a
+ * vector of ft::pair reads the same.
+ *
+ * @tparam T1 first column type (const qualified for const_iterator)
+ * @tparam T2 second column type (const qualified for const_iterator)
+ */
+template < class T1, class T2 >
+class soa_iterator
+    : public ft::iterator< ft::random_access_iterator_tag,
+                           ft::pair< typename ft::remove_const< T1 >::type,
+                                     typename ft::remove_const< T2 >::type >,
+                           std::ptrdiff_t,
+                           ft::arrow_proxy< ft::pair_reference< T1, T2 > >,
+                           ft::pair_reference< T1, T2 > > {
+ public:
+  /* Preserves Iterator's category */
+  typedef ft::random_access_iterator_tag iterator_category;
+  /* pair< first_type, second_type > */
+  typedef ft::pair< typename ft::remove_const< T1 >::type,
+                    typename ft::remove_const< T2 >::type >
+      value_type;
+  /* a signed integral type */
+  typedef std::ptrdiff_t difference_type;
+  /* pair of references into the two columns */
+  typedef ft::pair_reference< T1, T2 > reference;
+  /* proxy keeping the reference alive for operator-> */
+  typedef ft::arrow_proxy< reference > pointer;
+
+ protected:
+  T1* _first;
+  T2* _second;
+
+ public:
+  /**
+   * @brief default constructor
+   */
+  soa_iterator() : _first(ft::u_nullptr), _second(ft::u_nullptr){};
+
+  /**
+   * @brief initalization constructor
+   */
+  soa_iterator(T1* first, T2* second) : _first(first), _second(second){};
+
+  /**
+   * @brief copy Construct
+   */
+  soa_iterator(const soa_iterator& other)
+      : _first(other._first), _second(other._second){};
+
+  /**
+   * @brief soa_iterator< const T1, const T2 > casting operator
+   */
+  operator soa_iterator< const T1, const T2 >() const {
+    return soa_iterator< const T1, const T2 >(this->_first, this->_second);
+  }
+
+  soa_iterator& operator=(const soa_iterator& other) {
+    this->_first = other._first;
+    this->_second = other._second;
+    return *this;
+  };
+
+  /**
+   * @brief Returns a pair of references to the pointed elements.
+   */
+  reference operator*() const { return reference(*_first, *_second); };
+
+  /**
+   * @brief Returns a proxy giving access to first / second.
+   */
+  pointer operator->() const { return pointer(operator*()); };
+
+  soa_iterator& operator++() {
+    ++_first;
+    ++_second;
+    return *this;
+  };
+
+  soa_iterator operator++(int) {
+    soa_iterator tmp = *this;
+    ++(*this);
+    return tmp;
+  };
+
+  soa_iterator& operator--() {
+    --_first;
+    --_second;
+    return *this;
+  };
+
+  soa_iterator operator--(int) {
+    soa_iterator tmp = *this;
+    --(*this);
+    return tmp;
+  };
+
+  soa_iterator operator+(difference_type n) const {
+    return soa_iterator(_first + n, _second + n);
+  };
+
+  soa_iterator& operator+=(difference_type n) {
+    _first += n;
+    _second += n;
+    return *this;
+  };
+
+  soa_iterator operator-(difference_type n) const {
+    return soa_iterator(_first - n, _second - n);
+  };
+
+  soa_iterator& operator-=(difference_type n) {
+    _first -= n;
+    _second -= n;
+    return *this;
+  };
+
+  reference operator[](difference_type n) const {
+    return reference(_first[n], _second[n]);
+  };
+
+  /**
+   * @brief get base pointer into the first column, used for comparisons
+   */
+  T1* const& base() const { return this->_first; }
+
+  /**
+   * @brief get base pointer into the second column
+   */
+  T2* const& second_base() const { return this->_second; }
+};
+
+template < class A1, class A2, class B1, class B2 >
+bool operator==(const soa_iterator< A1, A2 >& lhs,
+                const soa_iterator< B1, B2 >& rhs) {
+  return (lhs.base() == rhs.base());
+};
+
+template < class A1, class A2, class B1, class B2 >
+bool operator!=(const soa_iterator< A1, A2 >& lhs,
+                const soa_iterator< B1, B2 >& rhs) {
+  return (lhs.base() != rhs.base());
+};
+
+template < class A1, class A2, class B1, class B2 >
+bool operator<(const soa_iterator< A1, A2 >& lhs,
+               const soa_iterator< B1, B2 >& rhs) {
+  return (lhs.base() < rhs.base());
+};
+
+template < class A1, class A2, class B1, class B2 >
+bool operator<=(const soa_iterator< A1, A2 >& lhs,
+                const soa_iterator< B1, B2 >& rhs) {
+  return (lhs.base() <= rhs.base());
+};
+
+template < class A1, class A2, class B1, class B2 >
+bool operator>(const soa_iterator< A1, A2 >& lhs,
+               const soa_iterator< B1, B2 >& rhs) {
+  return (lhs.base() > rhs.base());
+};
+
+template < class A1, class A2, class B1, class B2 >
+bool operator>=(const soa_iterator< A1, A2 >& lhs,
+                const soa_iterator< B1, B2 >& rhs) {
+  return (lhs.base() >= rhs.base());
+};
+
+template < class T1, class T2 >
+soa_iterator< T1, T2 > operator+(
+    typename soa_iterator< T1, T2 >::difference_type n,
+    const soa_iterator< T1, T2 >& iter) {
+  return iter + n;
+};
+
+template < class A1, class A2, class B1, class B2 >
+typename soa_iterator< A1, A2 >::difference_type operator-(
+    const soa_iterator< A1, A2 >& lhs, const soa_iterator< B1, B2 >& rhs) {
+  return lhs.base() - rhs.base();
+};
+
+/**
+ * @brief Contiguous view of one column of a soa_vector: a pointer and a
+ * length, for tight loops the compiler can vectorize. Invalidated like an
+ * iterator.
+ *
+ * @tparam T column type, const qualified for a read only view
+ */
+template < class T >
+struct soa_column {
+  typedef T value_type;
+  typedef T* iterator;
+  /* an unsigned integral type */
+  typedef std::size_t size_type;
+
+  T* data;
+  size_type length;
+
+  soa_column(T* d, size_type n) : data(d), length(n){};
+
+  size_type size() const { return this->length; };
+  bool empty() const { return this->length == 0; };
+  T* begin() const { return this->data; };
+  T* end() const { return this->data + this->length; };
+  T& operator[](size_type n) const { return this->data[n]; };
+};
+
+/**
+ * @brief Sequence of pairs stored as a structure of arrays: every first
+ * member in one contiguous column, every second member in another.
+ *
+ * A scan over one field touches only that column, so no cache line is
+ * spent on the other member and the loop can be vectorized (see
+ * first_column / second_column). Element access through operator[] or
+ * the iterators yields ft::pair_reference proxies with the same first /
+ * second members as ft::pair, so algorithms written for a vector of pairs
+ * keep working. The price is one extra allocation and two writes per
+ * insert.
+ *
+ * Records with more than two fields can nest: the second column of a
+ * soa_vector< A, ft::pair< B, C > > is still a plain array of pairs, so
+ * keep the hot field first.
+ *
+ * @tparam T1 Type of the first members.
+ * @tparam T2 Type of the second members.
+ * @tparam _Alloc allocator, rebound for each column.
+ */
+template < class T1, class T2,
+           class _Alloc = std::allocator< ft::pair< T1, T2 > > >
+class soa_vector {
+ public:
+  /* The first template parameter (T1) */
+  typedef T1 first_type;
+  /* The second template parameter (T2) */
+  typedef T2 second_type;
+  /* pair< first_type, second_type > */
+  typedef ft::pair< T1, T2 > value_type;
+  /* The third template parameter (_Alloc) */
+  typedef _Alloc allocator_type;
+  /* storage of the first members */
+  typedef ft::vector< T1, typename _Alloc::template rebind< T1 >::other >
+      first_container_type;
+  /* storage of the second members, parallel to the first */
+  typedef ft::vector< T2, typename _Alloc::template rebind< T2 >::other >
+      second_container_type;
+  /* pair of references to an element */
+  typedef ft::pair_reference< T1, T2 > reference;
+  /* pair of const references to an element */
+  typedef ft::pair_reference< const T1, const T2 > const_reference;
+  /* a random access iterator to value_type */
+  typedef ft::soa_iterator< T1, T2 > iterator;
+  /* a random access iterator to const value_type */
+  typedef ft::soa_iterator< const T1, const T2 > const_iterator;
+  /* reverse_iterator<iterator> */
+  typedef ft::reverse_iterator< iterator > reverse_iterator;
+  /* reverse_iterator<const_iterator> */
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+  /* a signed integral type */
+  typedef std::ptrdiff_t difference_type;
+  /* an unsigned integral type */
+  typedef typename first_container_type::size_type size_type;
+
+ private:
+  first_container_type _first;
+  second_container_type _second;
+
+ public:
+  /**
+   * @brief empty container constructor (default constructor)
+   */
+  explicit soa_vector(const allocator_type& alloc = allocator_type())
+      : _first(alloc), _second(alloc){};
+
+  /**
+   * @brief fill constructor
+   */
+  explicit soa_vector(size_type n, const value_type& val = value_type(),
+                      const allocator_type& alloc = allocator_type())
+      : _first(n, val.first, alloc), _second(n, val.second, alloc){};
+
+  /**
+   * @brief range constructor, from any range of pairs
+   */
+  template < class InputIterator >
+  soa_vector(InputIterator first, InputIterator last,
+             const allocator_type& alloc = allocator_type(),
+             typename ft::enable_if< !ft::is_integral< InputIterator >::value,
+                                     InputIterator >::type* = ft::u_nullptr)
+      : _first(alloc), _second(alloc) {
+    for (; first != last; ++first) this->push_back(*first);
+  };
+
+  /**
+   * @brief copy constructor
+   */
+  soa_vector(const soa_vector& x) : _first(x._first), _second(x._second){};
+
+  soa_vector& operator=(const soa_vector& x) {
+    if (this != &x) {
+      soa_vector tmp(x);
+      this->swap(tmp);
+    }
+    return *this;
+  };
+
+  iterator begin() { return this->_at(0); };
+  const_iterator begin() const { return this->_at(0); };
+  iterator end() { return this->_at(this->size()); };
+  const_iterator end() const { return this->_at(this->size()); };
+
+  reverse_iterator rbegin() { return reverse_iterator(this->end()); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(this->end());
+  };
+  reverse_iterator rend() { return reverse_iterator(this->begin()); };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(this->begin());
+  };
+
+  size_type size() const { return this->_first.size(); };
+
+  size_type max_size() const {
+    return std::min(this->_first.max_size(), this->_second.max_size());
+  };
+
+  /**
+   * @brief Resizes the container so that it contains n elements, filling
+   * with val.
+   */
+  void resize(size_type n, value_type val = value_type()) {
+    size_type old = this->size();
+    this->_first.resize(n, val.first);
+    try {
+      this->_second.resize(n, val.second);
+    } catch (...) {
+      this->_first.resize(old);
+      throw;
+    }
+  };
+
+  size_type capacity() const {
+    return std::min(this->_first.capacity(), this->_second.capacity());
+  };
+
+  bool empty() const { return this->_first.empty(); };
+
+  void reserve(size_type n) {
+    this->_first.reserve(n);
+    this->_second.reserve(n);
+  };
+
+  reference operator[](size_type n) {
+    return reference(this->_first[n], this->_second[n]);
+  };
+
+  const_reference operator[](size_type n) const {
+    return const_reference(this->_first[n], this->_second[n]);
+  };
+
+  reference at(size_type n) {
+    if (n >= this->size()) throw std::out_of_range("ft::soa_vector");
+    return (*this)[n];
+  };
+
+  const_reference at(size_type n) const {
+    if (n >= this->size()) throw std::out_of_range("ft::soa_vector");
+    return (*this)[n];
+  };
+
+  reference front() { return (*this)[0]; };
+  const_reference front() const { return (*this)[0]; };
+  reference back() { return (*this)[this->size() - 1]; };
+  const_reference back() const { return (*this)[this->size() - 1]; };
+
+  /**
+   * @brief The first members, contiguous.
+   */
+  soa_column< T1 > first_column() {
+    return soa_column< T1 >(this->_data(this->_first), this->size());
+  };
+
+  soa_column< const T1 > first_column() const {
+    return soa_column< const T1 >(this->_data(this->_first), this->size());
+  };
+
+  /**
+   * @brief The second members, contiguous.
+   */
+  soa_column< T2 > second_column() {
+    return soa_column< T2 >(this->_data(this->_second), this->size());
+  };
+
+  soa_column< const T2 > second_column() const {
+    return soa_column< const T2 >(this->_data(this->_second), this->size());
+  };
+
+  void push_back(const value_type& val) {
+    this->push_back(val.first, val.second);
+  };
+
+  /**
+   * @brief Append (a, b) without building a pair.
+   */
+  void push_back(const first_type& a, const second_type& b) {
+    this->_first.push_back(a);
+    try {
+      this->_second.push_back(b);
+    } catch (...) {
+      this->_first.pop_back();
+      throw;
+    }
+  };
+
+  void pop_back() {
+    this->_first.pop_back();
+    this->_second.pop_back();
+  };
+
+  /**
+   * @brief single element insert
+   */
+  iterator insert(iterator position, const value_type& val) {
+    size_type offset = this->_offset(position);
+    this->_first.insert(this->_first.begin() + offset, val.first);
+    try {
+      this->_second.insert(this->_second.begin() + offset, val.second);
+    } catch (...) {
+      this->_first.erase(this->_first.begin() + offset);
+      throw;
+    }
+    return this->_at(offset);
+  };
+
+  /**
+   * @brief fill insert
+   */
+  void insert(iterator position, size_type n, const value_type& val) {
+    size_type offset = this->_offset(position);
+    this->_first.insert(this->_first.begin() + offset, n, val.first);
+    try {
+      this->_second.insert(this->_second.begin() + offset, n, val.second);
+    } catch (...) {
+      this->_first.erase(this->_first.begin() + offset,
+                         this->_first.begin() + offset + n);
+      throw;
+    }
+  };
+
+  iterator erase(iterator position) {
+    size_type offset = this->_offset(position);
+    this->_first.erase(this->_first.begin() + offset);
+    this->_second.erase(this->_second.begin() + offset);
+    return this->_at(offset);
+  };
+
+  iterator erase(iterator first, iterator last) {
+    size_type offset = this->_offset(first);
+    size_type n = last - first;
+    this->_first.erase(this->_first.begin() + offset,
+                       this->_first.begin() + offset + n);
+    this->_second.erase(this->_second.begin() + offset,
+                        this->_second.begin() + offset + n);
+    return this->_at(offset);
+  };
+
+  void swap(soa_vector& x) {
+    this->_first.swap(x._first);
+    this->_second.swap(x._second);
+  };
+
+  void clear() {
+    this->_first.clear();
+    this->_second.clear();
+  };
+
+  allocator_type get_allocator() const {
+    return allocator_type(this->_first.get_allocator());
+  };
+
+ private:
+  template < class Column >
+  static typename Column::pointer _data(Column& column) {
+    if (column.empty()) return ft::u_nullptr;
+    return &column[0];
+  };
+
+  template < class Column >
+  static typename Column::const_pointer _data(const Column& column) {
+    if (column.empty()) return ft::u_nullptr;
+    return &column[0];
+  };
+
+  size_type _offset(const_iterator position) const {
+    return position - this->begin();
+  };
+
+  iterator _at(size_type n) {
+    return iterator(this->_data(this->_first) + n,
+                    this->_data(this->_second) + n);
+  };
+
+  const_iterator _at(size_type n) const {
+    return const_iterator(this->_data(this->_first) + n,
+                          this->_data(this->_second) + n);
+  };
+};
+
+template < class T1, class T2, class Alloc >
+bool operator==(const soa_vector< T1, T2, Alloc >& lhs,
+                const soa_vector< T1, T2, Alloc >& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+};
+
+template < class T1, class T2, class Alloc >
+bool operator!=(const soa_vector< T1, T2, Alloc >& lhs,
+                const soa_vector< T1, T2, Alloc >& rhs) {
+  return !(lhs == rhs);
+};
+
+template < class T1, class T2, class Alloc >
+bool operator<(const soa_vector< T1, T2, Alloc >& lhs,
+               const soa_vector< T1, T2, Alloc >& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+};
+
+template < class T1, class T2, class Alloc >
+bool operator<=(const soa_vector< T1, T2, Alloc >& lhs,
+                const soa_vector< T1, T2, Alloc >& rhs) {
+  return !(rhs < lhs);
+};
+
+template < class T1, class T2, class Alloc >
+bool operator>(const soa_vector< T1, T2, Alloc >& lhs,
+               const soa_vector< T1, T2, Alloc >& rhs) {
+  return rhs < lhs;
+};
+
+template < class T1, class T2, class Alloc >
+bool operator>=(const soa_vector< T1, T2, Alloc >& lhs,
+                const soa_vector< T1, T2, Alloc >& rhs) {
+  return !(lhs < rhs);
+};
+
+template < class T1, class T2, class Alloc >
+void swap(soa_vector< T1, T2, Alloc >& x, soa_vector< T1, T2, Alloc >& y) {
+  x.swap(y);
+};
+
+}  // namespace ft
+
+#endif  // FT__SOA_VECTOR_HPP
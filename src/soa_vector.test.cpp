@@ -0,0 +1,150 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/12
+ * @file src/soa_vector.test.cpp
+ */
+
+#include "soa_vector.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "vector.hpp"
+
+typedef ft::soa_vector< unsigned int, double > ft_soa;
+typedef ft::soa_vector< int, std::string > ft_soa_str;
+
+void test_soa_vector_basic(void) {
+  std::cout << "\t basic" << std::endl;
+
+  ft_soa v;
+  assert(v.empty() && v.size() == 0 && v.begin() == v.end());
+  for (unsigned int i = 0; i < 100; ++i) v.push_back(i, i * 0.5);
+  v.push_back(ft::make_pair(100u, 50.0));
+  assert(v.size() == 101 && v.capacity() >= 101);
+
+  // proxies read like ft::pair
+  assert(v[10].first == 10 && v[10].second == 5.0);
+  v[10].second = 7.0;
+  assert(v.at(10).second == 7.0);
+  ft::pair< unsigned int, double > copy = v[10];
+  assert(copy.first == 10 && copy.second == 7.0);
+  assert(v.front().first == 0 && v.back().first == 100);
+  try {
+    v.at(101);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+
+  v.pop_back();
+  v.resize(50);
+  assert(v.size() == 50 && v.back().first == 49);
+  v.resize(52, ft::make_pair(7u, 1.5));
+  assert(v[51].first == 7 && v[51].second == 1.5);
+
+  const ft_soa& cv = v;
+  assert(cv[0].first == 0 && cv.begin()->second == 0.0);
+}
+
+void test_soa_vector_iterator(void) {
+  std::cout << "\t iterator" << std::endl;
+
+  ft_soa v;
+  for (unsigned int i = 0; i < 10; ++i) v.push_back(i, i * 2.0);
+
+  unsigned int n = 0;
+  for (ft_soa::iterator it = v.begin(); it != v.end(); ++it, ++n) {
+    assert(it->first == n && (*it).second == n * 2.0);
+    it->second += 1.0;
+  }
+  ft_soa::const_iterator cit = v.begin();
+  assert((cit + 3)->second == 7.0 && cit[9].first == 9);
+  assert(v.end() - v.begin() == 10 && v.begin() < v.end());
+
+  ft_soa::reverse_iterator rit = v.rbegin();
+  assert((*rit).first == 9 && rit[9].first == 0);
+
+  // range constructor from a vector of pairs, and back
+  ft::vector< ft::pair< unsigned int, double > > aos;
+  for (unsigned int i = 0; i < 5; ++i) aos.push_back(ft::make_pair(i, 1.0));
+  ft_soa from(aos.begin(), aos.end());
+  assert(from.size() == 5 && from[4].first == 4);
+  ft::vector< ft::pair< unsigned int, double > > back;
+  for (ft_soa::iterator it = from.begin(); it != from.end(); ++it) {
+    back.push_back(*it);
+  }
+  assert(back == aos);
+}
+
+void test_soa_vector_modifiers(void) {
+  std::cout << "\t modifiers" << std::endl;
+
+  ft_soa_str v;
+  for (int i = 0; i < 5; ++i) v.push_back(i, std::string(1, 'a' + i));
+
+  ft_soa_str::iterator it = v.insert(v.begin() + 2, ft::make_pair(9, "x"));
+  assert(it->first == 9 && v.size() == 6 && v[3].second == "c");
+  v.insert(v.end(), 2, ft::make_pair(8, std::string("y")));
+  assert(v.size() == 8 && v.back().second == "y");
+
+  it = v.erase(v.begin());
+  assert(it->first == 1 && v.size() == 7);
+  it = v.erase(v.begin() + 1, v.begin() + 3);
+  assert(it->second == "d" && v.size() == 5);
+
+  ft_soa_str w(v);
+  assert(w == v && !(w < v) && w <= v);
+  w[0].second = "z";
+  assert(w != v && v < w && w > v);
+
+  w.swap(v);
+  assert(v[0].second == "z");
+  ft::swap(w, v);
+  assert(w[0].second == "z");
+
+  v = w;
+  assert(v == w);
+  v.clear();
+  assert(v.empty());
+}
+
+void test_soa_vector_columns(void) {
+  std::cout << "\t columns" << std::endl;
+
+  ft_soa v;
+  assert(v.first_column().empty());
+  for (unsigned int i = 0; i < 1000; ++i) v.push_back(i, 1.0);
+
+  ft::soa_column< unsigned int > keys = v.first_column();
+  ft::soa_column< double > values = v.second_column();
+  assert(keys.size() == 1000 && values.size() == 1000);
+  // contiguous and shared with the container
+  assert(&keys[999] - &keys[0] == 999);
+  values[3] = 42.0;
+  assert(v[3].second == 42.0);
+
+  double sum = 0;
+  for (const double* p = values.begin(); p != values.end(); ++p) sum += *p;
+  assert(sum == 999 + 42.0);
+
+  const ft_soa& cv = v;
+  ft::soa_column< const unsigned int > ckeys = cv.first_column();
+  assert(ckeys[500] == 500);
+}
+
+void test_soa_vector(void) {
+  std::cout << "Test: soa_vector" << std::endl;
+  test_soa_vector_basic();
+  test_soa_vector_iterator();
+  test_soa_vector_modifiers();
+  test_soa_vector_columns();
+}
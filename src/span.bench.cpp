@@ -0,0 +1,100 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/19
+ * @file src/span.bench.cpp
+ */
+
+#include <iostream>
+
+#include "bench.hpp"
+#include "span.hpp"
+#include "vector.hpp"
+
+namespace {
+
+/* a 2048 x 2048 row major matrix of ints, handed out in row blocks */
+const std::size_t g_side = 2048;
+const std::size_t g_block = 64;
+
+/**
+ * @brief A worker taking its slice by value, as a copy.
+ */
+long long span_bench_work(ft::vector< int > slice) {
+  long long sum = 0;
+  for (std::size_t i = 0; i < slice.size(); ++i) sum += slice[i];
+  return sum;
+}
+
+/**
+ * @brief The same worker taking a view.
+ */
+long long span_bench_work(ft::span< const int > slice) {
+  long long sum = 0;
+  for (std::size_t i = 0; i < slice.size(); ++i) sum += slice[i];
+  return sum;
+}
+
+long long span_bench_work(ft::strided_span< const int > column) {
+  long long sum = 0;
+  for (std::size_t i = 0; i < column.size(); ++i) sum += column[i];
+  return sum;
+}
+
+}  // namespace
+
+void bench_span(void) {
+  std::cout << "Bench: span" << std::endl;
+
+  ft::vector< int > matrix(g_side * g_side);
+  for (std::size_t i = 0; i < matrix.size(); ++i) {
+    matrix[i] = static_cast< int >(i % 1000);
+  }
+  const ft::vector< int >& view = matrix;
+  long long sum = 0;
+
+  double start = bench_now();
+  for (std::size_t row = 0; row < g_side; row += g_block) {
+    ft::vector< int >::const_iterator first = view.begin() + row * g_side;
+    sum += span_bench_work(
+        ft::vector< int >(first, first + g_block * g_side));
+  }
+  bench_report("row blocks as ft::vector copies", bench_now() - start,
+               g_side * g_side);
+
+  start = bench_now();
+  ft::span< const int > all(view);
+  for (std::size_t row = 0; row < g_side; row += g_block) {
+    sum += span_bench_work(all.subspan(row * g_side, g_block * g_side));
+  }
+  bench_report("row blocks as ft::span", bench_now() - start,
+               g_side * g_side);
+
+  start = bench_now();
+  for (std::size_t col = 0; col < g_side; ++col) {
+    ft::vector< int > column;
+    column.reserve(g_side);
+    for (std::size_t row = 0; row < g_side; ++row) {
+      column.push_back(view[row * g_side + col]);
+    }
+    sum += span_bench_work(column);
+  }
+  bench_report("columns as ft::vector copies", bench_now() - start,
+               g_side * g_side);
+
+  start = bench_now();
+  for (std::size_t col = 0; col < g_side; ++col) {
+    sum += span_bench_work(
+        ft::strided_span< const int >(all.strided(g_side, col)));
+  }
+  bench_report("columns as ft::strided_span", bench_now() - start,
+               g_side * g_side);
+
+  bench_sink(static_cast< std::size_t >(sum));
+}
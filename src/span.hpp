@@ -0,0 +1,404 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/19
+ * @file src/span.hpp
+ */
+
+#if !defined(FT__SPAN_HPP)
+#define FT__SPAN_HPP
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+
+namespace ft {
+
+/* count argument of subspan meaning "up to the end" */
+static const std::size_t dynamic_extent = static_cast< std::size_t >(-1);
+
+template < class T >
+class strided_span;
+
+/* whether T is a strided_span, which has data() and size() but is not
+ * contiguous */
+template < class T >
+struct _is_strided_span : public false_type {};
+
+template < class T >
+struct _is_strided_span< strided_span< T > > : public true_type {};
+
+template < class T >
+struct _is_strided_span< const strided_span< T > > : public true_type {};
+
+/**
+ * @brief Non-owning view of a contiguous sequence: a pointer and a length.
+ * Copying a span never copies elements; it is valid as long as the viewed
+ * storage is (for a vector, until it reallocates).
+ *
+ * @tparam T Element type, const qualified for a read only view.
+ */
+template < class T >
+class span {
+ public:
+  typedef T element_type;
+  typedef typename ft::remove_const< T >::type value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef T* iterator;
+  typedef T* const_iterator;
+  typedef ft::reverse_iterator< iterator > reverse_iterator;
+  typedef reverse_iterator const_reverse_iterator;
+
+ protected:
+  T* _data;
+  size_type _size;
+
+ public:
+  span() : _data(u_nullptr), _size(0){};
+  span(T* data, size_type n) : _data(data), _size(n){};
+
+  template < class U, std::size_t N >
+  span(U (&array)[N]) : _data(array), _size(N){};
+
+  /**
+   * @brief View of a contiguous container: anything with data() and size(),
+   * e.g. ft::vector, ft::compact_vector or another span. A strided_span also
+   * has both but is not contiguous, so it does not convert.
+   */
+  template < class Container >
+  span(Container& container,
+       typename ft::enable_if< !_is_strided_span< Container >::value >::type* =
+           u_nullptr)
+      : _data(container.data()), _size(container.size()){};
+
+  template < class Container >
+  span(const Container& container,
+       typename ft::enable_if< !_is_strided_span< Container >::value >::type* =
+           u_nullptr)
+      : _data(container.data()), _size(container.size()){};
+
+  iterator begin() const { return this->_data; };
+  iterator end() const { return this->_data + this->_size; };
+  reverse_iterator rbegin() const { return reverse_iterator(this->end()); };
+  reverse_iterator rend() const { return reverse_iterator(this->begin()); };
+
+  size_type size() const { return this->_size; };
+  size_type size_bytes() const { return this->_size * sizeof(T); };
+  bool empty() const { return this->_size == 0; };
+  pointer data() const { return this->_data; };
+
+  reference operator[](size_type n) const { return this->_data[n]; };
+  reference at(size_type n) const {
+    if (n >= this->_size) throw std::out_of_range("ft::span");
+    return this->_data[n];
+  };
+  reference front() const { return this->_data[0]; };
+  reference back() const { return this->_data[this->_size - 1]; };
+
+  /**
+   * @brief The first n elements, n <= size().
+   */
+  span first(size_type n) const { return span(this->_data, n); };
+
+  /**
+   * @brief The last n elements, n <= size().
+   */
+  span last(size_type n) const {
+    return span(this->_data + this->_size - n, n);
+  };
+
+  /**
+   * @brief count elements from offset, or all of them from offset to the end
+   * with dynamic_extent. Throws std::out_of_range past the end.
+   */
+  span subspan(size_type offset, size_type count = dynamic_extent) const {
+    if (offset > this->_size) throw std::out_of_range("ft::span");
+    if (count == dynamic_extent) count = this->_size - offset;
+    if (count > this->_size - offset) throw std::out_of_range("ft::span");
+    return span(this->_data + offset, count);
+  };
+
+  /**
+   * @brief Every stride-th element from offset: a column of a row major
+   * matrix stride elements wide, for instance. Throws std::invalid_argument
+   * for a 0 stride and std::out_of_range past the end.
+   */
+  strided_span< T > strided(size_type stride, size_type offset = 0) const {
+    if (stride == 0) throw std::invalid_argument("ft::span");
+    if (offset > this->_size) throw std::out_of_range("ft::span");
+    return strided_span< T >(this->_data + offset,
+                             (this->_size - offset + stride - 1) / stride,
+                             stride);
+  };
+};
+
+/**
+ * @brief View of the bytes behind a span.
+ */
+template < class T >
+span< const unsigned char > as_bytes(const span< T >& s) {
+  return span< const unsigned char >(
+      reinterpret_cast< const unsigned char* >(s.data()), s.size_bytes());
+}
+
+/**
+ * @brief Random access iterator over a strided_span: a base pointer, a
+ * stride and an index, so no pointer is ever formed past the last element.
+ */
+template < class T >
+class strided_iterator
+    : public ft::iterator< ft::random_access_iterator_tag, T > {
+ public:
+  typedef ft::random_access_iterator_tag iterator_category;
+  typedef T value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef T* pointer;
+  typedef T& reference;
+
+ protected:
+  T* _data;
+  difference_type _stride;
+  difference_type _index;
+
+ public:
+  strided_iterator() : _data(u_nullptr), _stride(1), _index(0){};
+  strided_iterator(T* data, difference_type stride, difference_type index)
+      : _data(data), _stride(stride), _index(index){};
+
+  /**
+   * @brief strided_iterator< const T > casting operator
+   */
+  operator strided_iterator< const T >() const {
+    return strided_iterator< const T >(this->_data, this->_stride,
+                                       this->_index);
+  };
+
+  reference operator*() const {
+    return this->_data[this->_index * this->_stride];
+  };
+  pointer operator->() const {
+    return this->_data + this->_index * this->_stride;
+  };
+
+  strided_iterator& operator++() {
+    ++this->_index;
+    return *this;
+  };
+
+  strided_iterator operator++(int) {
+    strided_iterator tmp = *this;
+    ++this->_index;
+    return tmp;
+  };
+
+  strided_iterator& operator--() {
+    --this->_index;
+    return *this;
+  };
+
+  strided_iterator operator--(int) {
+    strided_iterator tmp = *this;
+    --this->_index;
+    return tmp;
+  };
+
+  strided_iterator operator+(difference_type n) const {
+    return strided_iterator(this->_data, this->_stride, this->_index + n);
+  };
+
+  strided_iterator& operator+=(difference_type n) {
+    this->_index += n;
+    return *this;
+  };
+
+  strided_iterator operator-(difference_type n) const {
+    return strided_iterator(this->_data, this->_stride, this->_index - n);
+  };
+
+  strided_iterator& operator-=(difference_type n) {
+    this->_index -= n;
+    return *this;
+  };
+
+  reference operator[](difference_type n) const {
+    return this->_data[(this->_index + n) * this->_stride];
+  };
+
+  /**
+   * @brief get the element index, used for comparisons
+   */
+  difference_type index() const { return this->_index; };
+};
+
+template < class T1, class T2 >
+bool operator==(const strided_iterator< T1 >& lhs,
+                const strided_iterator< T2 >& rhs) {
+  return lhs.index() == rhs.index();
+};
+
+template < class T1, class T2 >
+bool operator!=(const strided_iterator< T1 >& lhs,
+                const strided_iterator< T2 >& rhs) {
+  return lhs.index() != rhs.index();
+};
+
+template < class T1, class T2 >
+bool operator<(const strided_iterator< T1 >& lhs,
+               const strided_iterator< T2 >& rhs) {
+  return lhs.index() < rhs.index();
+};
+
+template < class T1, class T2 >
+bool operator<=(const strided_iterator< T1 >& lhs,
+                const strided_iterator< T2 >& rhs) {
+  return lhs.index() <= rhs.index();
+};
+
+template < class T1, class T2 >
+bool operator>(const strided_iterator< T1 >& lhs,
+               const strided_iterator< T2 >& rhs) {
+  return lhs.index() > rhs.index();
+};
+
+template < class T1, class T2 >
+bool operator>=(const strided_iterator< T1 >& lhs,
+                const strided_iterator< T2 >& rhs) {
+  return lhs.index() >= rhs.index();
+};
+
+template < class T >
+strided_iterator< T > operator+(
+    typename strided_iterator< T >::difference_type n,
+    const strided_iterator< T >& iter) {
+  return iter + n;
+};
+
+template < class T1, class T2 >
+typename strided_iterator< T1 >::difference_type operator-(
+    const strided_iterator< T1 >& lhs, const strided_iterator< T2 >& rhs) {
+  return lhs.index() - rhs.index();
+};
+
+/**
+ * @brief Non-owning view of size() elements spaced stride() apart: a column
+ * of a row major matrix, one channel of interleaved samples. Like span, it
+ * copies nothing.
+ *
+ * @tparam T Element type, const qualified for a read only view.
+ */
+template < class T >
+class strided_span {
+ public:
+  typedef T element_type;
+  typedef typename ft::remove_const< T >::type value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef T* pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef ft::strided_iterator< T > iterator;
+  typedef iterator const_iterator;
+  typedef ft::reverse_iterator< iterator > reverse_iterator;
+  typedef reverse_iterator const_reverse_iterator;
+
+ protected:
+  T* _data;
+  size_type _size;
+  size_type _stride;
+
+ public:
+  strided_span() : _data(u_nullptr), _size(0), _stride(1){};
+
+  /**
+   * @brief n elements: data[0], data[stride], ..., data[(n - 1) * stride]
+   */
+  strided_span(T* data, size_type n, size_type stride)
+      : _data(data), _size(n), _stride(stride){};
+
+  /**
+   * @brief Every element of a span, stride 1; also span< T > to
+   * strided_span< const T >.
+   */
+  template < class U >
+  strided_span(const span< U >& s)
+      : _data(s.data()), _size(s.size()), _stride(1){};
+
+  /**
+   * @brief strided_span< T > to strided_span< const T >
+   */
+  template < class U >
+  strided_span(const strided_span< U >& s)
+      : _data(s.data()), _size(s.size()), _stride(s.stride()){};
+
+  iterator begin() const { return iterator(this->_data, this->_stride, 0); };
+  iterator end() const {
+    return iterator(this->_data, this->_stride, this->_size);
+  };
+  reverse_iterator rbegin() const { return reverse_iterator(this->end()); };
+  reverse_iterator rend() const { return reverse_iterator(this->begin()); };
+
+  size_type size() const { return this->_size; };
+  size_type stride() const { return this->_stride; };
+  bool empty() const { return this->_size == 0; };
+  pointer data() const { return this->_data; };
+
+  reference operator[](size_type n) const {
+    return this->_data[n * this->_stride];
+  };
+  reference at(size_type n) const {
+    if (n >= this->_size) throw std::out_of_range("ft::strided_span");
+    return this->_data[n * this->_stride];
+  };
+  reference front() const { return this->_data[0]; };
+  reference back() const {
+    return this->_data[(this->_size - 1) * this->_stride];
+  };
+
+  strided_span first(size_type n) const {
+    return strided_span(this->_data, n, this->_stride);
+  };
+
+  strided_span last(size_type n) const {
+    return strided_span(this->_data + (this->_size - n) * this->_stride, n,
+                        this->_stride);
+  };
+
+  strided_span subspan(size_type offset,
+                       size_type count = dynamic_extent) const {
+    if (offset > this->_size) throw std::out_of_range("ft::strided_span");
+    if (count == dynamic_extent) count = this->_size - offset;
+    if (count > this->_size - offset) {
+      throw std::out_of_range("ft::strided_span");
+    }
+    return strided_span(this->_data + offset * this->_stride, count,
+                        this->_stride);
+  };
+
+  /**
+   * @brief Every step-th element of this view. Throws std::invalid_argument
+   * for a 0 step.
+   */
+  strided_span strided(size_type step) const {
+    if (step == 0) throw std::invalid_argument("ft::strided_span");
+    return strided_span(this->_data, (this->_size + step - 1) / step,
+                        this->_stride * step);
+  };
+};
+
+}  // namespace ft
+
+#endif  // FT__SPAN_HPP
@@ -0,0 +1,156 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/19
+ * @file src/span.test.cpp
+ */
+
+#include "span.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+
+#include "compact_vector.hpp"
+#include "vector.hpp"
+
+namespace {
+
+int sp_test_sum(ft::span< const int > values) {
+  int sum = 0;
+  for (ft::span< const int >::iterator it = values.begin();
+       it != values.end(); ++it) {
+    sum += *it;
+  }
+  return sum;
+}
+
+void sp_test_fill(ft::span< int > values, int value) {
+  for (std::size_t i = 0; i < values.size(); ++i) values[i] = value;
+}
+
+int sp_test_column_sum(ft::strided_span< const int > values) {
+  int sum = 0;
+  for (ft::strided_span< const int >::iterator it = values.begin();
+       it != values.end(); ++it) {
+    sum += *it;
+  }
+  return sum;
+}
+
+/* which view an argument converts to */
+char sp_test_view(ft::span< const int >) { return 'c'; }
+char sp_test_view(ft::strided_span< const int >) { return 's'; }
+
+}  // namespace
+
+void test_span_span(void) {
+  std::cout << "\t span" << std::endl;
+
+  ft::vector< int > v;
+  for (int i = 0; i < 10; ++i) v.push_back(i);
+  const ft::vector< int >& cv = v;
+  assert(v.data() == &v[0] && cv.data() == &cv.front());
+
+  // vectors pass as spans without a copy
+  ft::span< int > s(v);
+  assert(s.data() == v.data() && s.size() == 10 && !s.empty());
+  assert(sp_test_sum(v) == 45 && sp_test_sum(cv) == 45);
+  sp_test_fill(s.subspan(8), 1);
+  assert(v[8] == 1 && v[9] == 1 && v[7] == 7);
+
+  assert(s.first(3).back() == 2 && s.last(2).front() == 1);
+  assert(s.subspan(2, 3).size() == 3 && s.subspan(2, 3)[0] == 2);
+  assert(s.subspan(10).empty() && s.size_bytes() == 10 * sizeof(int));
+  assert(*s.rbegin() == 1 && s.rend() - s.rbegin() == 10);
+  try {
+    s.subspan(11);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+  try {
+    s.subspan(4, 7);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+  try {
+    s.at(10);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+
+  int array[] = {1, 2, 3};
+  ft::span< int > a(array);
+  ft::span< const int > c = a;
+  assert(a.size() == 3 && c[2] == 3 && sp_test_sum(array) == 6);
+  assert(ft::as_bytes(a).size() == 3 * sizeof(int));
+
+  ft::compact_vector< int > small(4, 2);
+  assert(sp_test_sum(small) == 8 && ft::span< int >().empty());
+}
+
+void test_span_strided(void) {
+  std::cout << "\t strided" << std::endl;
+
+  // 4 x 3 row major matrix: m[r][c] = 10 * r + c
+  ft::vector< int > m;
+  for (int r = 0; r < 4; ++r) {
+    for (int c = 0; c < 3; ++c) m.push_back(10 * r + c);
+  }
+  ft::span< int > all(m);
+  ft::strided_span< int > column = all.strided(3, 1);
+  assert(column.size() == 4 && column.stride() == 3);
+  assert(column[0] == 1 && column[3] == 31 && column.back() == 31);
+  assert(sp_test_column_sum(column) == 1 + 11 + 21 + 31);
+  assert(sp_test_column_sum(all.strided(3, 2)) == 2 + 12 + 22 + 32);
+
+  // a strided_span never passes as a contiguous span
+  assert(sp_test_view(all.strided(2)) == 's' && sp_test_view(m) == 'c');
+  const ft::strided_span< int > const_column = column;
+  assert(sp_test_view(column) == 's' && sp_test_view(const_column) == 's');
+
+  column[2] = -1;
+  assert(m[7] == -1);
+  ft::strided_span< int > tail = column.subspan(1, 2);
+  assert(tail.size() == 2 && tail[0] == 11 && tail[1] == -1);
+  assert(column.first(1).back() == 1 && column.last(1).front() == 31);
+  assert(column.strided(2).size() == 2 && column.strided(2)[1] == -1);
+  try {
+    column.at(4);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+  try {
+    all.strided(0);
+    assert(false);
+  } catch (const std::invalid_argument& e) {
+  }
+  try {
+    column.strided(0);
+    assert(false);
+  } catch (const std::invalid_argument& e) {
+  }
+
+  ft::strided_span< int >::iterator it = column.begin();
+  assert(it[3] == 31 && *(it + 1) == 11 && column.end() - it == 4);
+  it += 3;
+  assert(*it == 31 && it > column.begin() && *--it == -1);
+  assert(*column.rbegin() == 31 && column.rbegin()[3] == 1);
+
+  // a contiguous span is a strided_span with stride 1
+  ft::strided_span< const int > flat = all.first(3);
+  assert(flat.stride() == 1 && flat[2] == 2 && sp_test_column_sum(flat) == 3);
+  assert(all.strided(5).size() == 3 && all.strided(1, 12).empty());
+}
+
+void test_span(void) {
+  std::cout << "Test: span" << std::endl;
+  test_span_span();
+  test_span_strided();
+}
@@ -0,0 +1,142 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/08
+ * @file src/spsc_ring.bench.cpp
+ */
+
+#include <pthread.h>
+
+#include <iostream>
+
+#include "bench.hpp"
+#include "spsc_ring.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const std::size_t g_items = 1 << 24;
+const std::size_t g_batch = 256;
+
+struct locked_queue {
+  pthread_mutex_t lock;
+  ft::vector< unsigned int > items;
+  std::size_t head;
+};
+
+void* ring_producer(void* arg) {
+  ft::spsc_ring< unsigned int >* ring =
+      static_cast< ft::spsc_ring< unsigned int >* >(arg);
+  ft::backoff wait;
+  for (std::size_t i = 0; i < g_items;) {
+    if (ring->push(static_cast< unsigned int >(i))) {
+      ++i;
+      wait.reset();
+    } else {
+      wait.pause();
+    }
+  }
+  return NULL;
+}
+
+void* ring_batch_producer(void* arg) {
+  ft::spsc_ring< unsigned int >* ring =
+      static_cast< ft::spsc_ring< unsigned int >* >(arg);
+  unsigned int batch[g_batch];
+  ft::backoff wait;
+  for (std::size_t i = 0; i < g_items;) {
+    std::size_t n = g_items - i < g_batch ? g_items - i : g_batch;
+    for (std::size_t j = 0; j < n; ++j) {
+      batch[j] = static_cast< unsigned int >(i + j);
+    }
+    std::size_t pushed = 0;
+    while (pushed < n) {
+      std::size_t done = ring->push_n(batch + pushed, n - pushed);
+      pushed += done;
+      if (done) {
+        wait.reset();
+      } else {
+        wait.pause();
+      }
+    }
+    i += n;
+  }
+  return NULL;
+}
+
+void* locked_producer(void* arg) {
+  locked_queue* queue = static_cast< locked_queue* >(arg);
+  for (std::size_t i = 0; i < g_items; ++i) {
+    pthread_mutex_lock(&queue->lock);
+    queue->items.push_back(static_cast< unsigned int >(i));
+    pthread_mutex_unlock(&queue->lock);
+  }
+  return NULL;
+}
+
+}  // namespace
+
+void bench_spsc_ring(void) {
+  std::cout << "Bench: spsc_ring" << std::endl;
+
+  std::size_t sum = 0;
+  ft::spsc_ring< unsigned int > ring(1 << 14);
+
+  double start = bench_now();
+  pthread_t producer;
+  pthread_create(&producer, NULL, ring_producer, &ring);
+  ft::backoff wait;
+  for (std::size_t i = 0; i < g_items;) {
+    unsigned int value;
+    if (ring.pop(value)) {
+      sum += value;
+      ++i;
+      wait.reset();
+    } else {
+      wait.pause();
+    }
+  }
+  pthread_join(producer, NULL);
+  bench_report("spsc_ring push / pop", bench_now() - start, g_items);
+
+  start = bench_now();
+  pthread_create(&producer, NULL, ring_batch_producer, &ring);
+  unsigned int batch[g_batch];
+  for (std::size_t i = 0; i < g_items;) {
+    std::size_t n = ring.pop_n(batch, g_batch);
+    for (std::size_t j = 0; j < n; ++j) sum += batch[j];
+    i += n;
+    if (n) {
+      wait.reset();
+    } else {
+      wait.pause();
+    }
+  }
+  pthread_join(producer, NULL);
+  bench_report("spsc_ring push_n / pop_n (256)", bench_now() - start,
+               g_items);
+
+  locked_queue queue;
+  pthread_mutex_init(&queue.lock, NULL);
+  queue.head = 0;
+  start = bench_now();
+  pthread_create(&producer, NULL, locked_producer, &queue);
+  for (std::size_t i = 0; i < g_items;) {
+    pthread_mutex_lock(&queue.lock);
+    for (; queue.head < queue.items.size(); ++queue.head, ++i) {
+      sum += queue.items[queue.head];
+    }
+    pthread_mutex_unlock(&queue.lock);
+  }
+  pthread_join(producer, NULL);
+  pthread_mutex_destroy(&queue.lock);
+  bench_report("mutex + ft::vector", bench_now() - start, g_items);
+
+  bench_sink(sum);
+}
@@ -0,0 +1,207 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/08
+ * @file src/spsc_ring.hpp
+ */
+
+#if !defined(FT__SPSC_RING_HPP)
+#define FT__SPSC_RING_HPP
+
+#include <cstddef>
+#include <memory>
+
+#include "atomic.hpp"
+
+namespace ft {
+
+/**
+ * @brief Lock-free bounded queue for exactly one producer thread and one
+ * consumer thread.
+ *
+ * head and tail are free running counters masked into a power of two
+ * buffer. Each side owns one counter, published with a release store and
+ * read by the other side with an acquire load, and keeps a private copy of
+ * the other side's counter, refreshed only when the ring looks full (or
+ * empty). The two sides live on separate cache lines, so in the steady
+ * state neither writes a line the other one reads.
+ *
+ * push / push_n may only be called from the producer, pop / pop_n only from
+ * the consumer.
+ *
+ * @tparam T Type of the elements.
+ * @tparam _Alloc allocator of the buffer, defaults to `allocator<T>`.
+ */
+template < class T, class _Alloc = std::allocator< T > >
+class spsc_ring {
+ public:
+  /* The first template parameter (T) */
+  typedef T value_type;
+  /* The second template parameter (_Alloc) */
+  typedef _Alloc allocator_type;
+  /* an unsigned integral type */
+  typedef std::size_t size_type;
+
+ private:
+  char _pad0[cache_line_size];
+  /* read only after construction, shared by both sides */
+  allocator_type _alloc;
+  T* _buffer;
+  size_type _mask;
+  char _pad1[cache_line_size];
+  /* producer side: next slot to write and last seen head */
+  ft::atomic< size_type > _tail;
+  size_type _head_cache;
+  char _pad2[cache_line_size];
+  /* consumer side: next slot to read and last seen tail */
+  ft::atomic< size_type > _head;
+  size_type _tail_cache;
+  char _pad3[cache_line_size];
+
+  spsc_ring(const spsc_ring&);
+  spsc_ring& operator=(const spsc_ring&);
+
+ public:
+  /**
+   * @brief Ring holding at least capacity elements, rounded up to a power
+   * of two.
+   */
+  explicit spsc_ring(size_type capacity,
+                     const allocator_type& alloc = allocator_type())
+      : _alloc(alloc), _tail(0), _head_cache(0), _head(0), _tail_cache(0) {
+    size_type n = 2;
+    while (n < capacity) n <<= 1;
+    this->_buffer = this->_alloc.allocate(n);
+    this->_mask = n - 1;
+  };
+
+  ~spsc_ring() {
+    size_type tail = this->_tail.load(memory_order_acquire);
+    for (size_type i = this->_head.load(memory_order_relaxed); i != tail;
+         ++i) {
+      this->_alloc.destroy(this->_buffer + (i & this->_mask));
+    }
+    this->_alloc.deallocate(this->_buffer, this->_mask + 1);
+  };
+
+  size_type capacity() const { return this->_mask + 1; };
+
+  /**
+   * @brief Number of queued elements. Exact only when both sides are idle.
+   */
+  size_type size() const {
+    size_type head = this->_head.load(memory_order_acquire);
+    return this->_tail.load(memory_order_acquire) - head;
+  };
+
+  bool empty() const { return this->size() == 0; };
+
+  allocator_type get_allocator() const { return this->_alloc; };
+
+  /**
+   * @brief Enqueue a copy of val (producer only).
+   *
+   * @return false if the ring is full
+   */
+  bool push(const value_type& val) {
+    size_type tail = this->_tail.load(memory_order_relaxed);
+    if (tail - this->_head_cache > this->_mask) {
+      this->_head_cache = this->_head.load(memory_order_acquire);
+      if (tail - this->_head_cache > this->_mask) return false;
+    }
+    this->_alloc.construct(this->_buffer + (tail & this->_mask), val);
+    this->_tail.store(tail + 1, memory_order_release);
+    return true;
+  };
+
+  /**
+   * @brief Dequeue the oldest element into val (consumer only).
+   *
+   * @return false if the ring is empty
+   */
+  bool pop(value_type& val) {
+    size_type head = this->_head.load(memory_order_relaxed);
+    if (head == this->_tail_cache) {
+      this->_tail_cache = this->_tail.load(memory_order_acquire);
+      if (head == this->_tail_cache) return false;
+    }
+    T* slot = this->_buffer + (head & this->_mask);
+    val = *slot;
+    this->_alloc.destroy(slot);
+    this->_head.store(head + 1, memory_order_release);
+    return true;
+  };
+
+  /**
+   * @brief Enqueue up to n elements from src with a single publish; the
+   * copy runs over at most two contiguous spans of the buffer (producer
+   * only).
+   *
+   * @return the number of elements enqueued
+   */
+  size_type push_n(const value_type* src, size_type n) {
+    size_type tail = this->_tail.load(memory_order_relaxed);
+    size_type room = this->capacity() - (tail - this->_head_cache);
+    if (room < n) {
+      this->_head_cache = this->_head.load(memory_order_acquire);
+      room = this->capacity() - (tail - this->_head_cache);
+      if (n > room) n = room;
+    }
+    if (n == 0) return 0;
+
+    size_type offset = tail & this->_mask;
+    size_type first = this->capacity() - offset;
+    if (first > n) first = n;
+    T* dst = this->_buffer + offset;
+    for (size_type i = 0; i < first; ++i) {
+      this->_alloc.construct(dst + i, src[i]);
+    }
+    for (size_type i = first; i < n; ++i) {
+      this->_alloc.construct(this->_buffer + (i - first), src[i]);
+    }
+    this->_tail.store(tail + n, memory_order_release);
+    return n;
+  };
+
+  /**
+   * @brief Dequeue up to n elements into dst with a single publish
+   * (consumer only).
+   *
+   * @return the number of elements dequeued
+   */
+  size_type pop_n(value_type* dst, size_type n) {
+    size_type head = this->_head.load(memory_order_relaxed);
+    size_type available = this->_tail_cache - head;
+    if (available < n) {
+      this->_tail_cache = this->_tail.load(memory_order_acquire);
+      available = this->_tail_cache - head;
+      if (n > available) n = available;
+    }
+    if (n == 0) return 0;
+
+    size_type offset = head & this->_mask;
+    size_type first = this->capacity() - offset;
+    if (first > n) first = n;
+    T* src = this->_buffer + offset;
+    for (size_type i = 0; i < first; ++i) {
+      dst[i] = src[i];
+      this->_alloc.destroy(src + i);
+    }
+    for (size_type i = first; i < n; ++i) {
+      dst[i] = this->_buffer[i - first];
+      this->_alloc.destroy(this->_buffer + (i - first));
+    }
+    this->_head.store(head + n, memory_order_release);
+    return n;
+  };
+};
+
+}  // namespace ft
+
+#endif  // FT__SPSC_RING_HPP
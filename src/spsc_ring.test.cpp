@@ -0,0 +1,110 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/08
+ * @file src/spsc_ring.test.cpp
+ */
+
+#include "spsc_ring.hpp"
+
+#include <pthread.h>
+
+#include <cassert>
+#include <iostream>
+#include <string>
+
+void test_spsc_ring_single(void) {
+  std::cout << "\t single thread" << std::endl;
+
+  ft::spsc_ring< std::string > ring(5);
+  assert(ring.capacity() == 8 && ring.empty());
+
+  std::string out;
+  assert(!ring.pop(out));
+  for (int i = 0; i < 8; ++i) assert(ring.push(std::string(i + 1, 'x')));
+  assert(!ring.push("full") && ring.size() == 8);
+  for (int i = 0; i < 3; ++i) {
+    assert(ring.pop(out) && out == std::string(i + 1, 'x'));
+  }
+
+  // the batch wraps around the end of the buffer
+  std::string batch[6] = {"a", "b", "c", "d", "e", "f"};
+  assert(ring.push_n(batch, 6) == 3 && ring.size() == 8);
+  std::string drained[16];
+  assert(ring.pop_n(drained, 16) == 8 && ring.empty());
+  assert(drained[4] == std::string(8, 'x') && drained[5] == "a");
+  assert(drained[7] == "c");
+  assert(ring.pop_n(drained, 4) == 0);
+
+  // elements still queued are destroyed with the ring
+  ring.push("left behind");
+}
+
+struct spsc_ring_test_args {
+  ft::spsc_ring< unsigned long >* ring;
+  unsigned long count;
+};
+
+static void* spsc_ring_test_producer(void* arg) {
+  spsc_ring_test_args* args = static_cast< spsc_ring_test_args* >(arg);
+  unsigned long batch[7];
+  unsigned long next = 0;
+  ft::backoff wait;
+  while (next < args->count) {
+    if (next % 3 == 0) {
+      if (args->ring->push(next)) {
+        ++next;
+        wait.reset();
+      } else {
+        wait.pause();
+      }
+      continue;
+    }
+    std::size_t n = 0;
+    for (; n < 7 && next + n < args->count; ++n) batch[n] = next + n;
+    std::size_t pushed = args->ring->push_n(batch, n);
+    next += pushed;
+    if (pushed) {
+      wait.reset();
+    } else {
+      wait.pause();
+    }
+  }
+  return NULL;
+}
+
+void test_spsc_ring_threads(void) {
+  std::cout << "\t producer / consumer" << std::endl;
+
+  ft::spsc_ring< unsigned long > ring(64);
+  spsc_ring_test_args args = {&ring, 200000};
+  pthread_t producer;
+  pthread_create(&producer, NULL, spsc_ring_test_producer, &args);
+
+  unsigned long expected = 0;
+  unsigned long batch[5];
+  ft::backoff wait;
+  while (expected < args.count) {
+    std::size_t n = ring.pop_n(batch, expected % 2 ? 5 : 1);
+    for (std::size_t i = 0; i < n; ++i) assert(batch[i] == expected++);
+    if (n) {
+      wait.reset();
+    } else {
+      wait.pause();
+    }
+  }
+  pthread_join(producer, NULL);
+  assert(ring.empty());
+}
+
+void test_spsc_ring(void) {
+  std::cout << "Test: spsc_ring" << std::endl;
+  test_spsc_ring_single();
+  test_spsc_ring_threads();
+}
@@ -23,4 +23,30 @@ void test_utility(void);
 
 void test_random_access_iterator(void);
 
+void test_flat_map(void);
+void test_btree_map(void);
+void test_unordered_map(void);
+void test_order_statistic_map(void);
+void test_spsc_ring(void);
+void test_mpmc_queue(void);
+void test_concurrent_vector(void);
+void test_rcu_vector(void);
+void test_reclamation(void);
+void test_thread_cache_allocator(void);
+void test_thread_pool(void);
+void test_soa_vector(void);
+void test_compact_vector(void);
+void test_vector_bool(void);
+void test_packed_int_vector(void);
+void test_cow_vector(void);
+void test_persistent_vector(void);
+void test_views(void);
+void test_span(void);
+void test_mdarray(void);
+void test_priority_queue(void);
+void test_ring_deque(void);
+void test_gap_buffer(void);
+void test_pma(void);
+void test_slot_map(void);
+
 #endif  // TEST_HPP
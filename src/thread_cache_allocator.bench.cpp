@@ -0,0 +1,142 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/10
+ * @file src/thread_cache_allocator.bench.cpp
+ */
+
+#include <pthread.h>
+
+#include <cstdio>
+#include <iostream>
+#include <memory>
+
+#include "bench.hpp"
+#include "mpmc_queue.hpp"
+#include "thread_cache_allocator.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const std::size_t g_vectors = 1 << 14;
+const std::size_t g_blocks = 1 << 18;
+
+struct churn_run {
+  std::size_t sum;
+};
+
+/**
+ * @brief Build and drop small vectors: every push_back that grows
+ * allocates and frees.
+ */
+template < class Alloc >
+void* churn_loop(void* arg) {
+  churn_run* run = static_cast< churn_run* >(arg);
+  for (std::size_t i = 0; i < g_vectors; ++i) {
+    ft::vector< std::size_t, Alloc > v;
+    for (std::size_t j = 0; j < 1 + (i & 63); ++j) v.push_back(j);
+    run->sum += v.back();
+  }
+  return NULL;
+}
+
+double churn(void* (*loop)(void*), int threads, std::size_t* sum) {
+  churn_run runs[64];
+  pthread_t ids[64];
+  double start = bench_now();
+  for (int i = 0; i < threads; ++i) {
+    runs[i].sum = 0;
+    pthread_create(&ids[i], NULL, loop, &runs[i]);
+  }
+  for (int i = 0; i < threads; ++i) {
+    pthread_join(ids[i], NULL);
+    *sum += runs[i].sum;
+  }
+  return bench_now() - start;
+}
+
+template < class Alloc >
+struct handoff_run {
+  ft::mpmc_queue< std::size_t* >* queue;
+  std::size_t sum;
+};
+
+/**
+ * @brief The producer allocates, the consumer frees: every block crosses
+ * threads.
+ */
+template < class Alloc >
+void* produce_loop(void* arg) {
+  handoff_run< Alloc >* run = static_cast< handoff_run< Alloc >* >(arg);
+  Alloc alloc;
+  for (std::size_t i = 0; i < g_blocks; ++i) {
+    std::size_t* block = alloc.allocate(4);
+    block[0] = i;
+    run->queue->push(block);
+  }
+  return NULL;
+}
+
+template < class Alloc >
+void* consume_loop(void* arg) {
+  handoff_run< Alloc >* run = static_cast< handoff_run< Alloc >* >(arg);
+  Alloc alloc;
+  for (std::size_t i = 0; i < g_blocks; ++i) {
+    std::size_t* block;
+    run->queue->pop(block);
+    run->sum += block[0];
+    alloc.deallocate(block, 4);
+  }
+  return NULL;
+}
+
+template < class Alloc >
+double handoff(std::size_t* sum) {
+  ft::mpmc_queue< std::size_t* > queue(1024);
+  handoff_run< Alloc > run = {&queue, 0};
+  pthread_t producer, consumer;
+  double start = bench_now();
+  pthread_create(&producer, NULL, produce_loop< Alloc >, &run);
+  pthread_create(&consumer, NULL, consume_loop< Alloc >, &run);
+  pthread_join(producer, NULL);
+  pthread_join(consumer, NULL);
+  *sum += run.sum;
+  return bench_now() - start;
+}
+
+}  // namespace
+
+void bench_thread_cache_allocator(void) {
+  std::cout << "Bench: thread_cache_allocator" << std::endl;
+
+  typedef ft::thread_cache_allocator< std::size_t > cached;
+  typedef std::allocator< std::size_t > global;
+
+  int cores = bench_cores();
+  char label[64];
+  std::size_t sum = 0;
+  /* 1, 2, 4, ... and finally the core count itself */
+  for (int threads = 1;; threads = threads * 2 < cores ? threads * 2 : cores) {
+    std::snprintf(label, sizeof(label), "thread_cache vector churn x%d",
+                  threads);
+    bench_report(label, churn(churn_loop< cached >, threads, &sum),
+                 g_vectors * threads);
+    std::snprintf(label, sizeof(label), "std::allocator vector churn x%d",
+                  threads);
+    bench_report(label, churn(churn_loop< global >, threads, &sum),
+                 g_vectors * threads);
+    if (threads == cores) break;
+  }
+
+  bench_report("thread_cache cross-thread free", handoff< cached >(&sum),
+               g_blocks);
+  bench_report("std::allocator cross-thread free", handoff< global >(&sum),
+               g_blocks);
+  bench_sink(sum);
+}
@@ -0,0 +1,396 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/10
+ * @file src/thread_cache_allocator.hpp
+ */
+
+#if !defined(FT__THREAD_CACHE_ALLOCATOR_HPP)
+#define FT__THREAD_CACHE_ALLOCATOR_HPP
+
+#include <pthread.h>
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+#include "atomic.hpp"
+#include "util.hpp"
+
+namespace ft {
+
+/**
+ * @brief Process wide memory behind every thread_cache_allocator.
+ *
+ * Requests up to max_block bytes are rounded up to one of 16 size classes
+ * (16, 32, 48, 64, 96, 128, 192, ... 4096). Each thread keeps a free list
+ * per class and serves allocate / deallocate from it without any lock or
+ * atomic. An empty list refills a whole batch from the central list of its
+ * class, a list grown past two batches hands one batch back, each under one
+ * short per-class lock. The central lists are fed by 64 KiB spans carved
+ * into blocks.
+ *
+ * A block carries no header: its class comes from the size passed to
+ * deallocate. So a block allocated on one thread and freed on another just
+ * joins the freeing thread's list, and flows back through the central list
+ * to wherever it is needed. When a thread exits its cache is emptied into
+ * the central lists and kept for the next thread.
+ *
+ * Spans are never returned to the system. Larger requests go straight to
+ * operator new.
+ */
+class thread_cache_pool {
+ public:
+  /* an unsigned integral type */
+  typedef std::size_t size_type;
+
+  /* number of size classes */
+  static const size_type classes = 16;
+  /* largest request served from the caches */
+  static const size_type max_block = 4096;
+  /* bytes carved from operator new at a time */
+  static const size_type span_size = 64 * 1024;
+
+ private:
+  struct _free_list {
+    void* head;
+    size_type count;
+  };
+
+  struct _central_list {
+    pthread_mutex_t lock;
+    void* head;
+    size_type count;
+    char pad[cache_line_size];
+  };
+
+  struct _cache {
+    _free_list lists[classes];
+    _cache* next;
+    bool in_use;
+    char pad[cache_line_size];
+  };
+
+  _central_list _central[classes];
+  /* guards _spans and _caches */
+  pthread_mutex_t _lock;
+  void* _spans;
+  _cache* _caches;
+  pthread_key_t _key;
+
+  thread_cache_pool() : _spans(ft::u_nullptr), _caches(ft::u_nullptr) {
+    for (size_type c = 0; c < classes; ++c) {
+      pthread_mutex_init(&this->_central[c].lock, NULL);
+      this->_central[c].head = ft::u_nullptr;
+      this->_central[c].count = 0;
+    }
+    pthread_mutex_init(&this->_lock, NULL);
+    pthread_key_create(&this->_key, _thread_exit);
+  };
+
+  thread_cache_pool(const thread_cache_pool&);
+  thread_cache_pool& operator=(const thread_cache_pool&);
+
+ public:
+  /**
+   * @brief The pool, created on first use and never destroyed.
+   */
+  static thread_cache_pool& instance() {
+    thread_cache_pool* pool = __atomic_load_n(&_instance(), __ATOMIC_ACQUIRE);
+    if (pool) return *pool;
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+    pthread_once(&once, _create);
+    return *_instance();
+  };
+
+  /**
+   * @brief Index of the smallest class holding bytes (bytes <= max_block).
+   */
+  static size_type class_of(size_type bytes) {
+    if (bytes <= 64) return bytes ? (bytes - 1) >> 4 : 0;
+    // 2^k < bytes <= 2^(k + 1): classes 1.5 * 2^k and 2^(k + 1)
+    size_type k = _log2(bytes - 1);
+    return 4 + 2 * (k - 6) + (bytes > (size_type(3) << (k - 1)));
+  };
+
+  static size_type class_size(size_type c) {
+    if (c < 4) return (c + 1) << 4;
+    size_type k = (c - 4) / 2 + 6;
+    return (c & 1) ? size_type(1) << (k + 1) : size_type(3) << (k - 1);
+  };
+
+  /**
+   * @brief Blocks moved between a thread and the central list at once:
+   * about 8 KiB worth, between 4 and 64 blocks.
+   */
+  static size_type batch_of(size_type c) {
+    size_type n = 8192 / class_size(c);
+    return n < 4 ? 4 : n > 64 ? 64 : n;
+  };
+
+  void* allocate(size_type bytes) {
+    if (bytes > max_block) return ::operator new(bytes);
+    size_type c = class_of(bytes);
+    _free_list& list = this->_cache_here()->lists[c];
+    if (!list.head) this->_refill(list, c);
+    void* block = list.head;
+    list.head = *static_cast< void** >(block);
+    --list.count;
+    return block;
+  };
+
+  /**
+   * @brief bytes must be the size block was allocated with; any thread may
+   * free any block.
+   */
+  void deallocate(void* block, size_type bytes) {
+    if (!block) return;
+    if (bytes > max_block) {
+      ::operator delete(block);
+      return;
+    }
+    size_type c = class_of(bytes);
+    _free_list& list = this->_cache_here()->lists[c];
+    *static_cast< void** >(block) = list.head;
+    list.head = block;
+    if (++list.count > 2 * batch_of(c)) this->_flush(list, c, batch_of(c));
+  };
+
+  /**
+   * @brief Blocks of class c free in the central list (a racy snapshot).
+   */
+  size_type central_free(size_type c) {
+    pthread_mutex_lock(&this->_central[c].lock);
+    size_type n = this->_central[c].count;
+    pthread_mutex_unlock(&this->_central[c].lock);
+    return n;
+  };
+
+  /**
+   * @brief Blocks of class c cached by the calling thread.
+   */
+  size_type cached_here(size_type c) {
+    return this->_cache_here()->lists[c].count;
+  };
+
+ private:
+  static thread_cache_pool*& _instance() {
+    static thread_cache_pool* pool = ft::u_nullptr;
+    return pool;
+  };
+
+  static void _create() {
+    __atomic_store_n(&_instance(), new thread_cache_pool(), __ATOMIC_RELEASE);
+  };
+
+  static void _thread_exit(void* cache) {
+    _thread_cache() = ft::u_nullptr;
+    _instance()->_release(static_cast< _cache* >(cache));
+  };
+
+  static size_type _log2(size_type n) {
+    return sizeof(unsigned long) * 8 - 1 -
+           __builtin_clzl(static_cast< unsigned long >(n));
+  };
+
+  /**
+   * @brief The calling thread's cache. A __thread pointer serves the fast
+   * path; the pthread key is what empties the cache when the thread exits.
+   */
+  _cache* _cache_here() {
+    _cache*& cache = _thread_cache();
+    if (!cache) cache = this->_adopt();
+    return cache;
+  };
+
+  static _cache*& _thread_cache() {
+    static __thread _cache* cache;
+    return cache;
+  };
+
+  /**
+   * @brief Give the calling thread an idle cache, or a new one.
+   */
+  _cache* _adopt() {
+    pthread_mutex_lock(&this->_lock);
+    _cache* cache = this->_caches;
+    while (cache && cache->in_use) cache = cache->next;
+    if (!cache) {
+      cache = new _cache();
+      cache->next = this->_caches;
+      this->_caches = cache;
+    }
+    cache->in_use = true;
+    pthread_mutex_unlock(&this->_lock);
+    pthread_setspecific(this->_key, cache);
+    return cache;
+  };
+
+  /**
+   * @brief Empty an exiting thread's cache into the central lists.
+   */
+  void _release(_cache* cache) {
+    for (size_type c = 0; c < classes; ++c) {
+      if (cache->lists[c].count) {
+        this->_flush(cache->lists[c], c, cache->lists[c].count);
+      }
+    }
+    pthread_mutex_lock(&this->_lock);
+    cache->in_use = false;
+    pthread_mutex_unlock(&this->_lock);
+  };
+
+  /**
+   * @brief Move up to one batch from the central list into list, carving
+   * a new span when the central list runs dry.
+   */
+  void _refill(_free_list& list, size_type c) {
+    size_type want = batch_of(c);
+    _central_list& central = this->_central[c];
+    pthread_mutex_lock(&central.lock);
+    size_type n = 0;
+    while (n < want && central.head) {
+      void* block = central.head;
+      central.head = *static_cast< void** >(block);
+      *static_cast< void** >(block) = list.head;
+      list.head = block;
+      ++n;
+    }
+    central.count -= n;
+    pthread_mutex_unlock(&central.lock);
+    list.count += n;
+    if (n == 0) this->_carve(list, c);
+  };
+
+  /**
+   * @brief Split a fresh span into blocks of class c: one batch goes to
+   * list, the rest to the central list.
+   */
+  void _carve(_free_list& list, size_type c) {
+    size_type size = class_size(c);
+    char* span = static_cast< char* >(::operator new(span_size));
+    pthread_mutex_lock(&this->_lock);
+    *reinterpret_cast< void** >(span) = this->_spans;
+    this->_spans = span;
+    pthread_mutex_unlock(&this->_lock);
+
+    // the first block of the span links the span list
+    size_type blocks = span_size / size - 1;
+    size_type mine = batch_of(c) < blocks ? batch_of(c) : blocks;
+    char* block = span + size;
+    for (size_type i = 0; i < mine; ++i, block += size) {
+      *reinterpret_cast< void** >(block) = list.head;
+      list.head = block;
+    }
+    list.count += mine;
+
+    void* head = ft::u_nullptr;
+    for (size_type i = mine; i < blocks; ++i, block += size) {
+      *reinterpret_cast< void** >(block) = head;
+      head = block;
+    }
+    if (head) this->_push_central(c, head, blocks - mine);
+  };
+
+  /**
+   * @brief Return the first n blocks of list to the central list.
+   */
+  void _flush(_free_list& list, size_type c, size_type n) {
+    void* first = list.head;
+    void* last = first;
+    for (size_type i = 1; i < n; ++i) last = *static_cast< void** >(last);
+    list.head = *static_cast< void** >(last);
+    list.count -= n;
+    *static_cast< void** >(last) = ft::u_nullptr;
+    this->_push_central(c, first, n);
+  };
+
+  /**
+   * @brief Splice a null terminated chain of n blocks into the central
+   * list of class c.
+   */
+  void _push_central(size_type c, void* chain, size_type n) {
+    void* tail = chain;
+    while (*static_cast< void** >(tail)) tail = *static_cast< void** >(tail);
+    _central_list& central = this->_central[c];
+    pthread_mutex_lock(&central.lock);
+    *static_cast< void** >(tail) = central.head;
+    central.head = chain;
+    central.count += n;
+    pthread_mutex_unlock(&central.lock);
+  };
+};
+
+/**
+ * @brief Allocator backed by thread_cache_pool: allocation and
+ * deallocation normally touch only the calling thread's cache. All
+ * instances share the pool, so any instance may free memory from any
+ * other, on any thread.
+ *
+ * @tparam T Type of the elements.
+ */
+template < class T >
+class thread_cache_allocator {
+ public:
+  typedef T value_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  template < class U >
+  struct rebind {
+    typedef thread_cache_allocator< U > other;
+  };
+
+  thread_cache_allocator() throw(){};
+  thread_cache_allocator(const thread_cache_allocator&) throw(){};
+  template < class U >
+  thread_cache_allocator(const thread_cache_allocator< U >&) throw(){};
+  ~thread_cache_allocator() throw(){};
+
+  pointer address(reference x) const { return &x; };
+  const_pointer address(const_reference x) const { return &x; };
+
+  pointer allocate(size_type n, const void* hint = 0) {
+    (void)hint;
+    if (n > this->max_size()) throw std::bad_alloc();
+    return static_cast< pointer >(
+        thread_cache_pool::instance().allocate(n * sizeof(T)));
+  };
+
+  void deallocate(pointer p, size_type n) {
+    thread_cache_pool::instance().deallocate(p, n * sizeof(T));
+  };
+
+  size_type max_size() const throw() {
+    return std::numeric_limits< size_type >::max() / sizeof(T);
+  };
+
+  void construct(pointer p, const_reference val) { new (p) T(val); };
+  void destroy(pointer p) { p->~T(); };
+};
+
+template < class T, class U >
+bool operator==(const thread_cache_allocator< T >&,
+                const thread_cache_allocator< U >&) {
+  return true;
+}
+
+template < class T, class U >
+bool operator!=(const thread_cache_allocator< T >&,
+                const thread_cache_allocator< U >&) {
+  return false;
+}
+
+}  // namespace ft
+
+#endif  // FT__THREAD_CACHE_ALLOCATOR_HPP
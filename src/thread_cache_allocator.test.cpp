@@ -0,0 +1,185 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/10
+ * @file src/thread_cache_allocator.test.cpp
+ */
+
+#include "thread_cache_allocator.hpp"
+
+#include <pthread.h>
+
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "vector.hpp"
+
+typedef ft::thread_cache_pool pool_type;
+
+void test_thread_cache_allocator_classes(void) {
+  std::cout << "\t size classes" << std::endl;
+
+  for (std::size_t c = 0; c < pool_type::classes; ++c) {
+    assert(pool_type::class_of(pool_type::class_size(c)) == c);
+    assert(pool_type::class_size(c) % 16 == 0);
+  }
+  assert(pool_type::class_size(pool_type::classes - 1) ==
+         pool_type::max_block);
+  for (std::size_t n = 1; n <= pool_type::max_block; ++n) {
+    std::size_t c = pool_type::class_of(n);
+    assert(pool_type::class_size(c) >= n);
+    // the class below is too small: the tightest fit
+    assert(c == 0 || pool_type::class_size(c - 1) < n);
+  }
+}
+
+void test_thread_cache_allocator_vector(void) {
+  std::cout << "\t with ft::vector" << std::endl;
+
+  ft::vector< int, ft::thread_cache_allocator< int > > ints;
+  for (int i = 0; i < 10000; ++i) ints.push_back(i);
+  for (int i = 0; i < 10000; ++i) assert(ints[i] == i);
+
+  ft::vector< std::string, ft::thread_cache_allocator< std::string > > strs(
+      100, "cached");
+  strs.insert(strs.begin() + 50, "middle");
+  assert(strs.size() == 101 && strs[50] == "middle" && strs[100] == "cached");
+
+  ft::thread_cache_allocator< int > a;
+  ft::thread_cache_allocator< char > b(a);
+  assert(a == b && !(a != b));
+  assert(a.max_size() > 0);
+}
+
+void test_thread_cache_allocator_batches(void) {
+  std::cout << "\t batched return" << std::endl;
+
+  pool_type& pool = pool_type::instance();
+  std::size_t c = pool_type::class_of(40);
+  std::size_t batch = pool_type::batch_of(c);
+
+  const int n = 1000;
+  void* blocks[n];
+  for (int i = 0; i < n; ++i) {
+    blocks[i] = pool.allocate(40);
+    std::memset(blocks[i], i & 0xff, 40);
+  }
+  for (int i = 0; i < n; ++i) {
+    assert(static_cast< unsigned char* >(blocks[i])[39] == (i & 0xff));
+  }
+  std::size_t central = pool.central_free(c);
+  for (int i = 0; i < n; ++i) pool.deallocate(blocks[i], 40);
+  // the thread keeps at most two batches, the rest went back
+  assert(pool.cached_here(c) <= 2 * batch);
+  assert(pool.central_free(c) >= central + n - 2 * batch);
+
+  // past max_block: straight to operator new
+  void* big = pool.allocate(pool_type::max_block + 1);
+  std::memset(big, 0, pool_type::max_block + 1);
+  pool.deallocate(big, pool_type::max_block + 1);
+  pool.deallocate(ft::u_nullptr, 16);
+}
+
+namespace {
+
+const int g_blocks = 4096;
+const int g_threads = 4;
+const int g_rounds = 50;
+
+struct tca_test_handoff {
+  void* blocks[g_blocks];
+};
+
+void* tca_test_free_all(void* arg) {
+  tca_test_handoff* handoff = static_cast< tca_test_handoff* >(arg);
+  for (int i = 0; i < g_blocks; ++i) {
+    assert(*static_cast< int* >(handoff->blocks[i]) == i);
+    pool_type::instance().deallocate(handoff->blocks[i], 24);
+  }
+  return NULL;
+}
+
+struct tca_test_ring {
+  ft::atomic< int* > slots[g_threads];
+};
+
+/**
+ * @brief Each thread builds and drops vectors, and passes a block per round
+ * to its neighbour, which frees it.
+ */
+void* tca_test_churn(void* arg) {
+  std::pair< tca_test_ring*, int >* self =
+      static_cast< std::pair< tca_test_ring*, int >* >(arg);
+  tca_test_ring* ring = self->first;
+  int id = self->second;
+  ft::thread_cache_allocator< int > alloc;
+  for (int round = 0; round < g_rounds; ++round) {
+    ft::vector< int, ft::thread_cache_allocator< int > > v;
+    for (int i = 0; i < 500; ++i) v.push_back(id * 1000 + i);
+    assert(v[499] == id * 1000 + 499);
+
+    int* mine = alloc.allocate(64);
+    mine[0] = id;
+    mine[63] = round;
+    // free what the previous thread left for us, allocated over there
+    int* theirs = ring->slots[id].exchange(ft::u_nullptr);
+    if (theirs) {
+      assert(theirs[0] == (id + g_threads - 1) % g_threads);
+      alloc.deallocate(theirs, 64);
+    }
+    int* unclaimed = ring->slots[(id + 1) % g_threads].exchange(mine);
+    if (unclaimed) alloc.deallocate(unclaimed, 64);
+  }
+  return NULL;
+}
+
+}  // namespace
+
+void test_thread_cache_allocator_threads(void) {
+  std::cout << "\t cross-thread free" << std::endl;
+
+  // allocated here, freed by a thread that exits and hands its cache back
+  pool_type& pool = pool_type::instance();
+  std::size_t c = pool_type::class_of(24);
+  tca_test_handoff handoff;
+  for (int i = 0; i < g_blocks; ++i) {
+    handoff.blocks[i] = pool.allocate(24);
+    *static_cast< int* >(handoff.blocks[i]) = i;
+  }
+  std::size_t central = pool.central_free(c);
+  pthread_t id;
+  pthread_create(&id, NULL, tca_test_free_all, &handoff);
+  pthread_join(id, NULL);
+  assert(pool.central_free(c) >= central + g_blocks);
+
+  tca_test_ring ring;
+  std::pair< tca_test_ring*, int > args[g_threads];
+  pthread_t ids[g_threads];
+  for (int i = 0; i < g_threads; ++i) {
+    args[i] = std::make_pair(&ring, i);
+    pthread_create(&ids[i], NULL, tca_test_churn, &args[i]);
+  }
+  for (int i = 0; i < g_threads; ++i) pthread_join(ids[i], NULL);
+  ft::thread_cache_allocator< int > alloc;
+  for (int i = 0; i < g_threads; ++i) {
+    int* left = ring.slots[i].load();
+    if (left) alloc.deallocate(left, 64);
+  }
+}
+
+void test_thread_cache_allocator(void) {
+  std::cout << "Test: thread_cache_allocator" << std::endl;
+  test_thread_cache_allocator_classes();
+  test_thread_cache_allocator_vector();
+  test_thread_cache_allocator_batches();
+  test_thread_cache_allocator_threads();
+}
@@ -0,0 +1,149 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/11
+ * @file src/thread_pool.bench.cpp
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+#include "bench.hpp"
+#include "thread_pool.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const long g_fib = 36;
+/* below this, fib and sort run sequentially */
+const long g_fib_cutoff = 18;
+const long g_sort_cutoff = 4096;
+const std::size_t g_sort = 1 << 21;
+
+long fib(long n) { return n < 2 ? n : fib(n - 1) + fib(n - 2); }
+
+struct fib_task {
+  ft::thread_pool* pool;
+  long n;
+  long* result;
+
+  fib_task(ft::thread_pool* p, long k, long* r) : pool(p), n(k), result(r){};
+
+  void operator()() const {
+    if (this->n < g_fib_cutoff) {
+      *this->result = fib(this->n);
+      return;
+    }
+    long a;
+    long b;
+    ft::task_group group(*this->pool);
+    group.fork(fib_task(this->pool, this->n - 1, &a));
+    fib_task(this->pool, this->n - 2, &b)();
+    group.join();
+    *this->result = a + b;
+  };
+};
+
+typedef ft::vector< int >::iterator sort_iterator;
+
+void sort_sequential(sort_iterator first, sort_iterator last) {
+  if (first != last) std::sort(&*first, &*first + (last - first));
+}
+
+struct sort_task {
+  ft::thread_pool* pool;
+  sort_iterator first;
+  sort_iterator last;
+
+  sort_task(ft::thread_pool* p, sort_iterator f, sort_iterator l)
+      : pool(p), first(f), last(l){};
+
+  void operator()() const {
+    if (this->last - this->first < g_sort_cutoff) {
+      sort_sequential(this->first, this->last);
+      return;
+    }
+    int* base = &*this->first;
+    long n = this->last - this->first;
+    int a = base[0];
+    int b = base[n / 2];
+    int c = base[n - 1];
+    int pivot = std::max(std::min(a, b), std::min(std::max(a, b), c));
+    int* middle = std::partition(base, base + n, less_than(pivot));
+    int* upper = std::partition(middle, base + n, not_greater(pivot));
+    ft::task_group group(*this->pool);
+    sort_iterator less_end = this->first + (middle - base);
+    sort_iterator greater_begin = this->first + (upper - base);
+    group.fork(sort_task(this->pool, this->first, less_end));
+    sort_task(this->pool, greater_begin, this->last)();
+    group.join();
+  };
+
+  struct less_than {
+    int pivot;
+    explicit less_than(int p) : pivot(p){};
+    bool operator()(int x) const { return x < this->pivot; };
+  };
+
+  struct not_greater {
+    int pivot;
+    explicit not_greater(int p) : pivot(p){};
+    bool operator()(int x) const { return !(this->pivot < x); };
+  };
+};
+
+}  // namespace
+
+void bench_thread_pool(void) {
+  std::cout << "Bench: thread_pool" << std::endl;
+
+  char label[64];
+  long sum = 0;
+  double start = bench_now();
+  long leaves = fib(g_fib);
+  /* fib(n) is a sum of fib(n) ones: report per leaf */
+  bench_report("sequential fib", bench_now() - start, leaves);
+  sum += leaves;
+
+  ft::vector< int > input(g_sort);
+  std::srand(42);
+  for (std::size_t i = 0; i < g_sort; ++i) input[i] = std::rand();
+  ft::vector< int > values(input);
+  start = bench_now();
+  sort_sequential(values.begin(), values.end());
+  bench_report("sequential sort", bench_now() - start, g_sort);
+  sum += values[g_sort / 2];
+
+  int cores = bench_cores();
+  /* 1, 2, 4, ... and finally the core count itself */
+  for (int threads = 1;; threads = threads * 2 < cores ? threads * 2 : cores) {
+    ft::thread_pool pool(threads);
+    long result = 0;
+    std::snprintf(label, sizeof(label), "work stealing fib x%d", threads);
+    start = bench_now();
+    ft::task_group group(pool);
+    group.fork(fib_task(&pool, g_fib, &result));
+    group.join();
+    bench_report(label, bench_now() - start, leaves);
+    sum += result;
+
+    values = input;
+    std::snprintf(label, sizeof(label), "work stealing sort x%d", threads);
+    start = bench_now();
+    group.fork(sort_task(&pool, values.begin(), values.end()));
+    group.join();
+    bench_report(label, bench_now() - start, g_sort);
+    sum += values[g_sort / 2];
+
+    if (threads == cores) break;
+  }
+  bench_sink(sum);
+}
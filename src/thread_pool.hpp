@@ -0,0 +1,632 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/11
+ * @file src/thread_pool.hpp
+ */
+
+#if !defined(FT__THREAD_POOL_HPP)
+#define FT__THREAD_POOL_HPP
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "atomic.hpp"
+#include "thread_cache_allocator.hpp"
+#include "util.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+/**
+ * @brief Unit of work run by a thread_pool. execute() runs the work,
+ * reports completion and frees the task.
+ */
+class pool_task {
+ public:
+  virtual ~pool_task(){};
+  virtual void execute() = 0;
+};
+
+/**
+ * @brief Chase-Lev work-stealing deque (with the fences of Le et al. for
+ * weak memory models).
+ *
+ * The owner pushes and pops at the bottom, LIFO, without any atomic
+ * read-modify-write except when taking the very last element. Thieves
+ * take from the top, FIFO, with one CAS. The buffer is a power of two
+ * ring that the owner doubles when full; replaced buffers stay allocated
+ * until the deque dies, since a thief may still be reading one.
+ *
+ * @tparam T element type, copied with atomic loads and stores: a pointer
+ * or an integer no wider than a machine word
+ */
+template < class T >
+class work_stealing_deque {
+ public:
+  typedef T value_type;
+  /* an unsigned integral type */
+  typedef std::size_t size_type;
+
+ private:
+  struct _buffer {
+    size_type mask;
+    ft::atomic< T >* slots;
+
+    explicit _buffer(size_type size)
+        : mask(size - 1), slots(new ft::atomic< T >[size]){};
+    ~_buffer() { delete[] this->slots; };
+
+    T get(std::ptrdiff_t i) const {
+      return this->slots[i & this->mask].load(memory_order_relaxed);
+    };
+    void put(std::ptrdiff_t i, T value) {
+      this->slots[i & this->mask].store(value, memory_order_relaxed);
+    };
+  };
+
+  ft::atomic< std::ptrdiff_t > _top;
+  char _pad0[cache_line_size];
+  ft::atomic< std::ptrdiff_t > _bottom;
+  ft::atomic< _buffer* > _buffer_ptr;
+  /* owner only: buffers replaced by a grow */
+  ft::vector< _buffer* > _retired;
+  char _pad1[cache_line_size];
+
+  work_stealing_deque(const work_stealing_deque&);
+  work_stealing_deque& operator=(const work_stealing_deque&);
+
+ public:
+  explicit work_stealing_deque(size_type capacity = 64)
+      : _top(0), _bottom(0) {
+    size_type n = 2;
+    while (n < capacity) n <<= 1;
+    this->_buffer_ptr.store(new _buffer(n));
+  };
+
+  ~work_stealing_deque() {
+    delete this->_buffer_ptr.load();
+    for (size_type i = 0; i < this->_retired.size(); ++i) {
+      delete this->_retired[i];
+    }
+  };
+
+  /**
+   * @brief Number of elements. Exact only for the owner while no thief is
+   * active.
+   */
+  size_type size() const {
+    std::ptrdiff_t bottom = this->_bottom.load(memory_order_relaxed);
+    std::ptrdiff_t top = this->_top.load(memory_order_relaxed);
+    return bottom > top ? static_cast< size_type >(bottom - top) : 0;
+  };
+
+  bool empty() const { return this->size() == 0; };
+
+  size_type capacity() const {
+    return this->_buffer_ptr.load(memory_order_relaxed)->mask + 1;
+  };
+
+  /**
+   * @brief Add value at the bottom (owner only).
+   */
+  void push(T value) {
+    std::ptrdiff_t bottom = this->_bottom.load(memory_order_relaxed);
+    std::ptrdiff_t top = this->_top.load(memory_order_acquire);
+    _buffer* buffer = this->_buffer_ptr.load(memory_order_relaxed);
+    if (bottom - top > static_cast< std::ptrdiff_t >(buffer->mask)) {
+      buffer = this->_grow(buffer, top, bottom);
+    }
+    buffer->put(bottom, value);
+    atomic_thread_fence(memory_order_release);
+    this->_bottom.store(bottom + 1, memory_order_relaxed);
+  };
+
+  /**
+   * @brief Take the newest element (owner only).
+   *
+   * @return false if the deque is empty or a thief won the last element
+   */
+  bool pop(T& value) {
+    std::ptrdiff_t bottom = this->_bottom.load(memory_order_relaxed) - 1;
+    _buffer* buffer = this->_buffer_ptr.load(memory_order_relaxed);
+    this->_bottom.store(bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    std::ptrdiff_t top = this->_top.load(memory_order_relaxed);
+    if (top > bottom) {
+      this->_bottom.store(bottom + 1, memory_order_relaxed);
+      return false;
+    }
+    value = buffer->get(bottom);
+    if (top < bottom) return true;
+    // the last element: race the thieves for it
+    bool won = this->_top.compare_exchange_strong(top, top + 1);
+    this->_bottom.store(bottom + 1, memory_order_relaxed);
+    return won;
+  };
+
+  /**
+   * @brief Take the oldest element (any thread).
+   *
+   * @return false if the deque looked empty or another thread won the race
+   */
+  bool steal(T& value) {
+    std::ptrdiff_t top = this->_top.load(memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    std::ptrdiff_t bottom = this->_bottom.load(memory_order_acquire);
+    if (top >= bottom) return false;
+    _buffer* buffer = this->_buffer_ptr.load(memory_order_acquire);
+    T stolen = buffer->get(top);
+    if (!this->_top.compare_exchange_strong(top, top + 1)) return false;
+    value = stolen;
+    return true;
+  };
+
+ private:
+  _buffer* _grow(_buffer* old, std::ptrdiff_t top, std::ptrdiff_t bottom) {
+    _buffer* buffer = new _buffer(2 * (old->mask + 1));
+    for (std::ptrdiff_t i = top; i < bottom; ++i) buffer->put(i, old->get(i));
+    this->_retired.push_back(old);
+    this->_buffer_ptr.store(buffer, memory_order_release);
+    return buffer;
+  };
+};
+
+/**
+ * @brief Fixed set of worker threads scheduling pool_tasks by work
+ * stealing.
+ *
+ * Every worker owns a work_stealing_deque. A task submitted from a worker
+ * goes to the bottom of its own deque and is most likely run by the same
+ * worker, newest first, which keeps divide and conquer depth first and
+ * cache warm. An idle worker steals the oldest task of a random victim,
+ * the biggest piece of work left, so stealing is rare. Tasks submitted
+ * from outside the pool go to a shared, locked queue. Workers that find
+ * nothing to do for a while sleep on a condition variable until new work
+ * is submitted.
+ *
+ * Threads waiting on a task_group help: they run pending tasks instead of
+ * blocking, so nested fork / join never deadlocks.
+ */
+class thread_pool {
+ public:
+  /* an unsigned integral type */
+  typedef std::size_t size_type;
+
+ private:
+  struct _worker {
+    thread_pool* pool;
+    size_type index;
+    unsigned long seed;
+    pthread_t thread;
+    work_stealing_deque< pool_task* > deque;
+  };
+
+  ft::vector< _worker* > _workers;
+  pthread_mutex_t _lock;
+  pthread_cond_t _wake;
+  /* guarded by _lock: tasks from outside the pool, and the wake count */
+  ft::vector< pool_task* > _injected;
+  size_type _signals;
+  ft::atomic< size_type > _injected_count;
+  ft::atomic< size_type > _sleepers;
+  ft::atomic< int > _stop;
+
+  thread_pool(const thread_pool&);
+  thread_pool& operator=(const thread_pool&);
+
+ public:
+  /**
+   * @brief Start threads workers; 0 starts one per online processor.
+   *
+   * @throw std::runtime_error if a thread cannot be created; the workers
+   * already started are joined first
+   */
+  explicit thread_pool(size_type threads = 0)
+      : _signals(0), _injected_count(0), _sleepers(0), _stop(0) {
+    if (threads == 0) threads = hardware_concurrency();
+    pthread_mutex_init(&this->_lock, NULL);
+    pthread_cond_init(&this->_wake, NULL);
+    for (size_type i = 0; i < threads; ++i) {
+      _worker* worker = new _worker();
+      worker->pool = this;
+      worker->index = i;
+      worker->seed = 2 * i + 1;
+      this->_workers.push_back(worker);
+    }
+    for (size_type i = 0; i < threads; ++i) {
+      if (pthread_create(&this->_workers[i]->thread, NULL, _worker_main,
+                         this->_workers[i]) != 0) {
+        this->_shutdown(i);
+        throw std::runtime_error("ft::thread_pool");
+      }
+    }
+  };
+
+  /**
+   * @brief Stop and join every worker. Every task_group must have been
+   * joined.
+   */
+  ~thread_pool() { this->_shutdown(this->_workers.size()); };
+
+  static size_type hardware_concurrency() {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n < 1 ? 1 : static_cast< size_type >(n);
+  };
+
+  /**
+   * @brief Number of worker threads.
+   */
+  size_type size() const { return this->_workers.size(); };
+
+  /**
+   * @brief Schedule task: on the caller's deque when called from one of
+   * this pool's workers, on the shared queue otherwise.
+   */
+  void submit(pool_task* task) {
+    _worker* self = this->_self();
+    if (self) {
+      self->deque.push(task);
+    } else {
+      pthread_mutex_lock(&this->_lock);
+      this->_injected.push_back(task);
+      this->_injected_count.fetch_add(1);
+      pthread_mutex_unlock(&this->_lock);
+    }
+    // pairs with the fence in _sleep: a worker about to sleep either sees
+    // the task or is seen here
+    atomic_thread_fence(memory_order_seq_cst);
+    if (this->_sleepers.load(memory_order_relaxed)) this->_notify();
+  };
+
+  /**
+   * @brief Run one pending task on the calling thread, if any: the newest
+   * of the caller's own deque first, then stolen or shared work.
+   *
+   * @return false if no task was found
+   */
+  bool run_one() {
+    _worker* self = this->_self();
+    pool_task* task;
+    if ((self && self->deque.pop(task)) || this->_find(self, task)) {
+      task->execute();
+      return true;
+    }
+    return false;
+  };
+
+  /**
+   * @brief Tasks waiting on the caller's own deque; 0 outside the pool.
+   * Zero means thieves took everything: the moment to offer more work.
+   */
+  size_type local_backlog() const {
+    _worker* self = this->_self();
+    return self ? self->deque.size() : 0;
+  };
+
+  /**
+   * @brief true on one of this pool's worker threads.
+   */
+  bool on_worker() const { return this->_self() != ft::u_nullptr; };
+
+ private:
+  static _worker*& _current() {
+    static __thread _worker* worker;
+    return worker;
+  };
+
+  _worker* _self() const {
+    _worker* worker = _current();
+    return worker && worker->pool == this ? worker : ft::u_nullptr;
+  };
+
+  static void* _worker_main(void* arg) {
+    _worker* self = static_cast< _worker* >(arg);
+    _current() = self;
+    self->pool->_loop();
+    return NULL;
+  };
+
+  void _loop() {
+    ft::backoff wait;
+    unsigned idle = 0;
+    while (!this->_stop.load(memory_order_relaxed)) {
+      if (this->run_one()) {
+        wait.reset();
+        idle = 0;
+      } else if (++idle < 64) {
+        wait.pause();
+      } else {
+        this->_sleep();
+        wait.reset();
+        idle = 0;
+      }
+    }
+  };
+
+  static unsigned long _next_random(unsigned long& seed) {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return seed;
+  };
+
+  /**
+   * @brief Steal from the workers, starting at a random victim, then take
+   * from the shared queue.
+   */
+  bool _find(_worker* self, pool_task*& task) {
+    size_type n = this->_workers.size();
+    if (n) {
+      // outside the pool, seed from the caller's stack address
+      unsigned long seed =
+          self ? self->seed : reinterpret_cast< unsigned long >(&task) | 1;
+      size_type start = _next_random(seed) % n;
+      if (self) self->seed = seed;
+      for (size_type i = 0; i < n; ++i) {
+        _worker* victim = this->_workers[(start + i) % n];
+        if (victim != self && victim->deque.steal(task)) return true;
+      }
+    }
+    if (!this->_injected_count.load(memory_order_relaxed)) return false;
+    bool found = false;
+    pthread_mutex_lock(&this->_lock);
+    if (!this->_injected.empty()) {
+      task = this->_injected.back();
+      this->_injected.pop_back();
+      this->_injected_count.fetch_sub(1);
+      found = true;
+    }
+    pthread_mutex_unlock(&this->_lock);
+    return found;
+  };
+
+  bool _has_work() const {
+    if (this->_injected_count.load()) return true;
+    for (size_type i = 0; i < this->_workers.size(); ++i) {
+      if (!this->_workers[i]->deque.empty()) return true;
+    }
+    return false;
+  };
+
+  /**
+   * @brief Block until a submit or the destructor signals. The sleeper
+   * count is raised before the final look for work, so a task submitted
+   * meanwhile is either found or triggers a signal.
+   */
+  void _sleep() {
+    pthread_mutex_lock(&this->_lock);
+    size_type seen = this->_signals;
+    pthread_mutex_unlock(&this->_lock);
+    this->_sleepers.fetch_add(1);
+    atomic_thread_fence(memory_order_seq_cst);
+    if (!this->_has_work()) {
+      pthread_mutex_lock(&this->_lock);
+      while (this->_signals == seen && !this->_stop.load()) {
+        pthread_cond_wait(&this->_wake, &this->_lock);
+      }
+      pthread_mutex_unlock(&this->_lock);
+    }
+    this->_sleepers.fetch_sub(1);
+  };
+
+  /**
+   * @brief Stop the workers, join the first started of them (the others
+   * never ran) and release everything the constructor set up.
+   */
+  void _shutdown(size_type started) {
+    pthread_mutex_lock(&this->_lock);
+    this->_stop.store(1);
+    ++this->_signals;
+    pthread_cond_broadcast(&this->_wake);
+    pthread_mutex_unlock(&this->_lock);
+    for (size_type i = 0; i < this->_workers.size(); ++i) {
+      if (i < started) pthread_join(this->_workers[i]->thread, NULL);
+      delete this->_workers[i];
+    }
+    this->_workers.clear();
+    pthread_cond_destroy(&this->_wake);
+    pthread_mutex_destroy(&this->_lock);
+  };
+
+  void _notify() {
+    pthread_mutex_lock(&this->_lock);
+    ++this->_signals;
+    pthread_cond_broadcast(&this->_wake);
+    pthread_mutex_unlock(&this->_lock);
+  };
+};
+
+/**
+ * @brief Set of forked tasks that can be joined together.
+ *
+ * fork() schedules a copy of a function object on the pool; join() waits
+ * until every task forked so far, including tasks they forked into the
+ * same group, has finished. The joining thread runs pending tasks while it
+ * waits. C++98 cannot carry an exception across threads: if a task throws,
+ * join() throws std::runtime_error instead.
+ */
+class task_group {
+ public:
+  /* an unsigned integral type */
+  typedef std::size_t size_type;
+
+ private:
+  template < class Function >
+  class _task : public pool_task {
+   private:
+    task_group* _group;
+    Function _f;
+
+   public:
+    _task(task_group* group, const Function& f) : _group(group), _f(f){};
+
+    void execute() {
+      task_group* group = this->_group;
+      try {
+        this->_f();
+      } catch (...) {
+        group->_failed.store(1);
+      }
+      thread_cache_allocator< _task > alloc;
+      alloc.destroy(this);
+      alloc.deallocate(this, 1);
+      group->_pending.fetch_sub(1, memory_order_acq_rel);
+    };
+  };
+
+  thread_pool* _pool;
+  ft::atomic< size_type > _pending;
+  ft::atomic< int > _failed;
+
+  task_group(const task_group&);
+  task_group& operator=(const task_group&);
+
+ public:
+  explicit task_group(thread_pool& pool)
+      : _pool(&pool), _pending(0), _failed(0){};
+
+  /**
+   * @brief Waits for the forked tasks, but swallows their failure: call
+   * join() to see it.
+   */
+  ~task_group() { this->_wait(); };
+
+  thread_pool& pool() const { return *this->_pool; };
+
+  /**
+   * @brief Schedule a copy of f, called as f().
+   */
+  template < class Function >
+  void fork(const Function& f) {
+    thread_cache_allocator< _task< Function > > alloc;
+    _task< Function >* task = alloc.allocate(1);
+    try {
+      alloc.construct(task, _task< Function >(this, f));
+    } catch (...) {
+      alloc.deallocate(task, 1);
+      throw;
+    }
+    this->_pending.fetch_add(1, memory_order_relaxed);
+    this->_pool->submit(task);
+  };
+
+  /**
+   * @brief Wait for every forked task, running pending tasks meanwhile.
+   */
+  void join() {
+    this->_wait();
+    int expected = 1;
+    if (this->_failed.compare_exchange_strong(expected, 0)) {
+      throw std::runtime_error("ft::task_group");
+    }
+  };
+
+  /**
+   * @brief Forked tasks not finished yet.
+   */
+  size_type pending() const { return this->_pending.load(); };
+
+ private:
+  void _wait() {
+    ft::backoff wait;
+    while (this->_pending.load(memory_order_acquire)) {
+      if (this->_pool->run_one()) {
+        wait.reset();
+      } else {
+        wait.pause();
+      }
+    }
+  };
+};
+
+/**
+ * @brief One piece of a parallel_for. While its range is longer than the
+ * grain it runs grain sized chunks, but whenever its worker's deque has
+ * been emptied by thieves it first forks off the upper half of what is
+ * left (lazy binary splitting): ranges only split where there are idle
+ * workers to take them.
+ *
+ * A thread outside the pool (the caller of parallel_for, helping in join)
+ * has no deque to watch, and its forks all go through the shared queue. It
+ * halves eagerly instead, but at most splits times, which leaves a few
+ * pieces per worker; the workers split those lazily.
+ */
+template < class Index, class Body >
+struct parallel_for_range {
+  task_group* group;
+  Index first;
+  Index last;
+  const Body* body;
+  std::size_t grain;
+  std::size_t splits;
+
+  parallel_for_range(task_group* g, Index f, Index l, const Body* b,
+                     std::size_t n, std::size_t s)
+      : group(g), first(f), last(l), body(b), grain(n), splits(s){};
+
+  void operator()() const {
+    Index begin = this->first;
+    Index end = this->last;
+    std::size_t splits = this->splits;
+    thread_pool& pool = this->group->pool();
+    bool on_worker = pool.on_worker();
+    while (static_cast< std::size_t >(end - begin) > this->grain) {
+      if (on_worker ? pool.local_backlog() == 0 : splits > 0) {
+        if (!on_worker) --splits;
+        Index middle = begin + (end - begin) / 2;
+        this->group->fork(parallel_for_range(this->group, middle, end,
+                                             this->body, this->grain,
+                                             splits));
+        end = middle;
+      } else {
+        Index next = begin + this->grain;
+        (*this->body)(begin, next);
+        begin = next;
+      }
+    }
+    if (begin != end) (*this->body)(begin, end);
+  };
+};
+
+/**
+ * @brief Call body(begin, end) over subranges covering [first, last), in
+ * parallel on pool, and return once all of them are done.
+ *
+ * Index is any type with random access arithmetic: an integer, a pointer
+ * or a random access iterator. Subranges are at most grain long; grain 0
+ * picks about eight chunks per worker.
+ */
+template < class Index, class Body >
+void parallel_for(thread_pool& pool, Index first, Index last,
+                  const Body& body, std::size_t grain = 0) {
+  if (!(first < last)) return;
+  std::size_t n = static_cast< std::size_t >(last - first);
+  if (grain == 0) grain = n / (8 * (pool.size() + 1));
+  if (grain == 0) grain = 1;
+  // off the pool, split into about two pieces per worker
+  std::size_t splits = 1;
+  for (std::size_t w = pool.size(); w > 1; w /= 2) ++splits;
+  task_group group(pool);
+  parallel_for_range< Index, Body > root(&group, first, last, &body, grain,
+                                         splits);
+  if (pool.on_worker()) {
+    root();
+  } else {
+    group.fork(root);
+  }
+  group.join();
+}
+
+}  // namespace ft
+
+#endif  // FT__THREAD_POOL_HPP
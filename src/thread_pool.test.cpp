@@ -0,0 +1,241 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/11
+ * @file src/thread_pool.test.cpp
+ */
+
+#include "thread_pool.hpp"
+
+#include <pthread.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "vector.hpp"
+
+void test_thread_pool_deque(void) {
+  std::cout << "\t work_stealing_deque" << std::endl;
+
+  ft::work_stealing_deque< long > deque(4);
+  long value;
+  assert(!deque.pop(value) && !deque.steal(value));
+  for (long i = 0; i < 100; ++i) deque.push(i);
+  assert(deque.size() == 100 && deque.capacity() >= 100);
+  // owner LIFO, thieves FIFO
+  assert(deque.pop(value) && value == 99);
+  assert(deque.steal(value) && value == 0);
+  assert(deque.steal(value) && value == 1);
+  while (deque.pop(value)) {
+  }
+  assert(deque.empty() && value == 2);
+}
+
+namespace {
+
+const long g_items = 100000;
+
+struct ws_test_shared {
+  ft::work_stealing_deque< long > deque;
+  ft::atomic< int > done;
+  ft::atomic< long > taken;
+  ft::atomic< long > sum;
+};
+
+void* ws_test_thief(void* arg) {
+  ws_test_shared* shared = static_cast< ws_test_shared* >(arg);
+  long taken = 0;
+  long sum = 0;
+  long value;
+  ft::backoff wait;
+  while (!shared->done.load() || !shared->deque.empty()) {
+    if (shared->deque.steal(value)) {
+      ++taken;
+      sum += value;
+    } else {
+      wait.pause();
+    }
+  }
+  shared->taken.fetch_add(taken);
+  shared->sum.fetch_add(sum);
+  return NULL;
+}
+
+}  // namespace
+
+void test_thread_pool_steal(void) {
+  std::cout << "\t concurrent steal" << std::endl;
+
+  ws_test_shared shared;
+  pthread_t thieves[3];
+  for (int i = 0; i < 3; ++i) {
+    pthread_create(&thieves[i], NULL, ws_test_thief, &shared);
+  }
+  long taken = 0;
+  long sum = 0;
+  long value;
+  for (long i = 1; i <= g_items; ++i) {
+    shared.deque.push(i);
+    // pop every third push: the owner races thieves for the last item
+    if (i % 3 == 0 && shared.deque.pop(value)) {
+      ++taken;
+      sum += value;
+    }
+  }
+  shared.done.store(1);
+  while (shared.deque.pop(value)) {
+    ++taken;
+    sum += value;
+  }
+  for (int i = 0; i < 3; ++i) pthread_join(thieves[i], NULL);
+  // every item taken exactly once
+  assert(taken + shared.taken.load() == g_items);
+  assert(sum + shared.sum.load() == g_items * (g_items + 1) / 2);
+}
+
+namespace {
+
+struct tp_test_fib {
+  ft::thread_pool* pool;
+  long n;
+  long* result;
+
+  void operator()() const {
+    if (this->n < 2) {
+      *this->result = this->n;
+      return;
+    }
+    long a;
+    long b;
+    ft::task_group group(*this->pool);
+    group.fork(tp_test_fib(this->pool, this->n - 1, &a));
+    tp_test_fib(this->pool, this->n - 2, &b)();
+    group.join();
+    *this->result = a + b;
+  };
+
+  tp_test_fib(ft::thread_pool* p, long k, long* r)
+      : pool(p), n(k), result(r){};
+};
+
+struct tp_test_throw {
+  void operator()() const { throw std::logic_error("task"); };
+};
+
+struct tp_test_mark {
+  ft::atomic< int >* hits;
+
+  void operator()(long first, long last) const {
+    for (long i = first; i < last; ++i) this->hits[i].fetch_add(1);
+  };
+};
+
+typedef ft::vector< int >::iterator tp_test_iterator;
+
+struct tp_test_square {
+  void operator()(tp_test_iterator first, tp_test_iterator last) const {
+    for (; first != last; ++first) *first = *first * *first;
+  };
+};
+
+/**
+ * @brief Quicksort over a random_access_iterator range, forking the left
+ * part.
+ */
+struct tp_test_sort {
+  ft::thread_pool* pool;
+  tp_test_iterator first;
+  tp_test_iterator last;
+
+  tp_test_sort(ft::thread_pool* p, tp_test_iterator f, tp_test_iterator l)
+      : pool(p), first(f), last(l){};
+
+  void operator()() const {
+    if (this->last - this->first < 2) return;
+    int pivot = *(this->first + (this->last - this->first) / 2);
+    tp_test_iterator i = this->first;
+    tp_test_iterator j = this->last - 1;
+    while (i <= j) {
+      while (*i < pivot) ++i;
+      while (pivot < *j) --j;
+      if (i <= j) {
+        int tmp = *i;
+        *i = *j;
+        *j = tmp;
+        ++i;
+        --j;
+      }
+    }
+    ft::task_group group(*this->pool);
+    group.fork(tp_test_sort(this->pool, this->first, j + 1));
+    tp_test_sort(this->pool, i, this->last)();
+    group.join();
+  };
+};
+
+}  // namespace
+
+void test_thread_pool_group(void) {
+  std::cout << "\t fork / join" << std::endl;
+
+  ft::thread_pool pool(4);
+  assert(pool.size() == 4 && !pool.on_worker());
+
+  long result = 0;
+  tp_test_fib(&pool, 20, &result)();
+  assert(result == 6765);
+
+  ft::task_group group(pool);
+  group.fork(tp_test_throw());
+  group.fork(tp_test_fib(&pool, 10, &result));
+  try {
+    group.join();
+    assert(false);
+  } catch (const std::runtime_error& e) {
+  }
+  assert(result == 55 && group.pending() == 0);
+  // the failure is reported once
+  group.join();
+
+  ft::vector< int > values;
+  for (int i = 0; i < 20000; ++i) values.push_back(std::rand() % 1000);
+  tp_test_sort(&pool, values.begin(), values.end())();
+  for (std::size_t i = 1; i < values.size(); ++i) {
+    assert(values[i - 1] <= values[i]);
+  }
+}
+
+void test_thread_pool_parallel_for(void) {
+  std::cout << "\t parallel_for" << std::endl;
+
+  ft::thread_pool pool(3);
+  const long n = 50000;
+  ft::atomic< int >* hits = new ft::atomic< int >[n];
+  tp_test_mark mark = {hits};
+  ft::parallel_for(pool, 0L, n, mark);
+  ft::parallel_for(pool, 0L, n, mark, 7);
+  ft::parallel_for(pool, 0L, 0L, mark);
+  for (long i = 0; i < n; ++i) assert(hits[i].load() == 2);
+  delete[] hits;
+
+  ft::vector< int > values(1000);
+  for (int i = 0; i < 1000; ++i) values[i] = i;
+  ft::parallel_for(pool, values.begin(), values.end(), tp_test_square(), 16);
+  for (int i = 0; i < 1000; ++i) assert(values[i] == i * i);
+}
+
+void test_thread_pool(void) {
+  std::cout << "Test: thread_pool" << std::endl;
+  test_thread_pool_deque();
+  test_thread_pool_steal();
+  test_thread_pool_group();
+  test_thread_pool_parallel_for();
+}
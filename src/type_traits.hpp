@@ -83,6 +83,47 @@ struct is_integral< unsigned long int > : public true_type {};
 template <>
 struct is_integral< unsigned long long int > : public true_type {};
 
+/**
+ * @brief Provides the member typedef type which is the same as T, except that
+ * its topmost const-qualifier is removed.
+ */
+template < class T >
+struct remove_const {
+  typedef T type;
+};
+
+template < class T >
+struct remove_const< const T > {
+  typedef T type;
+};
+
+/**
+ * @brief Provides the member typedef type which is the type referred to by T,
+ * or T itself if it is not a reference.
+ */
+template < class T >
+struct remove_reference {
+  typedef T type;
+};
+
+template < class T >
+struct remove_reference< T& > {
+  typedef T type;
+};
+
+/**
+ * @brief Checks whether T can be copied with memcpy / memmove and its
+ * source dropped without running a destructor. C++98 has no such trait, so
+ * this asks the compiler.
+ *
+ * @tparam T any complete type
+ */
+template < class T, bool = __is_trivially_copyable(T) >
+struct is_trivially_copyable : public false_type {};
+
+template < class T >
+struct is_trivially_copyable< T, true > : public true_type {};
+
 }  // namespace ft
 
 #endif  // FT__TYPE_TRAITS_HPP
@@ -0,0 +1,131 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/06
+ * @file src/unordered_map.bench.cpp
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <tr1/unordered_map>
+
+#include "bench.hpp"
+#include "unordered_map.hpp"
+#include "vector.hpp"
+
+void bench_unordered_map(void) {
+  std::cout << "Bench: unordered_map" << std::endl;
+
+  const std::size_t n = 1 << 20;
+  const std::size_t lookups = 1 << 22;
+
+  ft::vector< unsigned int > keys;
+  keys.reserve(n);
+  std::srand(42);
+  for (std::size_t i = 0; i < n; ++i) {
+    keys.push_back(static_cast< unsigned int >(std::rand()) * 2u);
+  }
+  ft::vector< unsigned int > probes;
+  probes.reserve(lookups);
+  for (std::size_t i = 0; i < lookups; ++i) {
+    probes.push_back(keys[std::rand() % n]);
+  }
+
+  double start = bench_now();
+  ft::unordered_map< unsigned int, unsigned int > swiss;
+  for (std::size_t i = 0; i < n; ++i) swiss[keys[i]] = i;
+  bench_report("unordered_map insert", bench_now() - start, n);
+
+  start = bench_now();
+  std::tr1::unordered_map< unsigned int, unsigned int > chained;
+  for (std::size_t i = 0; i < n; ++i) chained[keys[i]] = i;
+  bench_report("std::tr1::unordered_map insert", bench_now() - start, n);
+
+  start = bench_now();
+  std::map< unsigned int, unsigned int > tree;
+  for (std::size_t i = 0; i < n; ++i) tree[keys[i]] = i;
+  bench_report("std::map insert", bench_now() - start, n);
+
+  std::size_t sum = 0;
+  start = bench_now();
+  for (std::size_t i = 0; i < lookups; ++i) {
+    sum += swiss.find(probes[i])->second;
+  }
+  bench_report("unordered_map find (hit)", bench_now() - start, lookups);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < lookups; ++i) {
+    sum += chained.find(probes[i])->second;
+  }
+  bench_report("std::tr1::unordered_map find (hit)", bench_now() - start,
+               lookups);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < lookups; ++i) {
+    sum += tree.find(probes[i])->second;
+  }
+  bench_report("std::map find (hit)", bench_now() - start, lookups);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < lookups; ++i) {
+    sum += swiss.count(probes[i] + 1);
+  }
+  bench_report("unordered_map find (miss)", bench_now() - start, lookups);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < lookups; ++i) {
+    sum += chained.count(probes[i] + 1);
+  }
+  bench_report("std::tr1::unordered_map find (miss)", bench_now() - start,
+               lookups);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < n; ++i) sum += swiss.erase(keys[i]);
+  bench_report("unordered_map erase", bench_now() - start, n);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < n; ++i) sum += chained.erase(keys[i]);
+  bench_report("std::tr1::unordered_map erase", bench_now() - start, n);
+
+  // identity hashes sharing their low 20 bits, as ids with a tag in the
+  // low bits or addresses of aligned blocks have
+  ft::vector< unsigned long > shifted;
+  shifted.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    shifted.push_back(static_cast< unsigned long >(i) << 20);
+  }
+
+  start = bench_now();
+  ft::unordered_map< unsigned long, unsigned int > swiss_shifted;
+  for (std::size_t i = 0; i < n; ++i) swiss_shifted[shifted[i]] = i;
+  bench_report("unordered_map insert (keys << 20)", bench_now() - start, n);
+
+  start = bench_now();
+  std::tr1::unordered_map< unsigned long, unsigned int > chained_shifted;
+  for (std::size_t i = 0; i < n; ++i) chained_shifted[shifted[i]] = i;
+  bench_report("std::tr1::unordered_map insert (keys << 20)",
+               bench_now() - start, n);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < lookups; ++i) {
+    sum += swiss_shifted.find(shifted[probes[i] % n])->second;
+  }
+  bench_report("unordered_map find (keys << 20)", bench_now() - start,
+               lookups);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < lookups; ++i) {
+    sum += chained_shifted.find(shifted[probes[i] % n])->second;
+  }
+  bench_report("std::tr1::unordered_map find (keys << 20)",
+               bench_now() - start, lookups);
+
+  bench_sink(sum);
+}
@@ -0,0 +1,738 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/06
+ * @file src/unordered_map.hpp
+ */
+
+#if !defined(FT__UNORDERED_MAP_HPP)
+#define FT__UNORDERED_MAP_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "functional.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+#include "utility.hpp"
+
+namespace ft {
+
+/**
+ * @brief Control byte of a swiss table slot. A full slot stores the top 7
+ * bits of its mixed hash (H2, 0..127); special states are negative.
+ */
+typedef signed char swiss_ctrl_t;
+
+/* slot never used since the last rehash */
+static const swiss_ctrl_t swiss_empty = -128;
+/* slot emptied by erase while a probe sequence may pass through it */
+static const swiss_ctrl_t swiss_deleted = -2;
+/* end of the control array, stops iteration */
+static const swiss_ctrl_t swiss_sentinel = -1;
+
+/**
+ * @brief Control bytes of a table without storage: one sentinel followed by
+ * empties, so lookups and iteration need no special case.
+ */
+inline swiss_ctrl_t* swiss_empty_group() {
+  static swiss_ctrl_t group[16] = {
+      swiss_sentinel, swiss_empty, swiss_empty, swiss_empty,
+      swiss_empty,    swiss_empty, swiss_empty, swiss_empty,
+      swiss_empty,    swiss_empty, swiss_empty, swiss_empty,
+      swiss_empty,    swiss_empty, swiss_empty, swiss_empty};
+  return group;
+}
+
+/**
+ * @brief Index of the lowest set bit, mask must not be zero.
+ */
+inline unsigned swiss_lowest_bit(unsigned mask) {
+  return __builtin_ctz(mask);
+}
+
+/**
+ * @brief Sixteen consecutive control bytes matched in parallel. With SSE2 a
+ * match is one compare and one movemask; otherwise the bytes are scanned.
+ * Every match returns a bitmask where bit i stands for byte i.
+ */
+struct swiss_group {
+  static const std::size_t width = 16;
+
+#if defined(__SSE2__)
+  __m128i ctrl;
+
+  explicit swiss_group(const swiss_ctrl_t* pos)
+      : ctrl(_mm_loadu_si128(reinterpret_cast< const __m128i* >(pos))){};
+
+  unsigned match(swiss_ctrl_t h2) const {
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl));
+  };
+
+  unsigned match_empty() const { return this->match(swiss_empty); };
+
+  unsigned match_empty_or_deleted() const {
+    return _mm_movemask_epi8(
+        _mm_cmpgt_epi8(_mm_set1_epi8(swiss_sentinel), ctrl));
+  };
+#else
+  swiss_ctrl_t ctrl[16];
+
+  explicit swiss_group(const swiss_ctrl_t* pos) {
+    std::memcpy(ctrl, pos, width);
+  };
+
+  unsigned match(swiss_ctrl_t h2) const {
+    unsigned mask = 0;
+    for (std::size_t i = 0; i < width; ++i) mask |= (ctrl[i] == h2) << i;
+    return mask;
+  };
+
+  unsigned match_empty() const { return this->match(swiss_empty); };
+
+  unsigned match_empty_or_deleted() const {
+    unsigned mask = 0;
+    for (std::size_t i = 0; i < width; ++i) {
+      mask |= (ctrl[i] < swiss_sentinel) << i;
+    }
+    return mask;
+  };
+#endif
+};
+
+/**
+ * @brief Forward iterator over the full slots of a swiss table.
+ *
+ * @tparam T value type (const qualified for const_iterator)
+ */
+template < class T >
+class swiss_iterator : public ft::iterator< ft::forward_iterator_tag, T > {
+ public:
+  typedef ft::forward_iterator_tag iterator_category;
+  typedef typename ft::remove_const< T >::type value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef T* pointer;
+  typedef T& reference;
+
+ protected:
+  swiss_ctrl_t* _ctrl;
+  T* _slot;
+
+ public:
+  swiss_iterator() : _ctrl(ft::u_nullptr), _slot(ft::u_nullptr){};
+
+  /**
+   * @brief initalization constructor, moves forward to the first full slot
+   * at or after ctrl.
+   */
+  swiss_iterator(swiss_ctrl_t* ctrl, T* slot) : _ctrl(ctrl), _slot(slot) {
+    this->_skip_free();
+  };
+
+  swiss_iterator(const swiss_iterator& other)
+      : _ctrl(other._ctrl), _slot(other._slot){};
+
+  operator swiss_iterator< const T >() const {
+    return swiss_iterator< const T >(this->_ctrl, this->_slot);
+  }
+
+  swiss_iterator& operator=(const swiss_iterator& other) {
+    this->_ctrl = other._ctrl;
+    this->_slot = other._slot;
+    return *this;
+  };
+
+  reference operator*() const { return *_slot; };
+  pointer operator->() const { return _slot; };
+
+  swiss_iterator& operator++() {
+    ++_ctrl;
+    ++_slot;
+    this->_skip_free();
+    return *this;
+  };
+
+  swiss_iterator operator++(int) {
+    swiss_iterator tmp = *this;
+    ++(*this);
+    return tmp;
+  };
+
+  swiss_ctrl_t* const& ctrl() const { return this->_ctrl; }
+
+ private:
+  void _skip_free() {
+    while (*_ctrl < swiss_sentinel) {
+      ++_ctrl;
+      ++_slot;
+    }
+  };
+};
+
+template < class T1, class T2 >
+bool operator==(const swiss_iterator< T1 >& lhs,
+                const swiss_iterator< T2 >& rhs) {
+  return lhs.ctrl() == rhs.ctrl();
+};
+
+template < class T1, class T2 >
+bool operator!=(const swiss_iterator< T1 >& lhs,
+                const swiss_iterator< T2 >& rhs) {
+  return lhs.ctrl() != rhs.ctrl();
+};
+
+/**
+ * @brief An associative container of unique keys organized as an open
+ * addressing hash table in the "swiss table" layout.
+ *
+ * Next to the slot array lives one control byte per slot holding 7 bits of
+ * the hash. A lookup loads 16 control bytes at once and compares them all
+ * against the wanted hash bits, so keys are compared only for likely
+ * candidates and a miss usually ends on the first group that has an empty
+ * byte. Erase only leaves a tombstone when the slot sits inside a run of 16
+ * full bytes that a probe could have crossed; otherwise the slot returns to
+ * empty.
+ *
+ * The capacity is always 2^k - 1 slots. Inserting never rehashes until the
+ * load reaches max_load_factor(); call reserve() up front to keep rehashing
+ * out of the hot path. Rehash invalidates iterators, erase does not.
+ *
+ * @tparam Key Type of the keys.
+ * @tparam T Type of the mapped value.
+ * @tparam Hash hash function object, defaults to `ft::hash<Key>`.
+ * @tparam KeyEqual equality on keys, defaults to `equal_to<Key>`.
+ * @tparam _Alloc allocator for the ft::pair slots.
+ */
+template < class Key, class T, class Hash = ft::hash< Key >,
+           class KeyEqual = std::equal_to< Key >,
+           class _Alloc = std::allocator< ft::pair< const Key, T > > >
+class unordered_map {
+ public:
+  /* The first template parameter (Key) */
+  typedef Key key_type;
+  /* The second template parameter (T) */
+  typedef T mapped_type;
+  /* pair< const key_type, mapped_type > */
+  typedef ft::pair< const Key, T > value_type;
+  /* The third template parameter (Hash) */
+  typedef Hash hasher;
+  /* The fourth template parameter (KeyEqual) */
+  typedef KeyEqual key_equal;
+  /* The fifth template parameter (_Alloc) */
+  typedef _Alloc allocator_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+  /* a forward iterator to value_type */
+  typedef ft::swiss_iterator< value_type > iterator;
+  /* a forward iterator to const value_type */
+  typedef ft::swiss_iterator< const value_type > const_iterator;
+  /* an unsigned integral type */
+  typedef std::size_t size_type;
+  /* a signed integral type */
+  typedef std::ptrdiff_t difference_type;
+
+ private:
+  typedef typename _Alloc::template rebind< swiss_ctrl_t >::other
+      _ctrl_allocator;
+
+  /* smallest non empty capacity, one full group */
+  static const size_type _min_capacity = 15;
+
+  hasher _hash;
+  key_equal _eq;
+  allocator_type _alloc;
+  _ctrl_allocator _ctrl_alloc;
+  swiss_ctrl_t* _ctrl;
+  value_type* _slots;
+  size_type _capacity;
+  size_type _size;
+  size_type _growth_left;
+  float _max_load;
+
+ public:
+  /**
+   * @brief empty container constructor
+   *
+   * @param n minimal number of slots to allocate up front.
+   */
+  explicit unordered_map(size_type n = 0, const hasher& hf = hasher(),
+                         const key_equal& eql = key_equal(),
+                         const allocator_type& alloc = allocator_type())
+      : _hash(hf), _eq(eql), _alloc(alloc), _ctrl_alloc(alloc) {
+    this->_init();
+    if (n) this->rehash(n);
+  };
+
+  /**
+   * @brief range constructor
+   */
+  template < class InputIterator >
+  unordered_map(InputIterator first, InputIterator last, size_type n = 0,
+                const hasher& hf = hasher(),
+                const key_equal& eql = key_equal(),
+                const allocator_type& alloc = allocator_type(),
+                typename ft::enable_if< !ft::is_integral<
+                    InputIterator >::value >::type* = u_nullptr)
+      : _hash(hf), _eq(eql), _alloc(alloc), _ctrl_alloc(alloc) {
+    this->_init();
+    if (n) this->rehash(n);
+    this->insert(first, last);
+  };
+
+  /**
+   * @brief copy constructor
+   */
+  unordered_map(const unordered_map& x)
+      : _hash(x._hash),
+        _eq(x._eq),
+        _alloc(x._alloc),
+        _ctrl_alloc(x._ctrl_alloc) {
+    this->_init();
+    this->_max_load = x._max_load;
+    this->reserve(x.size());
+    this->insert(x.begin(), x.end());
+  };
+
+  unordered_map& operator=(const unordered_map& x) {
+    if (this != &x) {
+      unordered_map tmp(x);
+      this->swap(tmp);
+    }
+    return *this;
+  };
+
+  ~unordered_map() { this->_release(); };
+
+  iterator begin() { return iterator(this->_ctrl, this->_slots); };
+  const_iterator begin() const {
+    return const_iterator(this->_ctrl, this->_slots);
+  };
+  iterator end() {
+    return iterator(this->_ctrl + this->_capacity,
+                    this->_slots + this->_capacity);
+  };
+  const_iterator end() const {
+    return const_iterator(this->_ctrl + this->_capacity,
+                          this->_slots + this->_capacity);
+  };
+
+  bool empty() const { return this->_size == 0; };
+  size_type size() const { return this->_size; };
+  size_type max_size() const { return this->_alloc.max_size(); };
+
+  mapped_type& operator[](const key_type& k) {
+    return this->_insert_unique(k, mapped_type()).first->second;
+  };
+
+  mapped_type& at(const key_type& k) {
+    iterator it = this->find(k);
+    if (it == this->end()) throw std::out_of_range("ft::unordered_map");
+    return it->second;
+  };
+
+  const mapped_type& at(const key_type& k) const {
+    const_iterator it = this->find(k);
+    if (it == this->end()) throw std::out_of_range("ft::unordered_map");
+    return it->second;
+  };
+
+  ft::pair< iterator, bool > insert(const value_type& val) {
+    return this->_insert_unique(val.first, val.second);
+  };
+
+  /**
+   * @brief Insert element, the hint is ignored.
+   */
+  iterator insert(const_iterator hint, const value_type& val) {
+    (void)hint;
+    return this->_insert_unique(val.first, val.second).first;
+  };
+
+  template < class InputIterator >
+  void insert(
+      InputIterator first, InputIterator last,
+      typename ft::enable_if<
+          !ft::is_integral< InputIterator >::value >::type* = u_nullptr) {
+    for (; first != last; ++first) {
+      this->_insert_unique(first->first, first->second);
+    }
+  };
+
+  /**
+   * @brief Erase element at position
+   *
+   * @return iterator to the element that followed the erased one.
+   */
+  iterator erase(const_iterator position) {
+    size_type i = position.ctrl() - this->_ctrl;
+    this->_erase_at(i);
+    return iterator(this->_ctrl + i + 1, this->_slots + i + 1);
+  };
+
+  size_type erase(const key_type& k) {
+    size_type i = this->_find_index(k);
+    if (i == this->_capacity) return 0;
+    this->_erase_at(i);
+    return 1;
+  };
+
+  iterator erase(const_iterator first, const_iterator last) {
+    while (first != last) first = this->erase(first);
+    size_type i = last.ctrl() - this->_ctrl;
+    return iterator(this->_ctrl + i, this->_slots + i);
+  };
+
+  void clear() {
+    for (size_type i = 0; i < this->_capacity; ++i) {
+      if (this->_ctrl[i] >= 0) this->_alloc.destroy(this->_slots + i);
+    }
+    if (this->_capacity) {
+      this->_reset_ctrl();
+      this->_size = 0;
+      this->_growth_left = this->_growth(this->_capacity);
+    }
+  };
+
+  void swap(unordered_map& x) {
+    ft::swap(this->_hash, x._hash);
+    ft::swap(this->_eq, x._eq);
+    ft::swap(this->_ctrl, x._ctrl);
+    ft::swap(this->_slots, x._slots);
+    ft::swap(this->_capacity, x._capacity);
+    ft::swap(this->_size, x._size);
+    ft::swap(this->_growth_left, x._growth_left);
+    ft::swap(this->_max_load, x._max_load);
+  };
+
+  iterator find(const key_type& k) {
+    size_type i = this->_find_index(k);
+    return iterator(this->_ctrl + i, this->_slots + i);
+  };
+
+  const_iterator find(const key_type& k) const {
+    size_type i = this->_find_index(k);
+    return const_iterator(this->_ctrl + i, this->_slots + i);
+  };
+
+  size_type count(const key_type& k) const {
+    return this->_find_index(k) != this->_capacity;
+  };
+
+  ft::pair< iterator, iterator > equal_range(const key_type& k) {
+    iterator it = this->find(k);
+    iterator next = it;
+    if (it != this->end()) ++next;
+    return ft::make_pair(it, next);
+  };
+
+  ft::pair< const_iterator, const_iterator > equal_range(
+      const key_type& k) const {
+    const_iterator it = this->find(k);
+    const_iterator next = it;
+    if (it != this->end()) ++next;
+    return ft::make_pair(it, next);
+  };
+
+  /**
+   * @brief Number of slots.
+   */
+  size_type bucket_count() const { return this->_capacity; };
+
+  float load_factor() const {
+    if (this->_capacity == 0) return 0.0f;
+    return static_cast< float >(this->_size) / this->_capacity;
+  };
+
+  float max_load_factor() const { return this->_max_load; };
+
+  /**
+   * @brief Set the maximum load factor, clamped to [0.25, 0.95]. Rehashes
+   * right away: to a larger table if the current elements no longer fit,
+   * otherwise in place. The growth budget is only exact without tombstones,
+   * and a budget that ignored them could let inserts fill the last empty
+   * slot.
+   */
+  void max_load_factor(float ml) {
+    if (ml < 0.25f) ml = 0.25f;
+    if (ml > 0.95f) ml = 0.95f;
+    this->_max_load = ml;
+    if (this->_growth(this->_capacity) < this->_size) {
+      this->rehash(0);
+    } else if (this->_capacity) {
+      this->_resize(this->_capacity);
+    }
+  };
+
+  /**
+   * @brief Rebuild the table with at least n slots (and enough for the
+   * current elements). Also drops every tombstone.
+   */
+  void rehash(size_type n) {
+    size_type needed = this->_slots_for(this->_size);
+    if (n < needed) n = needed;
+    if (n == 0 && this->_size == 0) {
+      this->_release();
+      this->_init_storage();
+      return;
+    }
+    this->_resize(this->_normalize_capacity(n));
+  };
+
+  /**
+   * @brief Make room for n elements: no rehash happens until size() exceeds
+   * n.
+   */
+  void reserve(size_type n) {
+    if (n > this->_size + this->_growth_left) {
+      this->rehash(this->_slots_for(n));
+    }
+  };
+
+  hasher hash_function() const { return this->_hash; };
+  key_equal key_eq() const { return this->_eq; };
+  allocator_type get_allocator() const { return this->_alloc; };
+
+ private:
+  void _init() {
+    this->_max_load = 0.875f;
+    this->_init_storage();
+  };
+
+  void _init_storage() {
+    this->_ctrl = swiss_empty_group();
+    this->_slots = ft::u_nullptr;
+    this->_capacity = 0;
+    this->_size = 0;
+    this->_growth_left = 0;
+  };
+
+  void _release() {
+    if (!this->_capacity) return;
+    for (size_type i = 0; i < this->_capacity; ++i) {
+      if (this->_ctrl[i] >= 0) this->_alloc.destroy(this->_slots + i);
+    }
+    this->_ctrl_alloc.deallocate(this->_ctrl,
+                                 this->_capacity + swiss_group::width);
+    this->_alloc.deallocate(this->_slots, this->_capacity);
+  };
+
+  /**
+   * @brief Number of elements a capacity holds before growing; at least one
+   * slot always stays empty so every probe terminates.
+   */
+  size_type _growth(size_type capacity) const {
+    if (capacity == 0) return 0;
+    size_type growth = static_cast< size_type >(capacity * this->_max_load);
+    return growth < capacity ? growth : capacity - 1;
+  };
+
+  size_type _slots_for(size_type n) const {
+    return static_cast< size_type >(n / this->_max_load) + 1;
+  };
+
+  static size_type _normalize_capacity(size_type n) {
+    size_type capacity = _min_capacity;
+    while (capacity < n) capacity = capacity * 2 + 1;
+    return capacity;
+  };
+
+  /**
+   * @brief Mix the user hash: fold the high half into the low half,
+   * multiply by a 64-bit odd constant, and fold again. The low bits of a
+   * product only depend on the low bits of its input, so both folds are
+   * needed for keys that differ only in their high bits (i << 20, i << 44)
+   * to start on different probe sequences.
+   */
+  size_type _mix(size_type h) const {
+    h ^= h >> (sizeof(size_type) * 4);
+    h *= static_cast< size_type >(0x9E3779B97F4A7C15ULL);
+    return h ^ (h >> (sizeof(size_type) * 4));
+  };
+
+  static size_type _h1(size_type hash) { return hash; };
+
+  static swiss_ctrl_t _h2(size_type hash) {
+    return static_cast< swiss_ctrl_t >(hash >> (sizeof(size_type) * 8 - 7));
+  };
+
+  /**
+   * @brief Write a control byte and its clone. The first width - 1 bytes are
+   * mirrored after the sentinel so a group load never wraps.
+   */
+  void _set_ctrl(size_type i, swiss_ctrl_t h) {
+    this->_ctrl[i] = h;
+    this->_ctrl[((i - (swiss_group::width - 1)) & this->_capacity) +
+                ((swiss_group::width - 1) & this->_capacity)] = h;
+  };
+
+  void _reset_ctrl() {
+    std::memset(this->_ctrl, swiss_empty,
+                this->_capacity + swiss_group::width);
+    this->_ctrl[this->_capacity] = swiss_sentinel;
+  };
+
+  /**
+   * @brief Slot index of k, or capacity when absent. Probes group by group
+   * with a triangular sequence, which visits every group of a 2^k table.
+   */
+  size_type _find_index(const key_type& k) const {
+    size_type hash = this->_mix(this->_hash(k));
+    swiss_ctrl_t h2 = this->_h2(hash);
+    size_type pos = this->_h1(hash) & this->_capacity;
+    size_type step = 0;
+    while (true) {
+      swiss_group group(this->_ctrl + pos);
+      for (unsigned mask = group.match(h2); mask; mask &= mask - 1) {
+        size_type i = (pos + swiss_lowest_bit(mask)) & this->_capacity;
+        if (this->_eq(this->_slots[i].first, k)) return i;
+      }
+      if (group.match_empty()) return this->_capacity;
+      step += swiss_group::width;
+      pos = (pos + step) & this->_capacity;
+    }
+  };
+
+  /**
+   * @brief First empty or deleted slot on the probe sequence of hash.
+   */
+  size_type _find_free(size_type hash) const {
+    size_type pos = this->_h1(hash) & this->_capacity;
+    size_type step = 0;
+    while (true) {
+      swiss_group group(this->_ctrl + pos);
+      unsigned mask = group.match_empty_or_deleted();
+      if (mask) return (pos + swiss_lowest_bit(mask)) & this->_capacity;
+      step += swiss_group::width;
+      pos = (pos + step) & this->_capacity;
+    }
+  };
+
+  ft::pair< iterator, bool > _insert_unique(const Key& k, const T& v) {
+    size_type i = this->_find_index(k);
+    if (i != this->_capacity) {
+      return ft::make_pair(iterator(this->_ctrl + i, this->_slots + i), false);
+    }
+    size_type hash = this->_mix(this->_hash(k));
+    i = this->_find_free(hash);
+    if (this->_growth_left == 0 && this->_ctrl[i] != swiss_deleted) {
+      this->_grow();
+      i = this->_find_free(hash);
+    }
+    this->_alloc.construct(this->_slots + i, value_type(k, v));
+    this->_growth_left -= (this->_ctrl[i] == swiss_empty);
+    this->_set_ctrl(i, this->_h2(hash));
+    ++this->_size;
+    return ft::make_pair(iterator(this->_ctrl + i, this->_slots + i), true);
+  };
+
+  /**
+   * @brief Out of growth: rehash in place when tombstones are the reason,
+   * otherwise double the table.
+   */
+  void _grow() {
+    if (this->_capacity && this->_size * 2 <= this->_growth(this->_capacity)) {
+      this->_resize(this->_capacity);
+    } else {
+      this->_resize(this->_capacity ? this->_capacity * 2 + 1
+                                    : _min_capacity);
+    }
+  };
+
+  void _resize(size_type capacity) {
+    swiss_ctrl_t* old_ctrl = this->_ctrl;
+    value_type* old_slots = this->_slots;
+    size_type old_capacity = this->_capacity;
+
+    this->_ctrl = this->_ctrl_alloc.allocate(capacity + swiss_group::width);
+    this->_slots = this->_alloc.allocate(capacity);
+    this->_capacity = capacity;
+    this->_reset_ctrl();
+
+    for (size_type i = 0; i < old_capacity; ++i) {
+      if (old_ctrl[i] < 0) continue;
+      size_type hash = this->_mix(this->_hash(old_slots[i].first));
+      size_type j = this->_find_free(hash);
+      this->_set_ctrl(j, this->_h2(hash));
+      this->_alloc.construct(this->_slots + j, old_slots[i]);
+      this->_alloc.destroy(old_slots + i);
+    }
+    this->_growth_left = this->_growth(capacity) - this->_size;
+
+    if (old_capacity) {
+      this->_ctrl_alloc.deallocate(old_ctrl,
+                                   old_capacity + swiss_group::width);
+      this->_alloc.deallocate(old_slots, old_capacity);
+    }
+  };
+
+  /**
+   * @brief Free slot i. If no window of 16 bytes covering i was ever fully
+   * occupied, no probe sequence can have passed over i, so it goes back to
+   * empty instead of becoming a tombstone.
+   */
+  void _erase_at(size_type i) {
+    this->_alloc.destroy(this->_slots + i);
+    --this->_size;
+
+    size_type before = (i - swiss_group::width) & this->_capacity;
+    unsigned empty_before = swiss_group(this->_ctrl + before).match_empty();
+    unsigned empty_after = swiss_group(this->_ctrl + i).match_empty();
+    bool was_never_full =
+        empty_before && empty_after &&
+        (static_cast< size_type >(__builtin_ctz(empty_after)) +
+         static_cast< size_type >(__builtin_clz(empty_before << 16))) <
+            swiss_group::width;
+
+    if (was_never_full) {
+      this->_set_ctrl(i, swiss_empty);
+      ++this->_growth_left;
+    } else {
+      this->_set_ctrl(i, swiss_deleted);
+    }
+  };
+};
+
+template < class Key, class T, class Hash, class Pred, class Alloc >
+bool operator==(const unordered_map< Key, T, Hash, Pred, Alloc >& lhs,
+                const unordered_map< Key, T, Hash, Pred, Alloc >& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  typedef typename unordered_map< Key, T, Hash, Pred, Alloc >::const_iterator
+      const_iterator;
+  for (const_iterator it = lhs.begin(); it != lhs.end(); ++it) {
+    const_iterator other = rhs.find(it->first);
+    if (other == rhs.end() || !(other->second == it->second)) return false;
+  }
+  return true;
+};
+
+template < class Key, class T, class Hash, class Pred, class Alloc >
+bool operator!=(const unordered_map< Key, T, Hash, Pred, Alloc >& lhs,
+                const unordered_map< Key, T, Hash, Pred, Alloc >& rhs) {
+  return !(lhs == rhs);
+};
+
+template < class Key, class T, class Hash, class Pred, class Alloc >
+void swap(unordered_map< Key, T, Hash, Pred, Alloc >& x,
+          unordered_map< Key, T, Hash, Pred, Alloc >& y) {
+  x.swap(y);
+};
+
+}  // namespace ft
+
+#endif  // FT__UNORDERED_MAP_HPP
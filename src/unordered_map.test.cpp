@@ -0,0 +1,196 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/06
+ * @file src/unordered_map.test.cpp
+ */
+
+#include "unordered_map.hpp"
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+
+typedef ft::unordered_map< int, int > ft_unordered_map;
+typedef std::map< int, int > std_map;
+
+static bool same_content(const ft_unordered_map& ft_m,
+                         const std_map& std_m) {
+  if (ft_m.size() != std_m.size()) return false;
+  std::size_t visited = 0;
+  for (ft_unordered_map::const_iterator it = ft_m.begin(); it != ft_m.end();
+       ++it, ++visited) {
+    std_map::const_iterator found = std_m.find(it->first);
+    if (found == std_m.end() || found->second != it->second) return false;
+  }
+  return visited == std_m.size();
+}
+
+void test_unordered_map_modifiers(void) {
+  std::cout << "\t modifiers" << std::endl;
+
+  ft_unordered_map ft_m;
+  std_map std_m;
+
+  std::srand(11);
+  for (int i = 0; i < 20000; ++i) {
+    int k = std::rand() % 3000 - 1000;
+    switch (std::rand() % 4) {
+      case 0:
+        ft_m[k] = i;
+        std_m[k] = i;
+        break;
+      case 1:
+        assert(ft_m.insert(ft::make_pair(k, i)).second ==
+               std_m.insert(std::make_pair(k, i)).second);
+        break;
+      default:
+        assert(ft_m.erase(k) == std_m.erase(k));
+        break;
+    }
+    assert(ft_m.size() == std_m.size());
+  }
+  assert(same_content(ft_m, std_m));
+  assert(ft_m.load_factor() <= ft_m.max_load_factor());
+
+  std::size_t before = ft_m.size();
+  ft_unordered_map::iterator it = ft_m.begin();
+  while (it != ft_m.end()) {
+    if (it->first % 2 == 0) {
+      std_m.erase(it->first);
+      it = ft_m.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  assert(ft_m.size() < before && same_content(ft_m, std_m));
+
+  ft_unordered_map ft_copy(ft_m);
+  assert(ft_copy == ft_m);
+  ft_unordered_map ft_other;
+  ft_other[1] = 1;
+  ft_copy.swap(ft_other);
+  assert(ft_copy.size() == 1 && ft_other == ft_m);
+  ft_copy = ft_m;
+  assert(ft_copy == ft_m);
+  ft_copy[123456] = 0;
+  assert(ft_copy != ft_m);
+
+  ft_m.erase(ft_m.begin(), ft_m.end());
+  assert(ft_m.empty() && ft_m.begin() == ft_m.end());
+  ft_copy.clear();
+  assert(ft_copy.empty() && ft_copy.find(123456) == ft_copy.end());
+}
+
+void test_unordered_map_lookup(void) {
+  std::cout << "\t lookup" << std::endl;
+
+  ft_unordered_map ft_m;
+  for (int i = 0; i < 1000; i += 3) ft_m[i] = i * 2;
+  for (int i = -5; i < 1005; ++i) {
+    bool present = i >= 0 && i < 1000 && i % 3 == 0;
+    assert(ft_m.count(i) == (present ? 1u : 0u));
+    assert((ft_m.find(i) != ft_m.end()) == present);
+    ft::pair< ft_unordered_map::iterator, ft_unordered_map::iterator > range =
+        ft_m.equal_range(i);
+    assert((range.first != range.second) == present);
+    if (present) assert(ft_m.find(i)->second == i * 2);
+  }
+
+  const ft_unordered_map& cref = ft_m;
+  assert(cref.at(3) == 6);
+  try {
+    cref.at(4);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+
+  ft::unordered_map< std::string, int > words;
+  words["alpha"] = 1;
+  words["beta"] = 2;
+  words.insert(ft::make_pair(std::string("gamma"), 3));
+  assert(words.size() == 3 && words["beta"] == 2);
+  assert(words.count("delta") == 0);
+  words.erase("alpha");
+  assert(words.find("alpha") == words.end() && words.at("gamma") == 3);
+
+  // keys that differ only above their low 20 bits; with the identity hash
+  // they used to share one probe sequence and take seconds to insert
+  ft::unordered_map< unsigned long, int > shifted;
+  for (int i = 0; i < 50000; ++i) {
+    shifted[static_cast< unsigned long >(i) << 20] = i;
+  }
+  assert(shifted.size() == 50000);
+  for (int i = 0; i < 50000; ++i) {
+    assert(shifted.at(static_cast< unsigned long >(i) << 20) == i);
+    assert(shifted.count((static_cast< unsigned long >(i) << 20) + 1) == 0);
+  }
+}
+
+void test_unordered_map_buckets(void) {
+  std::cout << "\t buckets" << std::endl;
+
+  ft_unordered_map ft_m;
+  ft_m.reserve(1000);
+  std::size_t buckets = ft_m.bucket_count();
+  for (int i = 0; i < 1000; ++i) ft_m[i] = i;
+  assert(ft_m.bucket_count() == buckets);
+  assert(ft_m.load_factor() <= ft_m.max_load_factor());
+
+  ft_m.max_load_factor(0.3f);
+  assert(ft_m.load_factor() <= 0.3f);
+  assert(ft_m.bucket_count() > buckets);
+  for (int i = 0; i < 1000; ++i) assert(ft_m[i] == i);
+
+  // churn through many distinct keys so tombstones pile up and get purged
+  ft_unordered_map churn;
+  for (int i = 0; i < 100000; ++i) {
+    churn[i] = i;
+    if (i >= 64) churn.erase(i - 64);
+  }
+  assert(churn.size() == 64 && churn.bucket_count() < 1024);
+  for (int i = 100000 - 64; i < 100000; ++i) assert(churn.at(i) == i);
+
+  churn.rehash(0);
+  assert(churn.size() == 64 && churn.load_factor() <= 0.875f);
+  for (int i = 100000 - 64; i < 100000; ++i) assert(churn.at(i) == i);
+
+  // raising the load factor over a table full of tombstones must still
+  // leave an empty slot for every probe to stop at
+  for (unsigned int seed = 0; seed < 32; ++seed) {
+    ft_unordered_map small;
+    std_map std_m;
+    std::srand(seed);
+    for (int i = 0; i < 2000; ++i) {
+      int k = std::rand() % 64;
+      if (std::rand() % 2) {
+        small[k] = i;
+        std_m[k] = i;
+      } else {
+        assert(small.erase(k) == std_m.erase(k));
+      }
+    }
+    small.max_load_factor(0.95f);
+    for (int k = 0; k < 64; ++k) {
+      assert(small.count(k) == std_m.count(k));
+      small[k] = k;
+    }
+    for (int k = 64; k < 128; ++k) assert(small.count(k) == 0);
+    assert(small.size() == 64 && small.load_factor() <= 0.95f);
+  }
+}
+
+void test_unordered_map(void) {
+  std::cout << "Test: unordered_map" << std::endl;
+  test_unordered_map_modifiers();
+  test_unordered_map_lookup();
+  test_unordered_map_buckets();
+}
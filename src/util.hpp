@@ -35,6 +35,22 @@ struct nullptr_t {
 
 static nullptr_t u_nullptr = {};
 
+/**
+ * @brief Keeps an allocator as a base class so that a stateless allocator such
+ * as `std::allocator` takes no storage in the container deriving from it.
+ *
+ * @tparam _Alloc Allocator type, must be a class type.
+ */
+template < class _Alloc >
+class allocator_holder : private _Alloc {
+ public:
+  explicit allocator_holder(const _Alloc& alloc) : _Alloc(alloc){};
+
+ protected:
+  _Alloc& _alloc() { return *this; };
+  const _Alloc& _alloc() const { return *this; };
+};
+
 template < class InputIterator >
 typename ft::iterator_traits< InputIterator >::difference_type difference(
     InputIterator first, InputIterator last) {
@@ -108,6 +108,68 @@ bool operator>=(const pair< T1, T2 >& lhs, const pair< T1, T2 >& rhs) {
   return !(lhs < rhs);
 }
 
+/**
+ * @brief Pair of references
+ * Exposes first and second like pair, but both members refer to values stored
+ * elsewhere (e.g. in parallel key / value arrays). Used as the reference type
+ * of containers that do not store pair objects. Converts to any pair whose
+ * members are constructible from the referred values.
+ *
+ * @tparam T1 Type referred by first.
+ * @tparam T2 Type referred by second.
+ */
+template < class T1, class T2 >
+struct pair_reference {
+  /* The first template parameter (T1) */
+  typedef T1 first_type;
+  /* The second template parameter (T2) */
+  typedef T2 second_type;
+
+  /* Reference to the first value */
+  first_type& first;
+  /* Reference to the second value */
+  second_type& second;
+
+  pair_reference(first_type& a, second_type& b) : first(a), second(b){};
+
+  /**
+   * @brief copy / const-cast constructor
+   */
+  template < class U, class V >
+  pair_reference(const pair_reference< U, V >& pr)
+      : first(pr.first), second(pr.second){};
+
+  /**
+   * @brief Copy the referred values out as a pair.
+   */
+  template < class U, class V >
+  operator pair< U, V >() const {
+    return pair< U, V >(first, second);
+  }
+
+ private:
+  pair_reference& operator=(const pair_reference&);
+};
+
+template < class T1, class T2, class U1, class U2 >
+bool operator==(const pair_reference< T1, T2 >& lhs,
+                const pair_reference< U1, U2 >& rhs) {
+  return lhs.first == rhs.first && lhs.second == rhs.second;
+}
+
+template < class T1, class T2, class U1, class U2 >
+bool operator!=(const pair_reference< T1, T2 >& lhs,
+                const pair_reference< U1, U2 >& rhs) {
+  return !(lhs == rhs);
+}
+
+template < class T1, class T2, class U1, class U2 >
+bool operator<(const pair_reference< T1, T2 >& lhs,
+               const pair_reference< U1, U2 >& rhs) {
+  return lhs.first < rhs.first ||
+         (!(rhs.first < lhs.first) && lhs.second < rhs.second);
+}
+
 /**
  * @brief Exchanges the values of a and b.
  */
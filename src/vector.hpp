@@ -33,7 +33,10 @@ namespace ft {
  * allocation model, defaults to `allocator<_T>`.
  */
 template < class _T, class _Alloc = std::allocator< _T > >
-class vector {
+class vector : private ft::allocator_holder< _Alloc > {
+  /* empty allocators cost no space (empty base optimization) */
+  typedef ft::allocator_holder< _Alloc > _allocator_base;
+
  public:
   /**
    * @brief The first template parameter (_T)
@@ -81,7 +84,6 @@ class vector {
   typedef typename allocator_type::size_type size_type;
 
  private:
-  allocator_type _alloc;
   pointer _start;
   pointer _end;
   pointer _end_capacity;
@@ -92,7 +94,7 @@ class vector {
    * Constructs an empty container, with no elements.
    */
   explicit vector(const allocator_type& alloc = allocator_type())
-      : _alloc(alloc),
+      : _allocator_base(alloc),
         _start(u_nullptr),
         _end(u_nullptr),
         _end_capacity(u_nullptr){};
@@ -110,11 +112,11 @@ class vector {
    */
   explicit vector(size_type n, const value_type& val = value_type(),
                   const allocator_type& alloc = allocator_type())
-      : _alloc(alloc) {
-    this->_start = this->_alloc.allocate(n);
+      : _allocator_base(alloc) {
+    this->_start = this->_alloc().allocate(n);
     this->_end = this->_start;
     this->_end_capacity = this->_start + n;
-    while (n--) this->_alloc.construct(this->_end++, val);
+    while (n--) this->_alloc().construct(this->_end++, val);
   };
 
   /**
@@ -128,12 +130,12 @@ class vector {
          const allocator_type& alloc = allocator_type(),
          typename ft::enable_if<
              !ft::is_integral< InputIterator >::value >::type* = u_nullptr)
-      : _alloc(alloc) {
+      : _allocator_base(alloc) {
     size_type n = ft::difference(first, last);
-    this->_start = this->_alloc.allocate(n);
+    this->_start = this->_alloc().allocate(n);
     this->_end_capacity = this->_start + n;
     this->_end = this->_start;
-    while (n--) this->_alloc.construct(this->_end++, *first++);
+    while (n--) this->_alloc().construct(this->_end++, *first++);
   };
 
   /**
@@ -141,14 +143,14 @@ class vector {
    * Constructs a container with a copy of each of the elements in x, in the
    * same order.
    */
-  vector(const vector& x) : _alloc(x._alloc) {
+  vector(const vector& x) : _allocator_base(x._alloc()) {
     size_type n = x.size();
-    this->_start = this->_alloc.allocate(n);
+    this->_start = this->_alloc().allocate(n);
     this->_end_capacity = this->_start + n;
     this->_end = this->_start;
 
     pointer other = x._start;
-    while (n--) this->_alloc.construct(this->_end++, *other++);
+    while (n--) this->_alloc().construct(this->_end++, *other++);
   };
 
   vector& operator=(const vector& x) {
@@ -165,7 +167,7 @@ class vector {
    */
   ~vector() {
     this->clear();
-    this->_alloc.deallocate(this->_start, this->capacity());
+    this->_alloc().deallocate(this->_start, this->capacity());
   };
 
   /**
@@ -231,7 +233,7 @@ class vector {
    * @brief Return maximum size
    * Returns the maximum number of elements that the vector can hold.
    */
-  size_type max_size() const { return (this->_alloc.max_size()); };
+  size_type max_size() const { return (this->_alloc().max_size()); };
 
   /**
    * @brief Change size
@@ -245,12 +247,12 @@ class vector {
    */
   void resize(size_type n, value_type val = value_type()) {
     if (n > this->max_size()) {
-      throw std::out_of_range("ft::vector");
+      throw std::length_error("ft::vector");
     }
     size_type prev_size = this->size();
     if (prev_size > n) {
       while (prev_size-- > n) {
-        this->_alloc.destroy(--this->_end);
+        this->_alloc().destroy(--this->_end);
       }
       return;
     }
@@ -278,7 +280,7 @@ class vector {
    */
   void reserve(size_type n) {
     if (n > this->max_size()) {
-      throw std::out_of_range("ft::vector");
+      throw std::length_error("ft::vector");
     }
 
     if (this->capacity() >= n) {
@@ -289,17 +291,27 @@ class vector {
     pointer prev_end = this->_end;
     size_type prev_capacity = this->capacity();
 
-    this->_start = this->_alloc.allocate(n);
-    this->_end_capacity = this->_start + n;
-    this->_end = this->_start;
-
-    for (pointer target = prev_start; target != prev_end; ++target) {
-      this->_alloc.construct(this->_end++, *target);
+    // copy first: if a copy throws, the vector is left as it was
+    pointer start = this->_alloc().allocate(n);
+    pointer end = start;
+    try {
+      for (pointer target = prev_start; target != prev_end; ++target) {
+        this->_alloc().construct(end, *target);
+        ++end;
+      }
+    } catch (...) {
+      while (end != start) this->_alloc().destroy(--end);
+      this->_alloc().deallocate(start, n);
+      throw;
     }
+    this->_start = start;
+    this->_end_capacity = start + n;
+    this->_end = end;
+
     for (size_type len = prev_end - prev_start; len > 0; --len) {
-      this->_alloc.destroy(--prev_end);
+      this->_alloc().destroy(--prev_end);
     }
-    this->_alloc.deallocate(prev_start, prev_capacity);
+    this->_alloc().deallocate(prev_start, prev_capacity);
   };
 
   /**
@@ -359,6 +371,20 @@ class vector {
    */
   const_reference back() const { return *(this->_end - 1); };
 
+  /**
+   * @brief Access data
+   * Returns a direct pointer to the memory array used internally by the vector
+   * to store its owned elements, valid until the next reallocation.
+   */
+  pointer data() { return this->_start; };
+
+  /**
+   * @brief Access data
+   * Returns a direct pointer to the memory array used internally by the vector
+   * to store its owned elements, valid until the next reallocation.
+   */
+  const_pointer data() const { return this->_start; };
+
   /**
    * @brief Assign vector content
    * Assigns new contents to the vector, replacing its current contents, and
@@ -374,14 +400,25 @@ class vector {
       typename ft::enable_if<
           !ft::is_integral< InputIterator >::value >::type* = u_nullptr) {
     size_type n = ft::difference(first, last);
-    if (this->capacity() < n) {
-      this->_start = this->_alloc.allocate(n);
-      this->_end_capacity = this->_start + n;
-      this->_end = this->_start;
-    } else {
+    if (this->capacity() >= n) {
       this->clear();
+      while (n--) this->_alloc().construct(this->_end++, *first++);
+      return;
+    }
+
+    pointer prev_start = this->_start;
+    pointer prev_end = this->_end;
+    size_type prev_capacity = this->capacity();
+
+    this->_start = this->_alloc().allocate(n);
+    this->_end_capacity = this->_start + n;
+    this->_end = this->_start;
+
+    while (n--) this->_alloc().construct(this->_end++, *first++);
+    for (size_type len = prev_end - prev_start; len > 0; --len) {
+      this->_alloc().destroy(--prev_end);
     }
-    while (n--) this->_alloc.construct(this->_end++, *first++);
+    this->_alloc().deallocate(prev_start, prev_capacity);
   };
 
   /**
@@ -393,15 +430,25 @@ class vector {
    * @param val Value to fill the container with
    */
   void assign(size_type n, const value_type& val) {
-    this->clear();
     if (this->capacity() >= n) {
-      while (n--) this->_alloc.construct(this->_end++, val);
-    } else {
-      this->_start = this->_alloc.allocate(n);
-      this->_end_capacity = this->_start + n;
-      this->_end = this->_start;
-      while (n--) this->_alloc.construct(this->_end++, val);
+      this->clear();
+      while (n--) this->_alloc().construct(this->_end++, val);
+      return;
     }
+
+    pointer prev_start = this->_start;
+    pointer prev_end = this->_end;
+    size_type prev_capacity = this->capacity();
+
+    this->_start = this->_alloc().allocate(n);
+    this->_end_capacity = this->_start + n;
+    this->_end = this->_start;
+
+    while (n--) this->_alloc().construct(this->_end++, val);
+    for (size_type len = prev_end - prev_start; len > 0; --len) {
+      this->_alloc().destroy(--prev_end);
+    }
+    this->_alloc().deallocate(prev_start, prev_capacity);
   };
 
   /**
@@ -415,7 +462,8 @@ class vector {
           (this->size() == 0) ? 1 : (this->_end_capacity - this->_start) * 2;
       this->reserve(capacity);
     }
-    this->_alloc.construct(this->_end++, val);
+    this->_alloc().construct(this->_end, val);
+    ++this->_end;
   };
 
   /**
@@ -423,7 +471,7 @@ class vector {
    * Removes the last element in the vector, effectively reducing the container
    * size by one.
    */
-  void pop_back() { this->_alloc.destroy(--this->_end); };
+  void pop_back() { this->_alloc().destroy(--this->_end); };
 
   /**
    * @brief Insert elements
@@ -450,13 +498,14 @@ class vector {
     size_type pos_at = &(*position) - this->_start;
 
     if (this->capacity() >= this->size() + n) {
-      for (size_type i = 0; i < this->size() - pos_at; ++i) {
-        this->_alloc.construct(this->_end + n - i, *(this->_end - i));
-        this->_alloc.destroy(this->_end - i);
+      // move [position, end) up by n, last element first
+      for (size_type i = 1; i <= this->size() - pos_at; ++i) {
+        this->_alloc().construct(this->_end + n - i, *(this->_end - i));
+        this->_alloc().destroy(this->_end - i);
       }
       this->_end = this->_start + this->size() + n;
       for (size_type i = 0; i < n; ++i) {
-        this->_alloc.construct(this->_start + pos_at + i, val);
+        this->_alloc().construct(this->_start + pos_at + i, val);
       }
       return;
     }
@@ -468,25 +517,25 @@ class vector {
     size_type prev_size = this->size();
     size_type prev_capacity = this->capacity();
 
-    this->_start = this->_alloc.allocate(next_capacity);
+    this->_start = this->_alloc().allocate(next_capacity);
     this->_end = this->_start + prev_size + n;
     this->_end_capacity = this->_end;
 
     for (size_type i = 0; i < pos_at; ++i) {
-      this->_alloc.construct(this->_start + i, *(prev_start + i));
-      this->_alloc.destroy(prev_start + i);
+      this->_alloc().construct(this->_start + i, *(prev_start + i));
+      this->_alloc().destroy(prev_start + i);
     }
 
     for (size_type i = 0; i < prev_size - pos_at; ++i) {
-      this->_alloc.construct(this->_end - i - 1, *(prev_end - i - 1));
-      this->_alloc.destroy(prev_end - i - 1);
+      this->_alloc().construct(this->_end - i - 1, *(prev_end - i - 1));
+      this->_alloc().destroy(prev_end - i - 1);
     }
 
     for (size_type i = 0; i < n; ++i) {
-      this->_alloc.construct(this->_start + pos_at + i, val);
+      this->_alloc().construct(this->_start + pos_at + i, val);
     }
 
-    this->_alloc.deallocate(prev_start, prev_capacity);
+    this->_alloc().deallocate(prev_start, prev_capacity);
     return;
   };
 
@@ -507,13 +556,14 @@ class vector {
     size_type n = ft::difference(first, last);
 
     if (this->capacity() >= this->size() + n) {
-      for (size_type i = 0; i < this->size() - pos_at; ++i) {
-        this->_alloc.construct(this->_end + n - i, *(this->_end - i));
-        this->_alloc.destroy(this->_end - i);
+      // move [position, end) up by n, last element first
+      for (size_type i = 1; i <= this->size() - pos_at; ++i) {
+        this->_alloc().construct(this->_end + n - i, *(this->_end - i));
+        this->_alloc().destroy(this->_end - i);
       }
       this->_end = this->_start + this->size() + n;
       for (size_type i = 0; i < n; ++i) {
-        this->_alloc.construct(this->_start + pos_at + i, *first++);
+        this->_alloc().construct(this->_start + pos_at + i, *first++);
       }
       return;
     }
@@ -525,24 +575,24 @@ class vector {
     size_type prev_size = this->size();
     size_type prev_capacity = this->capacity();
 
-    this->_start = this->_alloc.allocate(next_capacity);
+    this->_start = this->_alloc().allocate(next_capacity);
     this->_end = this->_start + prev_size + n;
     this->_end_capacity = this->_end;
 
     for (size_type i = 0; i < pos_at; ++i) {
-      this->_alloc.construct(this->_start + i, *(prev_start + i));
-      this->_alloc.destroy(prev_start + i);
+      this->_alloc().construct(this->_start + i, *(prev_start + i));
+      this->_alloc().destroy(prev_start + i);
     }
 
     for (size_type i = 0; i < prev_size - pos_at; ++i) {
-      this->_alloc.construct(this->_end - i - 1, *(prev_end - i - 1));
-      this->_alloc.destroy(prev_end - i - 1);
+      this->_alloc().construct(this->_end - i - 1, *(prev_end - i - 1));
+      this->_alloc().destroy(prev_end - i - 1);
     }
 
     for (size_type i = 0; i < n; ++i) {
-      this->_alloc.construct(this->_start + pos_at + i, *first++);
+      this->_alloc().construct(this->_start + pos_at + i, *first++);
     }
-    this->_alloc.deallocate(prev_start, prev_capacity);
+    this->_alloc().deallocate(prev_start, prev_capacity);
     return;
   }
 
@@ -554,11 +604,12 @@ class vector {
    */
   iterator erase(iterator position) {
     size_type pos_at = &(*position) - this->_start;
-    this->_alloc.destroy(&(*position));
-    for (size_type i = 0; i < this->size() - pos_at; ++i) {
-      this->_alloc.construct(this->_start + pos_at + i,
+    this->_alloc().destroy(&(*position));
+    // move (position, end) down by one
+    for (size_type i = 0; i + 1 < this->size() - pos_at; ++i) {
+      this->_alloc().construct(this->_start + pos_at + i,
                              *(this->_start + pos_at + i + 1));
-      this->_alloc.destroy(this->_start + pos_at + i + 1);
+      this->_alloc().destroy(this->_start + pos_at + i + 1);
     }
     --this->_end;
     return this->_start + pos_at;
@@ -574,12 +625,13 @@ class vector {
     size_type pos_at = &(*first) - this->_start;
     size_type n = last - first;
     for (size_type i = 0; i < n; ++i) {
-      this->_alloc.destroy(&(*(first + i)));
+      this->_alloc().destroy(&(*(first + i)));
     }
-    for (size_type i = 0; i < this->size() - pos_at; ++i) {
-      this->_alloc.construct(this->_start + pos_at + i,
+    // move [last, end) down by n
+    for (size_type i = 0; i + n < this->size() - pos_at; ++i) {
+      this->_alloc().construct(this->_start + pos_at + i,
                              *(this->_start + pos_at + i + n));
-      this->_alloc.destroy(this->_start + pos_at + i + n);
+      this->_alloc().destroy(this->_start + pos_at + i + n);
     }
     this->_end = this->_start + this->size() - n;
     return this->_start + pos_at;
@@ -613,7 +665,7 @@ class vector {
    */
   void clear() {
     while (this->_start != this->_end) {
-      this->_alloc.destroy(--this->_end);
+      this->_alloc().destroy(--this->_end);
     }
   };
 
@@ -622,7 +674,7 @@ class vector {
    *
    * @return allocator_type
    */
-  allocator_type get_allocator() const { return this->_alloc; };
+  allocator_type get_allocator() const { return this->_alloc(); };
 };
 
 /**
@@ -734,4 +786,6 @@ void swap(vector< T, Alloc >& x, vector< T, Alloc >& y) {
 
 };  // namespace ft
 
+#include "vector_bool.hpp"
+
 #endif  // FT__VERCTOR_HPP
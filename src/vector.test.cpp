@@ -60,4 +60,14 @@ void test_vector(void) {
 
   ft_default.reserve(100);
   assert(ft_default.capacity() == 100);
+
+  // assign past the capacity releases the old elements and storage
+  ft::vector< std::string > ft_strings(2, std::string(40, 'a'));
+  ft_strings.assign(8, std::string(40, 'b'));
+  assert(ft_strings.size() == 8 && ft_strings[7] == std::string(40, 'b'));
+  std::vector< std::string > std_strings(16, std::string(40, 'c'));
+  ft_strings.assign(std_strings.begin(), std_strings.end());
+  assert(ft_strings.size() == 16 && ft_strings[15] == std_strings[15]);
+  ft_strings.assign(4, std::string(40, 'd'));
+  assert(ft_strings.size() == 4 && ft_strings.capacity() == 16);
 }
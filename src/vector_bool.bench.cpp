@@ -0,0 +1,126 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/14
+ * @file src/vector_bool.bench.cpp
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "bench.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const std::size_t g_bits = 1 << 24;
+const int g_passes = 8;
+
+}  // namespace
+
+void bench_vector_bool(void) {
+  std::cout << "Bench: vector_bool" << std::endl;
+
+  ft::vector< bool > packed;
+  ft::vector< bool > mask;
+  std::vector< bool > reference;
+  std::vector< bool > reference_mask;
+  /* the one byte per flag layout vector<bool> had before */
+  ft::vector< unsigned char > bytes;
+  std::srand(42);
+  double start = bench_now();
+  for (std::size_t i = 0; i < g_bits; ++i) packed.push_back(std::rand() & 1);
+  bench_report("ft::vector<bool> push_back", bench_now() - start, g_bits);
+  std::srand(42);
+  start = bench_now();
+  for (std::size_t i = 0; i < g_bits; ++i) {
+    reference.push_back(std::rand() & 1);
+  }
+  bench_report("std::vector<bool> push_back", bench_now() - start, g_bits);
+  for (std::size_t i = 0; i < g_bits; ++i) {
+    bytes.push_back(packed[i]);
+    mask.push_back(i % 3 == 0);
+    reference_mask.push_back(i % 3 == 0);
+  }
+
+  std::cout << "\t ft::vector<bool> bytes: " << packed.capacity() / 8
+            << ", std::vector<bool> bytes: " << reference.capacity() / 8
+            << ", ft::vector<unsigned char> bytes: " << bytes.capacity()
+            << std::endl;
+
+  std::size_t sum = 0;
+  start = bench_now();
+  for (int pass = 0; pass < g_passes; ++pass) sum += packed.count();
+  bench_report("ft::vector<bool> count", bench_now() - start,
+               g_bits * g_passes);
+
+  start = bench_now();
+  for (int pass = 0; pass < g_passes; ++pass) {
+    sum += std::count(reference.begin(), reference.end(), true);
+  }
+  bench_report("std::vector<bool> count", bench_now() - start,
+               g_bits * g_passes);
+
+  start = bench_now();
+  for (int pass = 0; pass < g_passes; ++pass) {
+    for (std::size_t i = 0; i < g_bits; ++i) sum += bytes[i];
+  }
+  bench_report("ft::vector<unsigned char> count", bench_now() - start,
+               g_bits * g_passes);
+
+  // walk the set bits of a sparse vector
+  ft::vector< bool > sparse(g_bits);
+  std::vector< bool > reference_sparse(g_bits);
+  for (std::size_t i = 0; i < g_bits; i += 1000) {
+    sparse[i] = true;
+    reference_sparse[i] = true;
+  }
+  start = bench_now();
+  for (std::size_t i = sparse.find_first(); i != sparse.size();
+       i = sparse.find_next(i)) {
+    sum += i;
+  }
+  bench_report("ft::vector<bool> find_next (sparse)", bench_now() - start,
+               g_bits);
+
+  start = bench_now();
+  for (std::size_t i = 0; i < g_bits; ++i) {
+    if (reference_sparse[i]) sum += i;
+  }
+  bench_report("std::vector<bool> scan (sparse)", bench_now() - start, g_bits);
+
+  start = bench_now();
+  for (int pass = 0; pass < g_passes; ++pass) {
+    packed &= mask;
+    packed |= mask;
+    packed ^= mask;
+  }
+  bench_report("ft::vector<bool> and/or/xor", bench_now() - start,
+               g_bits * g_passes * 3);
+
+  start = bench_now();
+  for (int pass = 0; pass < g_passes; ++pass) {
+    for (std::size_t i = 0; i < g_bits; ++i) {
+      reference[i] = reference[i] && reference_mask[i];
+    }
+    for (std::size_t i = 0; i < g_bits; ++i) {
+      reference[i] = reference[i] || reference_mask[i];
+    }
+    for (std::size_t i = 0; i < g_bits; ++i) {
+      reference[i] = reference[i] != reference_mask[i];
+    }
+  }
+  bench_report("std::vector<bool> and/or/xor", bench_now() - start,
+               g_bits * g_passes * 3);
+  sum += packed.count() + std::count(reference.begin(), reference.end(), true);
+
+  bench_sink(sum);
+}
@@ -0,0 +1,663 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/14
+ * @file src/vector_bool.hpp
+ */
+
+#if !defined(FT__VECTOR_BOOL_HPP)
+#define FT__VECTOR_BOOL_HPP
+
+#include <climits>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+#include "algorithm.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+/* storage unit of vector<bool> */
+typedef unsigned long bit_word;
+
+/* number of bits in a bit_word */
+static const std::size_t bit_word_size = sizeof(bit_word) * CHAR_BIT;
+
+/**
+ * @brief Proxy for one bit of a vector<bool>, standing in for `bool&`.
+ */
+class bit_reference {
+  bit_word* _word;
+  bit_word _mask;
+
+ public:
+  bit_reference(bit_word* word, std::size_t bit)
+      : _word(word), _mask(bit_word(1) << bit){};
+
+  operator bool() const { return (*this->_word & this->_mask) != 0; };
+
+  bit_reference& operator=(bool x) {
+    if (x) {
+      *this->_word |= this->_mask;
+    } else {
+      *this->_word &= ~this->_mask;
+    }
+    return *this;
+  };
+
+  bit_reference& operator=(const bit_reference& x) {
+    return *this = static_cast< bool >(x);
+  };
+
+  bool operator~() const { return !static_cast< bool >(*this); };
+
+  void flip() { *this->_word ^= this->_mask; };
+};
+
+/**
+ * @brief Random access iterator over the bits of a vector<bool>: a word
+ * pointer and a bit offset in that word.
+ *
+ * @tparam W bit_word, const qualified for const_iterator
+ * @tparam R bit_reference, or bool for const_iterator
+ */
+template < class W, class R >
+class bit_iterator : public ft::iterator< ft::random_access_iterator_tag, bool,
+                                          std::ptrdiff_t, void, R > {
+ public:
+  typedef ft::random_access_iterator_tag iterator_category;
+  typedef bool value_type;
+  typedef std::ptrdiff_t difference_type;
+  /* no addressable bool behind a bit */
+  typedef void pointer;
+  typedef R reference;
+
+ protected:
+  W* _word;
+  std::size_t _bit;
+
+ public:
+  bit_iterator() : _word(ft::u_nullptr), _bit(0){};
+
+  bit_iterator(W* word, std::size_t bit) : _word(word), _bit(bit){};
+
+  bit_iterator(const bit_iterator& other)
+      : _word(other._word), _bit(other._bit){};
+
+  /**
+   * @brief const_iterator casting operator
+   */
+  operator bit_iterator< const W, bool >() const {
+    return bit_iterator< const W, bool >(this->_word, this->_bit);
+  }
+
+  bit_iterator& operator=(const bit_iterator& other) {
+    this->_word = other._word;
+    this->_bit = other._bit;
+    return *this;
+  };
+
+  reference operator*() const {
+    return bit_reference(const_cast< bit_word* >(this->_word), this->_bit);
+  };
+
+  bit_iterator& operator++() {
+    if (++this->_bit == bit_word_size) {
+      this->_bit = 0;
+      ++this->_word;
+    }
+    return *this;
+  };
+
+  bit_iterator operator++(int) {
+    bit_iterator tmp = *this;
+    ++(*this);
+    return tmp;
+  };
+
+  bit_iterator& operator--() {
+    if (this->_bit-- == 0) {
+      this->_bit = bit_word_size - 1;
+      --this->_word;
+    }
+    return *this;
+  };
+
+  bit_iterator operator--(int) {
+    bit_iterator tmp = *this;
+    --(*this);
+    return tmp;
+  };
+
+  bit_iterator& operator+=(difference_type n) {
+    difference_type at = static_cast< difference_type >(this->_bit) + n;
+    difference_type words = at / static_cast< difference_type >(bit_word_size);
+    at %= static_cast< difference_type >(bit_word_size);
+    if (at < 0) {
+      at += static_cast< difference_type >(bit_word_size);
+      --words;
+    }
+    this->_word += words;
+    this->_bit = static_cast< std::size_t >(at);
+    return *this;
+  };
+
+  bit_iterator operator+(difference_type n) const {
+    bit_iterator tmp = *this;
+    return tmp += n;
+  };
+
+  bit_iterator& operator-=(difference_type n) { return *this += -n; };
+
+  bit_iterator operator-(difference_type n) const {
+    bit_iterator tmp = *this;
+    return tmp += -n;
+  };
+
+  reference operator[](difference_type n) const { return *(*this + n); };
+
+  /**
+   * @brief get the word pointer, used for comparisons
+   */
+  W* const& base() const { return this->_word; }
+
+  /**
+   * @brief get the bit offset inside base()
+   */
+  std::size_t offset() const { return this->_bit; }
+};
+
+template < class W1, class R1, class W2, class R2 >
+typename bit_iterator< W1, R1 >::difference_type operator-(
+    const bit_iterator< W1, R1 >& lhs, const bit_iterator< W2, R2 >& rhs) {
+  return (lhs.base() - rhs.base()) *
+             static_cast< std::ptrdiff_t >(bit_word_size) +
+         static_cast< std::ptrdiff_t >(lhs.offset()) -
+         static_cast< std::ptrdiff_t >(rhs.offset());
+};
+
+template < class W1, class R1, class W2, class R2 >
+bool operator==(const bit_iterator< W1, R1 >& lhs,
+                const bit_iterator< W2, R2 >& rhs) {
+  return lhs.base() == rhs.base() && lhs.offset() == rhs.offset();
+};
+
+template < class W1, class R1, class W2, class R2 >
+bool operator!=(const bit_iterator< W1, R1 >& lhs,
+                const bit_iterator< W2, R2 >& rhs) {
+  return !(lhs == rhs);
+};
+
+template < class W1, class R1, class W2, class R2 >
+bool operator<(const bit_iterator< W1, R1 >& lhs,
+               const bit_iterator< W2, R2 >& rhs) {
+  return lhs - rhs < 0;
+};
+
+template < class W1, class R1, class W2, class R2 >
+bool operator<=(const bit_iterator< W1, R1 >& lhs,
+                const bit_iterator< W2, R2 >& rhs) {
+  return lhs - rhs <= 0;
+};
+
+template < class W1, class R1, class W2, class R2 >
+bool operator>(const bit_iterator< W1, R1 >& lhs,
+               const bit_iterator< W2, R2 >& rhs) {
+  return lhs - rhs > 0;
+};
+
+template < class W1, class R1, class W2, class R2 >
+bool operator>=(const bit_iterator< W1, R1 >& lhs,
+                const bit_iterator< W2, R2 >& rhs) {
+  return lhs - rhs >= 0;
+};
+
+template < class W, class R >
+bit_iterator< W, R > operator+(typename bit_iterator< W, R >::difference_type n,
+                               const bit_iterator< W, R >& iter) {
+  return iter + n;
+};
+
+/**
+ * @brief vector of bool packed one bit per element in bit_words.
+ *
+ * Elements are reached through the bit_reference proxy, so `&v[0]` is not a
+ * `bool*`. Bits past size() are kept zero, which lets count(), the find
+ * functions and the bulk logical operators work a whole word at a time.
+ *
+ * @tparam _Alloc Allocator of bool, rebound to bit_word for the storage.
+ */
+template < class _Alloc >
+class vector< bool, _Alloc >
+    : private ft::allocator_holder<
+          typename _Alloc::template rebind< bit_word >::other > {
+  typedef typename _Alloc::template rebind< bit_word >::other _word_allocator;
+  typedef ft::allocator_holder< _word_allocator > _allocator_base;
+
+ public:
+  typedef bool value_type;
+  typedef _Alloc allocator_type;
+  /* proxy to a single bit */
+  typedef ft::bit_reference reference;
+  typedef bool const_reference;
+  typedef ft::bit_iterator< bit_word, bit_reference > iterator;
+  typedef ft::bit_iterator< const bit_word, bool > const_iterator;
+  typedef ft::reverse_iterator< iterator > reverse_iterator;
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+  typedef std::ptrdiff_t difference_type;
+  typedef std::size_t size_type;
+
+ private:
+  bit_word* _words;
+  size_type _size;
+  /* in bits, always a multiple of bit_word_size */
+  size_type _capacity;
+
+ public:
+  explicit vector(const allocator_type& alloc = allocator_type())
+      : _allocator_base(_word_allocator(alloc)),
+        _words(u_nullptr),
+        _size(0),
+        _capacity(0){};
+
+  explicit vector(size_type n, const value_type& val = value_type(),
+                  const allocator_type& alloc = allocator_type())
+      : _allocator_base(_word_allocator(alloc)),
+        _words(u_nullptr),
+        _size(0),
+        _capacity(0) {
+    this->assign(n, val);
+  };
+
+  template < class InputIterator >
+  vector(InputIterator first, InputIterator last,
+         const allocator_type& alloc = allocator_type(),
+         typename ft::enable_if<
+             !ft::is_integral< InputIterator >::value >::type* = u_nullptr)
+      : _allocator_base(_word_allocator(alloc)),
+        _words(u_nullptr),
+        _size(0),
+        _capacity(0) {
+    this->assign(first, last);
+  };
+
+  vector(const vector& x)
+      : _allocator_base(x._alloc()), _words(u_nullptr), _size(0), _capacity(0) {
+    *this = x;
+  };
+
+  vector& operator=(const vector& x) {
+    if (this != &x) {
+      this->clear();
+      this->reserve(x._size);
+      size_type words = _words_for(x._size);
+      for (size_type i = 0; i < words; ++i) this->_words[i] = x._words[i];
+      this->_size = x._size;
+    }
+    return *this;
+  };
+
+  ~vector() {
+    if (this->_words) {
+      this->_alloc().deallocate(this->_words, this->_capacity / bit_word_size);
+    }
+  };
+
+  iterator begin() { return iterator(this->_words, 0); };
+  const_iterator begin() const { return const_iterator(this->_words, 0); };
+  iterator end() {
+    return iterator(this->_words + this->_size / bit_word_size,
+                    this->_size % bit_word_size);
+  };
+  const_iterator end() const {
+    return const_iterator(this->_words + this->_size / bit_word_size,
+                          this->_size % bit_word_size);
+  };
+  reverse_iterator rbegin() { return reverse_iterator(this->end()); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(this->end());
+  };
+  reverse_iterator rend() { return reverse_iterator(this->begin()); };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(this->begin());
+  };
+
+  size_type size() const { return this->_size; };
+  size_type capacity() const { return this->_capacity; };
+  bool empty() const { return this->_size == 0; };
+
+  size_type max_size() const {
+    size_type words = this->_alloc().max_size();
+    size_type limit = static_cast< size_type >(-1) / bit_word_size;
+    return (words < limit ? words : limit) * bit_word_size;
+  };
+
+  void resize(size_type n, value_type val = value_type()) {
+    if (n > this->max_size()) throw std::out_of_range("ft::vector");
+    if (n < this->_size) {
+      this->_truncate(n);
+    } else {
+      this->insert(this->end(), n - this->_size, val);
+    }
+  };
+
+  void reserve(size_type n) {
+    if (n > this->max_size()) throw std::out_of_range("ft::vector");
+    if (n > this->_capacity) this->_reallocate(_words_for(n));
+  };
+
+  reference operator[](size_type n) {
+    return reference(this->_words + n / bit_word_size, n % bit_word_size);
+  };
+  const_reference operator[](size_type n) const {
+    return (this->_words[n / bit_word_size] >> (n % bit_word_size)) & 1;
+  };
+
+  reference at(size_type n) {
+    if (n >= this->_size) throw std::out_of_range("ft::vector");
+    return (*this)[n];
+  };
+  const_reference at(size_type n) const {
+    if (n >= this->_size) throw std::out_of_range("ft::vector");
+    return (*this)[n];
+  };
+
+  reference front() { return (*this)[0]; };
+  const_reference front() const { return (*this)[0]; };
+  reference back() { return (*this)[this->_size - 1]; };
+  const_reference back() const { return (*this)[this->_size - 1]; };
+
+  template < class InputIterator >
+  void assign(
+      InputIterator first, InputIterator last,
+      typename ft::enable_if<
+          !ft::is_integral< InputIterator >::value >::type* = u_nullptr) {
+    this->clear();
+    for (; first != last; ++first) this->push_back(*first);
+  };
+
+  void assign(size_type n, const value_type& val) {
+    this->clear();
+    this->reserve(n);
+    if (val) {
+      size_type words = _words_for(n);
+      for (size_type i = 0; i < words; ++i) this->_words[i] = ~bit_word(0);
+    }
+    this->_size = n;
+    this->_clear_tail();
+  };
+
+  void push_back(const value_type& val) {
+    if (this->_size == this->_capacity) this->_grow(1);
+    if (val) (*this)[this->_size] = true;
+    ++this->_size;
+  };
+
+  void pop_back() {
+    --this->_size;
+    (*this)[this->_size] = false;
+  };
+
+  iterator insert(iterator position, const value_type& val) {
+    size_type at = position - this->begin();
+    this->insert(position, 1, val);
+    return this->begin() + at;
+  };
+
+  void insert(iterator position, size_type n, const value_type& val) {
+    size_type at = this->_open(position - this->begin(), n);
+    for (size_type i = 0; i < n; ++i) (*this)[at + i] = val;
+  };
+
+  template < class InputIterator >
+  void insert(
+      iterator position, InputIterator first, InputIterator last,
+      typename ft::enable_if<
+          !ft::is_integral< InputIterator >::value >::type* = u_nullptr) {
+    size_type n = ft::difference(first, last);
+    size_type at = this->_open(position - this->begin(), n);
+    for (size_type i = 0; i < n; ++i, ++first) (*this)[at + i] = *first;
+  };
+
+  iterator erase(iterator position) {
+    return this->erase(position, position + 1);
+  };
+
+  iterator erase(iterator first, iterator last) {
+    size_type at = first - this->begin();
+    size_type n = last - first;
+    for (size_type i = at; i + n < this->_size; ++i) {
+      (*this)[i] = static_cast< const vector& >(*this)[i + n];
+    }
+    this->_truncate(this->_size - n);
+    return this->begin() + at;
+  };
+
+  void swap(vector& x) {
+    bit_word* words = x._words;
+    size_type size = x._size;
+    size_type capacity = x._capacity;
+    x._words = this->_words;
+    x._size = this->_size;
+    x._capacity = this->_capacity;
+    this->_words = words;
+    this->_size = size;
+    this->_capacity = capacity;
+  };
+
+  /**
+   * @brief Exchange two bits, as with std::vector<bool>::swap.
+   */
+  static void swap(reference x, reference y) {
+    bool tmp = x;
+    x = y;
+    y = tmp;
+  };
+
+  void clear() { this->_truncate(0); };
+
+  /**
+   * @brief Invert every bit.
+   */
+  void flip() {
+    size_type words = _words_for(this->_size);
+    for (size_type i = 0; i < words; ++i) this->_words[i] = ~this->_words[i];
+    this->_clear_tail();
+  };
+
+  /**
+   * @brief Number of set bits, one popcount per word.
+   */
+  size_type count() const {
+    size_type words = _words_for(this->_size);
+    size_type n = 0;
+    for (size_type i = 0; i < words; ++i) {
+      n += __builtin_popcountl(this->_words[i]);
+    }
+    return n;
+  };
+
+  /**
+   * @brief Index of the first set bit, or size() if there is none.
+   */
+  size_type find_first() const { return this->_find(0, 0); };
+
+  /**
+   * @brief Index of the first set bit after pos, or size() if there is none.
+   */
+  size_type find_next(size_type pos) const {
+    return this->_find(pos + 1, 0);
+  };
+
+  /**
+   * @brief Index of the first unset bit, or size() if there is none.
+   */
+  size_type find_first_unset() const { return this->_find(0, ~bit_word(0)); };
+
+  /**
+   * @brief Index of the first unset bit after pos, or size() if there is
+   * none.
+   */
+  size_type find_next_unset(size_type pos) const {
+    return this->_find(pos + 1, ~bit_word(0));
+  };
+
+  /**
+   * @brief Element-wise and with a vector of the same size.
+   */
+  vector& operator&=(const vector& x) {
+    this->_check_size(x);
+    size_type words = _words_for(this->_size);
+    for (size_type i = 0; i < words; ++i) this->_words[i] &= x._words[i];
+    return *this;
+  };
+
+  /**
+   * @brief Element-wise or with a vector of the same size.
+   */
+  vector& operator|=(const vector& x) {
+    this->_check_size(x);
+    size_type words = _words_for(this->_size);
+    for (size_type i = 0; i < words; ++i) this->_words[i] |= x._words[i];
+    return *this;
+  };
+
+  /**
+   * @brief Element-wise xor with a vector of the same size.
+   */
+  vector& operator^=(const vector& x) {
+    this->_check_size(x);
+    size_type words = _words_for(this->_size);
+    for (size_type i = 0; i < words; ++i) this->_words[i] ^= x._words[i];
+    return *this;
+  };
+
+  /**
+   * @brief Clear every bit that is set in x, a vector of the same size.
+   */
+  vector& and_not(const vector& x) {
+    this->_check_size(x);
+    size_type words = _words_for(this->_size);
+    for (size_type i = 0; i < words; ++i) this->_words[i] &= ~x._words[i];
+    return *this;
+  };
+
+  allocator_type get_allocator() const {
+    return allocator_type(this->_alloc());
+  };
+
+  /**
+   * @brief Compare whole words; bits past size() are zero on both sides.
+   */
+  friend bool operator==(const vector& lhs, const vector& rhs) {
+    if (lhs._size != rhs._size) return false;
+    size_type words = _words_for(lhs._size);
+    for (size_type i = 0; i < words; ++i) {
+      if (lhs._words[i] != rhs._words[i]) return false;
+    }
+    return true;
+  };
+
+ private:
+  static size_type _words_for(size_type bits) {
+    return (bits + bit_word_size - 1) / bit_word_size;
+  };
+
+  void _check_size(const vector& x) const {
+    if (x._size != this->_size) throw std::invalid_argument("ft::vector");
+  };
+
+  /**
+   * @brief Zero the bits of the last word past size().
+   */
+  void _clear_tail() {
+    size_type bit = this->_size % bit_word_size;
+    if (bit) {
+      this->_words[this->_size / bit_word_size] &= (bit_word(1) << bit) - 1;
+    }
+  };
+
+  /**
+   * @brief Shrink to n bits, zeroing the ones dropped.
+   */
+  void _truncate(size_type n) {
+    size_type words = _words_for(this->_size);
+    for (size_type i = _words_for(n); i < words; ++i) this->_words[i] = 0;
+    this->_size = n;
+    this->_clear_tail();
+  };
+
+  /**
+   * @brief Move the bits into a new block of exactly `words` words, zeroing
+   * the new ones.
+   */
+  void _reallocate(size_type words) {
+    bit_word* next = this->_alloc().allocate(words);
+    size_type used = _words_for(this->_size);
+    for (size_type i = 0; i < used; ++i) next[i] = this->_words[i];
+    for (size_type i = used; i < words; ++i) next[i] = 0;
+    if (this->_words) {
+      this->_alloc().deallocate(this->_words, this->_capacity / bit_word_size);
+    }
+    this->_words = next;
+    this->_capacity = words * bit_word_size;
+  };
+
+  /**
+   * @brief Make room for n more bits, doubling the word count.
+   */
+  void _grow(size_type n) {
+    if (n > this->max_size() - this->_size) {
+      throw std::out_of_range("ft::vector");
+    }
+    size_type words = this->_capacity / bit_word_size;
+    size_type need = _words_for(this->_size + n);
+    this->_reallocate(need > words * 2 ? need : words * 2);
+  };
+
+  /**
+   * @brief Shift [at, size) up by n bits and grow size by n, returning at.
+   * The bits in [at, at + n) are left as they were.
+   */
+  size_type _open(size_type at, size_type n) {
+    if (n > this->_capacity - this->_size) this->_grow(n);
+    size_type i = this->_size;
+    this->_size += n;
+    while (i-- > at) {
+      (*this)[i + n] = static_cast< const vector& >(*this)[i];
+    }
+    return at;
+  };
+
+  /**
+   * @brief First index >= from whose bit, xor-ed with invert, is set.
+   */
+  size_type _find(size_type from, bit_word invert) const {
+    if (from >= this->_size) return this->_size;
+    size_type words = _words_for(this->_size);
+    size_type i = from / bit_word_size;
+    bit_word word = (this->_words[i] ^ invert) &
+                    (~bit_word(0) << (from % bit_word_size));
+    while (!word) {
+      if (++i == words) return this->_size;
+      word = this->_words[i] ^ invert;
+    }
+    size_type found = i * bit_word_size + __builtin_ctzl(word);
+    // unset lookups see the zero tail as set bits
+    return found < this->_size ? found : this->_size;
+  };
+};
+
+}  // namespace ft
+
+#endif  // FT__VECTOR_BOOL_HPP
@@ -0,0 +1,195 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/14
+ * @file src/vector_bool.test.cpp
+ */
+
+#include "vector_bool.hpp"
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "vector.hpp"
+
+typedef ft::vector< bool > ft_bits;
+
+namespace {
+
+bool vb_test_same(const ft_bits& v, const std::vector< bool >& expect) {
+  if (v.size() != expect.size()) return false;
+  for (std::size_t i = 0; i < expect.size(); ++i) {
+    if (v[i] != expect[i]) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+void test_vector_bool_basic(void) {
+  std::cout << "\t basic" << std::endl;
+
+  ft_bits v;
+  assert(v.empty() && v.begin() == v.end());
+  for (int i = 0; i < 200; ++i) v.push_back(i % 3 == 0);
+  assert(v.size() == 200 && v.capacity() >= 200);
+  // one bit per element
+  assert(v.capacity() < 200 + ft::bit_word_size * 2);
+  assert(v[0] && !v[1] && v[3] && v.at(198) && !v.back());
+  try {
+    v.at(200);
+    assert(false);
+  } catch (const std::out_of_range& e) {
+  }
+
+  // proxies
+  v[1] = true;
+  assert(v[1]);
+  v[1] = v[2];
+  assert(!v[1]);
+  v[2].flip();
+  assert(v[2] && ~v[4]);
+  ft_bits::swap(v[0], v[1]);
+  assert(!v[0] && v[1]);
+
+  // iterators cross word boundaries both ways
+  std::size_t n = 0;
+  for (ft_bits::const_iterator it = v.begin(); it != v.end(); ++it) {
+    assert(*it == v[n++]);
+  }
+  ft_bits::iterator it = v.begin() + 130;
+  assert(it - v.begin() == 130 && *it == v[130]);
+  it -= 67;
+  assert(it - v.begin() == 63 && v.end() - it == 137);
+  assert(it[1] == v[64] && v.begin() < it && it <= v.end());
+  ft_bits::reverse_iterator rit = v.rbegin();
+  assert(*rit == v[199] && rit[199] == v[0]);
+
+  ft_bits fill(100, true);
+  assert(fill.size() == 100 && fill.count() == 100);
+  fill.resize(150);
+  assert(fill.count() == 100 && !fill[149]);
+  fill.resize(160, true);
+  assert(fill.count() == 110 && fill[159]);
+  fill.resize(10);
+  assert(fill.count() == 10);
+  fill.clear();
+  assert(fill.empty() && fill.count() == 0);
+}
+
+void test_vector_bool_modifiers(void) {
+  std::cout << "\t modifiers" << std::endl;
+
+  ft_bits v;
+  std::vector< bool > expect;
+  std::srand(7);
+  for (int step = 0; step < 2000; ++step) {
+    bool bit = std::rand() % 2;
+    std::size_t at = expect.empty() ? 0 : std::rand() % expect.size();
+    switch (std::rand() % 5) {
+      case 0:
+        v.insert(v.begin() + at, bit);
+        expect.insert(expect.begin() + at, bit);
+        break;
+      case 1: {
+        std::size_t n = std::rand() % 70;
+        v.insert(v.begin() + at, n, bit);
+        expect.insert(expect.begin() + at, n, bit);
+        break;
+      }
+      case 2:
+        if (!expect.empty()) {
+          v.erase(v.begin() + at);
+          expect.erase(expect.begin() + at);
+        }
+        break;
+      case 3: {
+        std::size_t n = std::rand() % (expect.size() - at + 1);
+        v.erase(v.begin() + at, v.begin() + at + n);
+        expect.erase(expect.begin() + at, expect.begin() + at + n);
+        break;
+      }
+      default:
+        v.push_back(bit);
+        expect.push_back(bit);
+    }
+  }
+  assert(vb_test_same(v, expect));
+
+  ft_bits copy(v);
+  assert(copy == v && !(copy != v) && !(copy < v) && copy >= v);
+  copy.flip();
+  assert(copy != v && copy.count() == v.size() - v.count());
+  copy = v;
+  assert(copy == v);
+  copy.pop_back();
+  assert(copy < v);
+
+  bool source[] = {true, false, true, true};
+  ft_bits range(source, source + 4);
+  range.insert(range.begin() + 1, source, source + 4);
+  assert(range.size() == 8 && range.count() == 6 && !range[2] && !range[5]);
+  range.assign(70, true);
+  assert(range.size() == 70 && range.count() == 70);
+  ft::swap(range, copy);
+  assert(copy.size() == 70 && range.size() + 1 == v.size());
+}
+
+void test_vector_bool_kernels(void) {
+  std::cout << "\t word kernels" << std::endl;
+
+  ft_bits v(300);
+  assert(v.find_first() == 300 && v.find_first_unset() == 0);
+  v[5] = v[64] = v[200] = v[299] = true;
+  assert(v.count() == 4);
+  assert(v.find_first() == 5 && v.find_next(5) == 64);
+  assert(v.find_next(64) == 200 && v.find_next(200) == 299);
+  assert(v.find_next(299) == 300);
+
+  ft_bits ones(130, true);
+  assert(ones.find_first_unset() == 130);
+  ones[128] = false;
+  assert(ones.find_first_unset() == 128 && ones.find_next_unset(128) == 130);
+
+  ft_bits a(100);
+  ft_bits b(100);
+  for (int i = 0; i < 100; ++i) {
+    a[i] = i % 2 == 0;
+    b[i] = i % 3 == 0;
+  }
+  ft_bits both(a);
+  both &= b;
+  assert(both.count() == 17 && both[6] && !both[3]);
+  ft_bits either(a);
+  either |= b;
+  assert(either.count() == 50 + 34 - 17);
+  ft_bits one(a);
+  one ^= b;
+  assert(one.count() == 50 + 34 - 2 * 17);
+  ft_bits only(a);
+  only.and_not(b);
+  assert(only.count() == 50 - 17 && only[2] && !only[6]);
+
+  ft_bits shorter(99);
+  try {
+    a &= shorter;
+    assert(false);
+  } catch (const std::invalid_argument& e) {
+  }
+}
+
+void test_vector_bool(void) {
+  std::cout << "Test: vector_bool" << std::endl;
+  test_vector_bool_basic();
+  test_vector_bool_modifiers();
+  test_vector_bool_kernels();
+}
@@ -0,0 +1,184 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/18
+ * @file src/views.bench.cpp
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+
+#include "bench.hpp"
+#include "vector.hpp"
+#include "views.hpp"
+
+static std::size_t g_views_bench_allocations = 0;
+
+/**
+ * @brief Stateless std::allocator that counts allocate calls made by the
+ * eager pipelines.
+ */
+template < class T >
+class views_counting_allocator : public std::allocator< T > {
+ public:
+  typedef typename std::allocator< T >::pointer pointer;
+  typedef typename std::allocator< T >::size_type size_type;
+
+  template < class U >
+  struct rebind {
+    typedef views_counting_allocator< U > other;
+  };
+
+  views_counting_allocator() {}
+  views_counting_allocator(const views_counting_allocator& other)
+      : std::allocator< T >(other) {}
+  template < class U >
+  views_counting_allocator(const views_counting_allocator< U >& other)
+      : std::allocator< T >(other) {}
+
+  pointer allocate(size_type n, const void* hint = 0) {
+    ++g_views_bench_allocations;
+    return std::allocator< T >::allocate(n, hint);
+  }
+};
+
+namespace {
+
+typedef ft::vector< int, views_counting_allocator< int > > counted_vector;
+
+const std::size_t g_items = 1 << 22;
+const int g_rounds = 8;
+
+int views_bench_scale(int x) { return x * 7 + 3; }
+
+bool views_bench_keep(int x) { return (x & 3) != 0; }
+
+/**
+ * @brief transform, filter, take, sum: one stage and one vector at a time
+ */
+long long views_bench_eager(const counted_vector& source) {
+  counted_vector scaled;
+  for (std::size_t i = 0; i < source.size(); ++i) {
+    scaled.push_back(views_bench_scale(source[i]));
+  }
+  counted_vector kept;
+  for (std::size_t i = 0; i < scaled.size(); ++i) {
+    if (views_bench_keep(scaled[i])) kept.push_back(scaled[i]);
+  }
+  counted_vector head;
+  for (std::size_t i = 0; i < kept.size() && i < g_items / 2; ++i) {
+    head.push_back(kept[i]);
+  }
+  long long sum = 0;
+  for (std::size_t i = 0; i < head.size(); ++i) sum += head[i];
+  return sum;
+}
+
+/**
+ * @brief The same pipeline fused into one pass by views
+ */
+long long views_bench_lazy(const counted_vector& source) {
+  typedef ft::transform_iterator< counted_vector::const_iterator,
+                                  int (*)(int) >
+      scaled;
+  typedef ft::filter_iterator< scaled, bool (*)(int) > kept;
+  ft::iterator_range< kept > head = ft::views::take(
+      ft::views::filter(ft::views::transform(source, views_bench_scale),
+                        views_bench_keep),
+      g_items / 2);
+  long long sum = 0;
+  for (kept it = head.begin(); it != head.end(); ++it) sum += *it;
+  return sum;
+}
+
+/**
+ * @brief Weighted sum of every 4th element: a strided copy, then a loop
+ */
+long long views_bench_eager_stride(const counted_vector& source,
+                                   const counted_vector& weights) {
+  counted_vector strided;
+  for (std::size_t i = 0; i < source.size(); i += 4) {
+    strided.push_back(source[i]);
+  }
+  long long sum = 0;
+  for (std::size_t i = 0; i < strided.size() && i < weights.size(); ++i) {
+    sum += static_cast< long long >(strided[i]) * weights[i];
+  }
+  return sum;
+}
+
+long long views_bench_lazy_stride(const counted_vector& source,
+                                  const counted_vector& weights) {
+  typedef ft::zip_iterator<
+      ft::stride_iterator< counted_vector::const_iterator >,
+      counted_vector::const_iterator >
+      zipped;
+  ft::iterator_range< zipped > pairs =
+      ft::views::zip(ft::views::stride(source, 4), weights);
+  long long sum = 0;
+  for (zipped it = pairs.begin(); it != pairs.end(); ++it) {
+    sum += static_cast< long long >((*it).first) * (*it).second;
+  }
+  return sum;
+}
+
+template < class Pipeline >
+long long views_bench_run(const char* label, Pipeline pipeline,
+                          const counted_vector& source) {
+  long long sum = 0;
+  g_views_bench_allocations = 0;
+  double start = bench_now();
+  for (int round = 0; round < g_rounds; ++round) sum += pipeline(source);
+  bench_report(label, bench_now() - start, g_items * g_rounds);
+  std::cout << "\t   allocations per run: "
+            << g_views_bench_allocations / g_rounds << std::endl;
+  return sum;
+}
+
+template < class Pipeline >
+long long views_bench_run(const char* label, Pipeline pipeline,
+                          const counted_vector& source,
+                          const counted_vector& weights) {
+  long long sum = 0;
+  g_views_bench_allocations = 0;
+  double start = bench_now();
+  for (int round = 0; round < g_rounds; ++round) {
+    sum += pipeline(source, weights);
+  }
+  bench_report(label, bench_now() - start, g_items * g_rounds);
+  std::cout << "\t   allocations per run: "
+            << g_views_bench_allocations / g_rounds << std::endl;
+  return sum;
+}
+
+}  // namespace
+
+void bench_views(void) {
+  std::cout << "Bench: views" << std::endl;
+
+  counted_vector source;
+  counted_vector weights;
+  std::srand(42);
+  for (std::size_t i = 0; i < g_items; ++i) source.push_back(std::rand());
+  for (std::size_t i = 0; i < g_items / 4; ++i) {
+    weights.push_back(std::rand() % 16);
+  }
+
+  long long sum = 0;
+  sum += views_bench_run("eager transform/filter/take", views_bench_eager,
+                         source);
+  sum += views_bench_run("views transform/filter/take", views_bench_lazy,
+                         source);
+  sum += views_bench_run("eager stride + zip", views_bench_eager_stride,
+                         source, weights);
+  sum += views_bench_run("views stride + zip", views_bench_lazy_stride,
+                         source, weights);
+  bench_sink(static_cast< std::size_t >(sum));
+}
@@ -0,0 +1,986 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/18
+ * @file src/views.hpp
+ */
+
+#if !defined(FT__VIEWS_HPP)
+#define FT__VIEWS_HPP
+
+#include <cstddef>
+#include <iterator>
+
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+
+namespace ft {
+
+template < int N >
+struct _category_rank_size {
+  char size[N];
+};
+
+/* declared only: ranks a category tag, ft or std, by overload resolution */
+_category_rank_size< 1 > _category_rank(ft::input_iterator_tag);
+_category_rank_size< 2 > _category_rank(ft::forward_iterator_tag);
+_category_rank_size< 3 > _category_rank(ft::bidirectional_iterator_tag);
+_category_rank_size< 4 > _category_rank(ft::random_access_iterator_tag);
+_category_rank_size< 1 > _category_rank(std::input_iterator_tag);
+_category_rank_size< 2 > _category_rank(std::forward_iterator_tag);
+_category_rank_size< 3 > _category_rank(std::bidirectional_iterator_tag);
+_category_rank_size< 4 > _category_rank(std::random_access_iterator_tag);
+
+template < int Rank >
+struct _category_of_rank;
+template <>
+struct _category_of_rank< 1 > {
+  typedef ft::input_iterator_tag type;
+};
+template <>
+struct _category_of_rank< 2 > {
+  typedef ft::forward_iterator_tag type;
+};
+template <>
+struct _category_of_rank< 3 > {
+  typedef ft::bidirectional_iterator_tag type;
+};
+template <>
+struct _category_of_rank< 4 > {
+  typedef ft::random_access_iterator_tag type;
+};
+
+/**
+ * @brief The weaker of two iterator categories, as an ft tag. With the
+ * default Limit it turns a std tag into the matching ft tag.
+ */
+template < class Category, class Limit = ft::random_access_iterator_tag >
+struct weaker_iterator_category {
+  static const int _rank = sizeof(_category_rank(Category()));
+  static const int _limit = sizeof(_category_rank(Limit()));
+  typedef typename _category_of_rank< (_rank < _limit ? _rank : _limit) >::type
+      type;
+};
+
+/**
+ * @brief Type returned by a unary function object: its result_type, or the
+ * return type of a function pointer.
+ */
+template < class Function >
+struct function_result {
+  typedef typename Function::result_type type;
+};
+
+template < class R, class A >
+struct function_result< R (*)(A) > {
+  typedef R type;
+};
+
+/**
+ * @brief operator-> of an underlying iterator, pointer or class.
+ */
+template < class T >
+T* _view_arrow(T* p) {
+  return p;
+}
+
+template < class Iterator >
+typename Iterator::pointer _view_arrow(const Iterator& it) {
+  return it.operator->();
+}
+
+/**
+ * @brief Advance it by up to n steps without passing bound.
+ *
+ * @return the steps that were left when bound was reached
+ */
+template < class Iterator, class Distance >
+Distance _view_advance(Iterator& it, Distance n, const Iterator& bound,
+                       ft::input_iterator_tag) {
+  for (; n > 0 && it != bound; --n) ++it;
+  return n;
+}
+
+template < class Iterator, class Distance >
+Distance _view_advance(Iterator& it, Distance n, const Iterator& bound,
+                       ft::random_access_iterator_tag) {
+  Distance left = bound - it;
+  if (n > left) {
+    it = bound;
+    return n - left;
+  }
+  it += n;
+  return 0;
+}
+
+template < class Iterator, class Distance >
+Distance _view_advance(Iterator& it, Distance n, const Iterator& bound) {
+  return ft::_view_advance(
+      it, n, bound,
+      typename weaker_iterator_category< typename iterator_traits<
+          Iterator >::iterator_category >::type());
+}
+
+/**
+ * @brief Number of elements in [first, last) where the view needs it to step
+ * back from its end: bidirectional iterators and up. 0 below that.
+ */
+template < class Iterator >
+typename iterator_traits< Iterator >::difference_type _view_size(
+    Iterator, Iterator, ft::input_iterator_tag) {
+  return 0;
+}
+
+template < class Iterator >
+typename iterator_traits< Iterator >::difference_type _view_size(
+    Iterator first, Iterator last, ft::bidirectional_iterator_tag) {
+  return ft::distance(first, last);
+}
+
+template < class Iterator >
+typename iterator_traits< Iterator >::difference_type _view_size(
+    Iterator first, Iterator last) {
+  return ft::_view_size(
+      first, last,
+      typename weaker_iterator_category< typename iterator_traits<
+          Iterator >::iterator_category >::type());
+}
+
+/**
+ * @brief Pair returned by enumerate and zip iterators. Unlike pair, first and
+ * second may be references into the viewed ranges. Converts to any pair whose
+ * members are constructible from them.
+ */
+template < class T1, class T2 >
+struct view_pair {
+  typedef T1 first_type;
+  typedef T2 second_type;
+
+  first_type first;
+  second_type second;
+
+  view_pair(first_type a, second_type b) : first(a), second(b){};
+
+  template < class U, class V >
+  operator pair< U, V >() const {
+    return pair< U, V >(first, second);
+  }
+
+ private:
+  view_pair& operator=(const view_pair&);
+};
+
+/**
+ * @brief A [first, last) pair usable wherever a container is read from.
+ * Every view is one, so views compose.
+ */
+template < class Iterator >
+class iterator_range {
+ public:
+  typedef Iterator iterator;
+  typedef Iterator const_iterator;
+  typedef typename iterator_traits< Iterator >::value_type value_type;
+  typedef typename iterator_traits< Iterator >::reference reference;
+  typedef typename iterator_traits< Iterator >::difference_type
+      difference_type;
+  typedef std::size_t size_type;
+
+ protected:
+  Iterator _first;
+  Iterator _last;
+
+ public:
+  iterator_range() : _first(), _last(){};
+  iterator_range(Iterator first, Iterator last) : _first(first), _last(last){};
+
+  iterator begin() const { return this->_first; };
+  iterator end() const { return this->_last; };
+  bool empty() const { return this->_first == this->_last; };
+
+  /**
+   * @brief Number of elements: constant time for random access ranges,
+   * a walk otherwise.
+   */
+  size_type size() const { return ft::distance(this->_first, this->_last); };
+
+  reference front() const { return *this->_first; };
+  reference operator[](difference_type n) const { return this->_first[n]; };
+};
+
+template < class Iterator >
+iterator_range< Iterator > make_range(Iterator first, Iterator last) {
+  return iterator_range< Iterator >(first, last);
+}
+
+/**
+ * @brief Applies a function to each element on dereference. Keeps the
+ * category of the underlying iterator.
+ *
+ * @tparam Iterator Underlying iterator.
+ * @tparam Function Unary function object with result_type, or function
+ * pointer.
+ */
+template < class Iterator, class Function >
+class transform_iterator {
+ public:
+  typedef Iterator iterator_type;
+  /* Preserves Iterator's category */
+  typedef typename weaker_iterator_category< typename iterator_traits<
+      Iterator >::iterator_category >::type iterator_category;
+  /* whatever Function returns, often a value */
+  typedef typename function_result< Function >::type reference;
+  typedef typename remove_const<
+      typename remove_reference< reference >::type >::type value_type;
+  typedef typename iterator_traits< Iterator >::difference_type
+      difference_type;
+  typedef ft::arrow_proxy< reference > pointer;
+
+ protected:
+  Iterator _current;
+  Function _func;
+
+ public:
+  transform_iterator() : _current(), _func(){};
+  transform_iterator(Iterator it, Function func)
+      : _current(it), _func(func){};
+
+  reference operator*() const { return this->_func(*this->_current); };
+  pointer operator->() const { return pointer(**this); };
+
+  transform_iterator& operator++() {
+    ++this->_current;
+    return *this;
+  };
+
+  transform_iterator operator++(int) {
+    transform_iterator tmp = *this;
+    ++this->_current;
+    return tmp;
+  };
+
+  transform_iterator& operator--() {
+    --this->_current;
+    return *this;
+  };
+
+  transform_iterator operator--(int) {
+    transform_iterator tmp = *this;
+    --this->_current;
+    return tmp;
+  };
+
+  transform_iterator operator+(difference_type n) const {
+    return transform_iterator(this->_current + n, this->_func);
+  };
+
+  transform_iterator& operator+=(difference_type n) {
+    this->_current += n;
+    return *this;
+  };
+
+  transform_iterator operator-(difference_type n) const {
+    return transform_iterator(this->_current - n, this->_func);
+  };
+
+  transform_iterator& operator-=(difference_type n) {
+    this->_current -= n;
+    return *this;
+  };
+
+  reference operator[](difference_type n) const {
+    return this->_func(this->_current[n]);
+  };
+
+  /**
+   * @brief get the underlying iterator, used for comparisons
+   */
+  const Iterator& base() const { return this->_current; };
+};
+
+template < class I, class F >
+bool operator==(const transform_iterator< I, F >& lhs,
+                const transform_iterator< I, F >& rhs) {
+  return lhs.base() == rhs.base();
+};
+
+template < class I, class F >
+bool operator!=(const transform_iterator< I, F >& lhs,
+                const transform_iterator< I, F >& rhs) {
+  return lhs.base() != rhs.base();
+};
+
+template < class I, class F >
+bool operator<(const transform_iterator< I, F >& lhs,
+               const transform_iterator< I, F >& rhs) {
+  return lhs.base() < rhs.base();
+};
+
+template < class I, class F >
+bool operator<=(const transform_iterator< I, F >& lhs,
+                const transform_iterator< I, F >& rhs) {
+  return lhs.base() <= rhs.base();
+};
+
+template < class I, class F >
+bool operator>(const transform_iterator< I, F >& lhs,
+               const transform_iterator< I, F >& rhs) {
+  return lhs.base() > rhs.base();
+};
+
+template < class I, class F >
+bool operator>=(const transform_iterator< I, F >& lhs,
+                const transform_iterator< I, F >& rhs) {
+  return lhs.base() >= rhs.base();
+};
+
+template < class I, class F >
+transform_iterator< I, F > operator+(
+    typename transform_iterator< I, F >::difference_type n,
+    const transform_iterator< I, F >& iter) {
+  return iter + n;
+};
+
+template < class I, class F >
+typename transform_iterator< I, F >::difference_type operator-(
+    const transform_iterator< I, F >& lhs,
+    const transform_iterator< I, F >& rhs) {
+  return lhs.base() - rhs.base();
+};
+
+/**
+ * @brief Skips the elements a predicate rejects. At most bidirectional:
+ * positions of kept elements are not known without walking.
+ *
+ * @tparam Iterator Underlying iterator.
+ * @tparam Predicate Unary predicate on the elements.
+ */
+template < class Iterator, class Predicate >
+class filter_iterator {
+ public:
+  typedef Iterator iterator_type;
+  typedef typename weaker_iterator_category<
+      typename iterator_traits< Iterator >::iterator_category,
+      ft::bidirectional_iterator_tag >::type iterator_category;
+  typedef typename iterator_traits< Iterator >::value_type value_type;
+  typedef typename iterator_traits< Iterator >::difference_type
+      difference_type;
+  typedef typename iterator_traits< Iterator >::pointer pointer;
+  typedef typename iterator_traits< Iterator >::reference reference;
+
+ protected:
+  Iterator _current;
+  Iterator _last;
+  Predicate _pred;
+
+ public:
+  filter_iterator() : _current(), _last(), _pred(){};
+
+  /**
+   * @brief An iterator on the first element of [it, last) that pred keeps.
+   */
+  filter_iterator(Iterator it, Iterator last, Predicate pred)
+      : _current(it), _last(last), _pred(pred) {
+    this->_satisfy();
+  };
+
+  reference operator*() const { return *this->_current; };
+  pointer operator->() const { return ft::_view_arrow(this->_current); };
+
+  filter_iterator& operator++() {
+    ++this->_current;
+    this->_satisfy();
+    return *this;
+  };
+
+  filter_iterator operator++(int) {
+    filter_iterator tmp = *this;
+    ++(*this);
+    return tmp;
+  };
+
+  filter_iterator& operator--() {
+    do {
+      --this->_current;
+    } while (!this->_pred(*this->_current));
+    return *this;
+  };
+
+  filter_iterator operator--(int) {
+    filter_iterator tmp = *this;
+    --(*this);
+    return tmp;
+  };
+
+  /**
+   * @brief get the underlying iterator, used for comparisons
+   */
+  const Iterator& base() const { return this->_current; };
+
+ private:
+  void _satisfy() {
+    while (this->_current != this->_last && !this->_pred(*this->_current)) {
+      ++this->_current;
+    }
+  };
+};
+
+template < class I, class P >
+bool operator==(const filter_iterator< I, P >& lhs,
+                const filter_iterator< I, P >& rhs) {
+  return lhs.base() == rhs.base();
+};
+
+template < class I, class P >
+bool operator!=(const filter_iterator< I, P >& lhs,
+                const filter_iterator< I, P >& rhs) {
+  return lhs.base() != rhs.base();
+};
+
+/**
+ * @brief Visits every step-th element of [first, last). Keeps the category
+ * of the underlying iterator; never steps past last.
+ */
+template < class Iterator >
+class stride_iterator {
+ public:
+  typedef Iterator iterator_type;
+  /* Preserves Iterator's category */
+  typedef typename weaker_iterator_category< typename iterator_traits<
+      Iterator >::iterator_category >::type iterator_category;
+  typedef typename iterator_traits< Iterator >::value_type value_type;
+  typedef typename iterator_traits< Iterator >::difference_type
+      difference_type;
+  typedef typename iterator_traits< Iterator >::pointer pointer;
+  typedef typename iterator_traits< Iterator >::reference reference;
+
+ protected:
+  Iterator _current;
+  Iterator _last;
+  difference_type _step;
+  /* steps cut short by last, undone when stepping back */
+  difference_type _missing;
+
+ public:
+  stride_iterator() : _current(), _last(), _step(1), _missing(0){};
+  stride_iterator(Iterator it, Iterator last, difference_type step,
+                  difference_type missing = 0)
+      : _current(it), _last(last), _step(step), _missing(missing){};
+
+  reference operator*() const { return *this->_current; };
+  pointer operator->() const { return ft::_view_arrow(this->_current); };
+
+  stride_iterator& operator++() {
+    this->_missing =
+        ft::_view_advance(this->_current, this->_step, this->_last);
+    return *this;
+  };
+
+  stride_iterator operator++(int) {
+    stride_iterator tmp = *this;
+    ++(*this);
+    return tmp;
+  };
+
+  stride_iterator& operator--() {
+    ft::advance(this->_current, this->_missing - this->_step);
+    this->_missing = 0;
+    return *this;
+  };
+
+  stride_iterator operator--(int) {
+    stride_iterator tmp = *this;
+    --(*this);
+    return tmp;
+  };
+
+  stride_iterator& operator+=(difference_type n) {
+    if (n > 0) {
+      this->_missing =
+          ft::_view_advance(this->_current, n * this->_step, this->_last);
+    } else if (n < 0) {
+      this->_current += n * this->_step + this->_missing;
+      this->_missing = 0;
+    }
+    return *this;
+  };
+
+  stride_iterator operator+(difference_type n) const {
+    stride_iterator tmp = *this;
+    return tmp += n;
+  };
+
+  stride_iterator& operator-=(difference_type n) { return *this += -n; };
+
+  stride_iterator operator-(difference_type n) const {
+    stride_iterator tmp = *this;
+    return tmp += -n;
+  };
+
+  reference operator[](difference_type n) const { return *(*this + n); };
+
+  /**
+   * @brief get the underlying iterator, used for comparisons
+   */
+  const Iterator& base() const { return this->_current; };
+
+  difference_type step() const { return this->_step; };
+  difference_type missing() const { return this->_missing; };
+};
+
+template < class I >
+bool operator==(const stride_iterator< I >& lhs,
+                const stride_iterator< I >& rhs) {
+  return lhs.base() == rhs.base();
+};
+
+template < class I >
+bool operator!=(const stride_iterator< I >& lhs,
+                const stride_iterator< I >& rhs) {
+  return lhs.base() != rhs.base();
+};
+
+template < class I >
+bool operator<(const stride_iterator< I >& lhs,
+               const stride_iterator< I >& rhs) {
+  return lhs.base() < rhs.base();
+};
+
+template < class I >
+bool operator<=(const stride_iterator< I >& lhs,
+                const stride_iterator< I >& rhs) {
+  return lhs.base() <= rhs.base();
+};
+
+template < class I >
+bool operator>(const stride_iterator< I >& lhs,
+               const stride_iterator< I >& rhs) {
+  return lhs.base() > rhs.base();
+};
+
+template < class I >
+bool operator>=(const stride_iterator< I >& lhs,
+                const stride_iterator< I >& rhs) {
+  return lhs.base() >= rhs.base();
+};
+
+template < class I >
+stride_iterator< I > operator+(
+    typename stride_iterator< I >::difference_type n,
+    const stride_iterator< I >& iter) {
+  return iter + n;
+};
+
+template < class I >
+typename stride_iterator< I >::difference_type operator-(
+    const stride_iterator< I >& lhs, const stride_iterator< I >& rhs) {
+  return (lhs.base() - rhs.base() + lhs.missing() - rhs.missing()) /
+         lhs.step();
+};
+
+/**
+ * @brief Pairs each element with its index: dereferences to
+ * view_pair< difference_type, reference >. Keeps the category of the underlying
+ * iterator.
+ */
+template < class Iterator >
+class enumerate_iterator {
+ public:
+  typedef Iterator iterator_type;
+  /* Preserves Iterator's category */
+  typedef typename weaker_iterator_category< typename iterator_traits<
+      Iterator >::iterator_category >::type iterator_category;
+  typedef typename iterator_traits< Iterator >::difference_type
+      difference_type;
+  typedef ft::pair< difference_type,
+                    typename iterator_traits< Iterator >::value_type >
+      value_type;
+  typedef ft::view_pair< difference_type,
+                         typename iterator_traits< Iterator >::reference >
+      reference;
+  typedef ft::arrow_proxy< reference > pointer;
+
+ protected:
+  Iterator _current;
+  difference_type _index;
+
+ public:
+  enumerate_iterator() : _current(), _index(0){};
+  enumerate_iterator(Iterator it, difference_type index)
+      : _current(it), _index(index){};
+
+  reference operator*() const {
+    return reference(this->_index, *this->_current);
+  };
+  pointer operator->() const { return pointer(**this); };
+
+  enumerate_iterator& operator++() {
+    ++this->_current;
+    ++this->_index;
+    return *this;
+  };
+
+  enumerate_iterator operator++(int) {
+    enumerate_iterator tmp = *this;
+    ++(*this);
+    return tmp;
+  };
+
+  enumerate_iterator& operator--() {
+    --this->_current;
+    --this->_index;
+    return *this;
+  };
+
+  enumerate_iterator operator--(int) {
+    enumerate_iterator tmp = *this;
+    --(*this);
+    return tmp;
+  };
+
+  enumerate_iterator operator+(difference_type n) const {
+    return enumerate_iterator(this->_current + n, this->_index + n);
+  };
+
+  enumerate_iterator& operator+=(difference_type n) {
+    this->_current += n;
+    this->_index += n;
+    return *this;
+  };
+
+  enumerate_iterator operator-(difference_type n) const {
+    return enumerate_iterator(this->_current - n, this->_index - n);
+  };
+
+  enumerate_iterator& operator-=(difference_type n) { return *this += -n; };
+
+  reference operator[](difference_type n) const {
+    return reference(this->_index + n, this->_current[n]);
+  };
+
+  /**
+   * @brief get the underlying iterator, used for comparisons
+   */
+  const Iterator& base() const { return this->_current; };
+
+  difference_type index() const { return this->_index; };
+};
+
+template < class I >
+bool operator==(const enumerate_iterator< I >& lhs,
+                const enumerate_iterator< I >& rhs) {
+  return lhs.base() == rhs.base();
+};
+
+template < class I >
+bool operator!=(const enumerate_iterator< I >& lhs,
+                const enumerate_iterator< I >& rhs) {
+  return lhs.base() != rhs.base();
+};
+
+template < class I >
+bool operator<(const enumerate_iterator< I >& lhs,
+               const enumerate_iterator< I >& rhs) {
+  return lhs.base() < rhs.base();
+};
+
+template < class I >
+bool operator<=(const enumerate_iterator< I >& lhs,
+                const enumerate_iterator< I >& rhs) {
+  return lhs.base() <= rhs.base();
+};
+
+template < class I >
+bool operator>(const enumerate_iterator< I >& lhs,
+               const enumerate_iterator< I >& rhs) {
+  return lhs.base() > rhs.base();
+};
+
+template < class I >
+bool operator>=(const enumerate_iterator< I >& lhs,
+                const enumerate_iterator< I >& rhs) {
+  return lhs.base() >= rhs.base();
+};
+
+template < class I >
+enumerate_iterator< I > operator+(
+    typename enumerate_iterator< I >::difference_type n,
+    const enumerate_iterator< I >& iter) {
+  return iter + n;
+};
+
+template < class I >
+typename enumerate_iterator< I >::difference_type operator-(
+    const enumerate_iterator< I >& lhs, const enumerate_iterator< I >& rhs) {
+  return lhs.base() - rhs.base();
+};
+
+/**
+ * @brief Walks two ranges in lock step: dereferences to
+ * view_pair< reference1, reference2 >. Has the weaker of the two categories and
+ * stops at the end of the shorter range.
+ */
+template < class Iterator1, class Iterator2 >
+class zip_iterator {
+ public:
+  typedef typename weaker_iterator_category<
+      typename iterator_traits< Iterator1 >::iterator_category,
+      typename iterator_traits< Iterator2 >::iterator_category >::type
+      iterator_category;
+  typedef typename iterator_traits< Iterator1 >::difference_type
+      difference_type;
+  typedef ft::pair< typename iterator_traits< Iterator1 >::value_type,
+                    typename iterator_traits< Iterator2 >::value_type >
+      value_type;
+  typedef ft::view_pair< typename iterator_traits< Iterator1 >::reference,
+                         typename iterator_traits< Iterator2 >::reference >
+      reference;
+  typedef ft::arrow_proxy< reference > pointer;
+
+ protected:
+  Iterator1 _first;
+  Iterator2 _second;
+
+ public:
+  zip_iterator() : _first(), _second(){};
+  zip_iterator(Iterator1 first, Iterator2 second)
+      : _first(first), _second(second){};
+
+  reference operator*() const {
+    return reference(*this->_first, *this->_second);
+  };
+  pointer operator->() const { return pointer(**this); };
+
+  zip_iterator& operator++() {
+    ++this->_first;
+    ++this->_second;
+    return *this;
+  };
+
+  zip_iterator operator++(int) {
+    zip_iterator tmp = *this;
+    ++(*this);
+    return tmp;
+  };
+
+  zip_iterator& operator--() {
+    --this->_first;
+    --this->_second;
+    return *this;
+  };
+
+  zip_iterator operator--(int) {
+    zip_iterator tmp = *this;
+    --(*this);
+    return tmp;
+  };
+
+  zip_iterator operator+(difference_type n) const {
+    return zip_iterator(this->_first + n, this->_second + n);
+  };
+
+  zip_iterator& operator+=(difference_type n) {
+    this->_first += n;
+    this->_second += n;
+    return *this;
+  };
+
+  zip_iterator operator-(difference_type n) const {
+    return zip_iterator(this->_first - n, this->_second - n);
+  };
+
+  zip_iterator& operator-=(difference_type n) { return *this += -n; };
+
+  reference operator[](difference_type n) const {
+    return reference(this->_first[n], this->_second[n]);
+  };
+
+  /**
+   * @brief get the first underlying iterator, used for comparisons
+   */
+  const Iterator1& base() const { return this->_first; };
+  const Iterator2& second_base() const { return this->_second; };
+};
+
+/**
+ * @brief Equal when either side is: the end of the shorter range ends the
+ * zip.
+ */
+template < class I1, class I2 >
+bool operator==(const zip_iterator< I1, I2 >& lhs,
+                const zip_iterator< I1, I2 >& rhs) {
+  return lhs.base() == rhs.base() || lhs.second_base() == rhs.second_base();
+};
+
+template < class I1, class I2 >
+bool operator!=(const zip_iterator< I1, I2 >& lhs,
+                const zip_iterator< I1, I2 >& rhs) {
+  return !(lhs == rhs);
+};
+
+template < class I1, class I2 >
+bool operator<(const zip_iterator< I1, I2 >& lhs,
+               const zip_iterator< I1, I2 >& rhs) {
+  return lhs.base() < rhs.base();
+};
+
+template < class I1, class I2 >
+bool operator<=(const zip_iterator< I1, I2 >& lhs,
+                const zip_iterator< I1, I2 >& rhs) {
+  return lhs.base() <= rhs.base();
+};
+
+template < class I1, class I2 >
+bool operator>(const zip_iterator< I1, I2 >& lhs,
+               const zip_iterator< I1, I2 >& rhs) {
+  return lhs.base() > rhs.base();
+};
+
+template < class I1, class I2 >
+bool operator>=(const zip_iterator< I1, I2 >& lhs,
+                const zip_iterator< I1, I2 >& rhs) {
+  return lhs.base() >= rhs.base();
+};
+
+template < class I1, class I2 >
+zip_iterator< I1, I2 > operator+(
+    typename zip_iterator< I1, I2 >::difference_type n,
+    const zip_iterator< I1, I2 >& iter) {
+  return iter + n;
+};
+
+template < class I1, class I2 >
+typename zip_iterator< I1, I2 >::difference_type operator-(
+    const zip_iterator< I1, I2 >& lhs, const zip_iterator< I1, I2 >& rhs) {
+  return lhs.base() - rhs.base();
+};
+
+/**
+ * @brief Cut both ends back to the shorter length, so a bidirectional or
+ * random access zip can step back from its end. Forward zips stop through
+ * operator== instead.
+ */
+template < class Iterator1, class Iterator2 >
+void _zip_trim(Iterator1, Iterator1&, Iterator2, Iterator2&,
+               ft::input_iterator_tag){};
+
+template < class Iterator1, class Iterator2 >
+void _zip_trim(Iterator1 first1, Iterator1& last1, Iterator2 first2,
+               Iterator2& last2, ft::bidirectional_iterator_tag) {
+  typename iterator_traits< Iterator1 >::difference_type n1 =
+      ft::distance(first1, last1);
+  typename iterator_traits< Iterator2 >::difference_type n2 =
+      ft::distance(first2, last2);
+  if (n1 < n2) {
+    last2 = first2;
+    ft::advance(last2, n1);
+  } else {
+    last1 = first1;
+    ft::advance(last1, n2);
+  }
+};
+
+/**
+ * @brief Lazy views over a range: anything with begin() / end() and a
+ * const_iterator, including a container or another view. Each returns an
+ * iterator_range of adapted iterators; nothing is copied or allocated and
+ * elements are visited once, when the result is iterated. The viewed range
+ * must outlive the view.
+ */
+namespace views {
+
+template < class Range, class Function >
+ft::iterator_range<
+    ft::transform_iterator< typename Range::const_iterator, Function > >
+transform(const Range& range, Function func) {
+  typedef ft::transform_iterator< typename Range::const_iterator, Function >
+      iterator;
+  return ft::iterator_range< iterator >(iterator(range.begin(), func),
+                                        iterator(range.end(), func));
+}
+
+template < class Range, class Predicate >
+ft::iterator_range<
+    ft::filter_iterator< typename Range::const_iterator, Predicate > >
+filter(const Range& range, Predicate pred) {
+  typedef ft::filter_iterator< typename Range::const_iterator, Predicate >
+      iterator;
+  return ft::iterator_range< iterator >(
+      iterator(range.begin(), range.end(), pred),
+      iterator(range.end(), range.end(), pred));
+}
+
+/**
+ * @brief The first n elements, or all of them. Same iterator type as the
+ * range; finding the end walks up to n steps below random access.
+ */
+template < class Range >
+ft::iterator_range< typename Range::const_iterator > take(
+    const Range& range, typename Range::difference_type n) {
+  typename Range::const_iterator last = range.begin();
+  ft::_view_advance(last, n, range.end());
+  return ft::iterator_range< typename Range::const_iterator >(range.begin(),
+                                                              last);
+}
+
+/**
+ * @brief All but the first n elements.
+ */
+template < class Range >
+ft::iterator_range< typename Range::const_iterator > drop(
+    const Range& range, typename Range::difference_type n) {
+  typename Range::const_iterator first = range.begin();
+  ft::_view_advance(first, n, range.end());
+  return ft::iterator_range< typename Range::const_iterator >(first,
+                                                              range.end());
+}
+
+/**
+ * @brief Elements 0, step, 2 * step, ... ; step > 0.
+ */
+template < class Range >
+ft::iterator_range< ft::stride_iterator< typename Range::const_iterator > >
+stride(const Range& range, typename Range::difference_type step) {
+  typedef ft::stride_iterator< typename Range::const_iterator > iterator;
+  typename Range::difference_type size =
+      ft::_view_size(range.begin(), range.end());
+  return ft::iterator_range< iterator >(
+      iterator(range.begin(), range.end(), step),
+      iterator(range.end(), range.end(), step, (step - size % step) % step));
+}
+
+template < class Range >
+ft::iterator_range< ft::enumerate_iterator< typename Range::const_iterator > >
+enumerate(const Range& range) {
+  typedef ft::enumerate_iterator< typename Range::const_iterator > iterator;
+  return ft::iterator_range< iterator >(
+      iterator(range.begin(), 0),
+      iterator(range.end(), ft::_view_size(range.begin(), range.end())));
+}
+
+template < class Range1, class Range2 >
+ft::iterator_range< ft::zip_iterator< typename Range1::const_iterator,
+                                      typename Range2::const_iterator > >
+zip(const Range1& range1, const Range2& range2) {
+  typedef ft::zip_iterator< typename Range1::const_iterator,
+                            typename Range2::const_iterator >
+      iterator;
+  typename Range1::const_iterator last1 = range1.end();
+  typename Range2::const_iterator last2 = range2.end();
+  ft::_zip_trim(range1.begin(), last1, range2.begin(), last2,
+                typename iterator::iterator_category());
+  return ft::iterator_range< iterator >(
+      iterator(range1.begin(), range2.begin()), iterator(last1, last2));
+}
+
+}  // namespace views
+
+}  // namespace ft
+
+#endif  // FT__VIEWS_HPP
@@ -0,0 +1,182 @@
+/**
+ *         _                            __   _                __
+ *        (_)___ ____  ________  ____  / /__(_)___ ___   ____/ /__ _   __
+ *       / / __ `/ _ \/ ___/ _ \/ __ \/ //_/ / __ `__ \ / __  / _ \ | / /
+ *      / / /_/ /  __(__  )  __/ /_/ / ,< / / / / / / // /_/ /  __/ |/ /
+ *   __/ /\__,_/\___/____/\___/\____/_/|_/_/_/ /_/ /_(_)__,_/\___/|___/
+ *  /___/
+ *
+ * @author JaeSeoKim <devjaeseo@gmail.com>
+ * @date 2021/10/18
+ * @file src/views.test.cpp
+ */
+
+#include "views.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <list>
+#include <string>
+
+#include "vector.hpp"
+
+namespace {
+
+int vw_test_rank(ft::bidirectional_iterator_tag) { return 3; }
+int vw_test_rank(ft::random_access_iterator_tag) { return 4; }
+
+template < class Range >
+int vw_test_category(const Range&) {
+  return vw_test_rank(typename ft::iterator_traits<
+                      typename Range::iterator >::iterator_category());
+}
+
+int vw_test_square(int x) { return x * x; }
+
+bool vw_test_odd(int x) { return x % 2 != 0; }
+
+struct vw_test_length {
+  typedef std::size_t result_type;
+
+  std::size_t operator()(const std::string& s) const { return s.size(); }
+};
+
+}  // namespace
+
+void test_views_categories(void) {
+  std::cout << "\t categories" << std::endl;
+
+  ft::vector< int > v;
+  std::list< int > l;
+  // random access stays random access through transform, stride, zip
+  assert(vw_test_category(ft::views::transform(v, vw_test_square)) == 4);
+  assert(vw_test_category(ft::views::stride(v, 3)) == 4);
+  assert(vw_test_category(ft::views::enumerate(v)) == 4);
+  assert(vw_test_category(ft::views::take(v, 3)) == 4);
+  assert(vw_test_category(ft::views::zip(v, v)) == 4);
+  // filter caps at bidirectional, zip takes the weaker side
+  assert(vw_test_category(ft::views::filter(v, vw_test_odd)) == 3);
+  assert(vw_test_category(ft::views::zip(v, l)) == 3);
+  assert(vw_test_category(ft::views::transform(l, vw_test_square)) == 3);
+  assert(vw_test_category(ft::views::transform(
+             ft::views::filter(v, vw_test_odd), vw_test_square)) == 3);
+}
+
+void test_views_views(void) {
+  std::cout << "\t views" << std::endl;
+
+  ft::vector< int > v;
+  for (int i = 0; i < 10; ++i) v.push_back(i);
+
+  ft::iterator_range<
+      ft::transform_iterator< ft::vector< int >::const_iterator,
+                              int (*)(int) > >
+      squares = ft::views::transform(v, vw_test_square);
+  assert(squares.size() == 10 && squares[3] == 9 && squares.front() == 0);
+
+  int odd_squares[] = {1, 9, 25, 49, 81};
+  int i = 0;
+  for (ft::filter_iterator< ft::transform_iterator<
+                                ft::vector< int >::const_iterator,
+                                int (*)(int) >,
+                            bool (*)(int) >
+           it = ft::views::filter(squares, vw_test_odd).begin(),
+           end = ft::views::filter(squares, vw_test_odd).end();
+       it != end; ++it) {
+    assert(*it == odd_squares[i++]);
+  }
+  assert(i == 5);
+
+  assert(ft::views::take(v, 3).size() == 3);
+  assert(ft::views::take(v, 30).size() == 10);
+  assert(ft::views::drop(v, 7).front() == 7 && ft::views::drop(v, 30).empty());
+  assert(ft::views::take(ft::views::drop(v, 2), 3)[2] == 4);
+
+  // 0 3 6 9
+  assert(ft::views::stride(v, 3).size() == 4);
+  assert(ft::views::stride(v, 3)[3] == 9);
+  assert(ft::views::stride(v, 5).size() == 2);
+  assert(ft::views::stride(v, 20).size() == 1);
+
+  std::list< std::string > words;
+  words.push_back("a");
+  words.push_back("bcd");
+  words.push_back("ef");
+  i = 0;
+  std::list< std::string >::const_iterator word = words.begin();
+  for (ft::enumerate_iterator< std::list< std::string >::const_iterator >
+           it = ft::views::enumerate(words).begin();
+       it != ft::views::enumerate(words).end(); ++it, ++i, ++word) {
+    assert((*it).first == i && (*it).second == *word);
+    assert(it->second.size() == word->size());
+  }
+  assert(ft::views::enumerate(v)[4].first == 4);
+
+  // zip stops at the shorter side
+  assert(ft::views::zip(v, words).size() == 3);
+  assert(ft::views::zip(words, v).size() == 3);
+  std::size_t lengths = 0;
+  ft::iterator_range< ft::zip_iterator<
+      ft::vector< int >::const_iterator,
+      ft::transform_iterator< std::list< std::string >::const_iterator,
+                              vw_test_length > > >
+      zipped = ft::views::zip(v, ft::views::transform(words, vw_test_length()));
+  for (ft::zip_iterator<
+           ft::vector< int >::const_iterator,
+           ft::transform_iterator< std::list< std::string >::const_iterator,
+                                   vw_test_length > >
+           it = zipped.begin();
+       it != zipped.end(); ++it) {
+    lengths += (*it).first * (*it).second;
+  }
+  assert(lengths == 0 * 1 + 1 * 3 + 2 * 2);
+  ft::pair< int, std::size_t > last = *--zipped.end();
+  assert(last.first == 2 && last.second == 2);
+}
+
+void test_views_iterators(void) {
+  std::cout << "\t iterators" << std::endl;
+
+  ft::vector< int > v;
+  for (int i = 0; i < 10; ++i) v.push_back(i);
+
+  typedef ft::stride_iterator< ft::vector< int >::const_iterator > strided;
+  ft::iterator_range< strided > s = ft::views::stride(v, 3);
+  strided it = s.end();
+  // stepping back from the end lands on the last element, not last - step
+  assert(*--it == 9 && *--it == 6 && it - s.begin() == 2);
+  assert(s.end() - it == 2 && *(it + 1) == 9 && it + 2 == s.end());
+  assert(*(s.end() - 4) == 0 && s.begin() < it && 1 + s.begin() == it - 1);
+  ft::reverse_iterator< strided > r(s.end());
+  assert(*r == 9 && r[3] == 0);
+
+  std::list< int > l(v.begin().base(), v.end().base());
+  ft::iterator_range< ft::stride_iterator< std::list< int >::const_iterator > >
+      ls = ft::views::stride(l, 4);
+  assert(*--ls.end() == 8 && ls.size() == 3);
+
+  ft::iterator_range< ft::filter_iterator< std::list< int >::const_iterator,
+                                           bool (*)(int) > >
+      odd = ft::views::filter(l, vw_test_odd);
+  ft::filter_iterator< std::list< int >::const_iterator, bool (*)(int) > o =
+      odd.end();
+  assert(*--o == 9 && *--o == 7 && odd.size() == 5);
+
+  ft::enumerate_iterator< std::list< int >::const_iterator > e =
+      ft::views::enumerate(l).end();
+  --e;
+  assert((*e).first == 9 && (*e).second == 9);
+  assert(ft::views::enumerate(v).end() - ft::views::enumerate(v).begin() ==
+         10);
+
+  ft::vector< int > w(4, 1);
+  assert(ft::views::zip(v, w).end() - ft::views::zip(v, w).begin() == 4);
+  assert((*(ft::views::zip(v, w).end() - 1)).first == 3);
+}
+
+void test_views(void) {
+  std::cout << "Test: views" << std::endl;
+  test_views_categories();
+  test_views_views();
+  test_views_iterators();
+}